@@ -0,0 +1,113 @@
+# SPDX-FileCopyrightText: 2026 Tokodon Contributors
+# SPDX-License-Identifier: BSD-2-Clause
+
+# Turns the emoji list written by tools/update-emojis.py into constant tables, so none of it has to be built at runtime.
+#
+# cmake -DINPUT=utils/emojis.txt -DOUTPUT=emojitables.h -P GenerateEmojiTables.cmake
+
+cmake_minimum_required(VERSION 3.16)
+
+# In the order of EmojiModel::Category
+set(categories Smileys People Nature Food Activities Travel Objects Symbols Flags Component)
+
+foreach(category IN LISTS categories)
+    set(emojis_${category} "")
+    set(count_${category} 0)
+endforeach()
+set(tone_bases "")
+
+file(STRINGS "${INPUT}" lines ENCODING UTF-8 REGEX "^[^#]")
+
+foreach(line IN LISTS lines)
+    string(REPLACE "\t" ";" fields "${line}")
+    list(LENGTH fields field_count)
+    if(NOT field_count EQUAL 4)
+        message(FATAL_ERROR "Expected four fields separated by tabs: ${line}")
+    endif()
+    list(GET fields 0 category)
+    list(GET fields 1 codepoints)
+    list(GET fields 2 shortname)
+    list(GET fields 3 description)
+
+    set(unicode "")
+    string(REPLACE " " ";" codepoints "${codepoints}")
+    foreach(codepoint IN LISTS codepoints)
+        string(LENGTH "${codepoint}" length)
+        math(EXPR padding "8 - ${length}")
+        string(REPEAT "0" ${padding} zeros)
+        string(APPEND unicode "\\U${zeros}${codepoint}")
+    endforeach()
+
+    set(escaped_shortname "${shortname}")
+    set(escaped_description "${description}")
+    foreach(variable escaped_shortname escaped_description)
+        string(REPLACE "\\" "\\\\" ${variable} "${${variable}}")
+        string(REPLACE "\"" "\\\"" ${variable} "${${variable}}")
+    endforeach()
+    set(record "    {u\"${unicode}\", u\"${escaped_shortname}\", u\"${escaped_description}\"},\n")
+
+    if(category STREQUAL "Tone")
+        # Like "waving hand: light skin tone", which is offered for "waving hand"
+        string(REGEX REPLACE ":.*" "" base "${escaped_description}")
+        list(FIND tone_bases "${base}" base_index)
+        if(base_index EQUAL -1)
+            list(LENGTH tone_bases base_index)
+            list(APPEND tone_bases "${base}")
+            set(tones_${base_index} "")
+            set(tone_count_${base_index} 0)
+        endif()
+        string(APPEND tones_${base_index} "${record}")
+        math(EXPR tone_count_${base_index} "${tone_count_${base_index}} + 1")
+    elseif(category IN_LIST categories)
+        string(APPEND emojis_${category} "${record}")
+        math(EXPR count_${category} "${count_${category}} + 1")
+    else()
+        message(FATAL_ERROR "Unknown emoji category ${category}")
+    endif()
+endforeach()
+
+set(emojis "")
+set(offsets "0")
+set(offset 0)
+foreach(category IN LISTS categories)
+    string(APPEND emojis "${emojis_${category}}")
+    math(EXPR offset "${offset} + ${count_${category}}")
+    string(APPEND offsets ", ${offset}")
+endforeach()
+
+# Sorted by code unit like QStringView::compare(), which is the same as by byte in UTF-8 outside of surrogates
+set(sorted_bases ${tone_bases})
+list(SORT sorted_bases)
+
+set(tones "")
+set(tone_groups "")
+set(offset 0)
+foreach(base IN LISTS sorted_bases)
+    list(FIND tone_bases "${base}" base_index)
+    string(APPEND tones "${tones_${base_index}}")
+    string(APPEND tone_groups "    {u\"${base}\", ${offset}, ${tone_count_${base_index}}},\n")
+    math(EXPR offset "${offset} + ${tone_count_${base_index}}")
+endforeach()
+
+file(WRITE "${OUTPUT}" "// This file is generated from utils/emojis.txt by cmake/GenerateEmojiTables.cmake. All changes will be lost.
+// clang-format off
+
+#pragma once
+
+#include \"utils/emojidata.h\"
+
+namespace EmojiData
+{
+inline constexpr EmojiRecord emojis[] = {
+${emojis}};
+
+// Where each category starts in emojis, from EmojiModel::Smileys to EmojiModel::Component, followed by where the last one ends
+inline constexpr qsizetype categoryOffsets[] = {${offsets}};
+
+inline constexpr EmojiRecord tones[] = {
+${tones}};
+
+inline constexpr EmojiToneGroup toneGroups[] = {
+${tone_groups}};
+}
+")
@@ -5,12 +5,16 @@
 #include "account/abstractaccount.h"
 
 #include "account/accountmanager.h"
+#include "account/instanceprofile.h"
 #include "account/relationship.h"
+#include "network/mediaprefetcher.h"
 #include "network/networkcontroller.h"
+#include "network/validatorcache.h"
 #include "utils/messagefiltercontainer.h"
 #include "utils/navigation.h"
 
 #include <KLocalizedString>
+#include <QHostAddress>
 #include <QJsonDocument>
 #include <QNetworkReply>
 #include <QUrlQuery>
@@ -29,25 +33,26 @@ AbstractAccount::AbstractAccount(const QString &instanceUri, QObject *parent)
     , m_identity(std::make_shared<Identity>())
     , m_preferences(new Preferences(this))
     , m_notificationFilteringPolicy(new NotificationFilteringPolicy(this))
+    , m_interactions(new InteractionQueue(this))
+    , m_markers(new MarkerSync(this))
+    , m_mediaUploads(new MediaUploadManager(this))
+    , m_mediaPrefetcher(new MediaPrefetcher(this))
     , m_maxMediaAttachments(4)
-    , m_attachmentFilterStrings({i18n("All supported formats (*.jpg *.jpeg *.png *.gif *.webp *.heic *.heif *.avif *.webm *.mp4 *.m4v *.mov)"),
-                                 i18n("JPEG image (*.jpg *.jpeg)"),
-                                 i18n("PNG image (*.png)"),
-                                 i18n("GIF image (*.gif)"),
-                                 i18n("WebP image (*.webp)"),
-                                 i18n("HEIC image(*.heic)"),
-                                 i18n("HEIF image (*.heif)"),
-                                 i18n("AVIF image (*.avif)"),
-                                 i18n("WebM video (*.webm)"),
-                                 i18n("MPEG-4 video (*.mp4)"),
-                                 i18n("M4V video (*.m4v)"),
-                                 i18n("QuickTime video (*.mov)"),
-                                 i18n("All files (*)")})
 {
     // Test code uses a blank instance URI
     if (!AccountManager::instance().testMode()) {
         Q_ASSERT(!instanceUri.isEmpty());
     }
+
+    // Use the stored capabilities until the instance is asked again
+    applyInstanceProfile(InstanceProfileStore::instance().profile(instanceHost()));
+
+    connect(&InstanceProfileStore::instance(), &InstanceProfileStore::profileChanged, this, [this](const QString &host) {
+        if (host == instanceHost()) {
+            applyInstanceProfile(InstanceProfileStore::instance().profile(host));
+            Q_EMIT fetchedInstanceMetadata();
+        }
+    });
 }
 
 AccountConfig *AbstractAccount::config()
@@ -72,6 +77,26 @@ NotificationFilteringPolicy *AbstractAccount::notificationFilteringPolicy() cons
     return m_notificationFilteringPolicy;
 }
 
+InteractionQueue *AbstractAccount::interactionQueue() const
+{
+    return m_interactions;
+}
+
+MarkerSync *AbstractAccount::markerSync() const
+{
+    return m_markers;
+}
+
+MediaUploadManager *AbstractAccount::mediaUploads() const
+{
+    return m_mediaUploads;
+}
+
+MediaPrefetcher *AbstractAccount::mediaPrefetcher() const
+{
+    return m_mediaPrefetcher;
+}
+
 QString AbstractAccount::username() const
 {
     return m_name;
@@ -111,6 +136,11 @@ QString AbstractAccount::instanceName() const
     return m_instance_name;
 }
 
+InstanceProfile::Software AbstractAccount::instanceSoftware() const
+{
+    return m_instanceSoftware;
+}
+
 bool AbstractAccount::haveToken() const
 {
     return !m_token.isEmpty();
@@ -124,7 +154,11 @@ bool AbstractAccount::hasName() const
 QUrl AbstractAccount::apiUrl(const QString &path) const
 {
     QUrl url = QUrl::fromUserInput(m_instance_uri);
-    url.setScheme(QStringLiteral("https"));
+    // Tests run against a server on this machine without TLS, everything else has to use HTTPS
+    const bool localTestServer = AccountManager::instance().testMode() && url.scheme() == "http"_L1 && QHostAddress(url.host()).isLoopback();
+    if (!localTestServer) {
+        url.setScheme(QStringLiteral("https"));
+    }
     url.setPath(path);
 
     return url;
@@ -348,6 +382,8 @@ void AbstractAccount::setInstanceUri(const QString &instance_uri)
     instance_url.setScheme(QStringLiteral("https")); // getting token from http is not supported
 
     m_instance_uri = instance_url.toString();
+
+    applyInstanceProfile(InstanceProfileStore::instance().profile(instanceHost()));
 }
 
 QString AbstractAccount::instanceUri() const
@@ -374,220 +410,153 @@ void AbstractAccount::setToken(const QString &authcode)
     });
 }
 
-void AbstractAccount::mutatePost(const QString &id, const QString &verb, bool deliver_home)
-{
-    const QUrl mutation_url = apiUrl(QStringLiteral("/api/v1/statuses/%1/%2").arg(id, verb));
-    const QJsonDocument doc;
-
-    post(mutation_url, doc, true, this, [this, deliver_home](QNetworkReply *reply) {
-        const auto data = reply->readAll();
-        const auto doc = QJsonDocument::fromJson(data);
-
-        if (deliver_home) {
-            QList<Post *> posts;
-            auto obj = doc.object();
-
-            auto p = new Post(this, obj, this);
-            posts.push_back(p);
-
-            Q_EMIT fetchedTimeline(QStringLiteral("home"), posts);
-        }
-    });
-}
-
 void AbstractAccount::favorite(Post *p)
 {
-    mutatePost(p->postId(), QStringLiteral("favourite"));
+    m_interactions->enqueue(p->postId(), InteractionQueue::Favourite, true);
 }
 
 void AbstractAccount::unfavorite(Post *p)
 {
-    mutatePost(p->postId(), QStringLiteral("unfavourite"));
+    m_interactions->enqueue(p->postId(), InteractionQueue::Favourite, false);
 }
 
 void AbstractAccount::repeat(Post *p)
 {
-    mutatePost(p->postId(), QStringLiteral("reblog"), true);
+    m_interactions->enqueue(p->postId(), InteractionQueue::Reblog, true);
 }
 
 void AbstractAccount::unrepeat(Post *p)
 {
-    mutatePost(p->postId(), QStringLiteral("unreblog"));
+    m_interactions->enqueue(p->postId(), InteractionQueue::Reblog, false);
 }
 
 void AbstractAccount::bookmark(Post *p)
 {
-    mutatePost(p->postId(), QStringLiteral("bookmark"), true);
+    m_interactions->enqueue(p->postId(), InteractionQueue::Bookmark, true);
 }
 
 void AbstractAccount::unbookmark(Post *p)
 {
-    mutatePost(p->postId(), QStringLiteral("unbookmark"));
+    m_interactions->enqueue(p->postId(), InteractionQueue::Bookmark, false);
 }
 
 void AbstractAccount::pin(Post *p)
 {
-    mutatePost(p->postId(), QStringLiteral("pin"), true);
+    m_interactions->enqueue(p->postId(), InteractionQueue::Pin, true);
 }
 
 void AbstractAccount::unpin(Post *p)
 {
-    mutatePost(p->postId(), QStringLiteral("unpin"));
+    m_interactions->enqueue(p->postId(), InteractionQueue::Pin, false);
 }
 
 void AbstractAccount::mute(Post *p)
 {
-    mutatePost(p->postId(), QStringLiteral("mute"), false);
+    m_interactions->enqueue(p->postId(), InteractionQueue::Mute, true);
 }
 
 void AbstractAccount::unmute(Post *p)
 {
-    mutatePost(p->postId(), QStringLiteral("unmute"), false);
+    m_interactions->enqueue(p->postId(), InteractionQueue::Mute, false);
 }
 
-void AbstractAccount::fetchInstanceMetadata()
+void AbstractAccount::getCached(const QUrl &url,
+                                bool authenticated,
+                                QObject *parent,
+                                std::function<void(const QJsonDocument &)> callback,
+                                std::function<void(QNetworkReply *)> errorCallback)
 {
-    get(
-        apiUrl(QStringLiteral("/api/v2/instance")),
-        false,
-        this,
-        [this](QNetworkReply *reply) {
-            const auto data = reply->readAll();
-            const auto doc = QJsonDocument::fromJson(data);
-
-            if (!doc.isObject()) {
-                return;
-            }
-
-            const auto obj = doc.object();
-
-            if (obj.contains("configuration"_L1)) {
-                const auto configObj = obj["configuration"_L1].toObject();
-
-                if (configObj.contains("statuses"_L1)) {
-                    const auto statusConfigObj = configObj["statuses"_L1].toObject();
-                    m_maxPostLength = statusConfigObj["max_characters"_L1].toInt();
-                    m_charactersReservedPerUrl = statusConfigObj["characters_reserved_per_url"_L1].toInt();
-                    m_maxMediaAttachments = statusConfigObj["max_media_attachments"_L1].toInt();
-                }
+    const QUrl key = ValidatorCache::cacheKey(url, m_name);
 
-                if (configObj.contains("media_attachments"_L1)) {
-                    const auto statusConfigObj = configObj["media_attachments"_L1].toObject();
-                    if (statusConfigObj.contains("supported_mime_types"_L1)) {
-                        m_attachmentFilterStrings.clear();
-                        QStringList allGlobs;
-                        QMimeDatabase db;
-                        for (const auto &mimeTypeName : statusConfigObj["supported_mime_types"_L1].toArray()) {
-                            // FIXME: Some mimetypes such as audio/webm do not have a filter string for some reason.
-                            const auto mimeType = db.mimeTypeForName(mimeTypeName.toString());
-                            if (mimeType.isValid() && !mimeType.filterString().isEmpty() && !m_attachmentFilterStrings.contains(mimeType.filterString())) {
-                                m_attachmentFilterStrings.push_back(mimeType.filterString());
-                                allGlobs.append(mimeType.globPatterns());
-                            }
-                        }
-
-                        m_attachmentFilterStrings.prepend(i18n("All supported formats (%1)", allGlobs.join(QLatin1Char(' '))));
-                        m_attachmentFilterStrings.push_back(i18n("All files (*)"));
-                    }
+    get(
+        url,
+        authenticated,
+        parent,
+        [this, url, authenticated, parent, key, callback, errorCallback](QNetworkReply *reply) {
+            auto &cache = ValidatorCache::instance();
+
+            if (reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 304) {
+                const auto doc = cache.notModified(key);
+                if (doc.isNull()) {
+                    // The cached copy disappeared in the meantime, so request it again without validators
+                    cache.remove(key);
+                    getCached(url, authenticated, parent, callback, errorCallback);
+                    return;
                 }
-            }
 
-            // Pleroma/Akkoma may report maximum post characters here, instead
-            if (obj.contains("max_toot_chars"_L1)) {
-                m_maxPostLength = obj["max_toot_chars"_L1].toInt();
-            }
-
-            // Pleroma/Akkoma can report higher poll limits
-            if (obj.contains("poll_limits"_L1)) {
-                m_maxPollOptions = obj["poll_limits"_L1].toObject()["max_options"_L1].toInt();
-            }
-
-            // Other instance of poll options
-            if (obj.contains("polls"_L1)) {
-                m_maxPollOptions = obj["polls"_L1].toObject()["max_options"_L1].toInt();
-            }
-
-            if (obj.contains("registrations"_L1)) {
-                m_registrationsOpen = obj["registrations"_L1].toObject()["enabled"_L1].toBool();
-                m_registrationMessage = obj["registrations"_L1].toObject()["message"_L1].toString();
+                callback(doc);
+                return;
             }
 
-            m_supportsLocalVisibility = obj.contains("pleroma"_L1);
-
-            m_instance_name = obj["title"_L1].toString();
+            const auto data = reply->readAll();
+            const auto doc = QJsonDocument::fromJson(data);
+            cache.insert(key, reply, data, doc);
 
-            Q_EMIT fetchedInstanceMetadata();
+            callback(doc);
         },
-        [this](QNetworkReply *) {
-            // Fall back to v1 instance information
-            // TODO: a lot of this can be merged with v2 handling
-            get(apiUrl(QStringLiteral("/api/v1/instance")), false, this, [this](QNetworkReply *reply) {
-                const auto data = reply->readAll();
-                const auto doc = QJsonDocument::fromJson(data);
-
-                if (!doc.isObject()) {
-                    return;
-                }
-
-                const auto obj = doc.object();
-
-                if (obj.contains("configuration"_L1)) {
-                    const auto configObj = obj["configuration"_L1].toObject();
-
-                    if (configObj.contains("statuses"_L1)) {
-                        const auto statusConfigObj = configObj["statuses"_L1].toObject();
-                        m_maxPostLength = statusConfigObj["max_characters"_L1].toInt();
-                        m_charactersReservedPerUrl = statusConfigObj["characters_reserved_per_url"_L1].toInt();
-                    }
-                }
-
-                // Pleroma/Akkoma may report maximum post characters here, instead
-                if (obj.contains("max_toot_chars"_L1)) {
-                    m_maxPostLength = obj["max_toot_chars"_L1].toInt();
-                }
-
-                // Pleroma/Akkoma can report higher poll limits
-                if (obj.contains("poll_limits"_L1)) {
-                    m_maxPollOptions = obj["poll_limits"_L1].toObject()["max_options"_L1].toInt();
-                }
+        errorCallback,
+        ValidatorCache::instance().conditionalHeaders(key));
+}
 
-                // Other instance of poll options
-                if (obj.contains("polls"_L1)) {
-                    m_maxPollOptions = obj["polls"_L1].toObject()["max_options"_L1].toInt();
-                }
+void AbstractAccount::fetchInstanceMetadata()
+{
+    InstanceProfileStore::instance().refresh(this, true);
+    fetchCustomEmojis();
+}
 
-                m_registrationsOpen = obj["registrations"_L1].toBool();
+void AbstractAccount::loadInstanceMetadata()
+{
+    // Nothing is fetched while the stored profile is fresh, so whoever waits for the metadata has to hear about it here
+    if (!InstanceProfileStore::instance().isStale(instanceHost())) {
+        applyInstanceProfile(InstanceProfileStore::instance().profile(instanceHost()));
+        Q_EMIT fetchedInstanceMetadata();
+    }
 
-                m_supportsLocalVisibility = obj.contains("pleroma"_L1);
+    InstanceProfileStore::instance().refresh(this);
+    fetchCustomEmojis();
+}
 
-                m_instance_name = obj["title"_L1].toString();
+QString AbstractAccount::instanceHost() const
+{
+    return QUrl::fromUserInput(m_instance_uri).host();
+}
 
-                Q_EMIT fetchedInstanceMetadata();
-            });
-        });
+void AbstractAccount::applyInstanceProfile(const InstanceProfile &profile)
+{
+    m_maxPostLength = profile.maxPostLength;
+    m_charactersReservedPerUrl = profile.charactersReservedPerUrl;
+    m_maxPollOptions = profile.maxPollOptions;
+    m_maxMediaAttachments = profile.maxMediaAttachments;
+    m_imageMatrixLimit = profile.imageMatrixLimit;
+    m_imageSizeLimit = profile.imageSizeLimit;
+    m_supportsLocalVisibility = profile.supportsLocalVisibility;
+    m_registrationsOpen = profile.registrationsOpen;
+    m_registrationMessage = profile.registrationMessage;
+    m_instance_name = profile.name;
+    m_instanceSoftware = profile.software;
 
-    fetchCustomEmojis();
+    if (m_supportedMimeTypes != profile.supportedMimeTypes) {
+        m_supportedMimeTypes = profile.supportedMimeTypes;
+        m_attachmentFilterStrings.clear();
+    }
 }
 
 void AbstractAccount::saveTimelinePosition(const QString &timeline, const QString &lastReadId)
 {
-    QUrl uri = apiUrl(QStringLiteral("/api/v1/markers"));
-
-    QUrlQuery urlQuery(uri);
-    urlQuery.addQueryItem(QStringLiteral("%1[last_read_id]").arg(timeline), lastReadId);
-    uri.setQuery(urlQuery);
-
-    post(uri, urlQuery, true, this, {});
+    m_markers->setLastRead(timeline, lastReadId);
 }
 
 QUrl AbstractAccount::streamingUrl(const QString &stream)
 {
     QUrl url = apiUrl(QStringLiteral("/api/v1/streaming"));
-    url.setQuery(QUrlQuery{
+    QUrlQuery query{
         {QStringLiteral("access_token"), m_token},
-        {QStringLiteral("stream"), stream},
-    });
-    url.setScheme(QStringLiteral("wss"));
+    };
+    if (!stream.isEmpty()) {
+        query.addQueryItem(QStringLiteral("stream"), stream);
+    }
+    url.setQuery(query);
+    url.setScheme(url.scheme() == "http"_L1 ? QStringLiteral("ws") : QStringLiteral("wss"));
 
     return url;
 }
@@ -684,8 +653,54 @@ int AbstractAccount::maxMediaAttachments() const
     return m_maxMediaAttachments;
 }
 
+qint64 AbstractAccount::imageMatrixLimit() const
+{
+    return m_imageMatrixLimit;
+}
+
+qint64 AbstractAccount::imageSizeLimit() const
+{
+    return m_imageSizeLimit;
+}
+
 QStringList AbstractAccount::attachmentFilterStrings() const
 {
+    // Looking up every MIME type is slow, so only do it once the composer actually asks
+    if (!m_attachmentFilterStrings.isEmpty()) {
+        return m_attachmentFilterStrings;
+    }
+
+    if (m_supportedMimeTypes.isEmpty()) {
+        m_attachmentFilterStrings = {i18n("All supported formats (*.jpg *.jpeg *.png *.gif *.webp *.heic *.heif *.avif *.webm *.mp4 *.m4v *.mov)"),
+                                     i18n("JPEG image (*.jpg *.jpeg)"),
+                                     i18n("PNG image (*.png)"),
+                                     i18n("GIF image (*.gif)"),
+                                     i18n("WebP image (*.webp)"),
+                                     i18n("HEIC image(*.heic)"),
+                                     i18n("HEIF image (*.heif)"),
+                                     i18n("AVIF image (*.avif)"),
+                                     i18n("WebM video (*.webm)"),
+                                     i18n("MPEG-4 video (*.mp4)"),
+                                     i18n("M4V video (*.m4v)"),
+                                     i18n("QuickTime video (*.mov)"),
+                                     i18n("All files (*)")};
+        return m_attachmentFilterStrings;
+    }
+
+    QStringList allGlobs;
+    QMimeDatabase db;
+    for (const auto &mimeTypeName : m_supportedMimeTypes) {
+        // FIXME: Some mimetypes such as audio/webm do not have a filter string for some reason.
+        const auto mimeType = db.mimeTypeForName(mimeTypeName);
+        if (mimeType.isValid() && !mimeType.filterString().isEmpty() && !m_attachmentFilterStrings.contains(mimeType.filterString())) {
+            m_attachmentFilterStrings.push_back(mimeType.filterString());
+            allGlobs.append(mimeType.globPatterns());
+        }
+    }
+
+    m_attachmentFilterStrings.prepend(i18n("All supported formats (%1)", allGlobs.join(QLatin1Char(' '))));
+    m_attachmentFilterStrings.push_back(i18n("All files (*)"));
+
     return m_attachmentFilterStrings;
 }
 
@@ -766,7 +781,9 @@ void AbstractAccount::mutateRemotePost(const QString &url, const QString &verb)
                 Q_EMIT Navigation::instance().replyTo(post);
             } else {
                 const QString localID = status["id"_L1].toString();
-                mutatePost(localID, verb);
+                if (const auto interaction = InteractionQueue::fromVerb(verb)) {
+                    m_interactions->enqueue(localID, interaction->first, interaction->second);
+                }
             }
         }
     });
@@ -813,20 +830,21 @@ QString AbstractAccount::accessTokenKey() const
     return AccountManager::accessTokenKey(settingsGroupName());
 }
 
-void AbstractAccount::fetchCustomEmojis()
+QString AbstractAccount::credentialsKey() const
 {
-    m_customEmojis.clear();
-
-    get(apiUrl(QStringLiteral("/api/v1/custom_emojis")), true, this, [this](QNetworkReply *reply) {
-        if (200 != reply->attribute(QNetworkRequest::HttpStatusCodeAttribute))
-            return;
-
-        const auto data = reply->readAll();
-        const auto doc = QJsonDocument::fromJson(data);
+    return AccountManager::credentialsKey(settingsGroupName());
+}
 
+void AbstractAccount::fetchCustomEmojis()
+{
+    getCached(apiUrl(QStringLiteral("/api/v1/custom_emojis")), true, this, [this](const QJsonDocument &doc) {
         if (!doc.isArray())
             return;
 
+        m_customEmojis.clear();
+        m_customEmojiIndex.clear();
+        m_customEmojiUrls.clear();
+
         const auto array = doc.array();
 
         for (auto emojiObj : array) {
@@ -834,11 +852,11 @@ void AbstractAccount::fetchCustomEmojis()
                 continue;
             }
 
-            CustomEmoji customEmoji{};
-            customEmoji.shortcode = emojiObj[QStringLiteral("shortcode")].toString();
-            customEmoji.url = emojiObj[QStringLiteral("url")].toString();
+            const auto customEmoji = m_customEmojiCache.intern(emojiObj[QStringLiteral("shortcode")].toString(), emojiObj[QStringLiteral("url")].toString());
 
             m_customEmojis.push_back(customEmoji);
+            m_customEmojiIndex.add(customEmoji.shortcode, QVariant::fromValue(customEmoji));
+            m_customEmojiUrls.insert(customEmoji.shortcode, customEmoji.url);
         }
 
         Q_EMIT fetchedCustomEmojis();
@@ -850,6 +868,21 @@ QList<CustomEmoji> AbstractAccount::customEmojis() const
     return m_customEmojis;
 }
 
+const EmojiIndex &AbstractAccount::customEmojiIndex() const
+{
+    return m_customEmojiIndex;
+}
+
+const CustomEmojiUrls &AbstractAccount::customEmojiUrls() const
+{
+    return m_customEmojiUrls;
+}
+
+CustomEmojiCache &AbstractAccount::customEmojiCache()
+{
+    return m_customEmojiCache;
+}
+
 void AbstractAccount::addFavoriteList(const QString &id)
 {
     auto ids = config()->favoriteListIds();
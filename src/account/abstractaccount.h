@@ -4,16 +4,23 @@
 #pragma once
 
 #include "account/identity.h"
+#include "account/interactionqueue.h"
+#include "account/markersync.h"
+#include "account/mediauploadmanager.h"
+#include "account/instanceprofile.h"
 #include "account/notificationfilteringpolicy.h"
 #include "account/preferences.h"
 #include "accountconfig.h"
 #include "admin/adminaccountinfo.h"
 #include "admin/reportinfo.h"
 #include "utils/customemoji.h"
+#include "utils/emojiindex.h"
 
+#include <QJsonArray>
 #include <QJsonObject>
 #include <QtQml/qqmlregistration.h>
 
+class MediaPrefetcher;
 class Notification;
 class QNetworkReply;
 class QHttpMultiPart;
@@ -45,8 +52,8 @@ class AbstractAccount : public QObject
     Q_PROPERTY(QString registrationMessage READ registrationMessage NOTIFY fetchedInstanceMetadata)
     Q_PROPERTY(int unreadNotificationsCount READ unreadNotificationsCount NOTIFY unreadNotificationsCountChanged)
     Q_PROPERTY(NotificationFilteringPolicy *notificationFilteringPolicy READ notificationFilteringPolicy CONSTANT)
-    Q_PROPERTY(int maxMediaAttachments READ maxMediaAttachments CONSTANT)
-    Q_PROPERTY(QStringList attachmentFilterStrings READ attachmentFilterStrings CONSTANT)
+    Q_PROPERTY(int maxMediaAttachments READ maxMediaAttachments NOTIFY fetchedInstanceMetadata)
+    Q_PROPERTY(QStringList attachmentFilterStrings READ attachmentFilterStrings NOTIFY fetchedInstanceMetadata)
 
 public:
     /**
@@ -118,6 +125,26 @@ public:
      */
     [[nodiscard]] NotificationFilteringPolicy *notificationFilteringPolicy() const;
 
+    /**
+     * @return The queue delivering favorites, boosts and other interactions with posts.
+     */
+    [[nodiscard]] InteractionQueue *interactionQueue() const;
+
+    /**
+     * @return The read markers of this account's timelines.
+     */
+    [[nodiscard]] MarkerSync *markerSync() const;
+
+    /**
+     * @return The uploads of media attachments.
+     */
+    [[nodiscard]] MediaUploadManager *mediaUploads() const;
+
+    /**
+     * @return The prefetcher for the images of upcoming posts, shared by the timelines.
+     */
+    [[nodiscard]] MediaPrefetcher *mediaPrefetcher() const;
+
     /**
      * @return The username of the account.
      * @see setUsername()
@@ -126,14 +153,36 @@ public:
 
     /**
      * @brief Fetches instance-specific metadata like max post length, allowed content types, etc.
+     *
+     * This always asks the instance, even if the stored profile is still fresh.
      */
     void fetchInstanceMetadata();
 
+    /**
+     * @return The server software of the instance, as far as it could be detected.
+     */
+    [[nodiscard]] InstanceProfile::Software instanceSoftware() const;
+
     /**
      * @return The custom emojis that's accessible for this account.
      */
     [[nodiscard]] QList<CustomEmoji> customEmojis() const;
 
+    /**
+     * @return The custom emojis of this account indexed by shortcode, for searching and looking them up.
+     */
+    [[nodiscard]] const EmojiIndex &customEmojiIndex() const;
+
+    /**
+     * @return The URLs of the custom emojis that's accessible for this account, by shortcode.
+     */
+    [[nodiscard]] const CustomEmojiUrls &customEmojiUrls() const;
+
+    /**
+     * @return The custom emojis this account came across in posts and profiles, which those parsed later share their strings with.
+     */
+    [[nodiscard]] CustomEmojiCache &customEmojiCache();
+
     /**
      * @return The instance URI.
      * @see setInstanceUri()
@@ -207,8 +256,12 @@ public:
 
     /**
      * @brief Saves the timeline position.
+     *
+     * It's sent to the server a bit later, along with the other timelines, and only if it's newer than what was saved before.
+     *
      * @param timeline Which timeline to save, right now can only be "home" or "notifications"
      * @param lastReadId The last read post id.
+     * @see markerSync()
      */
     Q_INVOKABLE void saveTimelinePosition(const QString &timeline, const QString &lastReadId);
 
@@ -284,13 +337,29 @@ public:
 
     /**
      * @brief Returns a streaming url for @p stream.
-     * @param stream The requested stream (e.g. user).
+     * @param stream The requested stream (e.g. user), or empty to subscribe to streams after connecting.
      */
     QUrl streamingUrl(const QString &stream);
 
+    /**
+     * @brief Starts receiving events from @p stream, which is shared with anything else using it.
+     * @param stream The stream name (e.g. user, list or hashtag).
+     * @param parameter The list id or hashtag for streams which need one, otherwise empty.
+     * @see unsubscribeFromStream()
+     */
+    virtual void subscribeToStream(const QString &stream, const QString &parameter = {}) = 0;
+
+    /**
+     * @brief Stops receiving events from @p stream, once nothing else uses it.
+     * @param stream The stream name (e.g. user, list or hashtag).
+     * @param parameter The list id or hashtag for streams which need one, otherwise empty.
+     * @see subscribeToStream()
+     */
+    virtual void unsubscribeFromStream(const QString &stream, const QString &parameter = {}) = 0;
+
     /**
      * @param path The base API path.
-     * @return A well-formed URL of an API path.
+     * @return A well-formed URL of an API path. It always uses HTTPS, except for a server on this machine in test mode.
      */
     [[nodiscard]] QUrl apiUrl(const QString &path) const;
 
@@ -301,12 +370,52 @@ public:
      * @param parent The parent object that calls get() or the callback belongs to.
      * @param callback The callback that should be executed if the request is successful.
      * @param errorCallback The callback that should be executed if the request is not successful.
+     * @param headers Additional headers to send with the request.
      */
     virtual void get(const QUrl &url,
                      bool authenticated,
                      QObject *parent,
                      std::function<void(QNetworkReply *)> callback,
-                     std::function<void(QNetworkReply *)> errorCallback = nullptr) = 0;
+                     std::function<void(QNetworkReply *)> errorCallback = nullptr,
+                     QHash<QByteArray, QByteArray> headers = {}) = 0;
+
+    /**
+     * @brief Make an HTTP GET request for a JSON array, handing out its elements while the response is still being downloaded.
+     *
+     * This is meant for large responses like timelines, so they can be shown before the last byte arrived.
+     * @param url The url of the request.
+     * @param authenticated Whether the request should be authenticated.
+     * @param parent The parent object that calls getArray() or the callbacks belong to.
+     * @param elementsCallback The callback that should be executed with every batch of elements as they are parsed, in order. Headers are
+     * already available on the reply.
+     * @param callback The callback that should be executed once the whole response was read.
+     * @param errorCallback The callback that should be executed if the request is not successful.
+     * @see JsonArrayReader
+     */
+    virtual void getArray(const QUrl &url,
+                          bool authenticated,
+                          QObject *parent,
+                          std::function<void(QNetworkReply *, const QJsonArray &)> elementsCallback,
+                          std::function<void(QNetworkReply *)> callback,
+                          std::function<void(QNetworkReply *)> errorCallback = nullptr) = 0;
+
+    /**
+     * @brief Make a conditional HTTP GET request for a slow-changing JSON resource, like the instance metadata or custom emojis.
+     *
+     * If an earlier response had an ETag or Last-Modified header, the server is asked to revalidate it, and the cached document is reused when it
+     * responds with 304 Not Modified.
+     * @param url The url of the request.
+     * @param authenticated Whether the request should be authenticated.
+     * @param parent The parent object that calls getCached() or the callback belongs to.
+     * @param callback The callback that should be executed with the fresh or cached document.
+     * @param errorCallback The callback that should be executed if the request is not successful.
+     * @see ValidatorCache
+     */
+    void getCached(const QUrl &url,
+                   bool authenticated,
+                   QObject *parent,
+                   std::function<void(const QJsonDocument &)> callback,
+                   std::function<void(QNetworkReply *)> errorCallback = nullptr);
 
     /**
      * @brief Make an HTTP POST request to the server.
@@ -349,10 +458,15 @@ public:
      * @param authenticated Whether the request should be authenticated.
      * @param parent The parent object that calls get() or the callback belongs to.
      * @param callback The callback that should be executed if the request is successful.
+     * @param errorCallback The callback that should be executed if the request is not successful.
      * @return
      */
-    virtual QNetworkReply *
-    post(const QUrl &url, QHttpMultiPart *message, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)> callback) = 0;
+    virtual QNetworkReply *post(const QUrl &url,
+                                QHttpMultiPart *message,
+                                bool authenticated,
+                                QObject *parent,
+                                std::function<void(QNetworkReply *)> callback,
+                                std::function<void(QNetworkReply *)> errorCallback = nullptr) = 0;
 
     /**
      * @brief Make an HTTP PUT request to the server.
@@ -444,6 +558,16 @@ public:
 
     [[nodiscard]] int maxMediaAttachments() const;
 
+    /**
+     * @return The most pixels an uploaded image may have, or 0 if the instance doesn't say.
+     */
+    [[nodiscard]] qint64 imageMatrixLimit() const;
+
+    /**
+     * @return The largest image in bytes the instance accepts, or 0 if it doesn't say.
+     */
+    [[nodiscard]] qint64 imageSizeLimit() const;
+
     [[nodiscard]] QStringList attachmentFilterStrings() const;
 
     /**
@@ -538,6 +662,11 @@ public:
      */
     [[nodiscard]] QString accessTokenKey() const;
 
+    /**
+     * @return The preferred key name for the combined access token and client secret.
+     */
+    [[nodiscard]] QString credentialsKey() const;
+
     /**
      * @brief Add a list to this account's favorites.
      */
@@ -644,12 +773,29 @@ Q_SIGNALS:
     void errorOccured(const QString &errorMessage);
 
     /**
-     * @brief Emitted when a streaming event has been received
+     * @brief Emitted when a streaming event has been received on the user stream
      * @param eventType The type of streaming event.
      * @param payload The payload for the streaming event.
+     * @see streamEvent()
      */
     void streamingEvent(AbstractAccount::StreamingEventType eventType, const QByteArray &payload);
 
+    /**
+     * @brief Emitted when a streaming event has been received on any other subscribed stream
+     * @param streamKey The stream the event was received on, see StreamingClient::streamKey().
+     * @param eventType The type of streaming event.
+     * @param payload The payload for the streaming event.
+     * @see subscribeToStream()
+     */
+    void streamEvent(const QString &streamKey, AbstractAccount::StreamingEventType eventType, const QByteArray &payload);
+
+    /**
+     * @brief Emitted when the streaming connection is back after it was lost.
+     *
+     * Streamed timelines should fetch whatever they missed in the meantime.
+     */
+    void streamReconnected();
+
     /**
      * @brief Emitted when the number of follow requests was changed.
      */
@@ -707,6 +853,23 @@ protected:
      */
     void fetchCustomEmojis();
 
+    /**
+     * @brief Refreshes the instance metadata only if the stored profile is stale, and fetches custom emojis.
+     *
+     * fetchedInstanceMetadata() is emitted right away if the stored profile is still fresh.
+     */
+    void loadInstanceMetadata();
+
+    /**
+     * @return The host of the instance, used as the key for its InstanceProfile.
+     */
+    [[nodiscard]] QString instanceHost() const;
+
+    /**
+     * @brief Copies the capabilities in @p profile into the account.
+     */
+    void applyInstanceProfile(const InstanceProfile &profile);
+
     /**
      * @brief Sets the access token.
      * @param token The access token.
@@ -731,7 +894,14 @@ protected:
     std::shared_ptr<ReportInfo> m_reportInfo;
     Preferences *m_preferences = nullptr;
     NotificationFilteringPolicy *m_notificationFilteringPolicy = nullptr;
+    InteractionQueue *m_interactions = nullptr;
+    MarkerSync *m_markers = nullptr;
+    MediaUploadManager *m_mediaUploads = nullptr;
+    MediaPrefetcher *m_mediaPrefetcher = nullptr;
     QList<CustomEmoji> m_customEmojis;
+    EmojiIndex m_customEmojiIndex;
+    CustomEmojiUrls m_customEmojiUrls;
+    CustomEmojiCache m_customEmojiCache;
     QString m_additionalScopes;
     AccountConfig *m_config = nullptr;
     bool m_registrationsOpen = false;
@@ -740,12 +910,15 @@ protected:
     int m_unreadNotificationsCount = 0;
     QString m_redirectUri;
     int m_maxMediaAttachments;
-    QStringList m_attachmentFilterStrings;
+    qint64 m_imageMatrixLimit = 0;
+    qint64 m_imageSizeLimit = 0;
+    QStringList m_supportedMimeTypes;
+    mutable QStringList m_attachmentFilterStrings;
+    InstanceProfile::Software m_instanceSoftware = InstanceProfile::Software::Unknown;
 
     // updates and notifications
     void handleNotification(const QJsonDocument &doc);
 
-    void mutatePost(const QString &id, const QString &verb, bool deliver_home = false);
     QMap<QString, std::shared_ptr<Identity>> m_identityCache;
     QMap<QString, std::shared_ptr<AdminAccountInfo>> m_adminIdentityCache;
     QMap<QString, AdminAccountInfo *> m_adminIdentityCacheWithVanillaPointer;
@@ -5,7 +5,10 @@
 #include "account/account.h"
 
 #include "account/notificationhandler.h"
+#include "network/jsonarrayreader.h"
 #include "network/networkcontroller.h"
+#include "network/networktimings.h"
+#include "utils/startuptrace.h"
 #include "tokodon_http_debug.h"
 
 #ifdef HAVE_KUNIFIEDPUSH
@@ -16,11 +19,13 @@
 #include "messagefiltercontainer.h"
 #include "tokodon-version.h"
 
+#include <QElapsedTimer>
 #include <QFileInfo>
 #include <QHttpMultiPart>
 #include <QJsonDocument>
 #include <QNetworkReply>
 #include <QRandomGenerator>
+#include <QScopeGuard>
 #include <QUrlQuery>
 #include <config.h>
 #include <qt6keychain/keychain.h>
@@ -30,7 +35,13 @@ using namespace Qt::Literals::StringLiterals;
 Account::Account(const QString &instanceUri, QNetworkAccessManager *nam, QObject *parent)
     : AbstractAccount(instanceUri, parent)
     , m_qnam(nam)
+    , m_streaming(new StreamingClient(this))
 {
+    connect(m_streaming, &StreamingClient::eventReceived, this, &Account::handleStreamingEvent);
+    connect(m_streaming, &StreamingClient::reconnected, this, [this] {
+        backfillNotifications();
+        Q_EMIT streamReconnected();
+    });
     connect(this, &Account::authenticated, this, &Account::checkForFollowRequests);
     connect(this, &Account::authenticated, this, &Account::checkForUnreadNotifications);
 }
@@ -49,9 +60,18 @@ void Account::get(const QUrl &url,
                   bool authenticated,
                   QObject *parent,
                   std::function<void(QNetworkReply *)> reply_cb,
-                  std::function<void(QNetworkReply *)> errorCallback)
+                  std::function<void(QNetworkReply *)> errorCallback,
+                  QHash<QByteArray, QByteArray> headers)
 {
     QNetworkRequest request = makeRequest(url, authenticated);
+    for (const auto [headerKey, headerValue] : headers.asKeyValueRange()) {
+        request.setRawHeader(headerKey, headerValue);
+    }
+    if (isConditionalRequest(request)) {
+        // We revalidate these ourselves, so the 304 needs to reach us instead of being answered by the disk cache
+        request.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::AlwaysNetwork);
+        request.setAttribute(QNetworkRequest::CacheSaveControlAttribute, false);
+    }
     qCDebug(TOKODON_HTTP) << "GET" << url;
 
     QNetworkReply *reply = m_qnam->get(request);
@@ -59,6 +79,52 @@ void Account::get(const QUrl &url,
     handleReply(reply, reply_cb, errorCallback);
 }
 
+void Account::getArray(const QUrl &url,
+                       bool authenticated,
+                       QObject *parent,
+                       std::function<void(QNetworkReply *, const QJsonArray &)> elementsCallback,
+                       std::function<void(QNetworkReply *)> callback,
+                       std::function<void(QNetworkReply *)> errorCallback)
+{
+    const QNetworkRequest request = makeRequest(url, authenticated);
+    qCDebug(TOKODON_HTTP) << "GET" << url << "(incremental)";
+
+    QNetworkReply *reply = m_qnam->get(request);
+    reply->setParent(parent);
+
+    const auto reader = std::make_shared<JsonArrayReader>();
+    const auto readElements = [reply, reader, elementsCallback] {
+        // Error responses are left in the buffer for the error callback
+        if (reader->hasError() || reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() != 200) {
+            return;
+        }
+
+        QElapsedTimer parseTimer;
+        parseTimer.start();
+        const auto elements = reader->feed(reply->readAll());
+        NetworkTimings::instance().recordParse(reply, parseTimer.nsecsElapsed());
+
+        if (reader->hasError()) {
+            qCWarning(TOKODON_HTTP) << "Failed to parse" << reply->url() << reader->errorString();
+        }
+        if (!elements.isEmpty() && elementsCallback) {
+            elementsCallback(reply, elements);
+        }
+    };
+    connect(reply, &QNetworkReply::readyRead, reply, readElements);
+
+    handleReply(
+        reply,
+        [readElements, callback](QNetworkReply *reply) {
+            // Whatever arrived with the last readyRead
+            readElements();
+            if (callback) {
+                callback(reply);
+            }
+        },
+        errorCallback);
+}
+
 void Account::post(const QUrl &url,
                    const QJsonDocument &doc,
                    bool authenticated,
@@ -125,7 +191,12 @@ void Account::post(const QUrl &url,
     handleReply(reply, reply_cb, errorCallback);
 }
 
-QNetworkReply *Account::post(const QUrl &url, QHttpMultiPart *message, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)> reply_cb)
+QNetworkReply *Account::post(const QUrl &url,
+                             QHttpMultiPart *message,
+                             bool authenticated,
+                             QObject *parent,
+                             std::function<void(QNetworkReply *)> reply_cb,
+                             std::function<void(QNetworkReply *)> errorCallback)
 {
     QNetworkRequest request = makeRequest(url, authenticated);
 
@@ -133,7 +204,8 @@ QNetworkReply *Account::post(const QUrl &url, QHttpMultiPart *message, bool auth
 
     QNetworkReply *reply = m_qnam->post(request, message);
     reply->setParent(parent);
-    handleReply(reply, reply_cb);
+    message->setParent(reply);
+    handleReply(reply, reply_cb, errorCallback);
     return reply;
 }
 
@@ -171,12 +243,31 @@ QNetworkRequest Account::makeRequest(const QUrl &url, bool authenticated) const
     return request;
 }
 
+bool Account::isConditionalRequest(const QNetworkRequest &request)
+{
+    return request.hasRawHeader(QByteArrayLiteral("If-None-Match")) || request.hasRawHeader(QByteArrayLiteral("If-Modified-Since"));
+}
+
 void Account::handleReply(QNetworkReply *reply, std::function<void(QNetworkReply *)> reply_cb, std::function<void(QNetworkReply *)> errorCallback) const
 {
+    NetworkTimings::instance().track(reply);
+
     connect(reply, &QNetworkReply::finished, [reply, reply_cb, errorCallback]() {
         reply->deleteLater();
-        if (200 != reply->attribute(QNetworkRequest::HttpStatusCodeAttribute) && !reply->url().toString().contains("nodeinfo"_L1)) {
-            NetworkController::instance().logError(reply->url().toString(), reply->errorString());
+
+        QElapsedTimer callbackTimer;
+        callbackTimer.start();
+        const auto recordTiming = qScopeGuard([reply, &callbackTimer] {
+            NetworkTimings::instance().complete(reply, callbackTimer.nsecsElapsed());
+        });
+
+        const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+        const bool notModified = statusCode == 304 && isConditionalRequest(reply->request());
+        if (statusCode != 200 && !notModified && !reply->url().toString().contains("nodeinfo"_L1)) {
+            // Other successful statuses, like media still being processed, are up to the callback but aren't errors
+            if (reply->error() != QNetworkReply::NoError) {
+                NetworkController::instance().logError(reply->url().toString(), reply->errorString());
+            }
             if (errorCallback) {
                 errorCallback(reply);
             }
@@ -222,7 +313,7 @@ void Account::requestRemoteObject(const QUrl &remoteUrl, QObject *parent, std::f
     get(url, true, parent, std::move(callback));
 }
 
-static QMap<QString, AbstractAccount::StreamingEventType> stringToStreamingEventType = {
+static const QMap<QString, AbstractAccount::StreamingEventType> stringToStreamingEventType = {
     {QStringLiteral("update"), AbstractAccount::StreamingEventType::UpdateEvent},
     {QStringLiteral("delete"), AbstractAccount::StreamingEventType::DeleteEvent},
     {QStringLiteral("notification"), AbstractAccount::StreamingEventType::NotificationEvent},
@@ -235,57 +326,82 @@ static QMap<QString, AbstractAccount::StreamingEventType> stringToStreamingEvent
     {QStringLiteral("encrypted_message"), AbstractAccount::StreamingEventType::EncryptedMessageChangedEvent},
 };
 
-QWebSocket *Account::streamingSocket(const QString &stream)
+void Account::subscribeToStream(const QString &stream, const QString &parameter)
 {
-    if (m_token.isEmpty()) {
-        return nullptr;
-    }
+    m_streaming->subscribe(stream, parameter);
+}
 
-    if (m_websockets.contains(stream)) {
-        return m_websockets[stream];
+void Account::unsubscribeFromStream(const QString &stream, const QString &parameter)
+{
+    m_streaming->unsubscribe(stream, parameter);
+}
+
+StreamingClient *Account::streamingClient() const
+{
+    return m_streaming;
+}
+
+void Account::handleStreamingEvent(const QString &streamKey, const QString &eventName, const QByteArray &payload)
+{
+    const auto event = stringToStreamingEventType.value(eventName, InvalidEvent);
+    const bool isUserStream = streamKey == "user"_L1;
+
+    if (Config::autoUpdate()) {
+        if (isUserStream) {
+            Q_EMIT streamingEvent(event, payload);
+        } else {
+            Q_EMIT streamEvent(streamKey, event, payload);
+        }
     }
 
-    auto socket = new QWebSocket();
-    socket->setParent(this);
+    if (isUserStream && event == NotificationEvent) {
+        const auto doc = QJsonDocument::fromJson(payload);
+        m_lastStreamedNotificationId = doc["id"_L1].toString();
+        handleNotification(doc);
+    }
+}
 
-    const auto url = streamingUrl(stream);
+void Account::backfillNotifications()
+{
+    // Without a notification to start from, there's nothing to compare against
+    if (m_lastStreamedNotificationId.isEmpty()) {
+        return;
+    }
 
-    connect(socket, &QWebSocket::textMessageReceived, this, [this](const QString &message) {
-        const auto env = QJsonDocument::fromJson(message.toLocal8Bit());
-        if (env.isObject() && env.object().contains("event"_L1)) {
-            const auto event = stringToStreamingEventType[env.object()["event"_L1].toString()];
-            if (Config::autoUpdate()) {
-                Q_EMIT streamingEvent(event, env.object()["payload"_L1].toString().toLocal8Bit());
-            }
+    // since_id would only return the newest page, so this goes forward from the last one a page at a time
+    QUrl url = apiUrl(QStringLiteral("/api/v1/notifications"));
+    url.setQuery(QUrlQuery{{QStringLiteral("min_id"), m_lastStreamedNotificationId}});
 
-            if (event == NotificationEvent) {
-                const auto doc = QJsonDocument::fromJson(env.object()["payload"_L1].toString().toLocal8Bit());
-                handleNotification(doc);
-                return;
-            }
+    get(url, true, this, [this](QNetworkReply *reply) {
+        const auto notifications = QJsonDocument::fromJson(reply->readAll()).array();
+        if (notifications.isEmpty()) {
+            return;
         }
-    });
-    connect(socket, &QWebSocket::errorOccurred, this, [=](QAbstractSocket::SocketError) {
-        NetworkController::instance().logError(url.toString(), socket->errorString());
-    });
 
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::UserAgentHeader, QStringLiteral("Tokodon/").append(QStringLiteral(TOKODON_VERSION_STRING)));
-    socket->open(request);
+        // The newest notification comes first, but they should be handled in the order they arrived
+        for (qsizetype i = notifications.size() - 1; i >= 0; i--) {
+            const auto doc = QJsonDocument(notifications[i].toObject());
+            m_lastStreamedNotificationId = doc["id"_L1].toString();
+            handleNotification(doc);
+        }
 
-    m_websockets[stream] = socket;
-    return socket;
+        backfillNotifications();
+    });
 }
 
 void Account::validateToken()
 {
     const QUrl verify_credentials = apiUrl(QStringLiteral("/api/v1/accounts/verify_credentials"));
 
+    StartupTrace::instance().begin(StartupTrace::scope(this), QStringLiteral("verify credentials"));
+
     get(
         verify_credentials,
         true,
         this,
         [this, verify_credentials](QNetworkReply *reply) {
+            StartupTrace::instance().end(StartupTrace::scope(this), QStringLiteral("verify credentials"));
+
             if (!reply->isFinished()) {
                 qCWarning(TOKODON_HTTP) << "Authentification reply not finished" << username() << verify_credentials;
                 Q_EMIT authenticated(false, {});
@@ -344,15 +460,27 @@ void Account::validateToken()
 #endif
         },
         [this](QNetworkReply *reply) {
+            StartupTrace::instance().end(StartupTrace::scope(this), QStringLiteral("verify credentials"));
+
             const auto doc = QJsonDocument::fromJson(reply->readAll());
 
             Q_EMIT authenticated(false, doc.isEmpty() ? reply->errorString() : doc["error"_L1].toString());
         });
 
-    fetchInstanceMetadata();
+    loadInstanceMetadata();
+
+    if (m_token.isEmpty()) {
+        return;
+    }
+
+    // Every stream shares one connection, so this reconnects the ones timelines may have subscribed to already
+    m_streaming->setUrl(streamingUrl({}));
 
     // set up streaming for notifications
-    streamingSocket(QStringLiteral("user"));
+    if (!m_subscribedToUserStream) {
+        subscribeToStream(QStringLiteral("user"));
+        m_subscribedToUserStream = true;
+    }
 }
 
 void Account::setConfig(AccountConfig *config)
@@ -368,21 +496,7 @@ void Account::writeToSettings()
     config()->setName(m_name);
     config()->save();
 
-    auto accessTokenJob = new QKeychain::WritePasswordJob{QStringLiteral("Tokodon"), this};
-#ifdef SAILFISHOS
-    accessTokenJob->setInsecureFallback(true);
-#endif
-    accessTokenJob->setKey(accessTokenKey());
-    accessTokenJob->setTextData(m_token);
-    accessTokenJob->start();
-
-    auto clientSecretJob = new QKeychain::WritePasswordJob{QStringLiteral("Tokodon"), this};
-#ifdef SAILFISHOS
-    clientSecretJob->setInsecureFallback(true);
-#endif
-    clientSecretJob->setKey(clientSecretKey());
-    clientSecretJob->setTextData(m_client_secret);
-    clientSecretJob->start();
+    writeCredentials();
 }
 
 void Account::buildFromSettings()
@@ -392,17 +506,36 @@ void Account::buildFromSettings()
     m_client_id = config()->clientId();
     m_name = config()->name();
 
-    auto accessTokenJob = new QKeychain::ReadPasswordJob{QStringLiteral("Tokodon"), this};
+    StartupTrace::instance().begin(StartupTrace::scope(this), QStringLiteral("keychain"));
+
+    // Both secrets are in one entry, so only a single keychain round trip is needed per account
+    auto credentialsJob = new QKeychain::ReadPasswordJob{QStringLiteral("Tokodon"), this};
 #ifdef SAILFISHOS
-    accessTokenJob->setInsecureFallback(true);
+    credentialsJob->setInsecureFallback(true);
 #endif
-    accessTokenJob->setKey(accessTokenKey());
+    credentialsJob->setKey(credentialsKey());
+
+    connect(credentialsJob, &QKeychain::ReadPasswordJob::finished, this, [this, credentialsJob]() {
+        if (credentialsJob->error() == QKeychain::EntryNotFound) {
+            readLegacyCredentials();
+            return;
+        }
 
-    connect(accessTokenJob, &QKeychain::ReadPasswordJob::finished, [this, accessTokenJob]() {
-        setAccessToken(accessTokenJob->textData());
+        const auto obj = QJsonDocument::fromJson(credentialsJob->textData().toUtf8()).object();
+        m_client_secret = obj["client_secret"_L1].toString();
+        finishReadingCredentials(obj["access_token"_L1].toString());
     });
 
-    accessTokenJob->start();
+    credentialsJob->start();
+}
+
+void Account::readLegacyCredentials()
+{
+    auto accessTokenJob = new QKeychain::ReadPasswordJob{QStringLiteral("Tokodon"), this};
+#ifdef SAILFISHOS
+    accessTokenJob->setInsecureFallback(true);
+#endif
+    accessTokenJob->setKey(accessTokenKey());
 
     auto clientSecretJob = new QKeychain::ReadPasswordJob{QStringLiteral("Tokodon"), this};
 #ifdef SAILFISHOS
@@ -410,13 +543,78 @@ void Account::buildFromSettings()
 #endif
     clientSecretJob->setKey(clientSecretKey());
 
-    connect(clientSecretJob, &QKeychain::ReadPasswordJob::finished, [this, clientSecretJob]() {
+    // Wait for both entries, so they can be moved into the combined one
+    auto remainingJobs = std::make_shared<int>(2);
+    auto token = std::make_shared<QString>();
+    const auto jobFinished = [this, remainingJobs, token]() {
+        if (--(*remainingJobs) > 0) {
+            return;
+        }
+
+        finishReadingCredentials(*token);
+        if (!token->isEmpty()) {
+            // Only once they're safe in the combined entry, or they'd be lost
+            writeCredentials([this] {
+                deleteLegacyCredentials();
+            });
+        }
+    };
+
+    connect(accessTokenJob, &QKeychain::ReadPasswordJob::finished, this, [accessTokenJob, token, jobFinished]() {
+        *token = accessTokenJob->textData();
+        jobFinished();
+    });
+
+    connect(clientSecretJob, &QKeychain::ReadPasswordJob::finished, this, [this, clientSecretJob, jobFinished]() {
         m_client_secret = clientSecretJob->textData();
+        jobFinished();
     });
 
+    accessTokenJob->start();
     clientSecretJob->start();
 }
 
+void Account::finishReadingCredentials(const QString &token)
+{
+    StartupTrace::instance().end(StartupTrace::scope(this), QStringLiteral("keychain"));
+    setAccessToken(token);
+}
+
+void Account::deleteLegacyCredentials()
+{
+    for (const QString &key : {accessTokenKey(), clientSecretKey()}) {
+        auto job = new QKeychain::DeletePasswordJob{QStringLiteral("Tokodon"), this};
+#ifdef SAILFISHOS
+        job->setInsecureFallback(true);
+#endif
+        job->setKey(key);
+        job->start();
+    }
+}
+
+void Account::writeCredentials(std::function<void()> written)
+{
+    const QJsonObject obj{
+        {QStringLiteral("access_token"), m_token},
+        {QStringLiteral("client_secret"), m_client_secret},
+    };
+
+    auto credentialsJob = new QKeychain::WritePasswordJob{QStringLiteral("Tokodon"), this};
+#ifdef SAILFISHOS
+    credentialsJob->setInsecureFallback(true);
+#endif
+    credentialsJob->setKey(credentialsKey());
+    credentialsJob->setTextData(QString::fromUtf8(QJsonDocument(obj).toJson(QJsonDocument::Compact)));
+    if (written) {
+        connect(credentialsJob, &QKeychain::WritePasswordJob::finished, this, [credentialsJob, written = std::move(written)]() {
+            if (credentialsJob->error() == QKeychain::NoError) {
+                written();
+            }
+        });
+    }
+    credentialsJob->start();
+}
+
 void Account::checkForFollowRequests()
 {
     get(apiUrl(QStringLiteral("/api/v1/follow_requests")), true, this, [this](QNetworkReply *reply) {
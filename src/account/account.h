@@ -6,8 +6,7 @@
 
 #include "account/abstractaccount.h"
 #include "account/relationship.h"
-
-#include <QWebSocket>
+#include "network/streamingclient.h"
 
 class AccountConfig;
 
@@ -25,7 +24,14 @@ public:
              bool authenticated,
              QObject *parent,
              std::function<void(QNetworkReply *)> callback,
-             std::function<void(QNetworkReply *)> errorCallback = nullptr) override;
+             std::function<void(QNetworkReply *)> errorCallback = nullptr,
+             QHash<QByteArray, QByteArray> headers = {}) override;
+    void getArray(const QUrl &url,
+                  bool authenticated,
+                  QObject *parent,
+                  std::function<void(QNetworkReply *, const QJsonArray &)> elementsCallback,
+                  std::function<void(QNetworkReply *)> callback,
+                  std::function<void(QNetworkReply *)> errorCallback = nullptr) override;
     void post(const QUrl &url,
               const QJsonDocument &doc,
               bool authenticated,
@@ -39,7 +45,12 @@ public:
               QObject *parent,
               std::function<void(QNetworkReply *)> callback,
               std::function<void(QNetworkReply *)> errorCallback) override;
-    QNetworkReply *post(const QUrl &url, QHttpMultiPart *message, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)> callback) override;
+    QNetworkReply *post(const QUrl &url,
+                        QHttpMultiPart *message,
+                        bool authenticated,
+                        QObject *parent,
+                        std::function<void(QNetworkReply *)> callback,
+                        std::function<void(QNetworkReply *)> errorCallback = nullptr) override;
     void put(const QUrl &url, const QJsonDocument &doc, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)> callback) override;
     void put(const QUrl &url, const QUrlQuery &formdata, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)> callback) override;
     void patch(const QUrl &url, QHttpMultiPart *multiPart, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)>) override;
@@ -47,7 +58,13 @@ public:
     QNetworkReply *upload(const QUrl &filename, std::function<void(QNetworkReply *)> callback) override;
     void requestRemoteObject(const QUrl &url, QObject *parent, std::function<void(QNetworkReply *)> callback) override;
 
-    QWebSocket *streamingSocket(const QString &stream);
+    void subscribeToStream(const QString &stream, const QString &parameter = {}) override;
+    void unsubscribeFromStream(const QString &stream, const QString &parameter = {}) override;
+
+    /**
+     * @return The client multiplexing every stream of this account.
+     */
+    [[nodiscard]] StreamingClient *streamingClient() const;
     QNetworkAccessManager *qnam()
     {
         return m_qnam;
@@ -77,13 +94,25 @@ private:
     void unsubscribePushNotifications();
     void subscribePushNotifications();
     QUrlQuery buildNotificationFormData();
+    void handleStreamingEvent(const QString &streamKey, const QString &eventName, const QByteArray &payload);
+    void backfillNotifications();
+
+    // credentials stored before they were combined into a single keychain entry
+    void readLegacyCredentials();
+    void finishReadingCredentials(const QString &token);
+    void deleteLegacyCredentials();
+    // written is only called if the credentials were stored successfully
+    void writeCredentials(std::function<void()> written = nullptr);
 
     QNetworkAccessManager *m_qnam;
-    QMap<QString, QWebSocket *> m_websockets;
+    StreamingClient *m_streaming = nullptr;
+    bool m_subscribedToUserStream = false;
+    QString m_lastStreamedNotificationId;
     bool m_hasPushSubscription = false;
     bool m_authenticated = false;
 
     // common parts for all HTTP request
     [[nodiscard]] QNetworkRequest makeRequest(const QUrl &url, bool authenticated) const;
+    [[nodiscard]] static bool isConditionalRequest(const QNetworkRequest &request);
     void handleReply(QNetworkReply *reply, std::function<void(QNetworkReply *)> reply_cb, std::function<void(QNetworkReply *)> errorCallback = nullptr) const;
 };
@@ -12,6 +12,7 @@
 #include "account/account.h"
 #include "config.h"
 #include "network/networkaccessmanagerfactory.h"
+#include "utils/startuptrace.h"
 #include "tokodon_debug.h"
 
 #include <qt6keychain/keychain.h>
@@ -21,7 +22,7 @@ using namespace Qt::Literals::StringLiterals;
 AccountManager::AccountManager(QObject *parent)
     : QAbstractListModel(parent)
     , m_qnam(NetworkAccessManagerFactory().create(this))
-    , m_notificationHandler(new NotificationHandler(m_qnam, this))
+    , m_notificationHandler(new NotificationHandler(this))
 {
 }
 
@@ -170,6 +171,10 @@ void AccountManager::removeAccount(AbstractAccount *account)
     clientSecretJob->setKey(account->clientSecretKey());
     clientSecretJob->start();
 
+    auto credentialsJob = new QKeychain::DeletePasswordJob{QStringLiteral("Tokodon")};
+    credentialsJob->setKey(account->credentialsKey());
+    credentialsJob->start();
+
     const auto index = m_accounts.indexOf(account);
     beginRemoveRows(QModelIndex(), index, index);
     m_accounts.removeOne(account);
@@ -283,6 +288,15 @@ void AccountManager::loadFromSettings()
 
     qCDebug(TOKODON_LOG) << "Loading accounts from settings.";
 
+    StartupTrace::instance().begin(QStringLiteral("app"), QStringLiteral("load accounts"));
+
+    // old LastUsedAccount values used to be only username
+    const QString lastUsedAccount = Config::self()->lastUsedAccount();
+    const bool isOldVersion = !lastUsedAccount.contains(QLatin1Char('@'));
+    const bool isEmpty = lastUsedAccount.isEmpty() || lastUsedAccount == '@'_L1;
+
+    AbstractAccount *accountToSelect = nullptr;
+
     auto config = KSharedConfig::openStateConfig();
     for (const auto &id : config->groupList()) {
         if (id.contains('@'_L1)) {
@@ -302,12 +316,25 @@ void AccountManager::loadFromSettings()
                 continue;
             }
 
+            // Every account loads concurrently, but the UI only waits on this one
+            const bool matchesNewFormat = id == lastUsedAccount;
+            const bool matchesOldFormat = accountConfig->name() == lastUsedAccount;
+            const bool isLastUsed = isEmpty || (isOldVersion ? matchesOldFormat : matchesNewFormat);
+
             const auto account = new Account(accountConfig->instanceUri(), m_qnam, this);
             account->setConfig(accountConfig);
             addAccount(account);
+
+            if (!accountToSelect && isLastUsed) {
+                accountToSelect = account;
+            }
         }
     }
 
+    if (accountToSelect) {
+        selectAccount(accountToSelect, false);
+    }
+
     checkIfLoadingFinished();
 }
 
@@ -315,42 +342,48 @@ void AccountManager::checkIfLoadingFinished()
 {
     // no accounts at all
     if (m_accountStatus.empty()) {
-        m_ready = true;
-        Q_EMIT accountsReady();
+        setReady();
+        if (!m_allAccountsLoaded) {
+            m_allAccountsLoaded = true;
+            Q_EMIT allAccountsLoaded();
+        }
         return;
     }
 
+    // The selected account is enough to show the UI, the others can finish in the background
+    if (!m_ready) {
+        // Without a last used account, the first one is what gets shown
+        const qsizetype selectedIndex = std::max<qsizetype>(m_accounts.indexOf(m_selected_account), 0);
+        if (selectedIndex >= m_accountStatus.size() || m_accountStatus[selectedIndex] != AccountStatus::NotLoaded) {
+            qCDebug(TOKODON_LOG) << "Selected account has finished loading.";
+            setReady();
+        }
+    }
+
     // ensure every account is loaded, or has an error
     const bool finished = std::ranges::none_of(std::as_const(m_accountStatus), [](const auto status) {
         return status == AccountStatus::NotLoaded;
     });
-    if (!finished) {
+    if (!finished || m_allAccountsLoaded) {
         return;
     }
 
     qCDebug(TOKODON_LOG) << "Accounts have finished loading.";
 
-    auto config = Config::self();
-
-    // Test code manually selects the account
-    if (!m_testMode) {
-        for (auto account : m_accounts) {
-            // old LastUsedAccount values used to be only username
-            const bool isOldVersion = !config->lastUsedAccount().contains(QLatin1Char('@'));
-            const bool isEmpty = config->lastUsedAccount().isEmpty() || config->lastUsedAccount() == '@'_L1;
-            const bool matchesNewFormat = account->settingsGroupName() == config->lastUsedAccount();
-            const bool matchesOldFormat = account->username() == config->lastUsedAccount();
-
-            const bool isValid = isEmpty || (isOldVersion ? matchesOldFormat : matchesNewFormat);
+    m_allAccountsLoaded = true;
+    StartupTrace::instance().end(QStringLiteral("app"), QStringLiteral("load accounts"));
+    StartupTrace::instance().finish();
+    Q_EMIT allAccountsLoaded();
+}
 
-            if (isValid) {
-                selectAccount(account, false);
-                break;
-            }
-        }
+void AccountManager::setReady()
+{
+    if (m_ready) {
+        return;
     }
 
     m_ready = true;
+    StartupTrace::instance().mark(QStringLiteral("app"), QStringLiteral("ready"));
     Q_EMIT accountsReady();
 }
 
@@ -384,6 +417,15 @@ QString AccountManager::accessTokenKey(const QString &name)
 #endif
 }
 
+QString AccountManager::credentialsKey(const QString &name)
+{
+#ifdef TOKODON_FLATPAK
+    return QStringLiteral("%1-flatpak-credentials").arg(name);
+#else
+    return QStringLiteral("%1-credentials").arg(name);
+#endif
+}
+
 void AccountManager::migrateSettings()
 {
     if (m_testMode) {
@@ -77,8 +77,9 @@ public:
     [[nodiscard]] bool testMode() const;
 
     /**
-     * @return Whether or not the account manager is completely ready.
-     * @note This doesn't mean it has accounts, simply that it's done reading configs and the keychain.
+     * @return Whether or not the account manager is ready to show the UI.
+     * @note This doesn't mean it has accounts, simply that it's done reading configs and the selected account finished loading. Other accounts may
+     * still be loading, see allAccountsLoaded().
      */
     [[nodiscard]] bool isReady() const;
 
@@ -191,6 +192,13 @@ public:
      */
     static QString accessTokenKey(const QString &name);
 
+    /**
+     * @note It's preferred to use AbstractAccount::credentialsKey as it fills in the relevant information.
+     * @param name The settings group name, from AbstractAccount::settingsGroupName().
+     * @return The preferred key name for the combined access token and client secret.
+     */
+    static QString credentialsKey(const QString &name);
+
     /**
      * @return The list of accounts
      */
@@ -205,6 +213,11 @@ Q_SIGNALS:
 
     void accountsReady();
 
+    /**
+     * @brief Emitted once every account has finished loading, or failed to.
+     */
+    void allAccountsLoaded();
+
     void accountsReloaded();
 
     void accountSelected(AbstractAccount *account);
@@ -234,8 +247,10 @@ private:
     NotificationHandler *m_notificationHandler;
 
     bool m_ready = false;
+    bool m_allAccountsLoaded = false;
     bool m_hasAnyAccounts = false;
     bool m_testMode = false;
 
     void checkIfLoadingFinished();
+    void setReady();
 };
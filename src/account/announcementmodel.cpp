@@ -75,12 +75,11 @@ void AnnouncementModel::fillTimeline()
     }
     setLoading(true);
 
-    account->get(
+    account->getCached(
         account->apiUrl(QStringLiteral("/api/v1/announcements")),
         true,
         this,
-        [this](QNetworkReply *reply) {
-            const auto doc = QJsonDocument::fromJson(reply->readAll());
+        [this](const QJsonDocument &doc) {
             auto announcements = doc.array().toVariantList();
             std::ranges::reverse(announcements);
 
@@ -74,12 +74,11 @@ void FiltersModel::fillTimeline()
     m_filters.clear();
     endResetModel();
 
-    account->get(
+    account->getCached(
         account->apiUrl(QStringLiteral("/api/v2/filters")),
         true,
         this,
-        [this](QNetworkReply *reply) {
-            const auto doc = QJsonDocument::fromJson(reply->readAll());
+        [this](const QJsonDocument &doc) {
             auto filters = doc.array().toVariantList();
 
             if (!filters.isEmpty()) {
@@ -135,7 +135,7 @@ void Identity::fromSourceData(const QJsonObject &doc)
 
     m_displayNameHtml = m_displayName.replace(QLatin1Char('<'), QStringLiteral("&lt;")).replace(QLatin1Char('>'), QStringLiteral("&gt;"));
 
-    const auto emojis = CustomEmoji::parseCustomEmojis(doc["emojis"_L1].toArray());
+    const auto emojis = CustomEmoji::parseCustomEmojiUrls(doc["emojis"_L1].toArray(), m_parent ? &m_parent->customEmojiCache() : nullptr);
 
     m_displayNameHtml = TextHandler::replaceCustomEmojis(emojis, m_displayNameHtml);
     m_bio = TextHandler::replaceCustomEmojis(emojis, m_bio);
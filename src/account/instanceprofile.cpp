@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/instanceprofile.h"
+
+#include "account/abstractaccount.h"
+#include "account/accountmanager.h"
+
+#include <KConfigGroup>
+#include <KSharedConfig>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+using namespace Qt::Literals::StringLiterals;
+
+// How long a stored profile is used before it's refreshed in the background
+constexpr qint64 refreshIntervalSecs = 24 * 60 * 60;
+
+static KSharedConfig::Ptr profileConfig()
+{
+    return KSharedConfig::openStateConfig(QStringLiteral("tokodoninstancesrc"));
+}
+
+bool InstanceProfile::isValid() const
+{
+    return fetchedAt.isValid();
+}
+
+InstanceProfile InstanceProfile::fromJson(const QJsonObject &obj)
+{
+    InstanceProfile profile;
+
+    const auto configObj = obj["configuration"_L1].toObject();
+
+    const auto statusConfigObj = configObj["statuses"_L1].toObject();
+    profile.maxPostLength = statusConfigObj["max_characters"_L1].toInt(static_cast<int>(profile.maxPostLength));
+    profile.charactersReservedPerUrl = statusConfigObj["characters_reserved_per_url"_L1].toInt(static_cast<int>(profile.charactersReservedPerUrl));
+    profile.maxMediaAttachments = statusConfigObj["max_media_attachments"_L1].toInt(profile.maxMediaAttachments);
+
+    const auto mediaConfigObj = configObj["media_attachments"_L1].toObject();
+    for (const auto &mimeType : mediaConfigObj["supported_mime_types"_L1].toArray()) {
+        profile.supportedMimeTypes.push_back(mimeType.toString());
+    }
+    profile.imageMatrixLimit = mediaConfigObj["image_matrix_limit"_L1].toInteger(profile.imageMatrixLimit);
+    profile.imageSizeLimit = mediaConfigObj["image_size_limit"_L1].toInteger(profile.imageSizeLimit);
+
+    // Pleroma/Akkoma may report maximum post characters here, instead
+    if (obj.contains("max_toot_chars"_L1)) {
+        profile.maxPostLength = obj["max_toot_chars"_L1].toInt();
+    }
+
+    // Pleroma/Akkoma can report higher poll limits
+    if (obj.contains("poll_limits"_L1)) {
+        profile.maxPollOptions = obj["poll_limits"_L1].toObject()["max_options"_L1].toInt();
+    }
+
+    // Other instance of poll options
+    if (configObj.contains("polls"_L1)) {
+        profile.maxPollOptions = configObj["polls"_L1].toObject()["max_options"_L1].toInt(static_cast<int>(profile.maxPollOptions));
+    }
+    if (obj.contains("polls"_L1)) {
+        profile.maxPollOptions = obj["polls"_L1].toObject()["max_options"_L1].toInt();
+    }
+
+    // v2 reports an object with an optional message, v1 only a boolean
+    const auto registrations = obj["registrations"_L1];
+    if (registrations.isObject()) {
+        profile.registrationsOpen = registrations["enabled"_L1].toBool();
+        profile.registrationMessage = registrations["message"_L1].toString();
+    } else {
+        profile.registrationsOpen = registrations.toBool();
+    }
+
+    profile.supportsLocalVisibility = obj.contains("pleroma"_L1);
+
+    const QString version = obj["version"_L1].toString();
+    const QString sourceUrl = obj["source_url"_L1].toString();
+    if (profile.supportsLocalVisibility || version.contains("Pleroma"_L1) || version.contains("Akkoma"_L1)) {
+        profile.software = Software::Pleroma;
+    } else if (sourceUrl.contains("gotosocial"_L1, Qt::CaseInsensitive) || version.contains("gotosocial"_L1, Qt::CaseInsensitive)) {
+        profile.software = Software::GoToSocial;
+    } else if (!version.isEmpty()) {
+        profile.software = Software::Mastodon;
+    }
+
+    profile.name = obj["title"_L1].toString();
+
+    return profile;
+}
+
+InstanceProfileStore::InstanceProfileStore(QObject *parent)
+    : QObject(parent)
+{
+}
+
+InstanceProfileStore &InstanceProfileStore::instance()
+{
+    static InstanceProfileStore _instance;
+    return _instance;
+}
+
+InstanceProfile InstanceProfileStore::profile(const QString &host)
+{
+    if (host.isEmpty()) {
+        return {};
+    }
+
+    if (const auto it = m_profiles.constFind(host); it != m_profiles.cend()) {
+        return *it;
+    }
+
+    InstanceProfile profile;
+
+    // Test code should never pick up profiles from a real session
+    if (!AccountManager::instance().testMode()) {
+        const auto group = profileConfig()->group(host);
+        if (group.exists()) {
+            profile.name = group.readEntry("Name", profile.name);
+            profile.maxPostLength = group.readEntry("MaxPostLength", static_cast<int>(profile.maxPostLength));
+            profile.charactersReservedPerUrl = group.readEntry("CharactersReservedPerUrl", static_cast<int>(profile.charactersReservedPerUrl));
+            profile.maxPollOptions = group.readEntry("MaxPollOptions", static_cast<int>(profile.maxPollOptions));
+            profile.maxMediaAttachments = group.readEntry("MaxMediaAttachments", profile.maxMediaAttachments);
+            profile.supportedMimeTypes = group.readEntry("SupportedMimeTypes", QStringList{});
+            profile.imageMatrixLimit = group.readEntry("ImageMatrixLimit", profile.imageMatrixLimit);
+            profile.imageSizeLimit = group.readEntry("ImageSizeLimit", profile.imageSizeLimit);
+            profile.supportsLocalVisibility = group.readEntry("SupportsLocalVisibility", profile.supportsLocalVisibility);
+            profile.software = static_cast<InstanceProfile::Software>(group.readEntry("Software", static_cast<int>(profile.software)));
+            profile.registrationsOpen = group.readEntry("RegistrationsOpen", profile.registrationsOpen);
+            profile.registrationMessage = group.readEntry("RegistrationMessage", profile.registrationMessage);
+            profile.fetchedAt = group.readEntry("FetchedAt", QDateTime());
+        }
+    }
+
+    m_profiles.insert(host, profile);
+    return profile;
+}
+
+bool InstanceProfileStore::isStale(const QString &host)
+{
+    const auto stored = profile(host);
+    return !stored.isValid() || stored.fetchedAt.secsTo(QDateTime::currentDateTimeUtc()) > refreshIntervalSecs;
+}
+
+void InstanceProfileStore::refresh(AbstractAccount *account, const bool force)
+{
+    const QString host = QUrl::fromUserInput(account->instanceUri()).host();
+
+    // Another account on the same instance is already fetching it
+    if (const auto it = m_pendingHosts.constFind(host); it != m_pendingHosts.cend() && !it->isNull()) {
+        return;
+    }
+
+    if (!force && !isStale(host)) {
+        return;
+    }
+
+    m_pendingHosts.insert(host, account);
+    fetch(account, host, QStringLiteral("/api/v2/instance"), true);
+}
+
+void InstanceProfileStore::fetch(AbstractAccount *account, const QString &host, const QString &path, const bool fallback)
+{
+    account->getCached(
+        account->apiUrl(path),
+        false,
+        account,
+        [this, host](const QJsonDocument &doc) {
+            m_pendingHosts.remove(host);
+
+            if (!doc.isObject()) {
+                return;
+            }
+
+            store(host, InstanceProfile::fromJson(doc.object()));
+        },
+        [this, account, host, fallback](QNetworkReply *) {
+            if (fallback) {
+                // Fall back to v1 instance information
+                fetch(account, host, QStringLiteral("/api/v1/instance"), false);
+            } else {
+                m_pendingHosts.remove(host);
+            }
+        });
+}
+
+void InstanceProfileStore::store(const QString &host, const InstanceProfile &profile)
+{
+    auto &stored = m_profiles[host];
+    stored = profile;
+    stored.fetchedAt = QDateTime::currentDateTimeUtc();
+
+    if (!host.isEmpty() && !AccountManager::instance().testMode()) {
+        auto config = profileConfig();
+        auto group = config->group(host);
+        group.writeEntry("Name", stored.name);
+        group.writeEntry("MaxPostLength", static_cast<int>(stored.maxPostLength));
+        group.writeEntry("CharactersReservedPerUrl", static_cast<int>(stored.charactersReservedPerUrl));
+        group.writeEntry("MaxPollOptions", static_cast<int>(stored.maxPollOptions));
+        group.writeEntry("MaxMediaAttachments", stored.maxMediaAttachments);
+        group.writeEntry("SupportedMimeTypes", stored.supportedMimeTypes);
+        group.writeEntry("ImageMatrixLimit", stored.imageMatrixLimit);
+        group.writeEntry("ImageSizeLimit", stored.imageSizeLimit);
+        group.writeEntry("SupportsLocalVisibility", stored.supportsLocalVisibility);
+        group.writeEntry("Software", static_cast<int>(stored.software));
+        group.writeEntry("RegistrationsOpen", stored.registrationsOpen);
+        group.writeEntry("RegistrationMessage", stored.registrationMessage);
+        group.writeEntry("FetchedAt", stored.fetchedAt);
+        config->sync();
+    }
+
+    Q_EMIT profileChanged(host);
+}
+
+#include "moc_instanceprofile.cpp"
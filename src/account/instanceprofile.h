@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QDateTime>
+#include <QHash>
+#include <QJsonObject>
+#include <QObject>
+#include <QPointer>
+#include <QStringList>
+
+class AbstractAccount;
+
+/**
+ * @brief The capabilities of an instance, as reported by its instance metadata.
+ */
+struct InstanceProfile {
+    /**
+     * @brief The server software the instance is running.
+     */
+    enum class Software {
+        Unknown, /**< The software could not be determined. */
+        Mastodon, /**< Mastodon, or something that is compatible enough. */
+        Pleroma, /**< Pleroma or one of its forks, like Akkoma. */
+        GoToSocial, /**< GoToSocial. */
+    };
+
+    QString name;
+    size_t maxPostLength = 500; // default to 500, instances which support more signal it
+    size_t charactersReservedPerUrl = 23;
+    size_t maxPollOptions = 4;
+    int maxMediaAttachments = 4;
+    QStringList supportedMimeTypes;
+    qint64 imageMatrixLimit = 0; // in pixels, 0 if the instance doesn't say
+    qint64 imageSizeLimit = 0; // in bytes, 0 if the instance doesn't say
+    bool supportsLocalVisibility = false;
+    Software software = Software::Unknown;
+    bool registrationsOpen = false;
+    QString registrationMessage;
+    QDateTime fetchedAt;
+
+    /**
+     * @return If this profile was ever fetched from the instance.
+     */
+    [[nodiscard]] bool isValid() const;
+
+    /**
+     * @brief Parses either the v1 or the v2 instance metadata in @p obj.
+     */
+    static InstanceProfile fromJson(const QJsonObject &obj);
+};
+
+/**
+ * @brief Persists the InstanceProfile of every known instance, so they're available synchronously on startup.
+ *
+ * Profiles are refreshed in the background once they are older than a day. Accounts on the same instance share a single fetch.
+ */
+class InstanceProfileStore : public QObject
+{
+    Q_OBJECT
+
+public:
+    static InstanceProfileStore &instance();
+
+    /**
+     * @return The last known profile for @p host, or a default profile if it was never fetched.
+     */
+    InstanceProfile profile(const QString &host);
+
+    /**
+     * @return If the profile for @p host is missing or older than the refresh interval.
+     */
+    bool isStale(const QString &host);
+
+    /**
+     * @brief Fetches the instance metadata for @p account's instance, unless it's still fresh or already being fetched.
+     * @param account The account to fetch the metadata through.
+     * @param force Whether to fetch the metadata even if the stored profile is still fresh.
+     */
+    void refresh(AbstractAccount *account, bool force = false);
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when a new profile for @p host has been fetched.
+     */
+    void profileChanged(const QString &host);
+
+private:
+    explicit InstanceProfileStore(QObject *parent = nullptr);
+
+    void fetch(AbstractAccount *account, const QString &host, const QString &path, bool fallback);
+    void store(const QString &host, const InstanceProfile &profile);
+
+    QHash<QString, InstanceProfile> m_profiles;
+    QHash<QString, QPointer<AbstractAccount>> m_pendingHosts;
+};
@@ -0,0 +1,353 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/interactionqueue.h"
+
+#include "account/abstractaccount.h"
+#include "timeline/post.h"
+
+#include <KLocalizedString>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QMetaEnum>
+#include <QNetworkInformation>
+#include <QNetworkReply>
+
+#include <algorithm>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+// Boosts, bookmarks and pins show up in the home timeline
+bool deliversHome(const InteractionQueue::Kind kind, const bool enabled)
+{
+    return enabled && (kind == InteractionQueue::Reblog || kind == InteractionQueue::Bookmark || kind == InteractionQueue::Pin);
+}
+
+QString failureMessage(const InteractionQueue::Kind kind, const bool enabled, const QString &error)
+{
+    switch (kind) {
+    case InteractionQueue::Favourite:
+        return enabled ? i18nc("@info:status", "Could not favorite the post: %1", error) : i18nc("@info:status", "Could not unfavorite the post: %1", error);
+    case InteractionQueue::Reblog:
+        return enabled ? i18nc("@info:status", "Could not boost the post: %1", error) : i18nc("@info:status", "Could not unboost the post: %1", error);
+    case InteractionQueue::Bookmark:
+        return enabled ? i18nc("@info:status", "Could not bookmark the post: %1", error) : i18nc("@info:status", "Could not remove the bookmark: %1", error);
+    case InteractionQueue::Pin:
+        return enabled ? i18nc("@info:status", "Could not pin the post: %1", error) : i18nc("@info:status", "Could not unpin the post: %1", error);
+    case InteractionQueue::Mute:
+        return enabled ? i18nc("@info:status", "Could not mute the conversation: %1", error)
+                       : i18nc("@info:status", "Could not unmute the conversation: %1", error);
+    }
+    return error;
+}
+}
+
+InteractionQueue::InteractionQueue(AbstractAccount *account)
+    : QObject(account)
+    , m_account(account)
+{
+    m_batchTimer.setSingleShot(true);
+    m_batchTimer.setInterval(std::chrono::milliseconds(300));
+    connect(&m_batchTimer, &QTimer::timeout, this, &InteractionQueue::flush);
+
+    m_retryTimer.setSingleShot(true);
+    connect(&m_retryTimer, &QTimer::timeout, this, &InteractionQueue::flush);
+
+    // The queue is stored in the account's settings, which are only available once we know who it is
+    connect(account, &AbstractAccount::authenticated, this, [this](const bool successful) {
+        if (successful) {
+            restore();
+            flush();
+        }
+    });
+
+    if (QNetworkInformation::loadBackendByFeatures(QNetworkInformation::Feature::Reachability)) {
+        connect(QNetworkInformation::instance(), &QNetworkInformation::reachabilityChanged, this, [this](const QNetworkInformation::Reachability reachability) {
+            if (reachability == QNetworkInformation::Reachability::Online) {
+                // Being offline isn't the interaction's fault
+                m_retries = 0;
+                for (auto &interaction : m_queue) {
+                    interaction.attempts = 0;
+                }
+                flush();
+            }
+        });
+    }
+}
+
+void InteractionQueue::enqueue(const QString &postId, const Kind kind, const bool enabled)
+{
+    restore();
+
+    const auto it = find(postId, kind);
+    if (it == m_queue.end()) {
+        m_queue.push_back(Interaction{.postId = postId, .kind = kind, .enabled = enabled, .previous = !enabled});
+    } else if (it->inFlight) {
+        it->followUp = enabled;
+    } else if (enabled == it->previous) {
+        // Toggled back before it was sent, so there's nothing left to do
+        m_queue.erase(it);
+    } else {
+        it->enabled = enabled;
+    }
+
+    save();
+    Q_EMIT interactionChanged(postId, kind, enabled);
+    Q_EMIT pendingCountChanged();
+
+    if (!m_batchTimer.isActive()) {
+        m_batchTimer.start();
+    }
+}
+
+void InteractionQueue::flush()
+{
+    m_batchTimer.stop();
+    if (!isOnline()) {
+        return;
+    }
+
+    // Sending may finish right away and change the queue, so don't iterate over it directly
+    QList<std::pair<QString, Kind>> waiting;
+    for (const auto &interaction : std::as_const(m_queue)) {
+        if (!interaction.inFlight) {
+            waiting.push_back({interaction.postId, interaction.kind});
+        }
+    }
+
+    for (const auto &[postId, kind] : std::as_const(waiting)) {
+        const auto it = find(postId, kind);
+        if (it != m_queue.end() && !it->inFlight) {
+            send(*it);
+        }
+    }
+}
+
+qsizetype InteractionQueue::pendingCount() const
+{
+    return m_queue.size();
+}
+
+std::optional<bool> InteractionQueue::pendingState(const QString &postId, const Kind kind) const
+{
+    for (const auto &interaction : m_queue) {
+        if (interaction.postId == postId && interaction.kind == kind) {
+            return interaction.followUp.value_or(interaction.enabled);
+        }
+    }
+    return std::nullopt;
+}
+
+void InteractionQueue::setBatchDelay(const std::chrono::milliseconds delay)
+{
+    m_batchTimer.setInterval(delay);
+}
+
+void InteractionQueue::setRetryDelay(const std::chrono::milliseconds initial, const std::chrono::milliseconds max)
+{
+    m_initialRetryDelay = initial;
+    m_maxRetryDelay = max;
+}
+
+void InteractionQueue::setMaxAttempts(const int attempts)
+{
+    m_maxAttempts = std::max(attempts, 1);
+}
+
+QString InteractionQueue::verb(const Kind kind, const bool enabled)
+{
+    switch (kind) {
+    case Favourite:
+        return enabled ? u"favourite"_s : u"unfavourite"_s;
+    case Reblog:
+        return enabled ? u"reblog"_s : u"unreblog"_s;
+    case Bookmark:
+        return enabled ? u"bookmark"_s : u"unbookmark"_s;
+    case Pin:
+        return enabled ? u"pin"_s : u"unpin"_s;
+    case Mute:
+        return enabled ? u"mute"_s : u"unmute"_s;
+    }
+    return {};
+}
+
+std::optional<std::pair<InteractionQueue::Kind, bool>> InteractionQueue::fromVerb(const QString &verb)
+{
+    const auto kinds = QMetaEnum::fromType<Kind>();
+    for (int i = 0; i < kinds.keyCount(); i++) {
+        const auto kind = static_cast<Kind>(kinds.value(i));
+        for (const bool enabled : {true, false}) {
+            if (InteractionQueue::verb(kind, enabled) == verb) {
+                return std::pair{kind, enabled};
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+bool InteractionQueue::isTransientFailure(const QNetworkReply *reply)
+{
+    // No status at all means the server couldn't be reached
+    const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    return statusCode == 0 || statusCode == 408 || statusCode == 429 || statusCode >= 500;
+}
+
+bool InteractionQueue::isOnline() const
+{
+    const auto information = QNetworkInformation::instance();
+    return !information || information->reachability() != QNetworkInformation::Reachability::Disconnected;
+}
+
+void InteractionQueue::send(Interaction &interaction)
+{
+    interaction.inFlight = true;
+    interaction.attempts++;
+
+    const QString postId = interaction.postId;
+    const Kind kind = interaction.kind;
+
+    m_account->post(
+        m_account->apiUrl(u"/api/v1/statuses/%1/%2"_s.arg(postId, verb(kind, interaction.enabled))),
+        QJsonDocument{},
+        true,
+        this,
+        [this, postId, kind](QNetworkReply *reply) {
+            delivered(postId, kind, reply);
+        },
+        [this, postId, kind](const QNetworkReply *reply) {
+            failed(postId, kind, reply);
+        });
+}
+
+void InteractionQueue::delivered(const QString &postId, const Kind kind, QNetworkReply *reply)
+{
+    const auto it = find(postId, kind);
+    if (it == m_queue.end()) {
+        return;
+    }
+
+    const Interaction interaction = *it;
+    m_queue.erase(it);
+    m_retries = 0;
+
+    if (deliversHome(kind, interaction.enabled)) {
+        const auto doc = QJsonDocument::fromJson(reply->readAll());
+        Q_EMIT m_account->fetchedTimeline(u"home"_s, {new Post(m_account, doc.object(), m_account)});
+    }
+
+    // It was toggled again while being sent
+    if (interaction.followUp && *interaction.followUp != interaction.enabled) {
+        m_queue.push_back(Interaction{.postId = postId, .kind = kind, .enabled = *interaction.followUp, .previous = interaction.enabled});
+        send(m_queue.last());
+    }
+
+    save();
+    Q_EMIT pendingCountChanged();
+}
+
+void InteractionQueue::failed(const QString &postId, const Kind kind, const QNetworkReply *reply)
+{
+    const auto it = find(postId, kind);
+    if (it == m_queue.end()) {
+        return;
+    }
+
+    it->inFlight = false;
+    if (it->followUp) {
+        it->enabled = *std::exchange(it->followUp, std::nullopt);
+    }
+
+    // Try again when the network or the server was in the way, unless it was toggled back and there's nothing left to deliver
+    if (isTransientFailure(reply) && it->enabled != it->previous && it->attempts < m_maxAttempts) {
+        scheduleRetry();
+        save();
+        return;
+    }
+
+    // The server won't accept it no matter how often we ask, or couldn't be reached for too long, so put things back the way they were
+    const Interaction interaction = *it;
+    m_queue.erase(it);
+    save();
+    Q_EMIT pendingCountChanged();
+
+    if (interaction.enabled != interaction.previous) {
+        Q_EMIT interactionChanged(postId, kind, interaction.previous);
+        Q_EMIT m_account->errorOccured(failureMessage(kind, interaction.enabled, reply->errorString()));
+    }
+}
+
+void InteractionQueue::scheduleRetry()
+{
+    if (m_retryTimer.isActive()) {
+        return;
+    }
+
+    const auto delay = std::min(m_initialRetryDelay * (1 << std::min(m_retries, 16)), m_maxRetryDelay);
+    m_retries++;
+    m_retryTimer.start(delay);
+}
+
+QList<InteractionQueue::Interaction>::iterator InteractionQueue::find(const QString &postId, const Kind kind)
+{
+    return std::ranges::find_if(m_queue, [&postId, kind](const Interaction &interaction) {
+        return interaction.postId == postId && interaction.kind == kind;
+    });
+}
+
+void InteractionQueue::restore()
+{
+    if (m_restored || !m_account->config()) {
+        return;
+    }
+    m_restored = true;
+
+    const auto kinds = QMetaEnum::fromType<Kind>();
+    const auto stored = QJsonDocument::fromJson(m_account->config()->pendingInteractions().toUtf8()).array();
+    for (const auto &value : stored) {
+        const auto object = value.toObject();
+        const QString postId = object["postId"_L1].toString();
+        bool validKind = false;
+        const auto kind = static_cast<Kind>(kinds.keyToValue(object["kind"_L1].toString().toLatin1().constData(), &validKind));
+
+        if (!validKind || postId.isEmpty() || find(postId, kind) != m_queue.end()) {
+            continue;
+        }
+        m_queue.push_back(Interaction{.postId = postId,
+                                      .kind = kind,
+                                      .enabled = object["enabled"_L1].toBool(),
+                                      .previous = object["previous"_L1].toBool(),
+                                      .attempts = object["attempts"_L1].toInt()});
+    }
+
+    if (!stored.isEmpty()) {
+        Q_EMIT pendingCountChanged();
+    }
+}
+
+void InteractionQueue::save()
+{
+    auto config = m_account->config();
+    if (!config) {
+        return;
+    }
+
+    const auto kinds = QMetaEnum::fromType<Kind>();
+    QJsonArray stored;
+    for (const auto &interaction : std::as_const(m_queue)) {
+        stored.push_back(QJsonObject{
+            {u"postId"_s, interaction.postId},
+            {u"kind"_s, QString::fromLatin1(kinds.valueToKey(interaction.kind))},
+            // What was asked last is what should eventually be delivered
+            {u"enabled"_s, interaction.followUp.value_or(interaction.enabled)},
+            {u"previous"_s, interaction.previous},
+            {u"attempts"_s, interaction.attempts},
+        });
+    }
+
+    config->setPendingInteractions(QString::fromUtf8(QJsonDocument(stored).toJson(QJsonDocument::Compact)));
+    config->save();
+}
+
+#include "moc_interactionqueue.cpp"
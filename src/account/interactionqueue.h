@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+
+#include <chrono>
+#include <optional>
+
+class AbstractAccount;
+class QNetworkReply;
+
+/**
+ * @brief Delivers favourites, boosts, bookmarks, pins and mutes of an account's posts.
+ *
+ * Interactions are shown right away through interactionChanged(), and sent in the background shortly after, so toggling the same thing twice
+ * in a row cancels both without asking the server. Models only update their posts from interactionChanged(), so every one showing a post
+ * agrees on its state.
+ *
+ * Interactions which can't be delivered because of the network or the server are retried with an exponential backoff, and as soon as the
+ * network is back. One that still fails after a number of attempts is given up on and rolled back. The queue is saved in the account's
+ * settings, so nothing is lost when quitting while offline.
+ *
+ * If the server rejects an interaction, it's rolled back and the account's errorOccured() signal is emitted.
+ */
+class InteractionQueue : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Kind {
+        Favourite,
+        Reblog,
+        Bookmark,
+        Pin,
+        Mute,
+    };
+    Q_ENUM(Kind)
+
+    explicit InteractionQueue(AbstractAccount *account);
+
+    /**
+     * @brief Queue setting @p kind of the post @p postId to @p enabled.
+     */
+    void enqueue(const QString &postId, Kind kind, bool enabled);
+
+    /**
+     * @brief Sends everything that isn't on its way already, without waiting for the next retry.
+     */
+    void flush();
+
+    /**
+     * @return How many interactions weren't delivered yet.
+     */
+    [[nodiscard]] qsizetype pendingCount() const;
+
+    /**
+     * @return The state @p kind of @p postId will have once delivered, if it's still pending.
+     */
+    [[nodiscard]] std::optional<bool> pendingState(const QString &postId, Kind kind) const;
+
+    /**
+     * @brief Wait @p delay after an interaction before sending it, to catch it being undone.
+     */
+    void setBatchDelay(std::chrono::milliseconds delay);
+
+    /**
+     * @brief Wait @p initial before the first retry, doubling up to @p max for the following ones.
+     */
+    void setRetryDelay(std::chrono::milliseconds initial, std::chrono::milliseconds max);
+
+    /**
+     * @brief Roll an interaction back once it couldn't be delivered @p attempts times in a row while online.
+     */
+    void setMaxAttempts(int attempts);
+
+    /**
+     * @return The kind and state @p verb of the statuses API stands for, like "unreblog".
+     */
+    [[nodiscard]] static std::optional<std::pair<Kind, bool>> fromVerb(const QString &verb);
+
+Q_SIGNALS:
+    /**
+     * @brief The state of @p kind of the post @p postId changed, either because it was queued or rolled back.
+     */
+    void interactionChanged(const QString &postId, InteractionQueue::Kind kind, bool enabled);
+
+    void pendingCountChanged();
+
+private:
+    struct Interaction {
+        QString postId;
+        Kind kind = Favourite;
+        bool enabled = false;
+        bool previous = false; ///< The state on the server before, to roll back to.
+        std::optional<bool> followUp; ///< Set while being sent, if it was toggled again in the meantime.
+        bool inFlight = false;
+        int attempts = 0; ///< Since the network was last back.
+    };
+
+    [[nodiscard]] static QString verb(Kind kind, bool enabled);
+    [[nodiscard]] static bool isTransientFailure(const QNetworkReply *reply);
+    [[nodiscard]] bool isOnline() const;
+
+    void send(Interaction &interaction);
+    void delivered(const QString &postId, Kind kind, QNetworkReply *reply);
+    void failed(const QString &postId, Kind kind, const QNetworkReply *reply);
+    void scheduleRetry();
+
+    QList<Interaction>::iterator find(const QString &postId, Kind kind);
+    void restore();
+    void save();
+
+    AbstractAccount *const m_account;
+    QList<Interaction> m_queue;
+    bool m_restored = false;
+
+    QTimer m_batchTimer;
+    QTimer m_retryTimer;
+    std::chrono::milliseconds m_initialRetryDelay{2000};
+    std::chrono::milliseconds m_maxRetryDelay{std::chrono::minutes(5)};
+    int m_retries = 0;
+    int m_maxAttempts = 10;
+};
@@ -74,12 +74,11 @@ void ListsModel::fillTimeline()
     m_lists.clear();
     endResetModel();
 
-    account->get(
+    account->getCached(
         account->apiUrl(QStringLiteral("/api/v1/lists")),
         true,
         this,
-        [this](QNetworkReply *reply) {
-            const auto doc = QJsonDocument::fromJson(reply->readAll());
+        [this](const QJsonDocument &doc) {
             auto lists = doc.array().toVariantList();
 
             if (!lists.isEmpty()) {
@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/markersync.h"
+
+#include "account/abstractaccount.h"
+
+#include <QGuiApplication>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QNetworkReply>
+#include <QUrlQuery>
+
+using namespace Qt::Literals::StringLiterals;
+
+MarkerSync::MarkerSync(AbstractAccount *account)
+    : QObject(account)
+    , m_account(account)
+{
+    m_debounceTimer.setSingleShot(true);
+    m_debounceTimer.setInterval(std::chrono::seconds(5));
+    connect(&m_debounceTimer, &QTimer::timeout, this, &MarkerSync::flush);
+
+    // Don't wait for the timer if we may not get the chance to
+    if (const auto app = qobject_cast<QGuiApplication *>(QCoreApplication::instance())) {
+        connect(app, &QGuiApplication::applicationStateChanged, this, [this](const Qt::ApplicationState state) {
+            if (state == Qt::ApplicationSuspended || state == Qt::ApplicationHidden) {
+                flush();
+            }
+        });
+    }
+
+    // Probably won't finish before we're gone, but what's pending is saved and sent again on the next start anyway
+    if (const auto app = QCoreApplication::instance()) {
+        connect(app, &QCoreApplication::aboutToQuit, this, &MarkerSync::flush);
+    }
+
+    // The pending markers are stored in the account's settings, which are only available once we know who it is
+    connect(account, &AbstractAccount::authenticated, this, [this](const bool successful) {
+        if (successful) {
+            restore();
+            fetch();
+        }
+    });
+}
+
+void MarkerSync::setLastRead(const QString &timeline, const QString &lastReadId)
+{
+    if (lastReadId.isEmpty() || !isNewer(lastReadId, lastRead(timeline))) {
+        return;
+    }
+
+    restore();
+    m_pending[timeline] = lastReadId;
+    save();
+    m_debounceTimer.start();
+}
+
+void MarkerSync::setKnownLastRead(const QString &timeline, const QString &lastReadId)
+{
+    if (isNewer(lastReadId, m_known.value(timeline))) {
+        m_known[timeline] = lastReadId;
+    }
+
+    // Someone else already read further, on another device
+    if (m_pending.contains(timeline) && !isNewer(m_pending[timeline], m_known[timeline])) {
+        m_pending.remove(timeline);
+        save();
+    }
+}
+
+QString MarkerSync::lastRead(const QString &timeline) const
+{
+    QString newest = m_known.value(timeline);
+    for (const QString &id : {m_inFlight.value(timeline), m_pending.value(timeline)}) {
+        if (isNewer(id, newest)) {
+            newest = id;
+        }
+    }
+    return newest;
+}
+
+bool MarkerSync::hasPending() const
+{
+    return !m_pending.isEmpty();
+}
+
+void MarkerSync::flush()
+{
+    m_debounceTimer.stop();
+    if (m_pending.isEmpty()) {
+        return;
+    }
+
+    QUrlQuery formdata;
+    for (const auto &[timeline, lastReadId] : m_pending.asKeyValueRange()) {
+        formdata.addQueryItem(u"%1[last_read_id]"_s.arg(timeline), lastReadId);
+    }
+
+    const auto sent = std::exchange(m_pending, {});
+    m_inFlight.insert(sent);
+
+    m_account->post(
+        m_account->apiUrl(u"/api/v1/markers"_s),
+        formdata,
+        true,
+        this,
+        [this, sent](QNetworkReply *reply) {
+            for (const auto &[timeline, lastReadId] : sent.asKeyValueRange()) {
+                if (m_inFlight.value(timeline) == lastReadId) {
+                    m_inFlight.remove(timeline);
+                }
+                setKnownLastRead(timeline, lastReadId);
+            }
+
+            // The server answers with every marker it has now
+            const auto markers = QJsonDocument::fromJson(reply->readAll()).object();
+            for (const auto &timeline : markers.keys()) {
+                setKnownLastRead(timeline, markers[timeline]["last_read_id"_L1].toString());
+            }
+            save();
+        },
+        [this, sent](QNetworkReply *) {
+            // Try again in a while, unless something newer is waiting already
+            for (const auto &[timeline, lastReadId] : sent.asKeyValueRange()) {
+                if (m_inFlight.value(timeline) == lastReadId) {
+                    m_inFlight.remove(timeline);
+                }
+                if (isNewer(lastReadId, lastRead(timeline))) {
+                    m_pending[timeline] = lastReadId;
+                }
+            }
+            if (!m_pending.isEmpty() && !m_debounceTimer.isActive()) {
+                m_debounceTimer.start();
+            }
+        });
+}
+
+void MarkerSync::fetch()
+{
+    QUrl url = m_account->apiUrl(u"/api/v1/markers"_s);
+    url.setQuery(QUrlQuery{{u"timeline[]"_s, u"home"_s}, {u"timeline[]"_s, u"notifications"_s}});
+
+    m_account->get(
+        url,
+        true,
+        this,
+        [this](QNetworkReply *reply) {
+            const auto markers = QJsonDocument::fromJson(reply->readAll()).object();
+            for (const auto &timeline : markers.keys()) {
+                setKnownLastRead(timeline, markers[timeline]["last_read_id"_L1].toString());
+            }
+            flush();
+        },
+        [this](QNetworkReply *) {
+            flush();
+        });
+}
+
+void MarkerSync::setDebounceInterval(const std::chrono::milliseconds interval)
+{
+    m_debounceTimer.setInterval(interval);
+}
+
+bool MarkerSync::isNewer(const QString &id, const QString &than)
+{
+    // Ids are numbers too large for JSON, so they are compared as strings
+    if (id.size() != than.size()) {
+        return id.size() > than.size();
+    }
+    return id > than;
+}
+
+void MarkerSync::restore()
+{
+    if (m_restored || !m_account->config()) {
+        return;
+    }
+    m_restored = true;
+
+    const auto stored = QJsonDocument::fromJson(m_account->config()->pendingMarkers().toUtf8()).object();
+    for (const auto &timeline : stored.keys()) {
+        const QString lastReadId = stored[timeline].toString();
+        if (isNewer(lastReadId, lastRead(timeline))) {
+            m_pending[timeline] = lastReadId;
+        }
+    }
+}
+
+void MarkerSync::save()
+{
+    // Don't overwrite what was stored before it's read
+    restore();
+
+    auto config = m_account->config();
+    if (!config) {
+        return;
+    }
+
+    // What's being sent may never arrive, if we quit in the meantime
+    QJsonObject stored;
+    for (const auto &markers : {m_inFlight, m_pending}) {
+        for (const auto &[timeline, lastReadId] : markers.asKeyValueRange()) {
+            if (isNewer(lastReadId, stored[timeline].toString())) {
+                stored[timeline] = lastReadId;
+            }
+        }
+    }
+
+    config->setPendingMarkers(QString::fromUtf8(QJsonDocument(stored).toJson(QJsonDocument::Compact)));
+    config->save();
+}
+
+#include "moc_markersync.cpp"
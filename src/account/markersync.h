@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QObject>
+#include <QTimer>
+
+#include <chrono>
+
+class AbstractAccount;
+
+/**
+ * @brief Saves the read markers of an account's timelines on the server.
+ *
+ * Only the newest read post of each timeline is kept, and it's sent after a while without any newer one, or when the application is
+ * suspended or quits. All timelines waiting to be saved are sent in the same request, and a marker is never moved back to an older post.
+ *
+ * Markers which weren't sent yet are kept in the account's settings, so the ones which couldn't be sent before quitting are sent on the
+ * next start. Those the server has are fetched then too.
+ */
+class MarkerSync : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit MarkerSync(AbstractAccount *account);
+
+    /**
+     * @brief Mark everything up to @p lastReadId in @p timeline as read.
+     *
+     * Does nothing if a newer post was already marked as read.
+     */
+    void setLastRead(const QString &timeline, const QString &lastReadId);
+
+    /**
+     * @brief Tells that the server has @p timeline read up to @p lastReadId, for example after fetching the markers.
+     */
+    void setKnownLastRead(const QString &timeline, const QString &lastReadId);
+
+    /**
+     * @return The newest read post of @p timeline, whether it was sent yet or not.
+     */
+    [[nodiscard]] QString lastRead(const QString &timeline) const;
+
+    /**
+     * @return Whether some markers weren't sent yet.
+     */
+    [[nodiscard]] bool hasPending() const;
+
+    /**
+     * @brief Sends the pending markers right away.
+     */
+    void flush();
+
+    /**
+     * @brief Asks the server which posts were read last in the home and notifications timelines.
+     */
+    void fetch();
+
+    /**
+     * @brief Wait for @p interval without a newer read post before sending.
+     */
+    void setDebounceInterval(std::chrono::milliseconds interval);
+
+    /**
+     * @return Whether the post @p id is newer than @p than.
+     */
+    [[nodiscard]] static bool isNewer(const QString &id, const QString &than);
+
+private:
+    void restore();
+    void save();
+
+    AbstractAccount *const m_account;
+    QTimer m_debounceTimer;
+    bool m_restored = false;
+
+    QHash<QString, QString> m_pending;
+    QHash<QString, QString> m_inFlight; ///< Sent, but not confirmed by the server yet.
+    QHash<QString, QString> m_known; ///< What the server has.
+};
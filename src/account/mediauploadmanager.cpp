@@ -0,0 +1,340 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/mediauploadmanager.h"
+
+#include "account/abstractaccount.h"
+#include "account/interactionqueue.h"
+#include "network/networkrequestprogress.h"
+
+#include <KLocalizedString>
+#include <QCryptographicHash>
+#include <QFile>
+#include <QHttpMultiPart>
+#include <QJsonDocument>
+#include <QNetworkReply>
+#include <QTimer>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+constexpr int maxAttempts = 4;
+
+// Five minutes with the default poll interval, large videos can take a while
+constexpr int maxPolls = 300;
+
+// The server removes media which isn't attached to a post after about a day
+constexpr qint64 reuseSecs = 12 * 60 * 60;
+
+QString errorString(QNetworkReply *reply)
+{
+    const QString error = QJsonDocument::fromJson(reply->readAll())["error"_L1].toString();
+    return error.isEmpty() ? reply->errorString() : error;
+}
+}
+
+MediaUpload::MediaUpload(const MediaUploadManager::Source &source, QObject *parent)
+    : QObject(parent)
+    , m_source(source)
+    , m_progress(new NetworkRequestProgress(this))
+{
+}
+
+MediaUpload::State MediaUpload::state() const
+{
+    return m_state;
+}
+
+NetworkRequestProgress *MediaUpload::progress() const
+{
+    return m_progress;
+}
+
+QJsonObject MediaUpload::attachment() const
+{
+    return m_attachment;
+}
+
+QString MediaUpload::errorString() const
+{
+    return m_errorString;
+}
+
+int MediaUpload::attempts() const
+{
+    return m_attempts;
+}
+
+void MediaUpload::setState(const State state)
+{
+    if (m_state == state) {
+        return;
+    }
+    m_state = state;
+    Q_EMIT stateChanged();
+}
+
+MediaUploadManager::MediaUploadManager(AbstractAccount *account)
+    : QObject(account)
+    , m_account(account)
+{
+}
+
+MediaUpload *MediaUploadManager::upload(const Source &source)
+{
+    if (!source.hash.isEmpty()) {
+        if (const auto uploading = m_uploading.value(source.hash)) {
+            return uploading;
+        }
+
+        const auto uploaded = m_uploaded.constFind(source.hash);
+        if (uploaded != m_uploaded.cend() && uploaded->uploadedAt.secsTo(QDateTime::currentDateTimeUtc()) < reuseSecs) {
+            const auto upload = new MediaUpload(source, this);
+            const QJsonObject attachment = uploaded->attachment;
+
+            // Whoever asked can only connect to it once this returns
+            QMetaObject::invokeMethod(
+                upload,
+                [this, upload, attachment] {
+                    finish(upload, attachment);
+                },
+                Qt::QueuedConnection);
+            return upload;
+        }
+        m_uploaded.remove(source.hash);
+    }
+
+    const auto upload = new MediaUpload(source, this);
+    if (!source.hash.isEmpty()) {
+        m_uploading.insert(source.hash, upload);
+    }
+    m_queue.push_back(upload);
+    Q_EMIT pendingCountChanged();
+
+    startNext();
+    return upload;
+}
+
+void MediaUploadManager::forget(const QStringList &mediaIds)
+{
+    m_uploaded.removeIf([&mediaIds](const std::pair<const QByteArray &, Uploaded &> &entry) {
+        return mediaIds.contains(entry.second.attachment["id"_L1].toString());
+    });
+}
+
+int MediaUploadManager::pendingCount() const
+{
+    return m_queue.size() + m_running;
+}
+
+void MediaUploadManager::setMaxConcurrent(const int count)
+{
+    m_maxConcurrent = std::max(count, 1);
+}
+
+void MediaUploadManager::setRetryDelay(const std::chrono::milliseconds delay)
+{
+    m_retryDelay = delay;
+}
+
+void MediaUploadManager::setPollInterval(const std::chrono::milliseconds interval)
+{
+    m_pollInterval = interval;
+}
+
+QByteArray MediaUploadManager::hashFile(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    if (!hash.addData(&file)) {
+        return {};
+    }
+    return hash.result();
+}
+
+QByteArray MediaUploadManager::hashData(const QByteArray &data)
+{
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha256);
+}
+
+void MediaUploadManager::startNext()
+{
+    while (m_running < m_maxConcurrent && !m_queue.isEmpty()) {
+        const auto upload = m_queue.takeFirst();
+        if (!upload) {
+            continue;
+        }
+
+        m_running++;
+        send(upload);
+    }
+}
+
+void MediaUploadManager::send(MediaUpload *upload)
+{
+    // Before anything can fail, so it's known to take up one of the running uploads
+    upload->setState(MediaUpload::State::Uploading);
+
+    const auto message = multiPart(upload->m_source);
+    if (!message) {
+        // Whoever asked can only connect to it once upload() returns
+        QMetaObject::invokeMethod(
+            upload,
+            [this, upload] {
+                fail(upload, i18n("Could not read %1.", upload->m_source.fileName));
+            },
+            Qt::QueuedConnection);
+        return;
+    }
+
+    upload->m_attempts++;
+
+    const bool v1 = m_v1Only;
+    const auto reply = m_account->post(
+        m_account->apiUrl(v1 ? u"/api/v1/media"_s : u"/api/v2/media"_s),
+        message,
+        true,
+        upload,
+        [this, upload](QNetworkReply *reply) {
+            // Small images are often processed right away
+            finish(upload, QJsonDocument::fromJson(reply->readAll()).object());
+        },
+        [this, upload, v1](QNetworkReply *reply) {
+            const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+            if (statusCode == 202) {
+                upload->setState(MediaUpload::State::Processing);
+                poll(upload, QJsonDocument::fromJson(reply->readAll())["id"_L1].toString());
+                return;
+            }
+
+            // The asynchronous endpoint is a Mastodon addition that not every server has
+            if (statusCode == 404 && !v1) {
+                m_v1Only = true;
+                upload->m_attempts--;
+                send(upload);
+                return;
+            }
+
+            retry(upload, reply, [this, upload] {
+                send(upload);
+            });
+        });
+    upload->m_progress->setReply(reply);
+}
+
+void MediaUploadManager::poll(MediaUpload *upload, const QString &mediaId)
+{
+    if (mediaId.isEmpty()) {
+        fail(upload, i18n("The server sent an invalid response."));
+        return;
+    }
+
+    QTimer::singleShot(m_pollInterval, upload, [this, upload, mediaId] {
+        upload->m_polls++;
+        m_account->get(
+            m_account->apiUrl(u"/api/v1/media/%1"_s.arg(mediaId)),
+            true,
+            upload,
+            [this, upload](QNetworkReply *reply) {
+                finish(upload, QJsonDocument::fromJson(reply->readAll()).object());
+            },
+            [this, upload, mediaId](QNetworkReply *reply) {
+                // 206 means it's still being processed
+                const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+                if (statusCode != 206 && !InteractionQueue::isTransientFailure(reply)) {
+                    fail(upload, errorString(reply));
+                } else if (upload->m_polls >= maxPolls) {
+                    fail(upload, i18n("The server took too long to process %1.", upload->m_source.fileName));
+                } else {
+                    poll(upload, mediaId);
+                }
+            });
+    });
+}
+
+void MediaUploadManager::retry(MediaUpload *upload, QNetworkReply *reply, const std::function<void()> &again)
+{
+    if (!InteractionQueue::isTransientFailure(reply) || reply->error() == QNetworkReply::OperationCanceledError || upload->m_attempts >= maxAttempts) {
+        fail(upload, errorString(reply));
+        return;
+    }
+
+    // There are no partial uploads to resume from, so it starts over
+    QTimer::singleShot(m_retryDelay * (1 << (upload->m_attempts - 1)), upload, again);
+}
+
+void MediaUploadManager::finish(MediaUpload *upload, const QJsonObject &attachment)
+{
+    if (attachment["id"_L1].toString().isEmpty()) {
+        fail(upload, i18n("The server sent an invalid response."));
+        return;
+    }
+
+    const bool running = upload->m_state != MediaUpload::State::Queued;
+    const QByteArray &hash = upload->m_source.hash;
+    if (running && !hash.isEmpty()) {
+        m_uploading.remove(hash);
+        m_uploaded.insert(hash, {.attachment = attachment, .uploadedAt = QDateTime::currentDateTimeUtc()});
+    }
+
+    upload->m_attachment = attachment;
+    upload->setState(MediaUpload::State::Finished);
+    Q_EMIT upload->finished(attachment);
+    upload->deleteLater();
+
+    if (running) {
+        m_running--;
+        Q_EMIT pendingCountChanged();
+        startNext();
+    }
+}
+
+void MediaUploadManager::fail(MediaUpload *upload, const QString &errorString)
+{
+    const bool running = upload->m_state != MediaUpload::State::Queued;
+    if (!upload->m_source.hash.isEmpty()) {
+        m_uploading.remove(upload->m_source.hash);
+    }
+
+    upload->m_errorString = errorString;
+    upload->setState(MediaUpload::State::Failed);
+    Q_EMIT upload->failed(errorString);
+    upload->deleteLater();
+
+    if (running) {
+        m_running--;
+        Q_EMIT pendingCountChanged();
+        startNext();
+    }
+}
+
+QHttpMultiPart *MediaUploadManager::multiPart(const Source &source) const
+{
+    auto message = new QHttpMultiPart(QHttpMultiPart::FormDataType);
+
+    QHttpPart filePart;
+    filePart.setHeader(QNetworkRequest::ContentTypeHeader, source.mimeType.isEmpty() ? u"application/octet-stream"_s : source.mimeType);
+    filePart.setHeader(QNetworkRequest::ContentDispositionHeader, u"form-data; name=\"file\"; filename=\"%1\""_s.arg(source.fileName));
+
+    if (!source.data.isEmpty()) {
+        filePart.setBody(source.data);
+    } else {
+        // Streamed, since videos can be much larger than what should be kept in memory
+        auto file = new QFile(source.path, message);
+        if (!file->open(QIODevice::ReadOnly)) {
+            delete message;
+            return nullptr;
+        }
+        filePart.setBodyDevice(file);
+    }
+
+    message->append(filePart);
+    return message;
+}
+
+#include "moc_mediauploadmanager.cpp"
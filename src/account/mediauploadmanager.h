@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QDateTime>
+#include <QHash>
+#include <QJsonObject>
+#include <QObject>
+#include <QPointer>
+
+#include <chrono>
+#include <functional>
+
+class AbstractAccount;
+class MediaUpload;
+class NetworkRequestProgress;
+class QHttpMultiPart;
+class QNetworkReply;
+
+/**
+ * @brief Uploads media attachments of an account.
+ *
+ * A few files are uploaded at once, and the rest wait for their turn. Files are sent to the asynchronous v2 media endpoint, so the connection
+ * isn't held open while the server processes them. Instead the media is polled until it's ready. Servers without it get the v1 endpoint.
+ *
+ * Uploads which fail because of the network or the server are started over a few times. Uploading the same contents again, while it's still
+ * uploading or until it's attached to a post, reuses the same media instead.
+ */
+class MediaUploadManager : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Source {
+        QByteArray data; ///< The contents of the file, or empty to read them from path.
+        QString path;
+        QString fileName;
+        QString mimeType;
+        QByteArray hash; ///< Of the contents, to recognize the same file, see hashFile(). Not reused if empty.
+    };
+
+    explicit MediaUploadManager(AbstractAccount *account);
+
+    /**
+     * @brief Uploads @p source, or reuses an earlier upload of the same contents.
+     * @return The upload, which is deleted once it finished or failed.
+     */
+    MediaUpload *upload(const Source &source);
+
+    /**
+     * @brief Don't reuse the media @p mediaIds anymore, since they're attached to a post now.
+     */
+    void forget(const QStringList &mediaIds);
+
+    /**
+     * @return How many uploads are running or waiting for their turn.
+     */
+    [[nodiscard]] int pendingCount() const;
+
+    /**
+     * @brief Don't upload more than @p count files at once.
+     */
+    void setMaxConcurrent(int count);
+
+    /**
+     * @brief Wait @p delay before trying a failed upload again, and twice as long each time after that.
+     */
+    void setRetryDelay(std::chrono::milliseconds delay);
+
+    /**
+     * @brief Check whether the server is done processing media every @p interval.
+     */
+    void setPollInterval(std::chrono::milliseconds interval);
+
+    /**
+     * @return The hash of the file at @p path, for Source::hash. Reads all of it, so call it from a worker thread.
+     */
+    [[nodiscard]] static QByteArray hashFile(const QString &path);
+
+    /**
+     * @return The hash of @p data, for Source::hash.
+     */
+    [[nodiscard]] static QByteArray hashData(const QByteArray &data);
+
+Q_SIGNALS:
+    void pendingCountChanged();
+
+private:
+    struct Uploaded {
+        QJsonObject attachment;
+        QDateTime uploadedAt;
+    };
+
+    void startNext();
+    void send(MediaUpload *upload);
+    void poll(MediaUpload *upload, const QString &mediaId);
+    void retry(MediaUpload *upload, QNetworkReply *reply, const std::function<void()> &again);
+    void finish(MediaUpload *upload, const QJsonObject &attachment);
+    void fail(MediaUpload *upload, const QString &errorString);
+    [[nodiscard]] QHttpMultiPart *multiPart(const Source &source) const;
+
+    AbstractAccount *const m_account;
+
+    QList<QPointer<MediaUpload>> m_queue;
+    int m_running = 0;
+    QHash<QByteArray, MediaUpload *> m_uploading; ///< By hash, so the same contents are only uploaded once.
+    QHash<QByteArray, Uploaded> m_uploaded; ///< By hash, until it's attached to a post.
+    bool m_v1Only = false;
+
+    int m_maxConcurrent = 3;
+    std::chrono::milliseconds m_retryDelay = std::chrono::seconds(2);
+    std::chrono::milliseconds m_pollInterval = std::chrono::seconds(1);
+};
+
+/**
+ * @brief A single file being uploaded by MediaUploadManager.
+ */
+class MediaUpload : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum class State {
+        Queued, /**< Waiting for other uploads to finish. */
+        Uploading, /**< Being sent to the server. */
+        Processing, /**< Sent, but the server isn't done processing it yet. */
+        Finished, /**< Done, see attachment(). */
+        Failed, /**< Given up, see errorString(). */
+    };
+    Q_ENUM(State)
+
+    [[nodiscard]] State state() const;
+
+    /**
+     * @return The progress of sending the file.
+     */
+    [[nodiscard]] NetworkRequestProgress *progress() const;
+
+    /**
+     * @return The media attachment, once finished.
+     */
+    [[nodiscard]] QJsonObject attachment() const;
+
+    [[nodiscard]] QString errorString() const;
+
+    /**
+     * @return How many times it was sent so far.
+     */
+    [[nodiscard]] int attempts() const;
+
+Q_SIGNALS:
+    void stateChanged();
+    void finished(const QJsonObject &attachment);
+    void failed(const QString &errorString);
+
+private:
+    friend class MediaUploadManager;
+
+    MediaUpload(const MediaUploadManager::Source &source, QObject *parent);
+    void setState(State state);
+
+    MediaUploadManager::Source m_source;
+    State m_state = State::Queued;
+    NetworkRequestProgress *const m_progress;
+    QJsonObject m_attachment;
+    QString m_errorString;
+    int m_attempts = 0;
+    int m_polls = 0;
+};
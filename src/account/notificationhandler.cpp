@@ -6,23 +6,34 @@
 #include "account/account.h"
 #include "account/accountmanager.h"
 #include "network/networkcontroller.h"
+#include "utils/imagecache.h"
 
 #include <QPainter>
 
 #include <KLocalizedString>
 #include <KNotification>
-#include <QNetworkReply>
 
 #ifdef HAVE_KIO
 #include <KIO/ApplicationLauncherJob>
 #endif
 
-NotificationHandler::NotificationHandler(QNetworkAccessManager *nam, QObject *parent)
+namespace
+{
+// In device independent pixels, notification servers show them at about 48
+constexpr int avatarSize = 128;
+}
+
+NotificationHandler::NotificationHandler(QObject *parent)
     : QObject(parent)
-    , m_nam(nam)
 {
 }
 
+NotificationHandler::~NotificationHandler()
+{
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
 void NotificationHandler::handle(std::shared_ptr<Notification> notification, AbstractAccount *account)
 {
     KNotification *knotification;
@@ -157,7 +168,8 @@ void NotificationHandler::handle(std::shared_ptr<Notification> notification, Abs
         if (!notification->post()->spoilerText().isEmpty()) {
             knotification->setText(xi18n("<b>Content Notice</b>: %1", notification->post()->spoilerText()));
         } else if (!notification->post()->content().isEmpty()) {
-            knotification->setText(notification->post()->content());
+            // Notifications only understand a few tags, and show the rest as they are
+            knotification->setText(notification->post()->plainContent().toHtmlEscaped());
         } else {
             knotification->setText(i18n("This post has no text."));
         }
@@ -182,43 +194,89 @@ void NotificationHandler::handle(std::shared_ptr<Notification> notification, Abs
     m_lastConnection = connect(knotification, &KNotification::closed, this, &NotificationHandler::lastNotificationClosed);
 
     if (!notification->identity()->avatarUrl().isEmpty() && !notification->identity()->limited()) {
-        const auto avatarUrl = notification->identity()->avatarUrl();
-        auto request = QNetworkRequest(avatarUrl);
-        auto reply = m_nam->get(request);
-        connect(reply, &QNetworkReply::finished, this, [reply, knotification]() {
-            reply->deleteLater();
-            if (reply->error() != QNetworkReply::NoError) {
-                knotification->sendEvent();
-                return;
-            }
-            QPixmap img;
-            img.loadFromData(reply->readAll());
+        sendWithAvatar(knotification, notification->identity()->avatarUrl());
+    } else {
+        knotification->sendEvent();
+    }
+}
+
+QImage NotificationHandler::roundAvatar(const QImage &avatar, const int size)
+{
+    QImage rounded(size, size, QImage::Format_ARGB32_Premultiplied);
+    rounded.fill(Qt::transparent);
+
+    const QRect imageRect{0, 0, size, size};
+
+    QPainter painter(&rounded);
+    painter.setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
+    painter.setPen(Qt::NoPen);
+
+    // Fill background for transparent avatars
+    painter.setBrush(Qt::white);
+    painter.drawEllipse(imageRect);
 
-            // Handle avatars that are lopsided in one dimension
-            const int biggestDimension = std::max(img.width(), img.height());
-            const QRect imageRect{0, 0, biggestDimension, biggestDimension};
+    if (!avatar.isNull()) {
+        // Handle avatars that are lopsided in one dimension
+        const QImage scaled = avatar.scaled(imageRect.size(), Qt::KeepAspectRatioByExpanding, Qt::SmoothTransformation);
+        QBrush brush(scaled);
+        brush.setTransform(QTransform::fromTranslate(-(scaled.width() - size) / 2.0, -(scaled.height() - size) / 2.0));
+        painter.setBrush(brush);
+        painter.drawEllipse(imageRect);
+    }
+    painter.end();
 
-            QImage roundedImage(imageRect.size(), QImage::Format_ARGB32);
-            roundedImage.fill(Qt::transparent);
+    return rounded;
+}
 
-            QPainter painter(&roundedImage);
-            painter.setRenderHint(QPainter::SmoothPixmapTransform);
-            painter.setPen(Qt::NoPen);
+void NotificationHandler::sendWithAvatar(KNotification *notification, const QUrl &avatarUrl)
+{
+    if (const auto pixmap = m_avatars.object(avatarUrl)) {
+        notification->setPixmap(*pixmap);
+        notification->sendEvent();
+        return;
+    }
 
-            // Fill background for transparent avatars
-            painter.setBrush(Qt::white);
-            painter.drawRoundedRect(imageRect, imageRect.width(), imageRect.height());
+    auto &waiting = m_waitingForAvatar[avatarUrl];
+    waiting.push_back(notification);
+    if (waiting.size() > 1) {
+        return;
+    }
 
-            QBrush brush(img.scaledToHeight(biggestDimension));
-            painter.setBrush(brush);
-            painter.drawRoundedRect(imageRect, imageRect.width(), imageRect.height());
-            painter.end();
+    ImageCache::instance().request(avatarUrl, QSize(avatarSize, avatarSize), this, [this, avatarUrl](const QImage &avatar) {
+        if (avatar.isNull()) {
+            avatarReady(avatarUrl, {});
+            return;
+        }
 
-            knotification->setPixmap(QPixmap::fromImage(std::move(roundedImage)));
-            knotification->sendEvent();
+        // Painting is too slow for the main thread when a lot of notifications come in at once
+        m_pool.start([this, avatarUrl, avatar] {
+            const QImage rounded = roundAvatar(avatar, avatarSize);
+            QMetaObject::invokeMethod(
+                this,
+                [this, avatarUrl, rounded] {
+                    avatarReady(avatarUrl, rounded);
+                },
+                Qt::QueuedConnection);
         });
-    } else {
-        knotification->sendEvent();
+    });
+}
+
+void NotificationHandler::avatarReady(const QUrl &avatarUrl, const QImage &rounded)
+{
+    QPixmap pixmap;
+    if (!rounded.isNull()) {
+        pixmap = QPixmap::fromImage(rounded);
+        m_avatars.insert(avatarUrl, new QPixmap(pixmap));
+    }
+
+    // Send them even without an avatar, rather than not at all
+    for (const auto &notification : m_waitingForAvatar.take(avatarUrl)) {
+        if (notification) {
+            if (!pixmap.isNull()) {
+                notification->setPixmap(pixmap);
+            }
+            notification->sendEvent();
+        }
     }
 }
 
@@ -5,7 +5,12 @@
 
 #include "timeline/notification.h"
 
-class QNetworkAccessManager;
+#include <QCache>
+#include <QPixmap>
+#include <QPointer>
+#include <QThreadPool>
+
+class KNotification;
 
 /**
  * @brief Handles desktop notifications using KNotification.
@@ -15,7 +20,8 @@ class NotificationHandler : public QObject
     Q_OBJECT
 
 public:
-    explicit NotificationHandler(QNetworkAccessManager *nam, QObject *parent = nullptr);
+    explicit NotificationHandler(QObject *parent = nullptr);
+    ~NotificationHandler() override;
 
     /**
      * @brief Display a new notification for an account.
@@ -24,10 +30,27 @@ public:
      */
     void handle(std::shared_ptr<Notification> notification, AbstractAccount *account);
 
+    /**
+     * @return @p avatar cropped to a circle of @p size on a white background, for transparent avatars.
+     */
+    [[nodiscard]] static QImage roundAvatar(const QImage &avatar, int size);
+
 Q_SIGNALS:
     void lastNotificationClosed();
 
 private:
-    QNetworkAccessManager *m_nam;
+    /**
+     * @brief Sends @p notification with the avatar at @p avatarUrl, once it's ready.
+     */
+    void sendWithAvatar(KNotification *notification, const QUrl &avatarUrl);
+    void avatarReady(const QUrl &avatarUrl, const QImage &rounded);
+
     QMetaObject::Connection m_lastConnection;
+
+    // Bursts of notifications tend to come from the same few people
+    QCache<QUrl, QPixmap> m_avatars{64};
+    QHash<QUrl, QList<QPointer<KNotification>>> m_waitingForAvatar;
+
+    // Waited for when destroyed, so rounding an avatar never reports back to a handler that's gone
+    QThreadPool m_pool;
 };
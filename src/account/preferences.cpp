@@ -15,8 +15,8 @@ Preferences::Preferences(AbstractAccount *account)
     , m_account(account)
 {
     connect(account, &AbstractAccount::authenticated, this, [this, account]() {
-        account->get(account->apiUrl(QStringLiteral("/api/v1/preferences")), true, this, [this](QNetworkReply *reply) {
-            const auto obj = QJsonDocument::fromJson(reply->readAll()).object();
+        account->getCached(account->apiUrl(QStringLiteral("/api/v1/preferences")), true, this, [this](const QJsonDocument &doc) {
+            const auto obj = doc.object();
 
             if (const auto defaultLanguage = obj[QStringLiteral("posting:default:language")]; !defaultLanguage.isNull()) {
                 m_defaultLanguage = defaultLanguage.toString();
@@ -48,7 +48,7 @@ QString ProfileEditorBackend::displayName() const
 QString ProfileEditorBackend::displayNameHtml() const
 {
     if (m_account != nullptr) {
-        return TextHandler::replaceCustomEmojis(m_account->customEmojis(), m_displayName);
+        return TextHandler::replaceCustomEmojis(m_account->customEmojiUrls(), m_displayName);
     } else {
         return m_displayName;
     }
@@ -80,12 +80,11 @@ void RulesModel::fill()
     setLoading(true);
 
     // TODO: if v2, use the rules from the fetched metadata
-    m_account->get(
+    m_account->getCached(
         m_account->apiUrl(QStringLiteral("/api/v1/instance/rules")),
         false,
         this,
-        [this](QNetworkReply *reply) {
-            const auto doc = QJsonDocument::fromJson(reply->readAll());
+        [this](const QJsonDocument &doc) {
             auto rules = doc.array().toVariantList();
 
             if (!rules.isEmpty()) {
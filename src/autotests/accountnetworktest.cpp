@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/account.h"
+#include "account/accountmanager.h"
+#include "autotests/replayserver.h"
+#include "timeline/maintimelinemodel.h"
+
+#include <QNetworkAccessManager>
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace std::chrono_literals;
+
+/**
+ * End-to-end tests of the real Account, from the network to the models, against a local ReplayServer.
+ */
+class AccountNetworkTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+        AccountManager::instance().setTestMode(true);
+
+        QVERIFY(server.listen());
+        server.addTimeline(u"/api/v1/timelines/public"_s, ReplayServer::generatePosts(50));
+        server.addFixture(u"/api/v1/accounts/verify_credentials"_s, u"verify_credentials.json"_s);
+
+        account = new Account(server.instanceUri(), &nam, this);
+        AccountManager::instance().addAccount(account);
+    }
+
+    void init()
+    {
+        server.setLatency(0ms);
+        server.setBandwidth(0);
+    }
+
+    void testApiUrl()
+    {
+        QCOMPARE(account->apiUrl(u"/api/v1/timelines/public"_s), server.url(u"/api/v1/timelines/public"_s));
+
+        // Only servers on this machine may be talked to without TLS
+        Account remote(u"http://mastodon.example"_s, &nam);
+        QCOMPARE(remote.apiUrl(u"/api/v1/timelines/public"_s).scheme(), u"https"_s);
+
+        // And only while testing
+        AccountManager::instance().setTestMode(false);
+        QCOMPARE(account->apiUrl(u"/api/v1/timelines/public"_s).scheme(), u"https"_s);
+        QCOMPARE(account->streamingUrl({}).scheme(), u"wss"_s);
+        AccountManager::instance().setTestMode(true);
+        QCOMPARE(account->streamingUrl({}).scheme(), u"ws"_s);
+    }
+
+    void testPagination()
+    {
+        MainTimelineModel model;
+        model.setName(u"public"_s);
+
+        QTRY_COMPARE(model.rowCount({}), 20);
+        QTRY_VERIFY(!model.loading());
+
+        const auto lastId = model.data(model.index(19, 0), AbstractTimelineModel::IdRole).toString();
+        model.fillTimeline(lastId);
+        QTRY_COMPARE(model.rowCount({}), 40);
+        QTRY_VERIFY(!model.loading());
+
+        ReplayServer::Request nextPage;
+        for (const auto &request : server.requests()) {
+            if (request.url.path() == "/api/v1/timelines/public"_L1) {
+                nextPage = request;
+            }
+        }
+        QCOMPARE(QUrlQuery(nextPage.url).queryItemValue(u"max_id"_s), lastId);
+        QCOMPARE(QUrlQuery(nextPage.url).queryItemValue(u"local"_s), u"true"_s);
+
+        model.fillTimeline(model.data(model.index(39, 0), AbstractTimelineModel::IdRole).toString());
+        QTRY_COMPARE(model.rowCount({}), 50);
+        QTRY_VERIFY(!model.loading());
+    }
+
+    // On a slow connection, posts should show up while the page is still downloading
+    void testSlowConnection()
+    {
+        server.setLatency(50ms);
+        server.setBandwidth(64 * 1024);
+
+        MainTimelineModel model;
+        QSignalSpy insertions(&model, &QAbstractItemModel::rowsInserted);
+
+        QElapsedTimer timer;
+        timer.start();
+        model.setName(u"public"_s);
+
+        QTRY_VERIFY_WITH_TIMEOUT(!model.loading() && model.rowCount({}) == 20, 15000);
+        QVERIFY(timer.elapsed() >= 50);
+        QVERIFY(insertions.count() > 1);
+    }
+
+    void testStreaming()
+    {
+        server.setStreamingScript({
+            {.delay = 50ms, .stream = {u"user"_s}, .event = u"notification"_s, .payload = ReplayServer::fixture(u"notification_mention.json"_s)},
+        });
+
+        int notifications = 0;
+        connect(account, &AbstractAccount::notification, this, [&notifications] {
+            notifications++;
+        });
+
+        QSignalSpy authenticated(account, &AbstractAccount::authenticated);
+        account->setAccessToken(u"token"_s);
+        QTRY_COMPARE(authenticated.count(), 1);
+        QVERIFY(authenticated.first().first().toBool());
+
+        QTRY_COMPARE(server.streamingConnectionCount(), 1);
+        QTRY_COMPARE(notifications, 1);
+
+        const auto subscribed = std::ranges::any_of(server.streamingMessages(), [](const QJsonObject &message) {
+            return message["type"_L1] == "subscribe"_L1 && message["stream"_L1] == "user"_L1;
+        });
+        QVERIFY(subscribed);
+
+        disconnect(account, &AbstractAccount::notification, this, nullptr);
+    }
+
+    void benchmarkTimeline()
+    {
+        server.addTimeline(u"/api/v1/timelines/public"_s, ReplayServer::generatePosts(80), 80);
+
+        QBENCHMARK {
+            MainTimelineModel model;
+            model.setName(u"public"_s);
+            QTRY_COMPARE(model.rowCount({}), 80);
+            QTRY_VERIFY(!model.loading());
+        }
+    }
+
+private:
+    ReplayServer server;
+    QNetworkAccessManager nam;
+    Account *account = nullptr;
+};
+
+QTEST_MAIN(AccountNetworkTest)
+#include "accountnetworktest.moc"
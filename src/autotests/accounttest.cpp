@@ -65,6 +65,30 @@ private Q_SLOTS:
         QCOMPARE(account->registrationsOpen(), true);
         QCOMPARE(account->registrationMessage(), QString());
         QCOMPARE(account->supportsLocalVisibility(), false);
+        QCOMPARE(account->instanceSoftware(), InstanceProfile::Software::Mastodon);
+        QVERIFY(!InstanceProfileStore::instance().isStale(QStringLiteral("kde.social")));
+    }
+
+    // Make sure Pleroma-specific metadata is picked up
+    void testPleromaInstanceProfile()
+    {
+        const auto profile = InstanceProfile::fromJson(QJsonObject{
+            {QStringLiteral("title"), QStringLiteral("Pleroma")},
+            {QStringLiteral("version"), QStringLiteral("2.7.2 (compatible; Pleroma 2.5.0)")},
+            {QStringLiteral("max_toot_chars"), 5000},
+            {QStringLiteral("poll_limits"), QJsonObject{{QStringLiteral("max_options"), 20}}},
+            {QStringLiteral("registrations"), false},
+            {QStringLiteral("pleroma"), QJsonObject{}},
+        });
+
+        QCOMPARE(profile.name, QStringLiteral("Pleroma"));
+        QCOMPARE(profile.maxPostLength, size_t{5000});
+        QCOMPARE(profile.maxPollOptions, size_t{20});
+        QCOMPARE(profile.charactersReservedPerUrl, size_t{23});
+        QCOMPARE(profile.registrationsOpen, false);
+        QCOMPARE(profile.supportsLocalVisibility, true);
+        QCOMPARE(profile.software, InstanceProfile::Software::Pleroma);
+        QVERIFY(!profile.isValid());
     }
 
 private:
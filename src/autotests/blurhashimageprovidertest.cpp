@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/blurhashimageprovider.h"
+
+#include <QQuickTextureFactory>
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+const auto hash = u"eBB4=;054UK$=402%s%|r^O%06#?*7RijMxGpYMzniVNT@rFN3#=Kt"_s;
+
+QImage waitForImage(QQuickImageResponse *response)
+{
+    QSignalSpy finished(response, &QQuickImageResponse::finished);
+    if (!finished.wait()) {
+        return {};
+    }
+
+    const std::unique_ptr<QQuickTextureFactory> factory(response->textureFactory());
+    return factory ? factory->image() : QImage{};
+}
+}
+
+class BlurHashImageProviderTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testCached()
+    {
+        BlurHashImageProvider provider;
+
+        const std::unique_ptr<QQuickImageResponse> first(provider.requestImageResponse(hash, QSize(32, 32)));
+        const auto decoded = waitForImage(first.get());
+        QCOMPARE(decoded.size(), QSize(32, 32));
+
+        const std::unique_ptr<QQuickImageResponse> second(provider.requestImageResponse(hash, QSize(32, 32)));
+        const auto cached = waitForImage(second.get());
+
+        // Not just the same pixels, but the very same ones
+        QCOMPARE(cached.cacheKey(), decoded.cacheKey());
+
+        const auto statistics = provider.statistics();
+        QCOMPARE(statistics.misses, 1);
+        QCOMPARE(statistics.hits, 1);
+        QCOMPARE(statistics.count, 1);
+        QCOMPARE(statistics.bytes, decoded.sizeInBytes());
+
+        // Another size is another image
+        const std::unique_ptr<QQuickImageResponse> larger(provider.requestImageResponse(hash, QSize(64, 64)));
+        QCOMPARE(waitForImage(larger.get()).size(), QSize(64, 64));
+        QCOMPARE(provider.statistics().misses, 2);
+    }
+
+    void testJoined()
+    {
+        BlurHashImageProvider provider;
+
+        const std::unique_ptr<QQuickImageResponse> first(provider.requestImageResponse(hash, QSize(48, 48)));
+        const std::unique_ptr<QQuickImageResponse> second(provider.requestImageResponse(hash, QSize(48, 48)));
+        QSignalSpy firstFinished(first.get(), &QQuickImageResponse::finished);
+        QSignalSpy secondFinished(second.get(), &QQuickImageResponse::finished);
+
+        QTRY_COMPARE(firstFinished.count(), 1);
+        QTRY_COMPARE(secondFinished.count(), 1);
+
+        const std::unique_ptr<QQuickTextureFactory> firstFactory(first->textureFactory());
+        const std::unique_ptr<QQuickTextureFactory> secondFactory(second->textureFactory());
+        QCOMPARE(secondFactory->image().cacheKey(), firstFactory->image().cacheKey());
+
+        // Either it was still being decoded, or it was already there
+        const auto statistics = provider.statistics();
+        QCOMPARE(statistics.misses, 1);
+        QCOMPARE(statistics.joined + statistics.hits, 1);
+    }
+
+    void testByteBudget()
+    {
+        BlurHashImageProvider provider;
+
+        const std::unique_ptr<QQuickImageResponse> small(provider.requestImageResponse(hash, QSize(16, 16)));
+        const auto smallImage = waitForImage(small.get());
+
+        // Only room for one of them
+        provider.setByteBudget(smallImage.sizeInBytes());
+
+        const std::unique_ptr<QQuickImageResponse> other(provider.requestImageResponse(hash, QSize(16, 15)));
+        QVERIFY(!waitForImage(other.get()).isNull());
+        QCOMPARE(provider.statistics().count, 1);
+
+        const std::unique_ptr<QQuickImageResponse> again(provider.requestImageResponse(hash, QSize(16, 16)));
+        QVERIFY(!waitForImage(again.get()).isNull());
+        QCOMPARE(provider.statistics().misses, 3);
+    }
+
+    void testInvalid()
+    {
+        BlurHashImageProvider provider;
+
+        const std::unique_ptr<QQuickImageResponse> response(provider.requestImageResponse(u"invalid"_s, QSize(32, 32)));
+        QVERIFY(waitForImage(response.get()).isNull());
+    }
+};
+
+QTEST_MAIN(BlurHashImageProviderTest)
+#include "blurhashimageprovidertest.moc"
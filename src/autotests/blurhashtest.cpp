@@ -23,6 +23,9 @@ private Q_SLOTS:
     void decodeAC();
 
     void decodeImage();
+
+    void benchmarkDecode_data();
+    void benchmarkDecode();
 };
 
 void BlurHashTest::decode83_data()
@@ -103,5 +106,24 @@ void BlurHashTest::decodeImage()
     QCOMPARE(image.pixelColor(30, 30), QColor(0xff99b76d));
 }
 
+void BlurHashTest::benchmarkDecode_data()
+{
+    QTest::addColumn<QSize>("size");
+
+    // What the timeline asks for while the real thumbnails load
+    QTest::addRow("32x32") << QSize(32, 32);
+    QTest::addRow("64x64") << QSize(64, 64);
+}
+
+void BlurHashTest::benchmarkDecode()
+{
+    QFETCH(QSize, size);
+
+    QBENCHMARK {
+        const auto image = BlurHash::decode(QStringLiteral("eBB4=;054UK$=402%s%|r^O%06#?*7RijMxGpYMzniVNT@rFN3#=Kt"), size);
+        QCOMPARE(image.size(), size);
+    }
+}
+
 QTEST_GUILESS_MAIN(BlurHashTest)
 #include "blurhashtest.moc"
@@ -44,6 +44,52 @@ private Q_SLOTS:
                      "align=\"middle\" width=\"16\" src=\"https://cdn.masto.host/mastodonart/custom_emojis/images/000/389/600/static/4dd38081c3f8f04c.png\">"));
     }
 
+    void testCustomEmojiUrlReplacement_data()
+    {
+        QTest::addColumn<QString>("source");
+        QTest::addColumn<QString>("expected");
+
+        QTest::addRow("none") << QStringLiteral("No emoji here") << QStringLiteral("No emoji here");
+        QTest::addRow("unknown") << QStringLiteral(":blobcat: and :meow") << QStringLiteral(":blobcat: and :meow");
+        QTest::addRow("adjacent") << QStringLiteral("::a::b::") << QStringLiteral(":@#:");
+        QTest::addRow("colon before") << QStringLiteral("At 10:30 :a:!") << QStringLiteral("At 10:30 @!");
+        QTest::addRow("repeated") << QStringLiteral(":b: :b:") << QStringLiteral("# #");
+    }
+
+    void testCustomEmojiUrlReplacement()
+    {
+        QFETCH(QString, source);
+        QFETCH(QString, expected);
+
+        const CustomEmojiUrls emojis{
+            {QStringLiteral("a"), QStringLiteral("a.png")},
+            {QStringLiteral("b"), QStringLiteral("b.png")},
+        };
+        const auto image = [](const QString &url) {
+            return QStringLiteral("<img height=\"16\" align=\"middle\" width=\"16\" src=\"%1\">").arg(url);
+        };
+        // @ and # stand for the images of a and b
+        expected.replace(QLatin1Char('@'), image(QStringLiteral("a.png"))).replace(QLatin1Char('#'), image(QStringLiteral("b.png")));
+
+        QCOMPARE(TextHandler::replaceCustomEmojis(emojis, source), expected);
+    }
+
+    void testCustomEmojiCache()
+    {
+        CustomEmojiCache cache;
+
+        const auto emojis = CustomEmoji::parseCustomEmojiUrls(doc.array(), &cache);
+        QCOMPARE(emojis.size(), 2);
+        QCOMPARE(emojis[QStringLiteral("artaww")],
+                 QStringLiteral("https://cdn.masto.host/mastodonart/custom_emojis/images/000/181/127/static/63bd6a0097df7bbf.png"));
+        QCOMPARE(cache.size(), 2);
+
+        // Parsing them again shares the strings from before
+        const auto again = CustomEmoji::parseCustomEmojiUrls(doc.array(), &cache);
+        QCOMPARE(cache.size(), 2);
+        QCOMPARE(again[QStringLiteral("meowybara")].constData(), emojis[QStringLiteral("meowybara")].constData());
+    }
+
 private:
     QJsonDocument doc;
 };
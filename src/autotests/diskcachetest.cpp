@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "network/diskcache.h"
+
+#include <QAbstractNetworkCache>
+#include <QTemporaryDir>
+#include <QtTest/QtTest>
+
+#include <memory>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+constexpr qint64 kibibyte = 1024;
+
+void store(QAbstractNetworkCache *cache, const QUrl &url, const qint64 size)
+{
+    QNetworkCacheMetaData metaData;
+    metaData.setUrl(url);
+    metaData.setSaveToDisk(true);
+
+    const auto device = cache->prepare(metaData);
+    QVERIFY(device);
+    device->write(QByteArray(size, 'x'));
+    cache->insert(device);
+}
+
+bool contains(QAbstractNetworkCache *cache, const QUrl &url)
+{
+    return cache->metaData(url).isValid();
+}
+
+void read(QAbstractNetworkCache *cache, const QUrl &url)
+{
+    const std::unique_ptr<QIODevice> device(cache->data(url));
+    QVERIFY(device);
+}
+}
+
+class DiskCacheTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+    }
+
+    void init()
+    {
+        directory = std::make_unique<QTemporaryDir>();
+        QVERIFY(directory->isValid());
+        diskCache = std::make_unique<DiskCache>(directory->path());
+    }
+
+    void testPartitionFor_data()
+    {
+        QTest::addColumn<QUrl>("url");
+        QTest::addColumn<DiskCache::Partition>("partition");
+
+        QTest::addRow("api") << QUrl(u"https://example.org/api/v1/custom_emojis"_s) << DiskCache::Api;
+        QTest::addRow("nodeinfo") << QUrl(u"https://example.org/nodeinfo/2.0"_s) << DiskCache::Api;
+        QTest::addRow("avatar") << QUrl(u"https://files.example.org/accounts/avatars/000/000/001/original/a.png"_s) << DiskCache::Avatars;
+        QTest::addRow("remote avatar") << QUrl(u"https://files.example.org/cache/accounts/avatars/000/000/002/static/b.png"_s) << DiskCache::Avatars;
+        QTest::addRow("emoji") << QUrl(u"https://files.example.org/custom_emojis/images/000/000/001/static/blobcat.png"_s) << DiskCache::Avatars;
+        QTest::addRow("pleroma emoji") << QUrl(u"https://example.org/emoji/blobs/blobcat.png"_s) << DiskCache::Avatars;
+        QTest::addRow("preview") << QUrl(u"https://files.example.org/media_attachments/files/000/000/001/small/c.jpg"_s) << DiskCache::Previews;
+        QTest::addRow("link preview") << QUrl(u"https://files.example.org/preview_cards/images/000/000/001/original/d.jpg"_s) << DiskCache::Previews;
+        QTest::addRow("header") << QUrl(u"https://files.example.org/accounts/headers/000/000/001/original/e.jpg"_s) << DiskCache::Previews;
+        QTest::addRow("media") << QUrl(u"https://files.example.org/media_attachments/files/000/000/001/original/f.mp4"_s) << DiskCache::Media;
+        QTest::addRow("other") << QUrl(u"https://images.example.com/g.jpg"_s) << DiskCache::Media;
+    }
+
+    void testPartitionFor()
+    {
+        QFETCH(QUrl, url);
+        QFETCH(DiskCache::Partition, partition);
+
+        QCOMPARE(DiskCache::partitionFor(url), partition);
+    }
+
+    // Every cache created shares the same partitions
+    void testRouting()
+    {
+        const std::unique_ptr<QAbstractNetworkCache> cache(diskCache->createCache());
+        const QUrl api(u"https://example.org/api/v1/instance"_s);
+        const QUrl avatar(u"https://example.org/accounts/avatars/1/original/a.png"_s);
+
+        store(cache.get(), api, 4 * kibibyte);
+        store(cache.get(), avatar, 8 * kibibyte);
+
+        QVERIFY(diskCache->usage(DiskCache::Api) >= 4 * kibibyte);
+        QVERIFY(diskCache->usage(DiskCache::Avatars) >= 8 * kibibyte);
+        QCOMPARE(diskCache->usage(DiskCache::Previews), 0);
+        QCOMPARE(diskCache->usage(DiskCache::Media), 0);
+
+        const std::unique_ptr<QAbstractNetworkCache> other(diskCache->createCache());
+        QVERIFY(contains(other.get(), api));
+        QVERIFY(contains(other.get(), avatar));
+        QCOMPARE(other->cacheSize(), cache->cacheSize());
+    }
+
+    // Filling up one partition doesn't touch the others
+    void testQuota()
+    {
+        const std::unique_ptr<QAbstractNetworkCache> cache(diskCache->createCache());
+        const QUrl avatar(u"https://example.org/accounts/avatars/1/original/a.png"_s);
+        store(cache.get(), avatar, 8 * kibibyte);
+
+        diskCache->setQuota(DiskCache::Media, 100 * kibibyte);
+        for (int i = 0; i < 20; i++) {
+            store(cache.get(), QUrl(u"https://example.org/media/%1.mp4"_s.arg(i)), 20 * kibibyte);
+            QVERIFY(diskCache->usage(DiskCache::Media) <= 100 * kibibyte);
+        }
+
+        QVERIFY(contains(cache.get(), avatar));
+        QVERIFY(contains(cache.get(), QUrl(u"https://example.org/media/19.mp4"_s)));
+    }
+
+    // The largest entries go first, unless they're read often
+    void testEviction()
+    {
+        const std::unique_ptr<QAbstractNetworkCache> cache(diskCache->createCache());
+        diskCache->setQuota(DiskCache::Media, 100 * kibibyte);
+
+        const QUrl small(u"https://example.org/media/small.png"_s);
+        const QUrl large(u"https://example.org/media/large.mp4"_s);
+        const QUrl medium(u"https://example.org/media/medium.mp4"_s);
+        store(cache.get(), small, 10 * kibibyte);
+        store(cache.get(), large, 60 * kibibyte);
+        store(cache.get(), medium, 40 * kibibyte);
+
+        QVERIFY(contains(cache.get(), small));
+        QVERIFY(!contains(cache.get(), large));
+        QVERIFY(contains(cache.get(), medium));
+
+        diskCache->clear();
+
+        const QUrl reused(u"https://example.org/media/reused.mp4"_s);
+        const QUrl unused(u"https://example.org/media/unused.mp4"_s);
+        const QUrl latest(u"https://example.org/media/latest.mp4"_s);
+        store(cache.get(), reused, 40 * kibibyte);
+        store(cache.get(), unused, 35 * kibibyte);
+        for (int i = 0; i < 3; i++) {
+            read(cache.get(), reused);
+        }
+        store(cache.get(), latest, 25 * kibibyte);
+
+        QVERIFY(contains(cache.get(), reused));
+        QVERIFY(!contains(cache.get(), unused));
+        QVERIFY(contains(cache.get(), latest));
+    }
+
+    void testTrim()
+    {
+        const std::unique_ptr<QAbstractNetworkCache> cache(diskCache->createCache());
+        diskCache->setQuota(DiskCache::Previews, 100 * kibibyte);
+        for (int i = 0; i < 4; i++) {
+            store(cache.get(), QUrl(u"https://example.org/preview/%1.png"_s.arg(i)), 20 * kibibyte);
+        }
+        QVERIFY(diskCache->usage(DiskCache::Previews) >= 80 * kibibyte);
+
+        QSignalSpy changed(diskCache.get(), &DiskCache::statisticsChanged);
+        diskCache->trim();
+        QCOMPARE(changed.size(), 1);
+        QVERIFY(diskCache->usage(DiskCache::Previews) <= 50 * kibibyte);
+        QVERIFY(diskCache->usage(DiskCache::Previews) > 0);
+        QCOMPARE(diskCache->quota(DiskCache::Previews), 100 * kibibyte);
+    }
+
+    void testClear()
+    {
+        const std::unique_ptr<QAbstractNetworkCache> cache(diskCache->createCache());
+        const QUrl api(u"https://example.org/api/v1/instance"_s);
+        const QUrl media(u"https://example.org/media/a.mp4"_s);
+        store(cache.get(), api, kibibyte);
+        store(cache.get(), media, kibibyte);
+
+        diskCache->clear(DiskCache::Media);
+        QVERIFY(contains(cache.get(), api));
+        QVERIFY(!contains(cache.get(), media));
+
+        diskCache->clear();
+        QVERIFY(!contains(cache.get(), api));
+        QCOMPARE(cache->cacheSize(), 0);
+    }
+
+    void testStatistics()
+    {
+        const std::unique_ptr<QAbstractNetworkCache> cache(diskCache->createCache());
+        const QUrl avatar(u"https://example.org/accounts/avatars/1/original/a.png"_s);
+        store(cache.get(), avatar, kibibyte);
+
+        read(cache.get(), avatar);
+        read(cache.get(), avatar);
+        QVERIFY(!cache->data(QUrl(u"https://example.org/accounts/avatars/2/original/b.png"_s)));
+
+        const auto statistics = diskCache->statistics();
+        QCOMPARE(statistics.size(), DiskCache::partitionCount);
+
+        const auto avatars = statistics[DiskCache::Avatars].toMap();
+        QCOMPARE(avatars["partition"_L1].toInt(), int(DiskCache::Avatars));
+        QCOMPARE(avatars["hits"_L1].toInt(), 2);
+        QCOMPARE(avatars["misses"_L1].toInt(), 1);
+        QVERIFY(avatars["usage"_L1].toLongLong() >= kibibyte);
+        QCOMPARE(avatars["quota"_L1].toLongLong(), diskCache->quota(DiskCache::Avatars));
+    }
+
+private:
+    std::unique_ptr<QTemporaryDir> directory;
+    std::unique_ptr<DiskCache> diskCache;
+};
+
+QTEST_MAIN(DiskCacheTest)
+#include "diskcachetest.moc"
@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/emojiindex.h"
+
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+QStringList names(const QVariantList &emojis)
+{
+    QStringList names;
+    for (const auto &emoji : emojis) {
+        names.push_back(emoji.toString());
+    }
+    return names;
+}
+}
+
+class EmojiIndexTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init()
+    {
+        index.clear();
+        for (const auto &name : {u"grinning"_s, u"smiley"_s, u"smile"_s, u"blobcat"_s, u"BlobFox"_s, u"catface"_s, u"ablobcat_wave"_s}) {
+            index.add(name, name);
+        }
+    }
+
+    void testSearch_data()
+    {
+        QTest::addColumn<QString>("filter");
+        QTest::addColumn<QStringList>("expected");
+
+        QTest::addRow("one character") << u"g"_s << QStringList{u"grinning"_s};
+        QTest::addRow("two characters") << u"mi"_s << QStringList{u"smiley"_s, u"smile"_s};
+        QTest::addRow("prefix") << u"smile"_s << QStringList{u"smiley"_s, u"smile"_s};
+        QTest::addRow("prefix first") << u"cat"_s << QStringList{u"catface"_s, u"blobcat"_s, u"ablobcat_wave"_s};
+        QTest::addRow("long") << u"blobcat"_s << QStringList{u"blobcat"_s, u"ablobcat_wave"_s};
+        QTest::addRow("case") << u"BLOB"_s << QStringList{u"blobcat"_s, u"BlobFox"_s, u"ablobcat_wave"_s};
+        QTest::addRow("runs but no match") << u"catblob"_s << QStringList{};
+        QTest::addRow("unknown") << u"xyz"_s << QStringList{};
+        QTest::addRow("empty") << QString() << QStringList{u"grinning"_s, u"smiley"_s, u"smile"_s, u"blobcat"_s, u"BlobFox"_s, u"catface"_s, u"ablobcat_wave"_s};
+    }
+
+    void testSearch()
+    {
+        QFETCH(QString, filter);
+        QFETCH(QStringList, expected);
+
+        QCOMPARE(names(index.search(filter)), expected);
+    }
+
+    void testFind()
+    {
+        QCOMPARE(index.find(u"BlobFox"_s).toString(), u"BlobFox"_s);
+        QVERIFY(!index.find(u"blobfox"_s).isValid());
+        QVERIFY(!index.find(u"blob"_s).isValid());
+
+        // The first one added wins
+        index.add(u"smile"_s, u"duplicate"_s);
+        QCOMPARE(index.find(u"smile"_s).toString(), u"smile"_s);
+        QCOMPARE(index.size(), 8);
+    }
+
+    void testRepeatedRuns()
+    {
+        index.add(u"aaaa"_s, u"aaaa"_s);
+        // Listed once, however often a run appears in it
+        QCOMPARE(names(index.search(u"a"_s)), (QStringList{u"ablobcat_wave"_s, u"aaaa"_s, u"blobcat"_s, u"catface"_s}));
+        QCOMPARE(names(index.search(u"aa"_s)), QStringList{u"aaaa"_s});
+    }
+
+    void testMany()
+    {
+        index.clear();
+        for (int i = 0; i < 5000; i++) {
+            const QString name = u"emoji_%1"_s.arg(i);
+            index.add(name, name);
+        }
+
+        QCOMPARE(index.search(u"emoji_"_s).size(), 5000);
+        QCOMPARE(names(index.search(u"4999"_s)), QStringList{u"emoji_4999"_s});
+        QCOMPARE(index.search(u"_12"_s).size(), 111);
+        QCOMPARE(index.find(u"emoji_1234"_s).toString(), u"emoji_1234"_s);
+    }
+
+private:
+    EmojiIndex index;
+};
+
+QTEST_MAIN(EmojiIndexTest)
+#include "emojiindextest.moc"
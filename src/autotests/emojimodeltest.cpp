@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/emojimodel.h"
+
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+
+class EmojiModelTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testCategories()
+    {
+        EmojiModel model;
+
+        const auto smileys = model.emojis(nullptr, EmojiModel::Smileys);
+        QVERIFY(!smileys.isEmpty());
+        const auto grinning = qvariant_cast<Emoji>(smileys.first());
+        QCOMPARE(grinning.unicode, u"😀"_s);
+        QCOMPARE(grinning.shortName, u"grinning"_s);
+        QCOMPARE(grinning.description, u"grinning face"_s);
+
+        const auto flags = model.emojis(nullptr, EmojiModel::Flags);
+        QCOMPARE(qvariant_cast<Emoji>(flags.last()).description, u"Flag of Wales"_s);
+
+        QVERIFY(model.emojis(nullptr, EmojiModel::Search).isEmpty());
+        QVERIFY(model.emojis(nullptr, EmojiModel::History).isEmpty());
+    }
+
+    void testTones()
+    {
+        EmojiModel model;
+
+        const auto tones = model.tones(u"waving hand"_s);
+        QCOMPARE(tones.size(), 5);
+        QCOMPARE(qvariant_cast<Emoji>(tones.first()).shortName, u"wave_tone1"_s);
+        QCOMPARE(qvariant_cast<Emoji>(tones.last()).shortName, u"wave_tone5"_s);
+
+        QCOMPARE(model.tones(u"waving hand: medium skin tone"_s).size(), 5);
+        QVERIFY(model.tones(u"grinning face"_s).isEmpty());
+    }
+
+    void testSearch()
+    {
+        const auto results = EmojiModel::filterModel(nullptr, u"GRIN"_s);
+        QVERIFY(!results.isEmpty());
+        QCOMPARE(qvariant_cast<Emoji>(results.first()).shortName, u"grinning"_s);
+    }
+};
+
+QTEST_MAIN(EmojiModelTest)
+#include "emojimodeltest.moc"
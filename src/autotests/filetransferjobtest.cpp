@@ -0,0 +1,288 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/account.h"
+#include "account/accountmanager.h"
+#include "autotests/replayserver.h"
+#include "utils/filetransferjob.h"
+
+#include <QNetworkAccessManager>
+#include <QTemporaryDir>
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace std::chrono_literals;
+
+namespace
+{
+// Not repeating, so any misplaced chunk shows up
+QByteArray fileData(const qsizetype size)
+{
+    QByteArray data;
+    data.reserve(size);
+    for (qsizetype i = 0; i < size; i++) {
+        data.push_back(char((i * 7 + i / 251) % 256));
+    }
+    return data;
+}
+
+QByteArray readFile(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+    return file.readAll();
+}
+
+void writeFile(const QString &path, const QByteArray &data)
+{
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write(data);
+}
+}
+
+class FileTransferJobTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+        AccountManager::instance().setTestMode(true);
+
+        QVERIFY(server.listen());
+        QVERIFY(dir.isValid());
+
+        account = new Account(server.instanceUri(), &nam, this);
+    }
+
+    void testDownload()
+    {
+        const QByteArray data = fileData(10000);
+        server.addFile(u"/files/small.bin"_s, data);
+
+        const QString destination = dir.filePath(u"small.bin"_s);
+        QCOMPARE(run(u"/files/small.bin"_s, destination), 0);
+        QCOMPARE(readFile(destination), data);
+        QVERIFY(!QFile::exists(FileTransferJob::partialFileName(destination)));
+        QCOMPARE(server.requestCount(u"/files/small.bin"_s), 1);
+    }
+
+    // Large files are split up, and every segment asks for its own range
+    void testSegments()
+    {
+        const QByteArray data = fileData(64 * 1024 + 3);
+        server.addFile(u"/files/large.bin"_s, data);
+
+        const QString destination = dir.filePath(u"large.bin"_s);
+        QCOMPARE(run(u"/files/large.bin"_s, destination, 4, 16 * 1024), 0);
+        QCOMPARE(readFile(destination), data);
+        QVERIFY(!QFile::exists(FileTransferJob::partialFileName(destination) + u".sparse"_s));
+
+        QStringList ranges;
+        for (const auto &request : server.requests()) {
+            if (request.url.path() == "/files/large.bin"_L1) {
+                ranges.push_back(QString::fromLatin1(request.headers.value("range")));
+            }
+        }
+        // The first one doesn't know about segments yet, the others may arrive in any order
+        QCOMPARE(ranges.size(), 4);
+        QVERIFY(ranges.first().isEmpty());
+        QVERIFY(ranges.contains(u"bytes=16384-32767"_s));
+        QVERIFY(ranges.contains(u"bytes=32768-49151"_s));
+        QVERIFY(ranges.contains(u"bytes=49152-65538"_s));
+    }
+
+    // A connection which drops halfway continues where it left off
+    void testResumeDropped()
+    {
+        const QByteArray data = fileData(20000);
+        server.addRoute("GET", u"/files/flaky.bin"_s, [data, requests = 0](const ReplayServer::Request &request) mutable {
+            auto response = ReplayServer::rangeResponse(request, data);
+            if (++requests == 1) {
+                response.dropAfter = 5000;
+            }
+            return response;
+        });
+
+        const QString destination = dir.filePath(u"flaky.bin"_s);
+        QCOMPARE(run(u"/files/flaky.bin"_s, destination), 0);
+        QCOMPARE(readFile(destination), data);
+
+        const auto requests = server.requests();
+        QCOMPARE(requests.last().url.path(), u"/files/flaky.bin"_s);
+        QCOMPARE(requests.last().headers.value("range"), "bytes=5000-19999");
+    }
+
+    // What was downloaded is kept when it fails, and used by the next download to the same place
+    void testResumeFailed()
+    {
+        const QByteArray data = fileData(20000);
+        server.addRoute("GET", u"/files/broken.bin"_s, [this, data, requests = 0](const ReplayServer::Request &request) mutable {
+            auto response = ReplayServer::rangeResponse(request, data);
+            if (broken && ++requests > 1) {
+                return ReplayServer::Response{.status = 503, .body = {}, .headers = {}};
+            }
+            if (broken) {
+                response.dropAfter = 8000;
+            }
+            return response;
+        });
+
+        const QString destination = dir.filePath(u"broken.bin"_s);
+        QCOMPARE(run(u"/files/broken.bin"_s, destination), int(FileTransferJob::NetworkError));
+        QVERIFY(!QFile::exists(destination));
+        QCOMPARE(readFile(FileTransferJob::partialFileName(destination)), data.first(8000));
+
+        broken = false;
+        QCOMPARE(run(u"/files/broken.bin"_s, destination), 0);
+        QCOMPARE(readFile(destination), data);
+        QCOMPARE(server.requests().last().headers.value("range"), "bytes=8000-");
+    }
+
+    // Servers which don't understand ranges send all of it, which replaces the partial file
+    void testNoRanges()
+    {
+        const QByteArray data = fileData(3000);
+        server.addRoute("GET", u"/files/plain.bin"_s, [data](const ReplayServer::Request &) {
+            return ReplayServer::Response{.status = 200, .body = data, .headers = {{"Content-Type", "application/octet-stream"}}};
+        });
+
+        const QString destination = dir.filePath(u"plain.bin"_s);
+        writeFile(FileTransferJob::partialFileName(destination), "something else");
+
+        QCOMPARE(run(u"/files/plain.bin"_s, destination, 4, 1000), 0);
+        QCOMPARE(readFile(destination), data);
+        QCOMPARE(server.requestCount(u"/files/plain.bin"_s), 1);
+    }
+
+    // A partial file which is already complete can't be resumed, so it starts over
+    void testRangeNotSatisfiable()
+    {
+        // Shorter than before, but the server didn't notice it changed
+        const QByteArray data = fileData(2000);
+        server.addRoute("GET", u"/files/done.bin"_s, [this, data](const ReplayServer::Request &request) {
+            return interruptible(request, ReplayServer::rangeResponse(request, interruptAt >= 0 ? data : data.first(500), "\"same\""));
+        });
+
+        const QString destination = dir.filePath(u"done.bin"_s);
+        interrupt(u"/files/done.bin"_s, destination, 1000);
+        writeFile(destination, "an older file");
+
+        QCOMPARE(run(u"/files/done.bin"_s, destination), 0);
+        QCOMPARE(readFile(destination), data.first(500));
+
+        const auto requests = server.requests();
+        QCOMPARE(requests[requests.size() - 2].headers.value("range"), "bytes=1000-");
+        QVERIFY(requests.last().headers.value("range").isEmpty());
+    }
+
+    // A partial file is only continued for the same URL, and only as long as the file didn't change on the server
+    void testChangedFile()
+    {
+        const QByteArray oldData = fileData(6000);
+        const QByteArray newData = fileData(7000).sliced(1000);
+        server.addRoute("GET", u"/files/changed.bin"_s, [this, oldData, newData](const ReplayServer::Request &request) {
+            return interruptible(request, ReplayServer::rangeResponse(request, interruptAt >= 0 ? oldData : newData));
+        });
+        const QString destination = dir.filePath(u"changed.bin"_s);
+
+        interrupt(u"/files/changed.bin"_s, destination, 3000);
+        QCOMPARE(run(u"/files/changed.bin"_s, destination), 0);
+        QCOMPARE(readFile(destination), newData);
+        QCOMPARE(server.requests().last().headers.value("range"), "bytes=3000-");
+        QVERIFY(!server.requests().last().headers.value("if-range").isEmpty());
+
+        // Another file downloaded to the same place
+        const QByteArray otherData = fileData(5000);
+        server.addFile(u"/files/other.bin"_s, otherData);
+
+        interrupt(u"/files/changed.bin"_s, destination, 3000);
+        QCOMPARE(run(u"/files/other.bin"_s, destination), 0);
+        QCOMPARE(readFile(destination), otherData);
+        QVERIFY(server.requests().last().headers.value("range").isEmpty());
+
+        // Servers which don't understand If-Range send the rest of the new file, which doesn't belong to the old part
+        server.addRoute("GET", u"/files/changed.bin"_s, [this, oldData, newData](const ReplayServer::Request &request) {
+            ReplayServer::Request withoutIfRange = request;
+            withoutIfRange.headers.remove("if-range");
+            return interruptible(request, ReplayServer::rangeResponse(withoutIfRange, interruptAt >= 0 ? oldData : newData));
+        });
+
+        interrupt(u"/files/changed.bin"_s, destination, 3000);
+        QCOMPARE(run(u"/files/changed.bin"_s, destination), 0);
+        QCOMPARE(readFile(destination), newData);
+        QVERIFY(server.requests().last().headers.value("range").isEmpty());
+    }
+
+    // A partial file with gaps from a crash isn't trusted
+    void testCrashed()
+    {
+        const QByteArray data = fileData(4000);
+        server.addFile(u"/files/crashed.bin"_s, data);
+
+        const QString destination = dir.filePath(u"crashed.bin"_s);
+        writeFile(FileTransferJob::partialFileName(destination), QByteArray(4000, '\0'));
+        writeFile(FileTransferJob::partialFileName(destination) + u".sparse"_s, {});
+
+        QCOMPARE(run(u"/files/crashed.bin"_s, destination), 0);
+        QCOMPARE(readFile(destination), data);
+        QVERIFY(server.requests().last().headers.value("range").isEmpty());
+    }
+
+private:
+    // While interrupting, the first request for a file drops halfway and every later one fails
+    ReplayServer::Response interruptible(const ReplayServer::Request &request, ReplayServer::Response response) const
+    {
+        if (interruptAt < 0) {
+            return response;
+        }
+        if (request.headers.contains("range")) {
+            return ReplayServer::Response{.status = 503, .body = {}, .headers = {}};
+        }
+        response.dropAfter = interruptAt;
+        return response;
+    }
+
+    // Leaves the first @p size bytes of @p path behind in the partial file for @p destination
+    void interrupt(const QString &path, const QString &destination, const qsizetype size)
+    {
+        interruptAt = size;
+        QCOMPARE(run(path, destination), int(FileTransferJob::NetworkError));
+        interruptAt = -1;
+        QCOMPARE(QFileInfo(FileTransferJob::partialFileName(destination)).size(), size);
+    }
+
+    int run(const QString &path, const QString &destination, const int segments = 1, const qint64 minimumSegmentSize = 1024 * 1024)
+    {
+        auto job = new FileTransferJob(account, server.url(path).toString(), destination);
+        job->setAutoDelete(false);
+        job->setMaxSegments(segments);
+        job->setMinimumSegmentSize(minimumSegmentSize);
+        job->setRetryDelay(10ms);
+
+        QSignalSpy result(job, &KJob::result);
+        job->start();
+        if (!result.wait()) {
+            delete job;
+            return -1;
+        }
+
+        const int error = job->error();
+        delete job;
+        return error;
+    }
+
+    ReplayServer server;
+    QNetworkAccessManager nam;
+    QTemporaryDir dir;
+    Account *account = nullptr;
+    bool broken = true;
+    qsizetype interruptAt = -1;
+};
+
+QTEST_MAIN(FileTransferJobTest)
+#include "filetransferjobtest.moc"
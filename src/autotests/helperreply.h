@@ -38,5 +38,15 @@ public:
         QNetworkReply::setRawHeader(headerName, value);
     }
 
+    void setAttribute(QNetworkRequest::Attribute code, const QVariant &value)
+    {
+        QNetworkReply::setAttribute(code, value);
+    }
+
+    void setUrl(const QUrl &url)
+    {
+        QNetworkReply::setUrl(url);
+    }
+
     QFile apiResult;
 };
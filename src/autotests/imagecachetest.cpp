@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "autotests/replayserver.h"
+#include "utils/imagecache.h"
+
+#include <QBuffer>
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+QByteArray png(const QSize &size)
+{
+    QImage image(size, QImage::Format_RGB32);
+    image.fill(Qt::darkCyan);
+
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "PNG");
+    return data;
+}
+}
+
+class ImageCacheTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+
+        QVERIFY(server.listen());
+        for (const auto &path : {u"/avatar.png"_s, u"/preview.png"_s}) {
+            server.addRoute("GET", path, [](const ReplayServer::Request &) {
+                return ReplayServer::Response{.status = 200, .body = png(QSize(200, 100)), .headers = {{"Content-Type", "image/png"}}};
+            });
+        }
+    }
+
+    void testTargetSize_data()
+    {
+        QTest::addColumn<QSize>("original");
+        QTest::addColumn<QSize>("requested");
+        QTest::addColumn<QSize>("expected");
+
+        QTest::addRow("cover") << QSize(200, 100) << QSize(32, 32) << QSize(64, 32);
+        QTest::addRow("width only") << QSize(200, 100) << QSize(50, -1) << QSize(50, 25);
+        QTest::addRow("height only") << QSize(200, 100) << QSize(0, 20) << QSize(40, 20);
+        QTest::addRow("no size") << QSize(200, 100) << QSize() << QSize(200, 100);
+        QTest::addRow("never larger") << QSize(20, 20) << QSize(64, 64) << QSize(20, 20);
+    }
+
+    void testTargetSize()
+    {
+        QFETCH(QSize, original);
+        QFETCH(QSize, requested);
+        QFETCH(QSize, expected);
+
+        QCOMPARE(ImageCache::targetSize(original, requested), expected);
+    }
+
+    void testRequest()
+    {
+        ImageCache cache;
+        const QUrl url = server.url(u"/avatar.png"_s);
+
+        QImage first;
+        cache.request(url, QSize(32, 32), this, [&first](const QImage &image) {
+            first = image;
+        });
+        QTRY_VERIFY(!first.isNull());
+
+        QCOMPARE(first.size(), QSize(64, 32));
+        QCOMPARE(first.format(), QImage::Format_RGB32);
+        QCOMPARE(cache.cached(url, QSize(32, 32)).cacheKey(), first.cacheKey());
+
+        QImage second;
+        cache.request(url, QSize(32, 32), this, [&second](const QImage &image) {
+            second = image;
+        });
+        QTRY_VERIFY(!second.isNull());
+        QCOMPARE(second.cacheKey(), first.cacheKey());
+
+        const auto statistics = cache.statistics();
+        QCOMPARE(statistics[u"misses"_s].toInt(), 1);
+        QCOMPARE(statistics[u"hits"_s].toInt(), 1);
+        QCOMPARE(statistics[u"decodes"_s].toInt(), 1);
+        QCOMPARE(statistics[u"count"_s].toInt(), 1);
+    }
+
+    // Everyone asking while it's loading should share one download
+    void testJoined()
+    {
+        ImageCache cache;
+        const QUrl url = server.url(u"/preview.png"_s);
+        const auto before = server.requestCount(u"/preview.png"_s);
+
+        QList<QSize> sizes;
+        for (const auto &size : {QSize(16, 16), QSize(16, 16), QSize(48, 48)}) {
+            cache.request(url, size, this, [&sizes](const QImage &image) {
+                sizes.push_back(image.size());
+            });
+        }
+
+        QTRY_COMPARE(sizes.size(), 3);
+        QVERIFY(sizes.contains(QSize(32, 16)));
+        QVERIFY(sizes.contains(QSize(96, 48)));
+
+        QCOMPARE(server.requestCount(u"/preview.png"_s), before + 1);
+
+        const auto statistics = cache.statistics();
+        QCOMPARE(statistics[u"misses"_s].toInt(), 2);
+        QCOMPARE(statistics[u"joined"_s].toInt(), 1);
+    }
+
+    void testFailure()
+    {
+        ImageCache cache;
+
+        bool called = false;
+        QImage result;
+        cache.request(server.url(u"/missing.png"_s), QSize(32, 32), this, [&called, &result](const QImage &image) {
+            called = true;
+            result = image;
+        });
+
+        QTRY_VERIFY(called);
+        QVERIFY(result.isNull());
+        QCOMPARE(cache.statistics()[u"failures"_s].toInt(), 1);
+        QCOMPARE(cache.statistics()[u"count"_s].toInt(), 0);
+    }
+
+    void testSource()
+    {
+        QCOMPARE(ImageCache::source({}), QUrl());
+
+        const QUrl url(u"https://files.example.org/accounts/avatars/000/000/001/original/a.png?v=1"_s);
+        const QUrl source = ImageCache::source(url);
+        QCOMPARE(source.scheme(), u"image"_s);
+        QCOMPARE(source.host(), u"remote"_s);
+    }
+
+private:
+    ReplayServer server;
+};
+
+QTEST_MAIN(ImageCacheTest)
+#include "imagecachetest.moc"
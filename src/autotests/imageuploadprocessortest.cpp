@@ -0,0 +1,224 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "editor/imageuploadprocessor.h"
+
+#include <QBuffer>
+#include <QRandomGenerator>
+#include <QTemporaryDir>
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+QImage gradient(const QSize &size)
+{
+    QImage image(size, QImage::Format_RGB32);
+    for (int y = 0; y < size.height(); y++) {
+        for (int x = 0; x < size.width(); x++) {
+            image.setPixel(x, y, qRgb(x * 255 / size.width(), y * 255 / size.height(), 128));
+        }
+    }
+    return image;
+}
+
+QByteArray jpeg(const QImage &image, const int quality, const bool exif)
+{
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "JPEG", quality);
+
+    if (exif) {
+        // An APP1 segment with an empty, but valid looking, EXIF header right after the start of image marker
+        const QByteArray payload = QByteArrayLiteral("Exif\0\0MM\0*\0\0\0\x08\0\0");
+        QByteArray segment = QByteArrayLiteral("\xFF\xE1");
+        segment.append(static_cast<char>((payload.size() + 2) >> 8));
+        segment.append(static_cast<char>((payload.size() + 2) & 0xFF));
+        segment.append(payload);
+        data.insert(2, segment);
+    }
+    return data;
+}
+
+quint32 crc32(const QByteArrayView data)
+{
+    quint32 crc = 0xFFFFFFFF;
+    for (const char c : data) {
+        crc ^= static_cast<uchar>(c);
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+QByteArray png(const QImage &image, const bool exif)
+{
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "PNG");
+
+    if (exif) {
+        // An eXIf chunk with an empty EXIF header right after IHDR, which is 8 + 4 + 4 + 13 + 4 bytes in
+        const QByteArray payload = QByteArrayLiteral("MM\0*\0\0\0\x08\0\0");
+        QByteArray chunk;
+        QDataStream stream(&chunk, QIODevice::WriteOnly);
+        stream << quint32(payload.size());
+        stream.writeRawData("eXIf", 4);
+        stream.writeRawData(payload.constData(), payload.size());
+        stream << crc32(QByteArray("eXIf" + payload));
+        data.insert(33, chunk);
+    }
+    return data;
+}
+
+QString write(const QTemporaryDir &dir, const QString &name, const QByteArray &data)
+{
+    const QString path = dir.filePath(name);
+    QFile file(path);
+    file.open(QIODevice::WriteOnly);
+    file.write(data);
+    return path;
+}
+}
+
+class ImageUploadProcessorTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testClampedSize_data()
+    {
+        QTest::addColumn<QSize>("size");
+        QTest::addColumn<qint64>("maxPixels");
+        QTest::addColumn<QSize>("expected");
+
+        QTest::addRow("no limit") << QSize(4000, 3000) << qint64(0) << QSize(4000, 3000);
+        QTest::addRow("below") << QSize(400, 300) << qint64(120000) << QSize(400, 300);
+        QTest::addRow("landscape") << QSize(4000, 3000) << qint64(3000000) << QSize(2000, 1500);
+        QTest::addRow("portrait") << QSize(3000, 4000) << qint64(3000000) << QSize(1500, 2000);
+        QTest::addRow("thin") << QSize(10000, 1) << qint64(100) << QSize(100, 1);
+    }
+
+    void testClampedSize()
+    {
+        QFETCH(QSize, size);
+        QFETCH(qint64, maxPixels);
+        QFETCH(QSize, expected);
+
+        const QSize clamped = ImageUploadProcessor::clampedSize(size, maxPixels);
+        QCOMPARE(clamped, expected);
+        QVERIFY(maxPixels == 0 || static_cast<qint64>(clamped.width()) * clamped.height() <= maxPixels);
+    }
+
+    void testHasMetadata()
+    {
+        const QImage image = gradient(QSize(16, 16));
+        QVERIFY(ImageUploadProcessor::hasMetadata(jpeg(image, 80, true)));
+        QVERIFY(!ImageUploadProcessor::hasMetadata(jpeg(image, 80, false)));
+        QVERIFY(ImageUploadProcessor::hasMetadata(png(image, true)));
+        QVERIFY(!ImageUploadProcessor::hasMetadata(png(image, false)));
+
+        const QByteArray webp = QByteArrayLiteral("RIFF\x1A\0\0\0WEBPVP8L\x01\0\0\0\0\0");
+        QVERIFY(!ImageUploadProcessor::hasMetadata(webp));
+        QVERIFY(ImageUploadProcessor::hasMetadata(webp + QByteArrayLiteral("EXIF\x02\0\0\0MM")));
+
+        // Nothing is known about it, so it could have some
+        QVERIFY(ImageUploadProcessor::hasMetadata(QByteArrayLiteral("not an image")));
+    }
+
+    void testProcessFile()
+    {
+        QTemporaryDir dir;
+        const QByteArray original = jpeg(gradient(QSize(400, 300)), 100, true);
+        const QString path = write(dir, u"photo.jpeg"_s, original);
+
+        const auto result = ImageUploadProcessor::processFile(path, {.maxPixels = 30000, .quality = 80});
+        QVERIFY(!result.isNull());
+        QCOMPARE(result.fileName, u"photo.jpg"_s);
+        QCOMPARE(result.mimeType, u"image/jpeg"_s);
+        QCOMPARE(result.originalSize, static_cast<qint64>(original.size()));
+        QVERIFY(result.bytesSaved() > 0);
+        QVERIFY(!ImageUploadProcessor::hasMetadata(result.data));
+
+        const QImage uploaded = QImage::fromData(result.data);
+        QCOMPARE(uploaded.size(), QSize(200, 150));
+    }
+
+    // Metadata is stripped even if it doesn't need to be scaled down
+    void testStripsExif()
+    {
+        QTemporaryDir dir;
+        const QString path = write(dir, u"photo.jpg"_s, jpeg(gradient(QSize(64, 64)), 30, true));
+
+        const auto result = ImageUploadProcessor::processFile(path, {.quality = 95});
+        QVERIFY(!result.isNull());
+        QVERIFY(!ImageUploadProcessor::hasMetadata(result.data));
+    }
+
+    // Not only JPEGs carry metadata
+    void testStripsPngExif()
+    {
+        QTemporaryDir dir;
+        const QByteArray original = png(gradient(QSize(64, 64)), true);
+        QVERIFY(!QImage::fromData(original).isNull());
+        const QString path = write(dir, u"screenshot.png"_s, original);
+
+        const auto result = ImageUploadProcessor::processFile(path, {.quality = 95});
+        QVERIFY(!result.isNull());
+        QVERIFY(!ImageUploadProcessor::hasMetadata(result.data));
+    }
+
+    // Re-encoding an already small image would only make it worse
+    void testKeepsSmallOriginal()
+    {
+        QTemporaryDir dir;
+        const QString path = write(dir, u"small.jpg"_s, jpeg(gradient(QSize(64, 64)), 30, false));
+
+        QVERIFY(ImageUploadProcessor::processFile(path, {.quality = 95}).isNull());
+    }
+
+    void testNotAnImage()
+    {
+        QTemporaryDir dir;
+        const QString path = write(dir, u"video.mp4"_s, QByteArrayLiteral("\0\0\0\x18" "ftypmp42"));
+
+        QVERIFY(ImageUploadProcessor::processFile(path, {}).isNull());
+        QVERIFY(ImageUploadProcessor::processFile(dir.filePath(u"missing.png"_s), {}).isNull());
+    }
+
+    void testTransparency()
+    {
+        QImage transparent(32, 32, QImage::Format_ARGB32);
+        transparent.fill(Qt::transparent);
+        QCOMPARE(ImageUploadProcessor::processImage(transparent, u"pasted"_s, {}).mimeType, u"image/png"_s);
+
+        // Clipboard images usually have an alpha channel, even if they don't use it
+        QImage opaque(32, 32, QImage::Format_ARGB32);
+        opaque.fill(Qt::red);
+        const auto result = ImageUploadProcessor::processImage(opaque, u"pasted"_s, {});
+        QCOMPARE(result.mimeType, u"image/jpeg"_s);
+        QCOMPARE(result.fileName, u"pasted.jpg"_s);
+    }
+
+    void testSizeLimit()
+    {
+        QImage noise(512, 512, QImage::Format_RGB32);
+        QRandomGenerator random(42);
+        for (int y = 0; y < noise.height(); y++) {
+            for (int x = 0; x < noise.width(); x++) {
+                noise.setPixel(x, y, random.generate());
+            }
+        }
+
+        const auto result = ImageUploadProcessor::processImage(noise, u"noise"_s, {.maxBytes = 40000, .quality = 90});
+        QVERIFY(!result.isNull());
+        QVERIFY(result.data.size() <= 40000);
+    }
+};
+
+QTEST_MAIN(ImageUploadProcessorTest)
+#include "imageuploadprocessortest.moc"
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/account.h"
+#include "account/accountmanager.h"
+#include "account/interactionqueue.h"
+#include "autotests/replayserver.h"
+
+#include <QNetworkAccessManager>
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace std::chrono_literals;
+
+class InteractionQueueTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+        AccountManager::instance().setTestMode(true);
+
+        QVERIFY(server.listen());
+
+        account = new Account(server.instanceUri(), &nam, this);
+        queue = account->interactionQueue();
+        queue->setBatchDelay(50ms);
+        queue->setRetryDelay(20ms, 100ms);
+    }
+
+    void testToggledBack()
+    {
+        QSignalSpy changed(queue, &InteractionQueue::interactionChanged);
+
+        queue->enqueue(u"1"_s, InteractionQueue::Favourite, true);
+        QVERIFY(queue->pendingState(u"1"_s, InteractionQueue::Favourite) == true);
+        queue->enqueue(u"1"_s, InteractionQueue::Favourite, false);
+
+        QCOMPARE(changed.count(), 2);
+        QCOMPARE(queue->pendingCount(), 0);
+
+        QTest::qWait(150);
+        QCOMPARE(server.requestCount(u"/api/v1/statuses/1/favourite"_s), 0);
+        QCOMPARE(server.requestCount(u"/api/v1/statuses/1/unfavourite"_s), 0);
+    }
+
+    void testDelivery()
+    {
+        server.addRoute("POST", u"/api/v1/statuses/2/reblog"_s, [](const ReplayServer::Request &) {
+            return ReplayServer::Response{.status = 200, .body = ReplayServer::fixture(u"status.json"_s), .headers = {}};
+        });
+
+        QSignalSpy fetchedTimeline(account, &AbstractAccount::fetchedTimeline);
+
+        queue->enqueue(u"2"_s, InteractionQueue::Reblog, true);
+        QCOMPARE(queue->pendingCount(), 1);
+
+        QTRY_COMPARE(queue->pendingCount(), 0);
+        QCOMPARE(server.requestCount(u"/api/v1/statuses/2/reblog"_s), 1);
+
+        // Boosts show up in the home timeline
+        QCOMPARE(fetchedTimeline.count(), 1);
+        QCOMPARE(fetchedTimeline.first().first().toString(), u"home"_s);
+    }
+
+    void testRetry()
+    {
+        server.addRoute("POST", u"/api/v1/statuses/3/bookmark"_s, [attempt = 0](const ReplayServer::Request &) mutable {
+            if (attempt++ == 0) {
+                return ReplayServer::Response{.status = 503, .body = R"({"error":"Unavailable"})", .headers = {}};
+            }
+            return ReplayServer::Response{.status = 200, .body = ReplayServer::fixture(u"status.json"_s), .headers = {}};
+        });
+
+        QSignalSpy errors(account, &AbstractAccount::errorOccured);
+
+        queue->enqueue(u"3"_s, InteractionQueue::Bookmark, true);
+
+        QTRY_COMPARE(server.requestCount(u"/api/v1/statuses/3/bookmark"_s), 2);
+        QTRY_COMPARE(queue->pendingCount(), 0);
+        QCOMPARE(errors.count(), 0);
+    }
+
+    void testRejected()
+    {
+        server.addRoute("POST", u"/api/v1/statuses/4/pin"_s, [](const ReplayServer::Request &) {
+            return ReplayServer::Response{.status = 422, .body = R"({"error":"Validation failed"})", .headers = {}};
+        });
+
+        QSignalSpy changed(queue, &InteractionQueue::interactionChanged);
+        QSignalSpy errors(account, &AbstractAccount::errorOccured);
+
+        queue->enqueue(u"4"_s, InteractionQueue::Pin, true);
+
+        QTRY_COMPARE(errors.count(), 1);
+        QCOMPARE(queue->pendingCount(), 0);
+        QCOMPARE(server.requestCount(u"/api/v1/statuses/4/pin"_s), 1);
+
+        // Shown as pinned at first, then put back
+        QCOMPARE(changed.count(), 2);
+        QCOMPARE(changed.last().at(0).toString(), u"4"_s);
+        QCOMPARE(changed.last().at(1).value<InteractionQueue::Kind>(), InteractionQueue::Pin);
+        QCOMPARE(changed.last().at(2).toBool(), false);
+    }
+
+    void testGivesUp()
+    {
+        server.addRoute("POST", u"/api/v1/statuses/5/mute"_s, [](const ReplayServer::Request &) {
+            return ReplayServer::Response{.status = 503, .body = R"({"error":"Unavailable"})", .headers = {}};
+        });
+
+        QSignalSpy changed(queue, &InteractionQueue::interactionChanged);
+        QSignalSpy errors(account, &AbstractAccount::errorOccured);
+
+        queue->setMaxAttempts(3);
+        queue->enqueue(u"5"_s, InteractionQueue::Mute, true);
+
+        QTRY_COMPARE(errors.count(), 1);
+        QCOMPARE(queue->pendingCount(), 0);
+        QCOMPARE(server.requestCount(u"/api/v1/statuses/5/mute"_s), 3);
+        QCOMPARE(changed.last().at(2).toBool(), false);
+
+        QTest::qWait(300);
+        QCOMPARE(server.requestCount(u"/api/v1/statuses/5/mute"_s), 3);
+        queue->setMaxAttempts(10);
+    }
+
+    void testFromVerb()
+    {
+        QVERIFY(InteractionQueue::fromVerb(u"unreblog"_s) == std::pair(InteractionQueue::Reblog, false));
+        QVERIFY(InteractionQueue::fromVerb(u"favourite"_s) == std::pair(InteractionQueue::Favourite, true));
+        QVERIFY(!InteractionQueue::fromVerb(u"reply"_s));
+    }
+
+private:
+    ReplayServer server;
+    QNetworkAccessManager nam;
+    Account *account = nullptr;
+    InteractionQueue *queue = nullptr;
+};
+
+QTEST_MAIN(InteractionQueueTest)
+#include "interactionqueuetest.moc"
@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/account.h"
+#include "account/accountmanager.h"
+#include "network/jsonarrayreader.h"
+
+#include <QNetworkAccessManager>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+
+class JsonArrayReaderTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    static QByteArray readFile(const QString &name)
+    {
+        QFile file(QLatin1String(DATA_DIR "/%1").arg(name));
+        file.open(QIODevice::ReadOnly);
+        return file.readAll();
+    }
+
+    static QByteArray httpChunk(const QByteArray &data)
+    {
+        return QByteArray::number(data.size(), 16) + "\r\n" + data + "\r\n";
+    }
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        AccountManager::instance().setTestMode(true);
+    }
+
+    // No matter how the response is split up, the same elements should come out
+    void testChunked_data()
+    {
+        QTest::addColumn<qsizetype>("chunkSize");
+
+        QTest::newRow("byte by byte") << qsizetype(1);
+        QTest::newRow("7 bytes") << qsizetype(7);
+        QTest::newRow("64 bytes") << qsizetype(64);
+        QTest::newRow("4 KiB") << qsizetype(4096);
+    }
+
+    void testChunked()
+    {
+        QFETCH(qsizetype, chunkSize);
+
+        const QByteArray data = readFile(u"statuses.json"_s);
+        const QJsonArray expected = QJsonDocument::fromJson(data).array();
+        QVERIFY(!expected.isEmpty());
+
+        JsonArrayReader reader;
+        QJsonArray elements;
+        for (qsizetype i = 0; i < data.size(); i += chunkSize) {
+            for (const auto &element : reader.feed(QByteArrayView(data).sliced(i, std::min(chunkSize, data.size() - i)))) {
+                elements.push_back(element);
+            }
+            // Each element is handed out as soon as it's complete, not at the end
+            if (elements.size() < expected.size()) {
+                QVERIFY(!reader.atEnd());
+            }
+        }
+
+        QVERIFY(!reader.hasError());
+        QVERIFY(reader.atEnd());
+        QCOMPARE(reader.elementCount(), expected.size());
+        QCOMPARE(elements, expected);
+    }
+
+    void testValues()
+    {
+        const QByteArray data = R"( [1, -2.5e3, "a \"quoted\" ] bracket", true, null, {"a": "}", "b": [1, {"c": "\\"}]}, [[], {}], "" ] )";
+
+        JsonArrayReader reader;
+        QJsonArray elements;
+        for (const char c : data) {
+            for (const auto &element : reader.feed(QByteArrayView(&c, 1))) {
+                elements.push_back(element);
+            }
+        }
+
+        QVERIFY2(!reader.hasError(), qPrintable(reader.errorString()));
+        QVERIFY(reader.atEnd());
+        QCOMPARE(elements, QJsonDocument::fromJson(data).array());
+    }
+
+    void testEmpty()
+    {
+        JsonArrayReader reader;
+        QVERIFY(reader.feed(" [ \n ] ").isEmpty());
+        QVERIFY(!reader.hasError());
+        QVERIFY(reader.atEnd());
+    }
+
+    void testErrors_data()
+    {
+        QTest::addColumn<QByteArray>("data");
+        QTest::addColumn<int>("validElements");
+
+        QTest::newRow("object") << QByteArray(R"({"error": "Record not found"})") << 0;
+        QTest::newRow("trailing comma") << QByteArray("[1, 2,]") << 2;
+        QTest::newRow("missing comma") << QByteArray("[1 2]") << 1;
+        QTest::newRow("invalid element") << QByteArray(R"([{"a": 1}, {"a" 2}])") << 1;
+        QTest::newRow("trailing data") << QByteArray("[1] 2") << 1;
+    }
+
+    void testErrors()
+    {
+        QFETCH(QByteArray, data);
+        QFETCH(int, validElements);
+
+        JsonArrayReader reader;
+        const auto elements = reader.feed(data);
+
+        QVERIFY(reader.hasError());
+        QVERIFY(!reader.errorString().isEmpty());
+        QCOMPARE(elements.size(), validElements);
+
+        // Nothing more is read after an error
+        QVERIFY(reader.feed("[1]").isEmpty());
+    }
+
+    // The elements should reach the callback while the rest of the response is still on its way
+    void testAccount()
+    {
+        QTcpServer server;
+        QVERIFY(server.listen(QHostAddress::LocalHost));
+
+        QPointer<QTcpSocket> socket;
+        connect(&server, &QTcpServer::newConnection, this, [&server, &socket] {
+            socket = server.nextPendingConnection();
+            socket->write(
+                "HTTP/1.1 200 OK\r\n"
+                "Content-Type: application/json\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n");
+        });
+
+        QNetworkAccessManager nam;
+        Account account(u"http://127.0.0.1:%1"_s.arg(server.serverPort()), &nam);
+
+        QJsonArray received;
+        bool finished = false;
+        account.getArray(
+            QUrl(u"http://127.0.0.1:%1/api/v1/timelines/home"_s.arg(server.serverPort())),
+            true,
+            this,
+            [&received](QNetworkReply *, const QJsonArray &elements) {
+                for (const auto &element : elements) {
+                    received.push_back(element);
+                }
+            },
+            [&finished](QNetworkReply *) {
+                finished = true;
+            });
+
+        QTRY_VERIFY(socket);
+        socket->write(httpChunk(R"([{"id": "1"}, {"id": )"));
+        QTRY_COMPARE(received.size(), 1);
+        QVERIFY(!finished);
+
+        socket->write(httpChunk(R"("2"}, {"id": "3"}])"));
+        socket->write(httpChunk({}));
+        QTRY_VERIFY(finished);
+
+        QCOMPARE(received.size(), 3);
+        QCOMPARE(received.last()["id"_L1].toString(), u"3"_s);
+    }
+};
+
+QTEST_MAIN(JsonArrayReaderTest)
+#include "jsonarrayreadertest.moc"
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/account.h"
+#include "account/accountmanager.h"
+#include "account/markersync.h"
+#include "autotests/replayserver.h"
+
+#include <QJsonDocument>
+#include <QNetworkAccessManager>
+#include <QUrlQuery>
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace std::chrono_literals;
+
+class MarkerSyncTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+        AccountManager::instance().setTestMode(true);
+
+        QVERIFY(server.listen());
+        server.addRoute("POST", u"/api/v1/markers"_s, [this](const ReplayServer::Request &request) {
+            if (failing) {
+                return ReplayServer::Response{.status = 503, .body = {}, .headers = {}};
+            }
+
+            const QUrlQuery formdata(QString::fromUtf8(request.body));
+
+            QJsonObject markers;
+            for (const auto &timeline : {u"home"_s, u"notifications"_s}) {
+                const QString lastReadId = formdata.queryItemValue(u"%1[last_read_id]"_s.arg(timeline));
+                if (!lastReadId.isEmpty()) {
+                    markers[timeline] = QJsonObject{{u"last_read_id"_s, lastReadId}, {u"version"_s, 1}};
+                }
+            }
+            return ReplayServer::Response{.status = 200, .body = QJsonDocument(markers).toJson(), .headers = {}};
+        });
+
+        account = new Account(server.instanceUri(), &nam, this);
+        markers = account->markerSync();
+        markers->setDebounceInterval(50ms);
+    }
+
+    void testIsNewer()
+    {
+        QVERIFY(MarkerSync::isNewer(u"110000000000000001"_s, u"99999999999999999"_s));
+        QVERIFY(MarkerSync::isNewer(u"2"_s, u"1"_s));
+        QVERIFY(MarkerSync::isNewer(u"1"_s, QString()));
+        QVERIFY(!MarkerSync::isNewer(u"1"_s, u"1"_s));
+    }
+
+    // Scrolling through a backlog should only save where it ended, once
+    void testCoalesced()
+    {
+        account->saveTimelinePosition(u"home"_s, u"100"_s);
+        account->saveTimelinePosition(u"home"_s, u"102"_s);
+        account->saveTimelinePosition(u"home"_s, u"101"_s);
+        account->saveTimelinePosition(u"notifications"_s, u"7"_s);
+
+        QCOMPARE(markers->lastRead(u"home"_s), u"102"_s);
+        QVERIFY(markers->hasPending());
+        QCOMPARE(server.requestCount(u"/api/v1/markers"_s), 0);
+
+        QTRY_COMPARE(server.requestCount(u"/api/v1/markers"_s), 1);
+        QVERIFY(!markers->hasPending());
+
+        const QUrlQuery formdata(QString::fromUtf8(server.requests().last().body));
+        QCOMPARE(formdata.queryItemValue(u"home[last_read_id]"_s), u"102"_s);
+        QCOMPARE(formdata.queryItemValue(u"notifications[last_read_id]"_s), u"7"_s);
+
+        QTest::qWait(150);
+        QCOMPARE(server.requestCount(u"/api/v1/markers"_s), 1);
+    }
+
+    void testNeverBackwards()
+    {
+        markers->setKnownLastRead(u"home"_s, u"200"_s);
+
+        account->saveTimelinePosition(u"home"_s, u"150"_s);
+        QVERIFY(!markers->hasPending());
+        QCOMPARE(markers->lastRead(u"home"_s), u"200"_s);
+
+        // Read further on another device in the meantime
+        account->saveTimelinePosition(u"home"_s, u"250"_s);
+        markers->setKnownLastRead(u"home"_s, u"300"_s);
+        QVERIFY(!markers->hasPending());
+    }
+
+    void testFlush()
+    {
+        const auto before = server.requestCount(u"/api/v1/markers"_s);
+
+        account->saveTimelinePosition(u"notifications"_s, u"8"_s);
+        markers->flush();
+        QVERIFY(!markers->hasPending());
+
+        QTRY_COMPARE(server.requestCount(u"/api/v1/markers"_s), before + 1);
+        const QUrlQuery formdata(QString::fromUtf8(server.requests().last().body));
+        QCOMPARE(formdata.queryItemValue(u"notifications[last_read_id]"_s), u"8"_s);
+        QVERIFY(!formdata.hasQueryItem(u"home[last_read_id]"_s));
+    }
+
+    // A marker isn't taken as saved before the server says so, and is sent again after a while if it couldn't be
+    void testRetry()
+    {
+        const auto before = server.requestCount(u"/api/v1/markers"_s);
+
+        failing = true;
+        account->saveTimelinePosition(u"notifications"_s, u"9"_s);
+        QTRY_VERIFY(server.requestCount(u"/api/v1/markers"_s) > before);
+        QTRY_VERIFY(markers->hasPending());
+        QCOMPARE(markers->lastRead(u"notifications"_s), u"9"_s);
+
+        failing = false;
+        QTRY_VERIFY(server.requestCount(u"/api/v1/markers"_s) > before + 1);
+        QTRY_VERIFY(!markers->hasPending());
+        const QUrlQuery formdata(QString::fromUtf8(server.requests().last().body));
+        QCOMPARE(formdata.queryItemValue(u"notifications[last_read_id]"_s), u"9"_s);
+    }
+
+private:
+    bool failing = false;
+    ReplayServer server;
+    QNetworkAccessManager nam;
+    Account *account = nullptr;
+    MarkerSync *markers = nullptr;
+};
+
+QTEST_MAIN(MarkerSyncTest)
+#include "markersynctest.moc"
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "autotests/replayserver.h"
+#include "network/mediaprefetcher.h"
+
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace std::chrono_literals;
+
+class MediaPrefetcherTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+
+        QVERIFY(server.listen());
+        for (int i = 0; i < 11; i++) {
+            server.addRoute("GET", u"/media/%1.jpg"_s.arg(i), [](const ReplayServer::Request &) {
+                return ReplayServer::Response{.status = 200, .body = QByteArray(1000, 'x'), .headers = {{"Content-Type", "image/jpeg"}}};
+            });
+        }
+    }
+
+    void testPrefetch()
+    {
+        MediaPrefetcher prefetcher;
+        prefetcher.setIgnoreMetered(true);
+        prefetcher.setMaxConcurrent(2);
+
+        prefetcher.prefetch({{.url = url(0)}, {.url = url(1)}, {.url = url(1)}, {.url = QUrl()}, {.url = url(2)}});
+        QTRY_COMPARE(prefetcher.fetchedBytes(), 3000);
+
+        QCOMPARE(server.requestCount(u"/media/0.jpg"_s), 1);
+        QCOMPARE(server.requestCount(u"/media/1.jpg"_s), 1);
+        QCOMPARE(server.requestCount(u"/media/2.jpg"_s), 1);
+
+        // Already prefetched, so nothing is asked for again
+        QSignalSpy idleSpy(&prefetcher, &MediaPrefetcher::idle);
+        prefetcher.prefetch({{.url = url(0)}, {.url = url(2)}});
+        QCOMPARE(idleSpy.count(), 1);
+        QCOMPARE(server.requestCount(u"/media/0.jpg"_s), 1);
+        QCOMPARE(prefetcher.cancelledCount(), 0);
+    }
+
+    // Once something doesn't fit, the rest isn't downloaded
+    void testBudget()
+    {
+        MediaPrefetcher prefetcher;
+        prefetcher.setIgnoreMetered(true);
+        prefetcher.setMaxConcurrent(1);
+        prefetcher.setByteBudget(1500);
+
+        QSignalSpy idleSpy(&prefetcher, &MediaPrefetcher::idle);
+        prefetcher.prefetch({{.url = url(3)}, {.url = url(4)}, {.url = url(5)}});
+        QTRY_COMPARE(idleSpy.count(), 1);
+
+        QCOMPARE(prefetcher.fetchedBytes(), 1000);
+        QCOMPARE(prefetcher.cancelledCount(), 1);
+        QCOMPARE(server.requestCount(u"/media/5.jpg"_s), 0);
+    }
+
+    // Downloads running at once don't fit the budget together just because each would on its own
+    void testConcurrentBudget()
+    {
+        MediaPrefetcher prefetcher;
+        prefetcher.setIgnoreMetered(true);
+        prefetcher.setMaxConcurrent(4);
+        prefetcher.setByteBudget(1500);
+
+        QSignalSpy idleSpy(&prefetcher, &MediaPrefetcher::idle);
+        prefetcher.prefetch({{.url = url(8)}, {.url = url(9)}, {.url = url(10)}});
+        QTRY_COMPARE(idleSpy.count(), 1);
+
+        QCOMPARE(prefetcher.fetchedBytes(), 1000);
+        QCOMPARE(prefetcher.cancelledCount(), 2);
+    }
+
+    // The budget isn't renewed by asking again, only after a while
+    void testBudgetWindow()
+    {
+        MediaPrefetcher prefetcher;
+        prefetcher.setIgnoreMetered(true);
+        prefetcher.setByteBudget(1000);
+        prefetcher.setBudgetWindow(300ms);
+
+        QSignalSpy idleSpy(&prefetcher, &MediaPrefetcher::idle);
+        prefetcher.prefetch({{.url = url(6)}});
+        QTRY_COMPARE(idleSpy.count(), 1);
+        QCOMPARE(prefetcher.fetchedBytes(), 1000);
+
+        prefetcher.prefetch({{.url = url(7)}});
+        QCOMPARE(idleSpy.count(), 2);
+        QCOMPARE(server.requestCount(u"/media/7.jpg"_s), 0);
+
+        QTest::qWait(300);
+        prefetcher.prefetch({{.url = url(7)}});
+        QTRY_COMPARE(prefetcher.fetchedBytes(), 2000);
+    }
+
+    // Timelines sharing a prefetcher only stop what they asked for themselves
+    void testRequester()
+    {
+        MediaPrefetcher prefetcher;
+        prefetcher.setIgnoreMetered(true);
+        const QObject first;
+        const QObject second;
+
+        prefetcher.prefetch({{.url = url(0)}}, &first);
+        prefetcher.cancel(&second);
+        QCOMPARE(prefetcher.cancelledCount(), 0);
+        prefetcher.cancel(&first);
+        QCOMPARE(prefetcher.cancelledCount(), 1);
+    }
+
+    // Asking for something else drops what's not wanted anymore
+    void testReplace()
+    {
+        MediaPrefetcher prefetcher;
+        prefetcher.setIgnoreMetered(true);
+
+        prefetcher.prefetch({{.url = url(2)}});
+        prefetcher.prefetch({{.url = url(1)}});
+
+        QCOMPARE(prefetcher.cancelledCount(), 1);
+
+        QSignalSpy idleSpy(&prefetcher, &MediaPrefetcher::idle);
+        QVERIFY(idleSpy.wait());
+
+        prefetcher.cancel();
+        QCOMPARE(prefetcher.cancelledCount(), 1);
+    }
+
+private:
+    QUrl url(const int index) const
+    {
+        return server.url(u"/media/%1.jpg"_s.arg(index));
+    }
+
+    ReplayServer server;
+};
+
+QTEST_MAIN(MediaPrefetcherTest)
+#include "mediaprefetchertest.moc"
@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/account.h"
+#include "account/accountmanager.h"
+#include "account/mediauploadmanager.h"
+#include "autotests/replayserver.h"
+
+#include <QNetworkAccessManager>
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+using namespace std::chrono_literals;
+
+namespace
+{
+ReplayServer::Response media(const int status, const QString &id)
+{
+    const QByteArray url = status == 200 ? R"("https://files.example.org/original.png")" : "null";
+    return {.status = status, .body = R"({"id":")" + id.toLatin1() + R"(","type":"image","url":)" + url + "}", .headers = {}};
+}
+
+MediaUploadManager::Source source(const QByteArray &data)
+{
+    return {.data = data, .fileName = u"image.png"_s, .mimeType = u"image/png"_s, .hash = MediaUploadManager::hashData(data)};
+}
+}
+
+class MediaUploadManagerTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+        AccountManager::instance().setTestMode(true);
+
+        QVERIFY(server.listen());
+
+        // The first upload is accepted and processed in the background, every other one right away
+        server.addRoute("POST", u"/api/v2/media"_s, [this](const ReplayServer::Request &) {
+            const int id = ++uploads;
+            return media(id == 1 ? 202 : 200, QString::number(id));
+        });
+        server.addRoute("GET", u"/api/v1/media/1"_s, [polls = 0](const ReplayServer::Request &) mutable {
+            return media(++polls < 3 ? 206 : 200, u"1"_s);
+        });
+
+        account = new Account(server.instanceUri(), &nam, this);
+        manager = account->mediaUploads();
+        manager->setRetryDelay(20ms);
+        manager->setPollInterval(20ms);
+    }
+
+    void testProcessing()
+    {
+        const auto upload = manager->upload(source("first"));
+        QSignalSpy finished(upload, &MediaUpload::finished);
+        QCOMPARE(manager->pendingCount(), 1);
+
+        QVERIFY(finished.wait());
+        QCOMPARE(finished.first().first().toJsonObject()["id"_L1].toString(), u"1"_s);
+        QCOMPARE(server.requestCount(u"/api/v1/media/1"_s), 3);
+        QCOMPARE(manager->pendingCount(), 0);
+    }
+
+    // The same contents are only uploaded once, until they're attached to a post
+    void testReuse()
+    {
+        const auto before = server.requestCount(u"/api/v2/media"_s);
+
+        const auto first = manager->upload(source("second"));
+        QCOMPARE(manager->upload(source("second")), first);
+        QSignalSpy firstFinished(first, &MediaUpload::finished);
+        QVERIFY(firstFinished.wait());
+
+        const auto again = manager->upload(source("second"));
+        QVERIFY(again != first);
+        QSignalSpy againFinished(again, &MediaUpload::finished);
+        QVERIFY(againFinished.wait());
+        QCOMPARE(againFinished.first().first().toJsonObject()["id"_L1], firstFinished.first().first().toJsonObject()["id"_L1]);
+        QCOMPARE(server.requestCount(u"/api/v2/media"_s), before + 1);
+
+        manager->forget({firstFinished.first().first().toJsonObject()["id"_L1].toString()});
+
+        const auto afterPost = manager->upload(source("second"));
+        QSignalSpy afterPostFinished(afterPost, &MediaUpload::finished);
+        QVERIFY(afterPostFinished.wait());
+        QCOMPARE(server.requestCount(u"/api/v2/media"_s), before + 2);
+    }
+
+    void testConcurrency()
+    {
+        manager->setMaxConcurrent(1);
+
+        const auto first = manager->upload(source("third"));
+        const auto second = manager->upload(source("fourth"));
+        QCOMPARE(first->state(), MediaUpload::State::Uploading);
+        QCOMPARE(second->state(), MediaUpload::State::Queued);
+        QCOMPARE(manager->pendingCount(), 2);
+
+        QSignalSpy secondFinished(second, &MediaUpload::finished);
+        QVERIFY(secondFinished.wait());
+        QCOMPARE(manager->pendingCount(), 0);
+
+        manager->setMaxConcurrent(3);
+    }
+
+    // Files which can't be read don't keep others from being uploaded
+    void testMissingFile()
+    {
+        manager->setMaxConcurrent(1);
+
+        const auto missing =
+            manager->upload({.data = {}, .path = u"/nonexistent/image.png"_s, .fileName = u"image.png"_s, .mimeType = u"image/png"_s, .hash = {}});
+        const auto valid = manager->upload(source("fifth"));
+        QCOMPARE(manager->pendingCount(), 2);
+
+        QSignalSpy failed(missing, &MediaUpload::failed);
+        QSignalSpy finished(valid, &MediaUpload::finished);
+        QVERIFY(failed.wait());
+        QCOMPARE(failed.first().first().toString(), u"Could not read image.png."_s);
+        QVERIFY(finished.wait());
+        QCOMPARE(manager->pendingCount(), 0);
+
+        manager->setMaxConcurrent(3);
+    }
+
+    void testRetry()
+    {
+        ReplayServer flaky;
+        QVERIFY(flaky.listen());
+        flaky.addRoute("POST", u"/api/v2/media"_s, [attempt = 0](const ReplayServer::Request &) mutable {
+            return ++attempt < 3 ? ReplayServer::Response{.status = 503, .body = {}, .headers = {}} : media(200, u"7"_s);
+        });
+
+        Account flakyAccount(flaky.instanceUri(), &nam);
+        flakyAccount.mediaUploads()->setRetryDelay(10ms);
+
+        const auto upload = flakyAccount.mediaUploads()->upload(source("flaky"));
+        QSignalSpy finished(upload, &MediaUpload::finished);
+        QVERIFY(finished.wait());
+        QCOMPARE(upload->attempts(), 3);
+    }
+
+    void testFailure()
+    {
+        ReplayServer failing;
+        QVERIFY(failing.listen());
+        failing.addRoute("POST", u"/api/v2/media"_s, [](const ReplayServer::Request &) {
+            return ReplayServer::Response{.status = 422, .body = R"({"error":"File type not supported"})", .headers = {}};
+        });
+
+        Account failingAccount(failing.instanceUri(), &nam);
+
+        const auto upload = failingAccount.mediaUploads()->upload(source("failing"));
+        QSignalSpy failed(upload, &MediaUpload::failed);
+        QVERIFY(failed.wait());
+        QCOMPARE(failed.first().first().toString(), u"File type not supported"_s);
+        QCOMPARE(upload->attempts(), 1);
+    }
+
+    // Servers without the asynchronous endpoint get the old one
+    void testFallback()
+    {
+        ReplayServer old;
+        QVERIFY(old.listen());
+        old.addRoute("POST", u"/api/v1/media"_s, [](const ReplayServer::Request &) {
+            return media(200, u"9"_s);
+        });
+
+        Account oldAccount(old.instanceUri(), &nam);
+
+        const auto upload = oldAccount.mediaUploads()->upload(source("old"));
+        QSignalSpy finished(upload, &MediaUpload::finished);
+        QVERIFY(finished.wait());
+        QCOMPARE(finished.first().first().toJsonObject()["id"_L1].toString(), u"9"_s);
+        QCOMPARE(old.requestCount(u"/api/v2/media"_s), 1);
+        QCOMPARE(old.requestCount(u"/api/v1/media"_s), 1);
+    }
+
+private:
+    ReplayServer server;
+    QNetworkAccessManager nam;
+    Account *account = nullptr;
+    MediaUploadManager *manager = nullptr;
+    int uploads = 0;
+};
+
+QTEST_MAIN(MediaUploadManagerTest)
+#include "mediauploadmanagertest.moc"
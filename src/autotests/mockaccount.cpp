@@ -7,6 +7,7 @@
 
 #include "account/notificationhandler.h"
 #include "autotests/helperreply.h"
+#include "network/jsonarrayreader.h"
 
 using namespace Qt::Literals::StringLiterals;
 
@@ -17,7 +18,7 @@ MockAccount::MockAccount(QObject *parent)
     registerGet(apiUrl(QStringLiteral("/api/v1/preferences")), new TestReply(QStringLiteral("preferences.json"), this));
     m_preferences = new Preferences(this);
     m_notificationFilteringPolicy = new NotificationFilteringPolicy(this);
-    auto notificationHandler = new NotificationHandler(new QNetworkAccessManager, this);
+    auto notificationHandler = new NotificationHandler(this);
     connect(this, &MockAccount::notification, notificationHandler, [this, notificationHandler](std::shared_ptr<Notification> notification) {
         notificationHandler->handle(notification, this);
     });
@@ -34,11 +35,13 @@ void MockAccount::get(const QUrl &url,
                       bool authenticated,
                       QObject *parent,
                       std::function<void(QNetworkReply *)> callback,
-                      std::function<void(QNetworkReply *)> errorCallback)
+                      std::function<void(QNetworkReply *)> errorCallback,
+                      QHash<QByteArray, QByteArray> headers)
 {
     Q_UNUSED(authenticated)
     Q_UNUSED(parent)
     Q_UNUSED(errorCallback)
+    Q_UNUSED(headers)
 
     if (m_getReplies.contains(url)) {
         auto reply = m_getReplies[url];
@@ -52,6 +55,39 @@ void MockAccount::get(const QUrl &url,
     }
 }
 
+void MockAccount::getArray(const QUrl &url,
+                           bool authenticated,
+                           QObject *parent,
+                           std::function<void(QNetworkReply *, const QJsonArray &)> elementsCallback,
+                           std::function<void(QNetworkReply *)> callback,
+                           std::function<void(QNetworkReply *)> errorCallback)
+{
+    Q_UNUSED(authenticated)
+    Q_UNUSED(parent)
+
+    if (m_getReplies.contains(url)) {
+        auto reply = m_getReplies[url];
+        reply->open(QIODevice::ReadOnly);
+
+        // Hand the response over in small chunks, like a slow connection would
+        JsonArrayReader reader;
+        for (QByteArray chunk = reply->read(64); !chunk.isEmpty(); chunk = reply->read(64)) {
+            const auto elements = reader.feed(chunk);
+            if (!elements.isEmpty() && elementsCallback) {
+                elementsCallback(reply, elements);
+            }
+        }
+        if (callback) {
+            callback(reply);
+        }
+        reply->seek(0);
+    } else {
+        qWarning() << "Cannot find reply for " << url;
+        if (errorCallback)
+            errorCallback(m_errorReply);
+    }
+}
+
 void MockAccount::post(const QUrl &url,
                        const QJsonDocument &doc,
                        bool authenticated,
@@ -88,12 +124,18 @@ void MockAccount::post(const QUrl &url,
     Q_UNUSED(errorCallback)
 }
 
-QNetworkReply *MockAccount::post(const QUrl &url, QHttpMultiPart *message, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)> callback)
+QNetworkReply *MockAccount::post(const QUrl &url,
+                                 QHttpMultiPart *message,
+                                 bool authenticated,
+                                 QObject *parent,
+                                 std::function<void(QNetworkReply *)> callback,
+                                 std::function<void(QNetworkReply *)> errorCallback)
 {
     Q_UNUSED(url)
     Q_UNUSED(authenticated)
     Q_UNUSED(parent)
     Q_UNUSED(callback)
+    Q_UNUSED(errorCallback)
     Q_UNUSED(message)
     return nullptr;
 }
@@ -163,6 +205,18 @@ void MockAccount::checkForFollowRequests()
 {
 }
 
+void MockAccount::subscribeToStream(const QString &stream, const QString &parameter)
+{
+    Q_UNUSED(stream)
+    Q_UNUSED(parameter)
+}
+
+void MockAccount::unsubscribeFromStream(const QString &stream, const QString &parameter)
+{
+    Q_UNUSED(stream)
+    Q_UNUSED(parameter)
+}
+
 void MockAccount::checkForUnreadNotifications()
 {
 }
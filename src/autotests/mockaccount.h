@@ -16,7 +16,15 @@ public:
              bool authenticated,
              QObject *parent,
              std::function<void(QNetworkReply *)> callback,
-             std::function<void(QNetworkReply *)> errorCallback = nullptr) override;
+             std::function<void(QNetworkReply *)> errorCallback = nullptr,
+             QHash<QByteArray, QByteArray> headers = {}) override;
+
+    void getArray(const QUrl &url,
+                  bool authenticated,
+                  QObject *parent,
+                  std::function<void(QNetworkReply *, const QJsonArray &)> elementsCallback,
+                  std::function<void(QNetworkReply *)> callback,
+                  std::function<void(QNetworkReply *)> errorCallback = nullptr) override;
 
     void post(const QUrl &url,
               const QJsonDocument &doc,
@@ -33,7 +41,12 @@ public:
               std::function<void(QNetworkReply *)> callback,
               std::function<void(QNetworkReply *)> errorCallback = nullptr) override;
 
-    QNetworkReply *post(const QUrl &url, QHttpMultiPart *message, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)> callback) override;
+    QNetworkReply *post(const QUrl &url,
+                        QHttpMultiPart *message,
+                        bool authenticated,
+                        QObject *parent,
+                        std::function<void(QNetworkReply *)> callback,
+                        std::function<void(QNetworkReply *)> errorCallback = nullptr) override;
 
     void put(const QUrl &url, const QJsonDocument &doc, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)> callback) override;
     void put(const QUrl &url, const QUrlQuery &doc, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)> callback) override;
@@ -65,6 +78,9 @@ public:
 
     void updatePushNotifications() override {};
 
+    void subscribeToStream(const QString &stream, const QString &parameter = {}) override;
+    void unsubscribeFromStream(const QString &stream, const QString &parameter = {}) override;
+
     Q_INVOKABLE void mentionNotification();
     Q_INVOKABLE void favoriteNotification();
     Q_INVOKABLE void boostNotification();
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "autotests/helperreply.h"
+#include "network/networktimings.h"
+
+#include <QtTest/QtTest>
+
+#include <numeric>
+
+using namespace Qt::Literals::StringLiterals;
+
+class NetworkTimingsTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    void finishRequest(const QString &path, const int status = 200)
+    {
+        auto reply = new TestReply(u"statuses.json"_s, this);
+        reply->setUrl(QUrl(u"https://kde.social"_s + path));
+        reply->setAttribute(QNetworkRequest::HttpStatusCodeAttribute, status);
+
+        auto &timings = NetworkTimings::instance();
+        timings.track(reply);
+        Q_EMIT reply->metaDataChanged();
+        Q_EMIT reply->finished();
+
+        const auto doc = NetworkTimings::parseJson(reply, reply->readAll());
+        QVERIFY(doc.isArray());
+        timings.complete(reply, 1000);
+
+        delete reply;
+    }
+
+private Q_SLOTS:
+    void cleanup()
+    {
+        NetworkTimings::instance().setCapacity(256);
+    }
+
+    void testEndpointTemplate_data()
+    {
+        QTest::addColumn<QString>("url");
+        QTest::addColumn<QString>("endpoint");
+
+        QTest::newRow("static") << u"https://kde.social/api/v1/timelines/home?limit=20"_s << u"/api/v1/timelines/home"_s;
+        QTest::newRow("id") << u"https://kde.social/api/v1/statuses/109254436589120913/context"_s << u"/api/v1/statuses/:id/context"_s;
+        QTest::newRow("flake id") << u"https://pleroma.social/api/v1/accounts/AP7sqXyHwvF4rq9b8e/statuses"_s << u"/api/v1/accounts/:id/statuses"_s;
+        QTest::newRow("tag") << u"https://kde.social/api/v1/timelines/tag/kde"_s << u"/api/v1/timelines/tag/:tag"_s;
+        QTest::newRow("followed tag") << u"https://kde.social/api/v1/tags/kde/follow"_s << u"/api/v1/tags/:tag/follow"_s;
+        QTest::newRow("account") << u"https://kde.social/@carl"_s << u"/:acct"_s;
+        QTest::newRow("no token") << u"https://kde.social/api/v1/streaming?access_token=secret"_s << u"/api/v1/streaming"_s;
+    }
+
+    void testEndpointTemplate()
+    {
+        QFETCH(QString, url);
+        QFETCH(QString, endpoint);
+
+        QCOMPARE(NetworkTimings::endpointTemplate(QUrl(url)), endpoint);
+    }
+
+    void testRecord()
+    {
+        auto &timings = NetworkTimings::instance();
+        timings.clear();
+
+        finishRequest(u"/api/v1/statuses/1"_s, 404);
+
+        QCOMPARE(timings.rowCount(), 1);
+        const auto timing = timings.record(0);
+        QCOMPARE(timing.endpoint, u"/api/v1/statuses/:id"_s);
+        QCOMPARE(timing.status, 404);
+        QCOMPARE(timing.callback, qint64(1));
+        QVERIFY(timing.parse > 0);
+        QVERIFY(timing.total() >= timing.callback);
+
+        QCOMPARE(timings.summary()[u"count"_s].toInt(), 1);
+        const auto histogram = timings.histogram();
+        const int bucketed = std::accumulate(histogram.cbegin(), histogram.cend(), 0, [](const int sum, const QVariant &bucket) {
+            return sum + bucket.toMap()[u"count"_s].toInt();
+        });
+        QCOMPARE(bucketed, 1);
+    }
+
+    // Only the most recent requests should be kept, and exported oldest first
+    void testRingBuffer()
+    {
+        auto &timings = NetworkTimings::instance();
+        timings.setCapacity(3);
+
+        for (const auto &path : {u"/api/v1/a"_s, u"/api/v1/b"_s, u"/api/v1/c"_s, u"/api/v1/d"_s, u"/api/v1/e"_s}) {
+            finishRequest(path);
+        }
+
+        QCOMPARE(timings.rowCount(), 3);
+        QCOMPARE(timings.record(0).endpoint, u"/api/v1/e"_s);
+        QCOMPARE(timings.record(2).endpoint, u"/api/v1/c"_s);
+
+        const auto requests = QJsonDocument::fromJson(timings.toJson().toUtf8())["requests"_L1].toArray();
+        QCOMPARE(requests.size(), 3);
+        QCOMPARE(requests.first()["endpoint"_L1].toString(), u"/api/v1/c"_s);
+        QCOMPARE(requests.last()["endpoint"_L1].toString(), u"/api/v1/e"_s);
+    }
+};
+
+QTEST_MAIN(NetworkTimingsTest)
+#include "networktimingstest.moc"
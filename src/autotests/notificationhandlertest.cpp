@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/notificationhandler.h"
+
+#include <QtTest/QtTest>
+
+class NotificationHandlerTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testRoundAvatar()
+    {
+        // Wider than high, with the middle in another color
+        QImage avatar(300, 100, QImage::Format_RGB32);
+        avatar.fill(Qt::red);
+        for (int y = 0; y < avatar.height(); y++) {
+            for (int x = 100; x < 200; x++) {
+                avatar.setPixel(x, y, qRgb(0, 0, 255));
+            }
+        }
+
+        const auto rounded = NotificationHandler::roundAvatar(avatar, 64);
+        QCOMPARE(rounded.size(), QSize(64, 64));
+        QVERIFY(rounded.hasAlphaChannel());
+
+        // Outside of the circle
+        QCOMPARE(qAlpha(rounded.pixel(0, 0)), 0);
+        QCOMPARE(qAlpha(rounded.pixel(63, 63)), 0);
+
+        // Cropped to the middle
+        QCOMPARE(rounded.pixelColor(32, 32), QColor(Qt::blue));
+    }
+
+    void testTransparentAvatar()
+    {
+        QImage avatar(64, 64, QImage::Format_ARGB32);
+        avatar.fill(Qt::transparent);
+
+        const auto rounded = NotificationHandler::roundAvatar(avatar, 32);
+        QCOMPARE(rounded.pixelColor(16, 16), QColor(Qt::white));
+    }
+};
+
+QTEST_MAIN(NotificationHandlerTest)
+#include "notificationhandlertest.moc"
@@ -53,6 +53,25 @@ private Q_SLOTS:
         QCOMPARE(backend.charactersLeft(), 477);
     }
 
+    void charactersLeftTest()
+    {
+        PostEditorBackend backend;
+        backend.setAccount(account);
+
+        QSignalSpy entitiesSpy(&backend, &PostEditorBackend::entitiesChanged);
+        backend.setStatus(QStringLiteral("@alice@mastodon.social see https://kde.org and https://kde.org/"));
+
+        // The domain of a mention doesn't count, and every link counts the same
+        QCOMPARE(backend.charactersLeft(), 500 - 6 - 5 - 23 - 5 - 23);
+        QCOMPARE(entitiesSpy.count(), 1);
+        QCOMPARE(backend.entities().size(), 3);
+        QCOMPARE(backend.entities()[1].toMap()[QStringLiteral("type")].toString(), QStringLiteral("url"));
+        QCOMPARE(backend.entities()[1].toMap()[QStringLiteral("start")].toInt(), 27);
+
+        backend.setSpoilerText(QStringLiteral("CW"));
+        QCOMPARE(backend.charactersLeft(), 500 - 6 - 5 - 23 - 5 - 23 - 2);
+    }
+
 private:
     MockAccount *account = nullptr;
 };
@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "editor/posttextanalyzer.h"
+
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+QStringList describe(const QString &text, const QList<PostTextAnalyzer::Entity> &entities)
+{
+    QStringList descriptions;
+    for (const auto &entity : entities) {
+        const QString type = QStringList{u"url"_s, u"mention"_s, u"hashtag"_s, u"emoji"_s}[entity.type];
+        descriptions.push_back(type + u':' + text.sliced(entity.start, entity.length));
+    }
+    return descriptions;
+}
+}
+
+class PostTextAnalyzerTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testEntities_data()
+    {
+        QTest::addColumn<QString>("text");
+        QTest::addColumn<QStringList>("expected");
+
+        QTest::addRow("nothing") << u"Hello, world!"_s << QStringList{};
+        QTest::addRow("url") << u"see https://kde.org/, and"_s << QStringList{u"url:https://kde.org/"_s};
+        QTest::addRow("url without path") << u"(http://kde.org)"_s << QStringList{u"url:http://kde.org"_s};
+        QTest::addRow("urls run together") << u"https://www.google.com/https://www.google.com/"_s
+                                           << QStringList{u"url:https://www.google.com/https://www.google.com/"_s};
+        QTest::addRow("mention") << u"hi @alice."_s << QStringList{u"mention:@alice"_s};
+        QTest::addRow("remote mention") << u"@alice@mastodon.social!"_s << QStringList{u"mention:@alice@mastodon.social"_s};
+        QTest::addRow("email") << u"alice@example.com"_s << QStringList{};
+        QTest::addRow("hashtag") << u"#KDE #123 #tag_2"_s << QStringList{u"hashtag:#KDE"_s, u"hashtag:#tag_2"_s};
+        QTest::addRow("emoji") << u":blobcat::x: a:blobfox: :ablobcat_wave:"_s << QStringList{u"emoji::ablobcat_wave:"_s};
+        QTest::addRow("inside url") << u"https://kde.org/@alice/#top?:smile:x"_s << QStringList{u"url:https://kde.org/@alice/#top?:smile:x"_s};
+        QTest::addRow("mixed") << u"@bob #tag :emoji: https://kde.org"_s
+                               << QStringList{u"mention:@bob"_s, u"hashtag:#tag"_s, u"emoji::emoji:"_s, u"url:https://kde.org"_s};
+    }
+
+    void testEntities()
+    {
+        QFETCH(QString, text);
+        QFETCH(QStringList, expected);
+
+        PostTextAnalyzer analyzer;
+        QCOMPARE(analyzer.setText(text), !expected.isEmpty());
+        QCOMPARE(describe(text, analyzer.entities()), expected);
+    }
+
+    void testCountedLength()
+    {
+        PostTextAnalyzer analyzer;
+        QCOMPARE(analyzer.countedLength(23), 0);
+
+        analyzer.setText(u"Lorem ipsum dolor sit amet, https://www.google.com/"_s);
+        QCOMPARE(analyzer.countedLength(23), 51);
+        QCOMPARE(analyzer.countedLength(10), 38);
+
+        // Only the username of a mention counts
+        analyzer.setText(u"@alice@mastodon.social hi"_s);
+        QCOMPARE(analyzer.countedLength(23), 9);
+
+        // Characters, not UTF-16 code units
+        analyzer.setText(u"\U0001F600\U0001F600 é"_s);
+        QCOMPARE(analyzer.countedLength(23), 4);
+    }
+
+    void testGraphemes_data()
+    {
+        QTest::addColumn<QString>("text");
+        QTest::addColumn<qsizetype>("expected");
+
+        QTest::addRow("combining accent") << u"e\u0301"_s << qsizetype(1);
+        QTest::addRow("skin tone") << u"\U0001F44D\U0001F3FD"_s << qsizetype(1);
+        QTest::addRow("zwj sequence") << u"\U0001F468\u200D\U0001F469\u200D\U0001F467"_s << qsizetype(1);
+        QTest::addRow("flags") << u"\U0001F1E9\U0001F1EA\U0001F1EB\U0001F1F7"_s << qsizetype(2);
+        QTest::addRow("accent on whitespace") << u"a \u0301"_s << qsizetype(2);
+    }
+
+    void testGraphemes()
+    {
+        QFETCH(QString, text);
+        QFETCH(qsizetype, expected);
+
+        PostTextAnalyzer analyzer;
+        analyzer.setText(text);
+        QCOMPARE(analyzer.countedLength(23), expected);
+
+        // Typing it one code unit at a time ends up the same
+        PostTextAnalyzer typed;
+        for (qsizetype i = 1; i <= text.size(); i++) {
+            typed.setText(text.first(i));
+        }
+        QCOMPARE(typed.countedLength(23), expected);
+    }
+
+    void testTyping()
+    {
+        const QString text = u"Hey @alice@mastodon.social, look at https://kde.org/ #KDE :blobcat: \U0001F600\U0001F3FD and #tokodon "
+                             u"\U0001F1E9\U0001F1EA\U0001F1EB\U0001F1F7 \u0301e\u0301\n\u0600 \U0001F468\u200D\U0001F469 !"_s;
+
+        // Typed one character at a time, then deleted from the middle, it has to end up like reading all of it at once
+        PostTextAnalyzer analyzer;
+        for (qsizetype i = 1; i <= text.size(); i++) {
+            analyzer.setText(text.first(i));
+
+            PostTextAnalyzer fresh;
+            fresh.setText(text.first(i));
+            QCOMPARE(analyzer.countedLength(23), fresh.countedLength(23));
+        }
+        QString edited = text;
+        while (!edited.isEmpty()) {
+            edited.remove(edited.size() / 2, 1);
+            analyzer.setText(edited);
+
+            PostTextAnalyzer fresh;
+            fresh.setText(edited);
+            QCOMPARE(describe(edited, analyzer.entities()), describe(edited, fresh.entities()));
+            QCOMPARE(analyzer.countedLength(23), fresh.countedLength(23));
+        }
+        QVERIFY(analyzer.entities().isEmpty());
+        QCOMPARE(analyzer.countedLength(23), 0);
+    }
+
+    void testEdits()
+    {
+        PostTextAnalyzer analyzer;
+        analyzer.setText(u"#one #two"_s);
+
+        // Joining two words
+        QVERIFY(analyzer.setText(u"#one#two"_s));
+        QCOMPARE(describe(analyzer.text(), analyzer.entities()), QStringList{u"hashtag:#one"_s});
+
+        // Splitting them again
+        QVERIFY(analyzer.setText(u"#one #two"_s));
+        QCOMPARE(describe(analyzer.text(), analyzer.entities()), (QStringList{u"hashtag:#one"_s, u"hashtag:#two"_s}));
+
+        // Moves what comes after
+        QVERIFY(analyzer.setText(u"#one and #two"_s));
+        QCOMPARE(describe(analyzer.text(), analyzer.entities()), (QStringList{u"hashtag:#one"_s, u"hashtag:#two"_s}));
+
+        // Nothing changes for words after the last entity
+        analyzer.setText(u"#one and #two "_s);
+        QVERIFY(!analyzer.setText(u"#one and #two right"_s));
+        QVERIFY(!analyzer.setText(u"#one and #two right"_s));
+
+        // Replacing everything
+        QVERIFY(analyzer.setText(u"https://kde.org"_s));
+        QCOMPARE(describe(analyzer.text(), analyzer.entities()), QStringList{u"url:https://kde.org"_s});
+        QCOMPARE(analyzer.countedLength(23), 23);
+    }
+};
+
+QTEST_MAIN(PostTextAnalyzerTest)
+#include "posttextanalyzertest.moc"
@@ -0,0 +1,431 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "autotests/replayserver.h"
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QJsonDocument>
+#include <QTcpSocket>
+#include <QTimer>
+#include <QUrlQuery>
+#include <QWebSocket>
+
+#include <algorithm>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+// Bodies are trickled out this often when the bandwidth is limited
+constexpr auto bandwidthTick = std::chrono::milliseconds(10);
+
+QByteArray reasonPhrase(const int status)
+{
+    switch (status) {
+    case 200:
+        return "OK";
+    case 202:
+        return "Accepted";
+    case 206:
+        return "Partial Content";
+    case 304:
+        return "Not Modified";
+    case 404:
+        return "Not Found";
+    case 416:
+        return "Range Not Satisfiable";
+    case 422:
+        return "Unprocessable Entity";
+    case 429:
+        return "Too Many Requests";
+    case 503:
+        return "Service Unavailable";
+    default:
+        return "Status";
+    }
+}
+
+QString streamingMessage(const QStringList &stream, const QString &event, const QByteArray &payload)
+{
+    const QJsonObject envelope{
+        {u"stream"_s, QJsonArray::fromStringList(stream)},
+        {u"event"_s, event},
+        {u"payload"_s, QString::fromUtf8(payload)},
+    };
+    return QString::fromUtf8(QJsonDocument(envelope).toJson(QJsonDocument::Compact));
+}
+
+// Ids are numeric strings, so they need to be compared as numbers
+bool isNewer(const QString &id, const QString &than)
+{
+    if (id.size() != than.size()) {
+        return id.size() > than.size();
+    }
+    return id > than;
+}
+}
+
+ReplayServer::ReplayServer(QObject *parent)
+    : QObject(parent)
+    , m_webSocketServer(u"Tokodon replay server"_s, QWebSocketServer::NonSecureMode)
+{
+    connect(&m_server, &QTcpServer::newConnection, this, [this] {
+        while (auto socket = m_server.nextPendingConnection()) {
+            connect(socket, &QTcpSocket::readyRead, this, [this, socket] {
+                readRequest(socket);
+            });
+            connect(socket, &QTcpSocket::disconnected, this, [this, socket] {
+                m_busySockets.remove(socket);
+                socket->deleteLater();
+            });
+        }
+    });
+    connect(&m_webSocketServer, &QWebSocketServer::newConnection, this, &ReplayServer::handleStreamingConnection);
+}
+
+bool ReplayServer::listen()
+{
+    return m_server.listen(QHostAddress::LocalHost);
+}
+
+QString ReplayServer::instanceUri() const
+{
+    return u"http://127.0.0.1:%1"_s.arg(m_server.serverPort());
+}
+
+QUrl ReplayServer::url(const QString &path) const
+{
+    QUrl url(instanceUri());
+    url.setPath(path);
+    return url;
+}
+
+void ReplayServer::addRoute(const QByteArray &method, const QString &path, Handler handler)
+{
+    m_routes.insert({method, path}, std::move(handler));
+}
+
+void ReplayServer::addJson(const QString &path, const QByteArray &body, const int status)
+{
+    addRoute("GET", path, [body, status](const Request &) {
+        return Response{.status = status, .body = body, .headers = {}};
+    });
+}
+
+void ReplayServer::addFixture(const QString &path, const QString &name, const int status)
+{
+    addJson(path, fixture(name), status);
+}
+
+void ReplayServer::addFile(const QString &path, const QByteArray &data)
+{
+    addRoute("GET", path, [data](const Request &request) {
+        return rangeResponse(request, data);
+    });
+}
+
+ReplayServer::Response ReplayServer::rangeResponse(const Request &request, const QByteArray &data, const QByteArray &etag)
+{
+    const QByteArray tag = !etag.isEmpty() ? etag : '"' + QCryptographicHash::hash(data, QCryptographicHash::Sha1).toHex().first(16) + '"';
+    Response response{.status = 200,
+                      .body = data,
+                      .headers = {{"Content-Type", "application/octet-stream"}, {"Accept-Ranges", "bytes"}, {"ETag", tag}}};
+
+    // Only a single range is understood, like bytes=100- or bytes=100-199
+    const QByteArray range = request.headers.value("range");
+    if (!range.startsWith("bytes=")) {
+        return response;
+    }
+    // All of it is sent again if it's not the file the range was meant for
+    if (request.headers.contains("if-range") && request.headers.value("if-range") != tag) {
+        return response;
+    }
+    const QList<QByteArray> bounds = range.sliced(6).split('-');
+    if (bounds.size() != 2 || bounds[0].isEmpty()) {
+        return response;
+    }
+
+    const qint64 first = bounds[0].toLongLong();
+    const qint64 last = bounds[1].isEmpty() ? data.size() - 1 : std::min<qint64>(bounds[1].toLongLong(), data.size() - 1);
+    if (first >= data.size() || first > last) {
+        return Response{.status = 416, .body = {}, .headers = {{"Content-Range", "bytes */" + QByteArray::number(data.size())}, {"ETag", tag}}};
+    }
+
+    response.status = 206;
+    response.body = data.sliced(first, last - first + 1);
+    response.headers.insert("Content-Range",
+                            "bytes " + QByteArray::number(first) + '-' + QByteArray::number(last) + '/' + QByteArray::number(data.size()));
+    return response;
+}
+
+void ReplayServer::addTimeline(const QString &path, const QJsonArray &posts, const int pageSize)
+{
+    addRoute("GET", path, [this, path, posts, pageSize](const Request &request) {
+        const QUrlQuery query(request.url);
+        const QString maxId = query.queryItemValue(u"max_id"_s);
+        const QString sinceId = query.queryItemValue(u"since_id"_s);
+        const QString minId = query.queryItemValue(u"min_id"_s);
+        const int limit = query.hasQueryItem(u"limit"_s) ? query.queryItemValue(u"limit"_s).toInt() : pageSize;
+
+        QJsonArray matching;
+        for (const auto &post : posts) {
+            const QString id = post["id"_L1].toString();
+            if (!maxId.isEmpty() && !isNewer(maxId, id)) {
+                continue;
+            }
+            if (!sinceId.isEmpty() && !isNewer(id, sinceId)) {
+                continue;
+            }
+            if (!minId.isEmpty() && !isNewer(id, minId)) {
+                continue;
+            }
+            matching.push_back(post);
+        }
+
+        // min_id pages start right after it, the others start at the newest post
+        const qsizetype first = !minId.isEmpty() ? std::max<qsizetype>(matching.size() - limit, 0) : 0;
+        QJsonArray page;
+        for (qsizetype i = first; i < std::min<qsizetype>(first + limit, matching.size()); i++) {
+            page.push_back(matching[i]);
+        }
+
+        Response response{.status = 200, .body = QJsonDocument(page).toJson(QJsonDocument::Compact), .headers = {}};
+        if (!page.isEmpty()) {
+            QUrl next = url(path);
+            next.setQuery({{u"max_id"_s, page.last()["id"_L1].toString()}});
+            QUrl prev = url(path);
+            prev.setQuery({{u"min_id"_s, page.first()["id"_L1].toString()}});
+
+            response.headers.insert("Link", "<" + next.toEncoded() + ">; rel=\"next\", <" + prev.toEncoded() + ">; rel=\"prev\"");
+        }
+        return response;
+    });
+}
+
+QByteArray ReplayServer::fixture(const QString &name)
+{
+    QFile file(QLatin1String(DATA_DIR "/%1").arg(name));
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Missing test data" << name;
+        return {};
+    }
+    return file.readAll();
+}
+
+QJsonArray ReplayServer::generatePosts(const int count)
+{
+    const QJsonObject base = QJsonDocument::fromJson(fixture(u"status.json"_s)).object();
+
+    QJsonArray posts;
+    for (int i = 0; i < count; i++) {
+        // Snowflake-sized ids, counting down so the newest post comes first
+        const QString id = QString::number(110000000000000000LL + count - i);
+
+        QJsonObject post = base;
+        post["id"_L1] = id;
+        post["uri"_L1] = u"https://example.org/users/test/statuses/%1"_s.arg(id);
+        post["url"_L1] = u"https://example.org/@test/%1"_s.arg(id);
+        post["content"_L1] = u"<p>Generated post %1</p>"_s.arg(count - i);
+        posts.push_back(post);
+    }
+    return posts;
+}
+
+void ReplayServer::setLatency(const std::chrono::milliseconds latency)
+{
+    m_latency = latency;
+}
+
+void ReplayServer::setBandwidth(const qint64 bytesPerSecond)
+{
+    m_bandwidth = bytesPerSecond;
+}
+
+QList<ReplayServer::Request> ReplayServer::requests() const
+{
+    return m_requests;
+}
+
+qsizetype ReplayServer::requestCount(const QString &path) const
+{
+    return std::ranges::count_if(m_requests, [&path](const Request &request) {
+        return request.url.path() == path;
+    });
+}
+
+void ReplayServer::readRequest(QTcpSocket *socket)
+{
+    // Requests on the same connection are answered in order
+    if (m_busySockets.contains(socket)) {
+        return;
+    }
+
+    // Only peek until the request is complete, so WebSocket handshakes can be handed over untouched
+    const QByteArray pending = socket->peek(socket->bytesAvailable());
+    const qsizetype headerEnd = pending.indexOf("\r\n\r\n");
+    if (headerEnd < 0) {
+        return;
+    }
+
+    const QList<QByteArray> lines = pending.first(headerEnd).split('\n');
+    const QList<QByteArray> requestLine = lines.first().trimmed().split(' ');
+    if (requestLine.size() < 2) {
+        socket->abort();
+        return;
+    }
+
+    Request request;
+    request.method = requestLine[0];
+    request.url = QUrl::fromEncoded(instanceUri().toUtf8() + requestLine[1]);
+    for (const auto &line : lines.sliced(1)) {
+        const qsizetype colon = line.indexOf(':');
+        if (colon > 0) {
+            request.headers.insert(line.first(colon).trimmed().toLower(), line.sliced(colon + 1).trimmed());
+        }
+    }
+
+    const qint64 contentLength = request.headers.value("content-length").toLongLong();
+    if (pending.size() < headerEnd + 4 + contentLength) {
+        return;
+    }
+
+    if (request.headers.value("upgrade").toLower() == "websocket") {
+        disconnect(socket, nullptr, this, nullptr);
+        m_webSocketServer.handleConnection(socket);
+        return;
+    }
+
+    socket->skip(headerEnd + 4);
+    request.body = socket->read(contentLength);
+    m_requests.push_back(request);
+    Q_EMIT requestReceived(request.method, request.url.path());
+
+    const Response response = respond(request);
+    m_busySockets.insert(socket);
+    QTimer::singleShot(m_latency, socket, [this, socket, response] {
+        writeResponse(socket, response);
+    });
+}
+
+ReplayServer::Response ReplayServer::respond(const Request &request) const
+{
+    const auto handler = m_routes.constFind({request.method, request.url.path()});
+    if (handler == m_routes.constEnd()) {
+        return Response{.status = 404, .body = R"({"error":"Record not found"})", .headers = {}};
+    }
+    return handler.value()(request);
+}
+
+void ReplayServer::writeResponse(QTcpSocket *socket, const Response &response)
+{
+    QByteArray head = "HTTP/1.1 " + QByteArray::number(response.status) + ' ' + reasonPhrase(response.status) + "\r\n";
+    if (!response.headers.contains("Content-Type")) {
+        head += "Content-Type: application/json; charset=utf-8\r\n";
+    }
+    head += "Content-Length: " + QByteArray::number(response.body.size()) + "\r\n";
+    head += "Connection: keep-alive\r\n";
+    for (const auto &[name, value] : response.headers.asKeyValueRange()) {
+        head += name + ": " + value + "\r\n";
+    }
+    head += "\r\n";
+    socket->write(head);
+
+    const bool drop = response.dropAfter >= 0;
+    const QByteArray body = drop ? response.body.first(std::min(response.dropAfter, response.body.size())) : response.body;
+    const auto done = [this, socket, drop] {
+        if (drop) {
+            socket->disconnectFromHost();
+        } else {
+            finishResponse(socket);
+        }
+    };
+
+    if (m_bandwidth <= 0) {
+        socket->write(body);
+        done();
+        return;
+    }
+
+    const qint64 sliceSize = std::max<qint64>(m_bandwidth * bandwidthTick.count() / 1000, 1);
+    auto timer = new QTimer(socket);
+    timer->setInterval(bandwidthTick);
+    connect(timer, &QTimer::timeout, socket, [socket, timer, body, sliceSize, done, written = qsizetype(0)]() mutable {
+        const auto slice = body.sliced(written, std::min<qsizetype>(sliceSize, body.size() - written));
+        socket->write(slice);
+        written += slice.size();
+
+        if (written == body.size()) {
+            timer->deleteLater();
+            done();
+        }
+    });
+    timer->start();
+}
+
+void ReplayServer::finishResponse(QTcpSocket *socket)
+{
+    m_busySockets.remove(socket);
+
+    // The client may have sent the next request in the meantime
+    if (socket->bytesAvailable() > 0) {
+        readRequest(socket);
+    }
+}
+
+void ReplayServer::setStreamingScript(const QList<StreamingEvent> &script)
+{
+    m_streamingScript = script;
+}
+
+void ReplayServer::handleStreamingConnection()
+{
+    while (auto client = m_webSocketServer.nextPendingConnection()) {
+        m_streamingClients.push_back(client);
+
+        connect(client, &QWebSocket::textMessageReceived, this, [this](const QString &message) {
+            const auto object = QJsonDocument::fromJson(message.toUtf8()).object();
+            m_streamingMessages.push_back(object);
+            Q_EMIT streamingMessageReceived(object);
+        });
+        connect(client, &QWebSocket::disconnected, this, [this, client] {
+            m_streamingClients.removeAll(client);
+            client->deleteLater();
+        });
+
+        std::chrono::milliseconds at{0};
+        for (const auto &event : std::as_const(m_streamingScript)) {
+            at += event.delay;
+            QTimer::singleShot(at, client, [client, event] {
+                client->sendTextMessage(streamingMessage(event.stream, event.event, event.payload));
+            });
+        }
+    }
+}
+
+void ReplayServer::sendStreamingEvent(const QStringList &stream, const QString &event, const QByteArray &payload)
+{
+    const QString message = streamingMessage(stream, event, payload);
+    for (const auto client : std::as_const(m_streamingClients)) {
+        client->sendTextMessage(message);
+    }
+}
+
+void ReplayServer::dropStreamingConnections()
+{
+    for (const auto client : QList(m_streamingClients)) {
+        client->abort();
+    }
+}
+
+qsizetype ReplayServer::streamingConnectionCount() const
+{
+    return m_streamingClients.size();
+}
+
+QList<QJsonObject> ReplayServer::streamingMessages() const
+{
+    return m_streamingMessages;
+}
+
+#include "moc_replayserver.cpp"
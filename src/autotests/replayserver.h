@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QList>
+#include <QSet>
+#include <QTcpServer>
+#include <QUrl>
+#include <QWebSocketServer>
+
+#include <chrono>
+#include <functional>
+
+class QTcpSocket;
+class QWebSocket;
+
+/**
+ * @brief A local stand-in for a Mastodon server, to run the real Account against.
+ *
+ * Serves canned responses over plain HTTP, and the streaming API over a WebSocket on the same port. Responses can be slowed down with
+ * latency and a bandwidth limit, and timelines are paginated with Link headers like the real thing.
+ *
+ * @code
+ * ReplayServer server;
+ * server.listen();
+ * server.addTimeline(u"/api/v1/timelines/home"_s, ReplayServer::generatePosts(100));
+ *
+ * Account account(server.instanceUri(), &nam);
+ * @endcode
+ */
+class ReplayServer : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Request {
+        QByteArray method;
+        QUrl url;
+        QHash<QByteArray, QByteArray> headers; ///< With lowercase names.
+        QByteArray body;
+    };
+
+    struct Response {
+        int status = 200;
+        QByteArray body;
+        QHash<QByteArray, QByteArray> headers;
+        qsizetype dropAfter = -1; ///< Close the connection after this many bytes of the body, as if the network dropped. -1 sends all of it.
+    };
+
+    using Handler = std::function<Response(const Request &)>;
+
+    struct StreamingEvent {
+        std::chrono::milliseconds delay; ///< After the previous event, or the connection for the first one.
+        QStringList stream;
+        QString event;
+        QByteArray payload;
+    };
+
+    explicit ReplayServer(QObject *parent = nullptr);
+
+    /**
+     * @brief Starts listening on a free port of the loopback interface.
+     */
+    bool listen();
+
+    /**
+     * @return The instance URI to give to an Account.
+     */
+    [[nodiscard]] QString instanceUri() const;
+
+    /**
+     * @return The full url of @p path on this server.
+     */
+    [[nodiscard]] QUrl url(const QString &path) const;
+
+    /**
+     * @brief Answer @p method requests to @p path with @p handler. Query parameters aren't taken into account for matching.
+     */
+    void addRoute(const QByteArray &method, const QString &path, Handler handler);
+
+    /**
+     * @brief Answer GET requests to @p path with @p body.
+     */
+    void addJson(const QString &path, const QByteArray &body, int status = 200);
+
+    /**
+     * @brief Answer GET requests to @p path with the contents of the test data file @p name.
+     */
+    void addFixture(const QString &path, const QString &name, int status = 200);
+
+    /**
+     * @brief Answer GET requests to @p path with @p data, or the part of it asked for with a Range header. See rangeResponse().
+     */
+    void addFile(const QString &path, const QByteArray &data);
+
+    /**
+     * @return The response to @p request for @p data, taking a single Range and If-Range into account like a static file server would.
+     * The ETag is @p etag, or made up from @p data if it's empty.
+     */
+    [[nodiscard]] static Response rangeResponse(const Request &request, const QByteArray &data, const QByteArray &etag = {});
+
+    /**
+     * @brief Serves @p posts, newest first, as a timeline at @p path.
+     *
+     * max_id, since_id, min_id and limit are understood, and next and prev Link headers are sent along.
+     */
+    void addTimeline(const QString &path, const QJsonArray &posts, int pageSize = 20);
+
+    /**
+     * @return The contents of the test data file @p name.
+     */
+    [[nodiscard]] static QByteArray fixture(const QString &name);
+
+    /**
+     * @return @p count distinct posts, newest first, based on status.json.
+     */
+    [[nodiscard]] static QJsonArray generatePosts(int count);
+
+    /**
+     * @brief Wait for @p latency before answering each request.
+     */
+    void setLatency(std::chrono::milliseconds latency);
+
+    /**
+     * @brief Send response bodies at no more than @p bytesPerSecond. Zero means unlimited.
+     */
+    void setBandwidth(qint64 bytesPerSecond);
+
+    /**
+     * @return Every request received so far.
+     */
+    [[nodiscard]] QList<Request> requests() const;
+
+    /**
+     * @return How many requests were made to @p path.
+     */
+    [[nodiscard]] qsizetype requestCount(const QString &path) const;
+
+    /**
+     * @brief Plays @p script to every client connecting to the streaming API from now on.
+     */
+    void setStreamingScript(const QList<StreamingEvent> &script);
+
+    /**
+     * @brief Sends an event to every connected streaming client.
+     */
+    void sendStreamingEvent(const QStringList &stream, const QString &event, const QByteArray &payload);
+
+    /**
+     * @brief Aborts every streaming connection, as if the network dropped.
+     */
+    void dropStreamingConnections();
+
+    /**
+     * @return How many clients are connected to the streaming API.
+     */
+    [[nodiscard]] qsizetype streamingConnectionCount() const;
+
+    /**
+     * @return The messages clients sent over the streaming API, like subscriptions.
+     */
+    [[nodiscard]] QList<QJsonObject> streamingMessages() const;
+
+Q_SIGNALS:
+    void requestReceived(const QByteArray &method, const QString &path);
+    void streamingMessageReceived(const QJsonObject &message);
+
+private:
+    void readRequest(QTcpSocket *socket);
+    [[nodiscard]] Response respond(const Request &request) const;
+    void writeResponse(QTcpSocket *socket, const Response &response);
+    void finishResponse(QTcpSocket *socket);
+    void handleStreamingConnection();
+
+    QTcpServer m_server;
+    QWebSocketServer m_webSocketServer;
+    QSet<QTcpSocket *> m_busySockets;
+    QList<QWebSocket *> m_streamingClients;
+
+    QHash<std::pair<QByteArray, QString>, Handler> m_routes;
+    QList<Request> m_requests;
+    QList<QJsonObject> m_streamingMessages;
+    QList<StreamingEvent> m_streamingScript;
+
+    std::chrono::milliseconds m_latency{0};
+    qint64 m_bandwidth = 0;
+};
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/richtextcache.h"
+#include "utils/texthandler.h"
+
+#include <QSignalSpy>
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+
+class RichTextCacheTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testPrepare()
+    {
+        RichTextCache cache;
+        QSignalSpy ready(&cache, &RichTextCache::textReady);
+        const QString html = u"<p>مرحبا <a href=\"https://example.org/@alice\">@alice</a></p>"_s;
+        const QFont font;
+
+        QVERIFY(!cache.text(html, font));
+        // Asking again while it's being prepared doesn't prepare it twice
+        QVERIFY(!cache.text(html, font));
+
+        QVERIFY(ready.wait());
+        QCOMPARE(ready.size(), 1);
+        QCOMPARE(ready.first().first().toString(), html);
+
+        const auto text = cache.text(html, font);
+        QVERIFY(text);
+        QCOMPARE(*text, TextHandler::fixBidirectionality(html, font));
+    }
+
+    // Texts prepared for another font aren't used
+    void testFontChange()
+    {
+        RichTextCache cache;
+        QSignalSpy ready(&cache, &RichTextCache::textReady);
+        const QString html = u"<p>Hello</p>"_s;
+
+        QFont font;
+        QVERIFY(!cache.text(html, font));
+        QVERIFY(ready.wait());
+        QVERIFY(cache.text(html, font));
+
+        QSignalSpy fontChanged(&cache, &RichTextCache::fontChanged);
+        font.setPointSize(font.pointSize() + 4);
+        QVERIFY(!cache.text(html, font));
+        QVERIFY(ready.wait());
+        QCOMPARE(*cache.text(html, font), TextHandler::fixBidirectionality(html, font));
+        // Only later, since it's asked for while showing posts
+        QCOMPARE(fontChanged.size(), 1);
+
+        // Changed ahead of time, like when the setting changes
+        font.setPointSize(font.pointSize() + 4);
+        cache.setFont(font);
+        QCOMPARE(fontChanged.size(), 2);
+        QVERIFY(!cache.text(html, font));
+        cache.setFont(font);
+        QCOMPARE(fontChanged.size(), 2);
+    }
+
+    // What was still being prepared for the old font is thrown away
+    void testFontChangeWhilePreparing()
+    {
+        RichTextCache cache;
+        QSignalSpy ready(&cache, &RichTextCache::textReady);
+        const QString html = u"<p>Hello</p>"_s;
+
+        QFont font;
+        QVERIFY(!cache.text(html, font));
+        font.setPointSize(font.pointSize() + 4);
+        cache.setFont(font);
+
+        QVERIFY(!ready.wait(500));
+        QVERIFY(!cache.text(html, font));
+        QVERIFY(ready.wait());
+        QCOMPARE(*cache.text(html, font), TextHandler::fixBidirectionality(html, font));
+    }
+
+    void testEviction()
+    {
+        RichTextCache cache;
+        QSignalSpy ready(&cache, &RichTextCache::textReady);
+        const QFont font;
+        const QString first = u"<p>First</p>"_s;
+        const QString second = u"<p>Second</p>"_s;
+
+        QVERIFY(!cache.text(first, font));
+        QVERIFY(ready.wait());
+        cache.setMaxCost(cache.text(first, font)->size());
+
+        QVERIFY(!cache.text(second, font));
+        QVERIFY(ready.wait());
+        QVERIFY(cache.text(second, font));
+        QVERIFY(!cache.text(first, font));
+    }
+};
+
+QTEST_MAIN(RichTextCacheTest)
+#include "richtextcachetest.moc"
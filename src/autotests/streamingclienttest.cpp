@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/accountmanager.h"
+#include "network/streamingclient.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QWebSocketServer>
+#include <QtTest/QtTest>
+
+using namespace Qt::Literals::StringLiterals;
+
+class StreamingClientTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        AccountManager::instance().setTestMode(true);
+
+        server = new QWebSocketServer(QStringLiteral("Tokodon test"), QWebSocketServer::NonSecureMode, this);
+        QVERIFY(server->listen(QHostAddress::LocalHost));
+
+        connect(server, &QWebSocketServer::newConnection, this, [this] {
+            serverSocket = server->nextPendingConnection();
+            connections++;
+            connect(serverSocket, &QWebSocket::textMessageReceived, this, [this](const QString &message) {
+                received.push_back(QJsonDocument::fromJson(message.toUtf8()).object());
+            });
+        });
+    }
+
+    void init()
+    {
+        received.clear();
+    }
+
+    // Every stream should be subscribed to over the same connection, and only once
+    void testSubscribe()
+    {
+        client.subscribe(QStringLiteral("user"));
+        client.subscribe(QStringLiteral("hashtag"), QStringLiteral("KDE"));
+        client.subscribe(QStringLiteral("hashtag"), QStringLiteral("kde"));
+        client.subscribe(QStringLiteral("list"), QStringLiteral("1"));
+
+        client.setUrl(QUrl(QStringLiteral("ws://%1:%2/api/v1/streaming").arg(server->serverAddress().toString()).arg(server->serverPort())));
+
+        QTRY_COMPARE(received.size(), 3);
+        QCOMPARE(connections, 1);
+        QCOMPARE(client.subscriberCount(QStringLiteral("hashtag:kde")), 2);
+        QCOMPARE(client.subscriptions().size(), 3);
+
+        QStringList streams;
+        for (const auto &message : std::as_const(received)) {
+            QCOMPARE(message["type"_L1].toString(), QStringLiteral("subscribe"));
+            streams.push_back(StreamingClient::streamKey(message["stream"_L1].toString(),
+                                                         message.contains("tag"_L1) ? message["tag"_L1].toString() : message["list"_L1].toString()));
+        }
+        streams.sort();
+        QCOMPARE(streams, (QStringList{QStringLiteral("hashtag:kde"), QStringLiteral("list:1"), QStringLiteral("user")}));
+
+        // Subscribing to something new after connecting is sent right away
+        client.subscribe(QStringLiteral("public:local"));
+        QTRY_COMPARE(received.size(), 4);
+        QCOMPARE(received.last()["stream"_L1].toString(), QStringLiteral("public:local"));
+        QCOMPARE(connections, 1);
+    }
+
+    // The server should only be told to unsubscribe once the last user is gone
+    void testUnsubscribe()
+    {
+        client.unsubscribe(QStringLiteral("hashtag"), QStringLiteral("kde"));
+        QCOMPARE(client.subscriberCount(QStringLiteral("hashtag:kde")), 1);
+
+        client.unsubscribe(QStringLiteral("hashtag"), QStringLiteral("kde"));
+        QCOMPARE(client.subscriberCount(QStringLiteral("hashtag:kde")), 0);
+
+        QTRY_COMPARE(received.size(), 1);
+        QCOMPARE(received.first()["type"_L1].toString(), QStringLiteral("unsubscribe"));
+        QCOMPARE(received.first()["stream"_L1].toString(), QStringLiteral("hashtag"));
+        QCOMPARE(received.first()["tag"_L1].toString(), QStringLiteral("kde"));
+    }
+
+    // Events should be routed by the stream in their envelope
+    void testRouting()
+    {
+        QSignalSpy spy(&client, &StreamingClient::eventReceived);
+
+        serverSocket->sendTextMessage(QStringLiteral(R"({"stream":["list","1"],"event":"update","payload":"{\"id\":\"1\"}"})"));
+        serverSocket->sendTextMessage(QStringLiteral(R"({"stream":["hashtag","KDE"],"event":"delete","payload":"2"})"));
+        serverSocket->sendTextMessage(QStringLiteral(R"({"event":"notification","payload":"{}"})"));
+        serverSocket->sendTextMessage(QStringLiteral(R"({"error":"Unknown stream type"})"));
+
+        QTRY_COMPARE(spy.count(), 3);
+        QCOMPARE(spy.at(0).at(0).toString(), QStringLiteral("list:1"));
+        QCOMPARE(spy.at(0).at(1).toString(), QStringLiteral("update"));
+        QCOMPARE(spy.at(0).at(2).toByteArray(), QByteArrayLiteral("{\"id\":\"1\"}"));
+        QCOMPARE(spy.at(1).at(0).toString(), QStringLiteral("hashtag:kde"));
+        QCOMPARE(spy.at(1).at(2).toByteArray(), QByteArrayLiteral("2"));
+        QCOMPARE(spy.at(2).at(0).toString(), QStringLiteral("user"));
+    }
+
+    // The server drops the connection a few times, and every stream should come back each time
+    void testDroppedConnections()
+    {
+        client.setReconnectDelay(std::chrono::milliseconds(10), std::chrono::milliseconds(100));
+
+        QSignalSpy reconnectedSpy(&client, &StreamingClient::reconnected);
+        const int subscriptionCount = client.subscriptions().size();
+        const int previousConnections = connections;
+
+        QTimer dropTimer;
+        dropTimer.setInterval(100);
+        connect(&dropTimer, &QTimer::timeout, this, [this] {
+            if (serverSocket && serverSocket->state() == QAbstractSocket::ConnectedState) {
+                serverSocket->abort();
+            }
+        });
+        dropTimer.start();
+
+        QTRY_VERIFY_WITH_TIMEOUT(reconnectedSpy.count() >= 3, 5000);
+        dropTimer.stop();
+
+        QTRY_VERIFY(client.isConnected());
+        QCOMPARE(client.reconnectAttempts(), 0);
+        QTRY_COMPARE(connections - previousConnections, reconnectedSpy.count());
+        QTRY_COMPARE(received.size(), subscriptionCount * reconnectedSpy.count());
+        for (const auto &message : std::as_const(received)) {
+            QCOMPARE(message["type"_L1].toString(), QStringLiteral("subscribe"));
+        }
+    }
+
+    // While the server is gone, every attempt should wait longer than the last, up to the maximum
+    void testBackoff()
+    {
+        client.setReconnectDelay(std::chrono::milliseconds(20), std::chrono::milliseconds(200));
+
+        QList<std::chrono::milliseconds> delays;
+        connect(&client, &StreamingClient::reconnectScheduled, this, [&delays](const std::chrono::milliseconds delay) {
+            delays.push_back(delay);
+        });
+
+        const quint16 port = server->serverPort();
+        server->close();
+        serverSocket->abort();
+
+        QTRY_VERIFY_WITH_TIMEOUT(delays.size() >= 6, 5000);
+        QVERIFY(delays[1] > delays[0]);
+        QVERIFY(delays[2] > delays[1]);
+        for (const auto delay : std::as_const(delays)) {
+            QVERIFY(delay <= std::chrono::milliseconds(200));
+        }
+
+        QSignalSpy reconnectedSpy(&client, &StreamingClient::reconnected);
+        QVERIFY(server->listen(QHostAddress::LocalHost, port));
+        QTRY_COMPARE_WITH_TIMEOUT(reconnectedSpy.count(), 1, 5000);
+        QCOMPARE(client.reconnectAttempts(), 0);
+
+        disconnect(&client, &StreamingClient::reconnectScheduled, this, nullptr);
+    }
+
+private:
+    QWebSocketServer *server = nullptr;
+    QWebSocket *serverSocket = nullptr;
+    StreamingClient client;
+    QList<QJsonObject> received;
+    int connections = 0;
+};
+
+QTEST_MAIN(StreamingClientTest)
+#include "streamingclienttest.moc"
@@ -35,6 +35,32 @@ private Q_SLOTS:
         QCOMPARE(TextHandler::getNextLink(header), next);
         QCOMPARE(TextHandler::getPrevLink(header), prev);
     }
+
+    void stripHtml_data()
+    {
+        QTest::addColumn<QString>("html");
+        QTest::addColumn<QString>("text");
+
+        QTest::addRow("link") << QStringLiteral(
+            "<p>Hello <a href=\"https://kde.org\" rel=\"nofollow noopener\"><span class=\"invisible\">https://</span><span class=\"\">kde.org</span></a></p>")
+                              << QStringLiteral("Hello https://kde.org");
+        QTest::addRow("paragraphs") << QStringLiteral("<p>First</p><p>Second<br>line<br />and more</p>") << QStringLiteral("First\nSecond\nline\nand more");
+        QTest::addRow("entities") << QStringLiteral("<p>&lt;3 &amp; &quot;quotes&quot; &#39;single&#39; &#x1F600;</p>")
+                                  << QStringLiteral("<3 & \"quotes\" 'single' \U0001F600");
+        QTest::addRow("unknown entities") << QStringLiteral("Tom &amp Jerry &unknown; &#xZZ;") << QStringLiteral("Tom &amp Jerry &unknown; &#xZZ;");
+        QTest::addRow("whitespace") << QStringLiteral("<p>  lots   of\n space  </p>\n<p> here</p>") << QStringLiteral("lots of space\nhere");
+        QTest::addRow("non-breaking") << QStringLiteral("a&nbsp;&nbsp;b") << QStringLiteral("a  b");
+        QTest::addRow("emoji") << QStringLiteral("<p>Hi <img height=\"16\" align=\"middle\" width=\"16\" src=\"a.png\"></p>") << QStringLiteral("Hi");
+        QTest::addRow("empty") << QString() << QString();
+    }
+
+    void stripHtml()
+    {
+        QFETCH(QString, html);
+        QFETCH(QString, text);
+
+        QCOMPARE(TextHandler::stripHtml(html), text);
+    }
 };
 
 QTEST_MAIN(TextHandlerTest)
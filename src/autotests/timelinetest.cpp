@@ -111,6 +111,33 @@ private Q_SLOTS:
         QCOMPARE(tagModel.rowCount({}), 5);
     }
 
+    // Posts missed while the stream was down should be merged on top of the existing ones, however many pages they take up
+    void testTagModelBackfill()
+    {
+        const auto tagUrl = account->apiUrl(QStringLiteral("/api/v1/timelines/tag/backfill"));
+        account->registerGet(tagUrl, new TestReply(QStringLiteral("statuses-older.json"), account));
+
+        const auto pageUrl = [&tagUrl](const QString &minId) {
+            auto url = tagUrl;
+            url.setQuery(QUrlQuery{{QStringLiteral("min_id"), minId}});
+            return url;
+        };
+        account->registerGet(pageUrl(QStringLiteral("103270114826048975")), new TestReply(QStringLiteral("statuses-gap.json"), account));
+        account->registerGet(pageUrl(QStringLiteral("103270115326048975")), new TestReply(QStringLiteral("statuses.json"), account));
+        account->registerGet(pageUrl(QStringLiteral("103270115826048975")), new TestReply(QStringLiteral("empty-array.json"), account));
+
+        TagsTimelineModel tagModel;
+        tagModel.setHashtag(QStringLiteral("backfill"));
+        QCOMPARE(tagModel.rowCount({}), 2);
+
+        Q_EMIT account->streamReconnected();
+
+        QCOMPARE(tagModel.rowCount({}), 8);
+        QCOMPARE(tagModel.data(tagModel.index(0, 0), AbstractTimelineModel::IdRole).toString(), QStringLiteral("103270115826048975"));
+        QCOMPARE(tagModel.data(tagModel.index(5, 0), AbstractTimelineModel::IdRole).toString(), QStringLiteral("103270115326048975"));
+        QCOMPARE(tagModel.data(tagModel.index(6, 0), AbstractTimelineModel::IdRole).toString(), QStringLiteral("103270114826048975"));
+    }
+
     void testThreadModel()
     {
         account->registerGet(account->apiUrl(QStringLiteral("/api/v1/statuses/103270115826048975")), new TestReply(QStringLiteral("status.json"), account));
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/accountmanager.h"
+#include "autotests/helperreply.h"
+#include "autotests/mockaccount.h"
+#include "network/validatorcache.h"
+
+#include <QtTest/QtTest>
+
+class ValidatorCacheTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+        AccountManager::instance().setTestMode(true);
+        account = new MockAccount();
+        AccountManager::instance().addAccount(account);
+        ValidatorCache::instance().clear();
+    }
+
+    void cleanup()
+    {
+        ValidatorCache::instance().clear();
+    }
+
+    // A response with a validator should be revalidated next time, and reused when the server says it's not modified
+    void testNotModified()
+    {
+        auto &cache = ValidatorCache::instance();
+        const QUrl url = account->apiUrl(QStringLiteral("/api/v1/custom_emojis"));
+        const QUrl key = ValidatorCache::cacheKey(url, account->username());
+
+        auto reply = new TestReply(QStringLiteral("emoji.json"), account);
+        reply->setRawHeader("ETag", "W/\"1234\"");
+        account->registerGet(url, reply);
+
+        QJsonDocument received;
+        account->getCached(url, true, this, [&received](const QJsonDocument &doc) {
+            received = doc;
+        });
+
+        QVERIFY(received.isArray());
+        QCOMPARE(received.array().size(), 2);
+        QCOMPARE(cache.misses(), 1);
+        QCOMPARE(cache.bytesSaved(), 0);
+        QCOMPARE(cache.conditionalHeaders(key).value("If-None-Match"), QByteArrayLiteral("W/\"1234\""));
+
+        auto notModifiedReply = new TestReply(QStringLiteral("error.json"), account);
+        notModifiedReply->setAttribute(QNetworkRequest::HttpStatusCodeAttribute, 304);
+        account->registerGet(url, notModifiedReply);
+
+        received = {};
+        account->getCached(url, true, this, [&received](const QJsonDocument &doc) {
+            received = doc;
+        });
+
+        QVERIFY(received.isArray());
+        QCOMPARE(received.array().size(), 2);
+        QCOMPARE(cache.hits(), 1);
+        QCOMPARE(cache.bytesSaved(), QFileInfo(QLatin1String(DATA_DIR "/emoji.json")).size());
+    }
+
+    // Responses without any validators can't be revalidated, so they aren't kept around
+    void testNoValidators()
+    {
+        auto &cache = ValidatorCache::instance();
+        const QUrl url = account->apiUrl(QStringLiteral("/api/v1/instance/rules"));
+
+        account->registerGet(url, new TestReply(QStringLiteral("rules.json"), account));
+
+        QJsonDocument received;
+        account->getCached(url, false, this, [&received](const QJsonDocument &doc) {
+            received = doc;
+        });
+
+        QVERIFY(received.isArray());
+        QVERIFY(cache.conditionalHeaders(ValidatorCache::cacheKey(url, account->username())).isEmpty());
+    }
+
+    // The same endpoint on two accounts must not share cached responses
+    void testPerAccountKeys()
+    {
+        const QUrl url = account->apiUrl(QStringLiteral("/api/v1/lists"));
+        QVERIFY(ValidatorCache::cacheKey(url, QStringLiteral("alice")) != ValidatorCache::cacheKey(url, QStringLiteral("bob")));
+    }
+
+private:
+    MockAccount *account;
+};
+
+QTEST_MAIN(ValidatorCacheTest)
+#include "validatorcachetest.moc"
@@ -29,7 +29,7 @@ RowLayout {
         Layout.alignment: admin ? Qt.AlignCenter : Qt.AlignTop
         Layout.rowSpan: 5
 
-        source: root.identity?.avatarUrl ?? ""
+        source: ImageCache.source(root.identity?.avatarUrl ?? "")
         cache: true
         name: root.identity?.displayName ?? ""
     }
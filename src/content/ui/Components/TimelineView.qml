@@ -39,6 +39,35 @@ ListView {
     // Used for pages like TimelinePage to control video playback
     property bool isCurrentPage: true
 
+    // Start loading the images of the next few posts, in the direction we're scrolling in
+    function prefetchMedia(): void {
+        if (!root.isCurrentPage || !root.model.prefetch) {
+            return;
+        }
+        const first = root.indexAt(root.width / 2, root.contentY);
+        const last = root.indexAt(root.width / 2, root.contentY + root.height - 1);
+        if (first !== -1) {
+            // Decoded at the size the delegates show them at, so they find them in ImageCache
+            const gridWidth = root.itemAtIndex(first)?.attachmentGridWidth ?? 0;
+            root.model.prefetch(first, last !== -1 ? last : root.count - 1, gridWidth, Screen.devicePixelRatio);
+        }
+    }
+
+    onContentYChanged: Qt.callLater(root.prefetchMedia)
+    onCountChanged: Qt.callLater(root.prefetchMedia)
+    onIsCurrentPageChanged: {
+        if (root.isCurrentPage) {
+            Qt.callLater(root.prefetchMedia);
+        } else if (root.model.cancelPrefetch) {
+            root.model.cancelPrefetch();
+        }
+    }
+    Component.onDestruction: {
+        if (root.model && root.model.cancelPrefetch) {
+            root.model.cancelPrefetch();
+        }
+    }
+
     Connections {
         target: root.model
         function onPostSourceReady(backend, isEdit): void {
@@ -37,7 +37,7 @@ Delegates.IndicatorItemDelegate {
 
         KirigamiComponents.Avatar {
             name: root.authorIdentity.displayName
-            source: root.authorIdentity.avatarUrl
+            source: ImageCache.source(root.authorIdentity.avatarUrl)
             Layout.rightMargin: Kirigami.Units.largeSpacing
             sourceSize.width: Kirigami.Units.gridUnit + Kirigami.Units.largeSpacing * 2
             sourceSize.height: Kirigami.Units.gridUnit + Kirigami.Units.largeSpacing * 2
@@ -4,6 +4,8 @@
 import QtQuick
 import QtQuick.Controls 2 as QQC2
 import QtQuick.Layouts
+import QtQuick.Dialogs
+import QtCore
 import QtQml.Models
 
 import org.kde.kirigami 2 as Kirigami
@@ -13,8 +15,38 @@ import org.kde.kirigamiaddons.components 1 as Components
 import org.kde.tokodon
 
 MastoPage {
+    id: root
+
     title: "Debug"
 
+    readonly property var timingSummary: NetworkTimings.summary
+    property var imageStatistics: ImageCache.statistics()
+    readonly property real timingWindow: Math.max(timingSummary.windowEnd - timingSummary.windowStart, 1)
+    readonly property var phaseColors: [
+        Kirigami.Theme.disabledTextColor,
+        Kirigami.Theme.neutralTextColor,
+        Kirigami.Theme.linkColor,
+        Kirigami.Theme.positiveTextColor,
+        Kirigami.Theme.negativeTextColor
+    ]
+
+    function formatMsecs(msecs: real): string {
+        return msecs.toFixed(1) + " ms";
+    }
+
+    FileDialog {
+        id: exportDialog
+        fileMode: FileDialog.SaveFile
+        currentFolder: StandardPaths.writableLocation(StandardPaths.DocumentsLocation)
+        defaultSuffix: "json"
+        nameFilters: ["JSON files (*.json)"]
+        onAccepted: {
+            if (!NetworkTimings.exportToFile(selectedFile)) {
+                applicationWindow().showPassiveNotification("Could not export the network timings");
+            }
+        }
+    }
+
     FormCard.FormHeader {
         title: "Alerts"
     }
@@ -85,4 +117,251 @@ MastoPage {
             onClicked: AccountManager.selectedAccount.unknownNotification()
         }
     }
+
+    FormCard.FormHeader {
+        title: "Network Timings"
+    }
+
+    FormCard.FormCard {
+        FormCard.FormTextDelegate {
+            text: "Requests"
+            description: root.timingSummary.count + " requests, " + Math.round(root.timingSummary.bytes / 1024) + " KiB"
+        }
+
+        FormCard.FormTextDelegate {
+            text: "Total time"
+            description: "Median " + root.formatMsecs(root.timingSummary.median) + ", 95th percentile " + root.formatMsecs(root.timingSummary.p95)
+        }
+
+        FormCard.FormTextDelegate {
+            text: "Average phases"
+            description: "Queued " + root.formatMsecs(root.timingSummary.queueWait)
+                + ", connecting " + root.formatMsecs(root.timingSummary.connect)
+                + ", first byte " + root.formatMsecs(root.timingSummary.timeToFirstByte)
+                + ", transfer " + root.formatMsecs(root.timingSummary.transfer)
+                + ", parsing " + root.formatMsecs(root.timingSummary.parse)
+                + ", callback " + root.formatMsecs(root.timingSummary.callback)
+        }
+
+        FormCard.FormTextDelegate {
+            text: "Slowest endpoints"
+            description: root.timingSummary.slowestEndpoints.map(endpoint => endpoint.endpoint + " (" + endpoint.count + "×, " + root.formatMsecs(endpoint.average) + ")").join("\n")
+        }
+
+        FormCard.FormDelegateSeparator {}
+
+        FormCard.AbstractFormDelegate {
+            background: null
+            contentItem: RowLayout {
+                id: histogram
+
+                readonly property int maxCount: Math.max(1, ...NetworkTimings.histogram.map(bucket => bucket.count))
+
+                spacing: Kirigami.Units.smallSpacing
+                implicitHeight: Kirigami.Units.gridUnit * 6
+
+                Repeater {
+                    model: NetworkTimings.histogram
+
+                    delegate: ColumnLayout {
+                        id: bucketDelegate
+
+                        required property var modelData
+                        required property int index
+
+                        spacing: Kirigami.Units.smallSpacing
+                        Layout.fillWidth: true
+                        Layout.fillHeight: true
+
+                        QQC2.Label {
+                            text: bucketDelegate.modelData.count
+                            font: Kirigami.Theme.smallFont
+                            Layout.alignment: Qt.AlignHCenter
+                        }
+
+                        Item {
+                            Layout.fillWidth: true
+                            Layout.fillHeight: true
+
+                            Rectangle {
+                                anchors.bottom: parent.bottom
+                                width: parent.width
+                                height: parent.height * bucketDelegate.modelData.count / histogram.maxCount
+                                color: Kirigami.Theme.highlightColor
+                            }
+                        }
+
+                        QQC2.Label {
+                            text: bucketDelegate.modelData.upperBound < 0 ? "slower" : "< " + bucketDelegate.modelData.upperBound + " ms"
+                            font: Kirigami.Theme.smallFont
+                            Layout.alignment: Qt.AlignHCenter
+                        }
+                    }
+                }
+            }
+        }
+
+        FormCard.FormDelegateSeparator {}
+
+        FormCard.AbstractFormDelegate {
+            background: null
+            contentItem: ColumnLayout {
+                spacing: Kirigami.Units.smallSpacing
+
+                RowLayout {
+                    spacing: Kirigami.Units.largeSpacing
+
+                    Repeater {
+                        model: ["Queued", "Connecting", "First byte", "Transfer", "Callback"]
+
+                        delegate: RowLayout {
+                            id: legendDelegate
+
+                            required property string modelData
+                            required property int index
+
+                            spacing: Kirigami.Units.smallSpacing
+
+                            Rectangle {
+                                implicitWidth: Kirigami.Units.iconSizes.small
+                                implicitHeight: Kirigami.Units.iconSizes.small
+                                color: root.phaseColors[legendDelegate.index]
+                            }
+
+                            QQC2.Label {
+                                text: legendDelegate.modelData
+                                font: Kirigami.Theme.smallFont
+                            }
+                        }
+                    }
+                }
+
+                ListView {
+                    id: waterfall
+
+                    clip: true
+                    model: NetworkTimings
+                    implicitHeight: Kirigami.Units.gridUnit * 20
+                    Layout.fillWidth: true
+
+                    delegate: RowLayout {
+                        id: requestDelegate
+
+                        required property string method
+                        required property string endpoint
+                        required property int status
+                        required property real start
+                        required property real queueWait
+                        required property real connect
+                        required property real timeToFirstByte
+                        required property real transfer
+                        required property real callback
+                        required property real total
+
+                        width: ListView.view.width
+                        spacing: Kirigami.Units.smallSpacing
+
+                        QQC2.Label {
+                            text: requestDelegate.method + " " + requestDelegate.endpoint + " (" + requestDelegate.status + ")"
+                            elide: Text.ElideMiddle
+                            font: Kirigami.Theme.smallFont
+                            Layout.preferredWidth: waterfall.width * 0.4
+                        }
+
+                        Item {
+                            id: bars
+
+                            readonly property real scale: width / root.timingWindow
+
+                            implicitHeight: Kirigami.Units.gridUnit
+                            Layout.fillWidth: true
+
+                            Row {
+                                x: (requestDelegate.start - root.timingSummary.windowStart) * bars.scale
+                                height: parent.height
+
+                                Repeater {
+                                    model: [requestDelegate.queueWait, requestDelegate.connect, requestDelegate.timeToFirstByte, requestDelegate.transfer, requestDelegate.callback]
+
+                                    delegate: Rectangle {
+                                        required property real modelData
+                                        required property int index
+
+                                        width: Math.max(modelData * bars.scale, modelData > 0 ? 1 : 0)
+                                        height: parent.height
+                                        color: root.phaseColors[index]
+                                    }
+                                }
+                            }
+
+                            QQC2.ToolTip.text: root.formatMsecs(requestDelegate.total)
+                            QQC2.ToolTip.visible: waterfallHover.hovered
+
+                            HoverHandler {
+                                id: waterfallHover
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        FormCard.FormDelegateSeparator {}
+
+        FormCard.FormButtonDelegate {
+            text: "Export as JSON…"
+            enabled: root.timingSummary.count > 0
+            onClicked: exportDialog.open()
+        }
+
+        FormCard.FormButtonDelegate {
+            text: "Clear"
+            onClicked: NetworkTimings.clear()
+        }
+    }
+
+    FormCard.FormHeader {
+        title: "Image Cache"
+    }
+
+    FormCard.FormCard {
+        FormCard.FormTextDelegate {
+            text: "Memory"
+            description: root.imageStatistics.count + " images, " + Math.round(root.imageStatistics.bytes / 1024) + " of "
+                + Math.round(root.imageStatistics.byteBudget / 1024) + " KiB"
+        }
+
+        FormCard.FormTextDelegate {
+            text: "Requests"
+            description: root.imageStatistics.hits + " hits, " + root.imageStatistics.misses + " misses, "
+                + root.imageStatistics.joined + " joined a load in progress"
+        }
+
+        FormCard.FormTextDelegate {
+            text: "Downloads"
+            description: root.imageStatistics.downloads + " downloads, " + Math.round(root.imageStatistics.downloadedBytes / 1024) + " KiB, "
+                + root.imageStatistics.failures + " failed"
+        }
+
+        FormCard.FormTextDelegate {
+            text: "Decoding"
+            description: root.imageStatistics.decodes + " images, average " + root.formatMsecs(root.imageStatistics.averageDecodeTime / 1000)
+                + ", slowest " + root.formatMsecs(root.imageStatistics.maxDecodeTime / 1000)
+        }
+
+        FormCard.FormDelegateSeparator {}
+
+        FormCard.FormButtonDelegate {
+            text: "Refresh"
+            onClicked: root.imageStatistics = ImageCache.statistics()
+        }
+
+        FormCard.FormButtonDelegate {
+            text: "Clear"
+            onClicked: {
+                ImageCache.clear();
+                root.imageStatistics = ImageCache.statistics();
+            }
+        }
+    }
 }
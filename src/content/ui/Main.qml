@@ -834,6 +834,15 @@ StatefulApp.StatefulWindow {
         }
     }
 
+    // Errors of the other accounts, like their interactions being rolled back, would only be confusing here
+    Connections {
+        target: AccountManager.selectedAccount
+
+        function onErrorOccured(errorMessage: string): void {
+            root.showPassiveNotification(errorMessage);
+        }
+    }
+
     Loader {
         id: embedDialog
 
@@ -56,7 +56,7 @@ RowLayout {
                     implicitWidth: implicitHeight
 
                     name: modelData.displayName
-                    source: modelData.avatarUrl
+                    source: ImageCache.source(modelData.avatarUrl)
                     cache: true
 
                     onClicked: Navigation.openAccount(modelData.id)
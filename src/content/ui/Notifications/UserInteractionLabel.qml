@@ -59,7 +59,7 @@ RowLayout {
                 implicitWidth: implicitHeight
 
                 name: root.notificationActorIdentity ? root.notificationActorIdentity.displayName : ''
-                source: root.notificationActorIdentity ? root.notificationActorIdentity.avatarUrl : ''
+                source: root.notificationActorIdentity ? ImageCache.source(root.notificationActorIdentity.avatarUrl) : ''
                 cache: true
                 visible: root.isFavorite || root.isBoost
 
@@ -154,8 +154,11 @@ Item {
                         FocusedImage {
                             id: img
 
+                            // Decoded at the size it's shown at, which is also what TimelineModel prefetches
+                            readonly property size decodeSize: ImageCache.attachmentSize(Qt.size(root.viewportWidth, root.implicitHeight), attachmentsRepeater.count, imgContainer.index, Screen.devicePixelRatio)
+
                             anchors.fill: parent
-                            source: imgContainer.modelData.previewUrl
+                            source: decodeSize.width > 0 ? ImageCache.source(imgContainer.modelData.previewUrl) : ""
 
                             onStatusChanged: {
                                 if (status === Image.Error) {
@@ -167,7 +170,7 @@ Item {
                             crop: !root.shouldKeepAspectRatio
                             focusX: imgContainer.modelData.focusX
                             focusY: imgContainer.modelData.focusY
-                            sourceSize: Qt.size(imgContainer.modelData.sourceWidth, imgContainer.modelData.sourceHeight)
+                            sourceSize: decodeSize
 
                             Rectangle {
                                 anchors.fill: parent
@@ -215,7 +215,7 @@ Item {
                                 implicitWidth: implicitHeight
 
                                 name: root.card.authorIdentity ? root.card.authorIdentity.displayName : ''
-                                source: root.card.authorIdentity ? root.card.authorIdentity.avatarUrl : ''
+                                source: root.card.authorIdentity ? ImageCache.source(root.card.authorIdentity.avatarUrl) : ''
                                 cache: true
                             }
                             QQC2.Label {
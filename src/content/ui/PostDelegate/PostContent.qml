@@ -14,6 +14,8 @@ QQC2.Label {
     id: root
 
     required property string content
+    // The content as prepared in the background by the model, if it does that. It's shown as it is until that's done.
+    property var displayContent: undefined
     required property bool expandedPost
     required property bool secondary
     required property bool shouldOpenInternalLinks
@@ -30,7 +32,12 @@ QQC2.Label {
     Accessible.description: TextHandler.stripHtml(root.content)
 
     activeFocusOnTab: true
-    text: TextHandler.fixBidirectionality(root.content, Config.defaultFont)
+    text: {
+        if (root.displayContent === undefined) {
+            return TextHandler.fixBidirectionality(root.content, Config.defaultFont);
+        }
+        return root.displayContent.length > 0 ? root.displayContent : root.content;
+    }
     Layout.fillWidth: true
     textFormat: TextEdit.RichText
     wrapMode: TextEdit.Wrap
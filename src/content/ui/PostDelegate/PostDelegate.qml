@@ -47,6 +47,7 @@ QQC2.ItemDelegate {
     required property bool pinned
 
     required property string content
+    required property string displayContent
     required property string spoilerText
     required property string relativeTime
     required property string absoluteTime
@@ -84,6 +85,8 @@ QQC2.ItemDelegate {
 
     readonly property bool isSelf: AccountManager.selectedAccount.identity === root.authorIdentity
     readonly property real threadMargin: Kirigami.Units.largeSpacing * 4
+    // What the attachment grid is laid out at, for TimelineView to prefetch images at the right size
+    readonly property real attachmentGridWidth: flexColumn.innerWidth
 
     padding: 0
     topPadding: Kirigami.Units.largeSpacing
@@ -407,6 +410,7 @@ QQC2.ItemDelegate {
                 id: postContent
 
                 content: root.content
+                displayContent: root.displayContent
                 expandedPost: root.expandedPost
                 secondary: root.secondary
                 visible: root.spoilerText.length === 0 || AccountManager.selectedAccount.preferences.extendSpoiler
@@ -56,7 +56,7 @@ RowLayout {
             implicitWidth: implicitHeight
 
             name: root.identity ? root.identity.displayName : ''
-            source: root.identity ? root.identity.avatarUrl : ''
+            source: root.identity ? ImageCache.source(root.identity.avatarUrl) : ''
             cache: true
 
             onClicked: Navigation.openAccount(root.identity.id)
@@ -45,7 +45,7 @@ QQC2.AbstractButton {
             KirigamiComponents.AvatarButton {
                 id: avatar
 
-                source: root.post.authorIdentity.avatarUrl
+                source: ImageCache.source(root.post.authorIdentity.avatarUrl)
                 cache: true
                 onClicked: {
                     Navigation.openAccount(root.post.authorIdentity.id);
@@ -69,7 +69,8 @@ MediaContainer {
         id: previewImage
 
         anchors.fill: parent
-        source: root.previewUrl
+        source: ImageCache.source(root.previewUrl)
+        sourceSize: Qt.size(Math.ceil(width * Screen.devicePixelRatio), Math.ceil(height * Screen.devicePixelRatio))
 
         visible: ((player.item?.loading ?? false) || (player.item?.stopped ?? true)) && !root.isSensitive
 
@@ -176,4 +176,69 @@ FormCard.FormCardPage {
             }
         }
     }
+
+    FormCard.FormHeader {
+        title: i18nc("@title:group", "Uploads")
+    }
+
+    FormCard.FormCard {
+        FormCard.FormSwitchDelegate {
+            id: optimizeImageUploads
+            text: i18nc("@option:check", "Shrink images before uploading")
+            description: i18n("Images are scaled down to what your server allows and compressed, which makes uploading them faster. Metadata like the location a photo was taken at is removed.")
+            checked: Config.optimizeImageUploads
+            enabled: !Config.isOptimizeImageUploadsImmutable
+            onToggled: {
+                Config.optimizeImageUploads = checked
+                Config.save()
+            }
+        }
+
+        FormCard.FormDelegateSeparator {
+            below: optimizeImageUploads; above: uploadImageQuality
+        }
+
+        FormCard.FormSpinBoxDelegate {
+            id: uploadImageQuality
+            label: i18nc("@label:spinbox", "Image quality")
+            from: 10
+            to: 100
+            value: Config.uploadImageQuality
+            enabled: Config.optimizeImageUploads && !Config.isUploadImageQualityImmutable
+            onValueChanged: {
+                if (value !== Config.uploadImageQuality) {
+                    Config.uploadImageQuality = value
+                    Config.save()
+                }
+            }
+        }
+
+        FormCard.FormDelegateSeparator {
+            below: uploadImageQuality; above: uploadImageFormat
+        }
+
+        FormCard.FormComboBoxDelegate {
+            id: uploadImageFormat
+            text: i18nc("@label:listbox", "Image format")
+            description: i18n("WebP images are smaller, but some apps can't show them.")
+            textRole: "display"
+            valueRole: "value"
+            model: [
+                {
+                    display: i18nc("@item:inlistbox Image format", "JPEG"),
+                    value: "jpeg"
+                },
+                {
+                    display: i18nc("@item:inlistbox Image format", "WebP"),
+                    value: "webp"
+                },
+            ]
+            enabled: Config.optimizeImageUploads && !Config.isUploadImageFormatImmutable
+            Component.onCompleted: currentIndex = indexOfValue(Config.uploadImageFormat)
+            onActivated: {
+                Config.uploadImageFormat = currentValue
+                Config.save()
+            }
+        }
+    }
 }
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+import QtQuick
+import QtQuick.Controls 2 as QQC2
+import QtQuick.Layouts
+
+import org.kde.kirigami 2 as Kirigami
+import org.kde.kirigamiaddons.formcard 1 as FormCard
+
+import org.kde.tokodon
+
+FormCard.FormCardPage {
+    id: root
+
+    title: i18nc("@title:window", "Storage")
+
+    property var statistics: DiskCache.statistics()
+
+    // In the order of DiskCache.Partition, with the setting holding each quota in MiB
+    readonly property var partitions: [
+        {
+            name: i18nc("@label Cached data", "API responses"),
+            setting: "apiCacheSize"
+        },
+        {
+            name: i18nc("@label Cached data", "Avatars and emoji"),
+            setting: "avatarCacheSize"
+        },
+        {
+            name: i18nc("@label Cached data", "Previews"),
+            setting: "previewCacheSize"
+        },
+        {
+            name: i18nc("@label Cached data", "Full size media"),
+            setting: "mediaCacheSize"
+        }
+    ]
+
+    Connections {
+        target: DiskCache
+
+        function onStatisticsChanged(): void {
+            root.statistics = DiskCache.statistics();
+        }
+    }
+
+    FormCard.FormHeader {
+        title: i18nc("@title:group", "Cache")
+    }
+
+    FormCard.FormCard {
+        Repeater {
+            model: root.statistics
+
+            ColumnLayout {
+                id: partitionDelegate
+
+                required property var modelData
+                required property int index
+
+                readonly property var partition: root.partitions[modelData.partition]
+
+                spacing: 0
+
+                FormCard.FormDelegateSeparator {
+                    visible: partitionDelegate.index !== 0
+                }
+
+                FormCard.FormSpinBoxDelegate {
+                    label: partitionDelegate.partition.name
+                    from: 1
+                    to: 10000
+                    value: Config[partitionDelegate.partition.setting]
+                    textFromValue: (value, locale) => i18nc("@label:spinbox Size of a cache in mebibytes", "%1 MiB", value)
+                    valueFromText: (text, locale) => parseInt(text)
+                    onValueChanged: {
+                        if (value !== Config[partitionDelegate.partition.setting]) {
+                            Config[partitionDelegate.partition.setting] = value;
+                            Config.save();
+                            DiskCache.setQuota(partitionDelegate.modelData.partition, value * 1024 * 1024);
+                        }
+                    }
+                }
+
+                FormCard.FormTextDelegate {
+                    text: i18nc("@info %1 and %2 are sizes like 20 MB", "%1 of %2 used", Qt.locale().formattedDataSize(partitionDelegate.modelData.usage), Qt.locale().formattedDataSize(partitionDelegate.modelData.quota))
+                    description: i18nc("@info", "Found in the cache %1 times, not found %2 times this session", partitionDelegate.modelData.hits, partitionDelegate.modelData.misses)
+                }
+            }
+        }
+    }
+
+    FormCard.FormCard {
+        Layout.topMargin: Kirigami.Units.largeSpacing
+
+        FormCard.FormButtonDelegate {
+            id: trimButton
+            icon.name: "edit-cut"
+            text: i18nc("@action:button", "Trim Caches")
+            description: i18n("Removes large and rarely used files until every cache is well below half of its size.")
+            onClicked: DiskCache.trim()
+        }
+
+        FormCard.FormDelegateSeparator {
+            below: trimButton; above: clearButton
+        }
+
+        FormCard.FormButtonDelegate {
+            id: clearButton
+            icon.name: "edit-clear-all"
+            text: i18nc("@action:button", "Clear Caches")
+            description: i18n("Removes everything that was cached. It will be downloaded again when needed.")
+            onClicked: DiskCache.clear()
+        }
+    }
+}
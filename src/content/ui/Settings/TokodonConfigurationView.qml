@@ -51,6 +51,12 @@ KirigamiSettings.ConfigurationView {
             icon.name: "network-connect"
             page: () => Qt.createComponent("org.kde.tokodon", "NetworkProxyPage")
         },
+        KirigamiSettings.ConfigurationModule {
+            moduleId: "storage"
+            text: i18n("Storage")
+            icon.name: "drive-harddisk"
+            page: () => Qt.createComponent("org.kde.tokodon", "StoragePage")
+        },
         KirigamiSettings.ShortcutsConfigurationModule {
             application: root.application
         },
@@ -33,7 +33,6 @@ Kirigami.ScrollablePage {
     property var mentions: []
     property int visibility: AccountManager.selectedAccount.preferences.defaultVisibility
     property int sensitive: AccountManager.selectedAccount.preferences.defaultSensitive
-    readonly property NetworkRequestProgress progress: NetworkRequestProgress {}
     property var previewPost: null
     property string initialText
     property bool closeApplicationWhenFinished: false
@@ -89,36 +88,46 @@ Kirigami.ScrollablePage {
         }
     ]
 
-    data: Connections {
-        target: backend
-        function onPosted(error) {
-            if (error.length === 0) {
-                root.discardDraft = true;
+    data: [
+        Connections {
+            target: backend
+            function onPosted(error) {
+                if (error.length === 0) {
+                    root.discardDraft = true;
+                    if (root.closeApplicationWhenFinished) {
+                        root.Window.window.close();
+                    } else {
+                        root.Window.window.pageStack.layers.pop();
+                    }
+                    applicationWindow().newPost();
+                } else {
+                    banner.type = Kirigami.MessageType.Error;
+                    banner.text = error;
+                    console.log(error);
+                }
+            }
+
+            function onEditComplete(obj) {
                 if (root.closeApplicationWhenFinished) {
                     root.Window.window.close();
                 } else {
                     root.Window.window.pageStack.layers.pop();
                 }
-                applicationWindow().newPost();
-            } else {
-                banner.type = Kirigami.MessageType.Error;
-                banner.text = error;
-                console.log(error);
             }
-        }
 
-        function onEditComplete(obj) {
-            if (root.closeApplicationWhenFinished) {
-                root.Window.window.close();
-            } else {
-                root.Window.window.pageStack.layers.pop();
+            function onScheduledPostLoaded(): void {
+                root.refreshData();
             }
-        }
+        },
+        Connections {
+            target: root.backend.attachmentEditorModel
 
-        function onScheduledPostLoaded(): void {
-            root.refreshData();
+            function onUploadFailed(errorString: string): void {
+                banner.type = Kirigami.MessageType.Error;
+                banner.text = errorString;
+            }
         }
-    }
+    ]
 
     Component.onCompleted: {
         if (initialText.length > 0) {
@@ -264,11 +273,11 @@ Kirigami.ScrollablePage {
     }
 
     function uploadFile(url: string): void {
-        progress.reply = backend.attachmentEditorModel.append(url);
+        backend.attachmentEditorModel.append(url);
     }
 
     function uploadData(data: var): void {
-        progress.reply = backend.attachmentEditorModel.appendData(data);
+        backend.attachmentEditorModel.appendData(data);
     }
 
     function pasteImage(): bool {
@@ -428,9 +437,9 @@ Kirigami.ScrollablePage {
                     Layout.fillWidth: true
                     from: 0
                     to: 100
-                    visible: progress.uploading
-                    value: progress.progress
-                    indeterminate: progress.progress === 100 && progress.uploading
+                    visible: root.backend.attachmentEditorModel.uploading || root.backend.attachmentEditorModel.processing
+                    value: root.backend.attachmentEditorModel.uploadProgress
+                    indeterminate: (root.backend.attachmentEditorModel.uploadProgress === 100 && root.backend.attachmentEditorModel.uploading) || root.backend.attachmentEditorModel.processing
                     Layout.leftMargin: Kirigami.Units.smallSpacing
                     Layout.rightMargin: Kirigami.Units.smallSpacing
                 }
@@ -704,7 +713,7 @@ Kirigami.ScrollablePage {
 
                 icon.name: root.purposeIconName()
                 text: root.purposeString()
-                enabled: root.isStatusValid && root.isPollValid && (!progress.uploading || backend.attachmentEditorModel.count > 0)
+                enabled: root.isStatusValid && root.isPollValid && (!backend.attachmentEditorModel.uploading || backend.attachmentEditorModel.count > 0)
                 Layout.alignment: Qt.AlignRight
                 onClicked: {
                     if (!backend.attachmentEditorModel.isAltTextComplete()) {
@@ -9,8 +9,6 @@
 #include <QJsonDocument>
 #include <QNetworkReply>
 
-#include <QTextDocumentFragment>
-
 using namespace Qt::Literals::StringLiterals;
 
 ConversationModel::ConversationModel(QObject *parent)
@@ -55,7 +53,7 @@ QVariant ConversationModel::data(const QModelIndex &index, int role) const
     case UnreadRole:
         return m_conversations[row].unread;
     case ContentRole:
-        return QTextDocumentFragment::fromHtml(lastPost->content()).toPlainText();
+        return lastPost->plainContent();
     case ConversationAuthorsRole:
         if (identities.count() == 0) {
             return i18n("Empty conversation");
@@ -67,7 +65,7 @@ QVariant ConversationModel::data(const QModelIndex &index, int role) const
             return i18np("%2 and one other", "%2 and %1 others", identities.count() - 1, firstIdentity->displayNameHtml());
         }
     default:
-        return postData(lastPost, role);
+        return postData(index, lastPost, role);
     }
 }
 
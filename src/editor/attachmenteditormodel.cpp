@@ -4,9 +4,18 @@
 
 #include "editor/attachmenteditormodel.h"
 
+#include <KLocalizedString>
+#include <QFileInfo>
 #include <QJsonDocument>
+#include <QMimeDatabase>
+#include <QUuid>
 
 #include "account/account.h"
+#include "config.h"
+#include "network/networkrequestprogress.h"
+#include "tokodon_debug.h"
+
+using namespace Qt::Literals::StringLiterals;
 
 AttachmentEditorModel::AttachmentEditorModel(QObject *parent, AbstractAccount *account)
     : QAbstractListModel(parent)
@@ -14,6 +23,11 @@ AttachmentEditorModel::AttachmentEditorModel(QObject *parent, AbstractAccount *a
 {
 }
 
+AttachmentEditorModel::~AttachmentEditorModel()
+{
+    m_pool.waitForDone();
+}
+
 int AttachmentEditorModel::rowCount(const QModelIndex &parent) const
 {
     Q_UNUSED(parent);
@@ -25,6 +39,11 @@ int AttachmentEditorModel::count() const
     return rowCount({});
 }
 
+bool AttachmentEditorModel::processing() const
+{
+    return m_processing > 0;
+}
+
 QVariant AttachmentEditorModel::data(const QModelIndex &index, int role) const
 {
     if (!index.isValid()) {
@@ -57,39 +76,160 @@ QHash<int, QByteArray> AttachmentEditorModel::roleNames() const
     };
 }
 
-QNetworkReply *AttachmentEditorModel::append(const QString &filename)
+void AttachmentEditorModel::append(const QString &filename)
 {
-    if (rowCount({}) >= m_account->maxMediaAttachments()) {
-        return nullptr;
+    if (isFull()) {
+        return;
     }
 
     QString localFilename = filename;
     localFilename.remove(QStringLiteral("file://"));
 
-    return m_account->upload(QUrl::fromLocalFile(localFilename), [this](QNetworkReply *reply) {
-        const auto doc = QJsonDocument::fromJson(reply->readAll());
+    process([localFilename, optimize = Config::optimizeImageUploads(), options = uploadOptions()] {
+        const auto result = optimize ? ImageUploadProcessor::processFile(localFilename, options) : ImageUploadProcessor::Result{};
+        if (!result.isNull()) {
+            return Prepared{.source = {.data = result.data,
+                                       .fileName = result.fileName,
+                                       .mimeType = result.mimeType,
+                                       .hash = MediaUploadManager::hashData(result.data)},
+                            .originalSize = result.originalSize};
+        }
+
+        // Not an image, or one that is fine as it is
+        return Prepared{.source = {.path = localFilename,
+                                   .fileName = QFileInfo(localFilename).fileName(),
+                                   .mimeType = QMimeDatabase().mimeTypeForFile(localFilename).name(),
+                                   .hash = MediaUploadManager::hashFile(localFilename)}};
+    });
+}
+
+void AttachmentEditorModel::appendData(QVariant data)
+{
+    const auto image = data.value<QImage>();
+    if (image.isNull() || isFull()) {
+        return;
+    }
+
+    auto options = uploadOptions();
+    if (!Config::optimizeImageUploads()) {
+        // Still encoded in memory, but without losing anything
+        options = {.format = QByteArrayLiteral("png")};
+    }
+
+    process([image, baseName = QUuid::createUuid().toString(QUuid::WithoutBraces), options] {
+        const auto result = ImageUploadProcessor::processImage(image, baseName, options);
+        return Prepared{.source = {.data = result.data,
+                                   .fileName = result.fileName,
+                                   .mimeType = result.mimeType,
+                                   .hash = MediaUploadManager::hashData(result.data)},
+                        .originalSize = result.originalSize};
+    });
+}
+
+bool AttachmentEditorModel::isFull() const
+{
+    return rowCount({}) + m_processing + m_uploads.size() >= m_account->maxMediaAttachments();
+}
 
-        if (!doc.isObject()) {
+ImageUploadProcessor::Options AttachmentEditorModel::uploadOptions() const
+{
+    return {
+        .maxPixels = m_account->imageMatrixLimit(),
+        .maxBytes = m_account->imageSizeLimit(),
+        .quality = Config::uploadImageQuality(),
+        .format = Config::uploadImageFormat().toLatin1(),
+    };
+}
+
+void AttachmentEditorModel::process(std::function<Prepared()> prepare)
+{
+    m_processing++;
+    Q_EMIT processingChanged();
+
+    // Decoding and encoding a large photo, or hashing a video, takes long enough to freeze the composer
+    m_pool.start([this, prepare = std::move(prepare)] {
+        const auto prepared = prepare();
+        QMetaObject::invokeMethod(
+            this,
+            [this, prepared] {
+                upload(prepared);
+            },
+            Qt::QueuedConnection);
+    });
+}
+
+void AttachmentEditorModel::upload(const Prepared &prepared)
+{
+    m_processing--;
+    Q_EMIT processingChanged();
+
+    const auto &source = prepared.source;
+    if (source.data.isEmpty() && source.path.isEmpty()) {
+        Q_EMIT uploadFailed(i18n("The image could not be encoded for uploading."));
+        return;
+    }
+
+    if (!source.data.isEmpty() && prepared.originalSize > 0) {
+        qCDebug(TOKODON_LOG) << "Uploading" << source.fileName << "as" << source.data.size() << "bytes, saving" << prepared.originalSize - source.data.size()
+                             << "bytes";
+        Q_EMIT imageProcessed(prepared.originalSize, source.data.size());
+    }
+
+    const auto upload = m_account->mediaUploads()->upload(source);
+    m_uploads.push_back(upload);
+    Q_EMIT uploadsChanged();
+
+    connect(upload->progress(), &NetworkRequestProgress::progressChanged, this, &AttachmentEditorModel::uploadsChanged);
+    connect(upload, &MediaUpload::stateChanged, this, &AttachmentEditorModel::uploadsChanged);
+    connect(upload, &MediaUpload::finished, this, [this, upload](const QJsonObject &attachment) {
+        m_uploads.removeAll(upload);
+        Q_EMIT uploadsChanged();
+
+        // Attaching the same file twice only uploads it once, but it can't be in the same post twice either
+        const QString id = attachment["id"_L1].toString();
+        if (std::ranges::any_of(std::as_const(m_attachments), [&id](const Attachment *existing) {
+                return existing->id() == id;
+            })) {
             return;
         }
 
         beginInsertRows({}, m_attachments.count(), m_attachments.count());
-        m_attachments.append(new Attachment{doc.object(), this});
+        m_attachments.append(new Attachment{attachment, this});
         endInsertRows();
         Q_EMIT countChanged();
     });
+    connect(upload, &MediaUpload::failed, this, [this, upload](const QString &errorString) {
+        m_uploads.removeAll(upload);
+        Q_EMIT uploadsChanged();
+        Q_EMIT uploadFailed(errorString);
+    });
 }
 
-QNetworkReply *AttachmentEditorModel::appendData(QVariant data)
+bool AttachmentEditorModel::uploading() const
 {
-    const auto image = data.value<QImage>();
+    return !m_uploads.isEmpty();
+}
 
-    const QString tempPath = m_saveDir.filePath(QStringLiteral("%1.png").arg(QUuid::createUuid().toString()));
-    if (image.save(tempPath, "PNG")) {
-        return append(tempPath);
+int AttachmentEditorModel::uploadProgress() const
+{
+    if (m_uploads.isEmpty()) {
+        return 0;
     }
 
-    return nullptr;
+    int progress = 0;
+    for (const auto upload : m_uploads) {
+        switch (upload->state()) {
+        case MediaUpload::State::Queued:
+            break;
+        case MediaUpload::State::Uploading:
+            progress += upload->progress()->progress();
+            break;
+        default:
+            progress += 100;
+            break;
+        }
+    }
+    return progress / m_uploads.size();
 }
 
 void AttachmentEditorModel::appendExisting(Attachment *attachment)
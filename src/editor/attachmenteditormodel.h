@@ -7,8 +7,10 @@
 #include <QAbstractListModel>
 #include <QJsonArray>
 #include <QNetworkReply>
-#include <QTemporaryDir>
+#include <QThreadPool>
 
+#include "account/mediauploadmanager.h"
+#include "editor/imageuploadprocessor.h"
 #include "timeline/post.h"
 
 class QTimer;
@@ -18,14 +20,33 @@ class AttachmentEditorModel : public QAbstractListModel
 {
     Q_OBJECT
     Q_PROPERTY(int count READ count NOTIFY countChanged)
+    Q_PROPERTY(bool processing READ processing NOTIFY processingChanged)
+    Q_PROPERTY(bool uploading READ uploading NOTIFY uploadsChanged)
+    Q_PROPERTY(int uploadProgress READ uploadProgress NOTIFY uploadsChanged)
 
 public:
     explicit AttachmentEditorModel(QObject *parent, AbstractAccount *account);
+    ~AttachmentEditorModel() override;
 
     enum ExtraRole { PreviewRole = Qt::UserRole + 1, DescriptionRole, FocalXRole, FocalYRole };
 
     [[nodiscard]] int count() const;
 
+    /**
+     * @return If images are being shrunk before they are uploaded.
+     */
+    [[nodiscard]] bool processing() const;
+
+    /**
+     * @return If files are being uploaded, or waiting for the server to process them.
+     */
+    [[nodiscard]] bool uploading() const;
+
+    /**
+     * @return The progress of all running uploads together, from 0 to 100.
+     */
+    [[nodiscard]] int uploadProgress() const;
+
     Q_INVOKABLE [[nodiscard]] int rowCount(const QModelIndex &parent = {}) const override;
     [[nodiscard]] QVariant data(const QModelIndex &index, int role) const override;
     [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
@@ -35,8 +56,15 @@ public:
     void copyFromArray(const QJsonArray &array);
 
 public Q_SLOTS:
-    QNetworkReply *append(const QString &fileName);
-    QNetworkReply *appendData(QVariant data);
+    /**
+     * @brief Uploads the file at @p fileName, shrinking it first if it's an image.
+     */
+    void append(const QString &fileName);
+
+    /**
+     * @brief Uploads the image in @p data, for example from the clipboard.
+     */
+    void appendData(QVariant data);
     void appendExisting(Attachment *attachment);
     void removeAttachment(int row);
     void setDescription(int row, const QString &description);
@@ -50,11 +78,33 @@ public Q_SLOTS:
 Q_SIGNALS:
     void postChanged();
     void countChanged();
+    void processingChanged();
+
+    void uploadsChanged();
+
+    /// Emitted when an appended file couldn't be uploaded
+    void uploadFailed(const QString &errorString);
+
+    /// Emitted when an image was shrunk from @p originalSize to @p uploadSize bytes before uploading it
+    void imageProcessed(qint64 originalSize, qint64 uploadSize);
 
 private:
+    struct Prepared {
+        MediaUploadManager::Source source;
+        qint64 originalSize = 0; ///< If the image was shrunk, its size before.
+    };
+
+    [[nodiscard]] bool isFull() const;
+    [[nodiscard]] ImageUploadProcessor::Options uploadOptions() const;
+    void process(std::function<Prepared()> prepare);
+    void upload(const Prepared &prepared);
+
     QList<Attachment *> m_attachments;
     QHash<QString, QTimer *> m_updateTimers;
     AbstractAccount *m_account = nullptr;
+    int m_processing = 0;
+    QList<MediaUpload *> m_uploads;
 
-    QTemporaryDir m_saveDir;
+    // Last, so running processing is waited for before the rest is gone
+    QThreadPool m_pool;
 };
@@ -0,0 +1,248 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "editor/imageuploadprocessor.h"
+
+#include <QBuffer>
+#include <QFile>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QImageWriter>
+
+#include <cmath>
+#include <cstring>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+// Don't go below this quality when trying to fit the size limit, scale down instead
+constexpr int minimumQuality = 40;
+constexpr int maxAttempts = 8;
+
+bool isOpaque(const QImage &image)
+{
+    if (!image.hasAlphaChannel()) {
+        return true;
+    }
+
+    const QImage argb = image.convertToFormat(QImage::Format_ARGB32);
+    for (int y = 0; y < argb.height(); y++) {
+        const auto line = reinterpret_cast<const QRgb *>(argb.constScanLine(y));
+        for (int x = 0; x < argb.width(); x++) {
+            if (qAlpha(line[x]) != 255) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Copying only the pixels leaves the text keys behind, which the writers would otherwise store as comments
+QImage withoutMetadata(const QImage &image, const bool opaque)
+{
+    const QImage source = image.convertToFormat(opaque ? QImage::Format_RGB32 : QImage::Format_ARGB32);
+
+    QImage stripped(source.size(), source.format());
+    for (int y = 0; y < source.height(); y++) {
+        memcpy(stripped.scanLine(y), source.constScanLine(y), source.bytesPerLine());
+    }
+    stripped.setColorSpace(source.colorSpace());
+    return stripped;
+}
+
+QByteArray encode(const QImage &image, const QByteArray &format, const int quality)
+{
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+
+    QImageWriter writer(&buffer, format);
+    writer.setQuality(quality);
+    writer.setOptimizedWrite(true);
+    writer.setProgressiveScanWrite(true);
+    if (!writer.write(image)) {
+        return {};
+    }
+    return data;
+}
+}
+
+ImageUploadProcessor::Result ImageUploadProcessor::processFile(const QString &path, const Options &options)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+
+    QImageReader reader(&file);
+    if (!reader.canRead()) {
+        return {};
+    }
+
+    // Re-encoding would lose every frame but the first, and vector images have no pixels to limit
+    const QByteArray format = reader.format();
+    if (format.startsWith("svg") || (reader.supportsAnimation() && reader.imageCount() != 1)) {
+        return {};
+    }
+
+    // Mapped rather than read, since only the headers of the chunks are looked at
+    const uchar *mapped = file.map(0, file.size());
+    const bool metadata = hasMetadata(mapped ? QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), file.size()) : file.peek(64 * 1024));
+    if (mapped) {
+        file.unmap(const_cast<uchar *>(mapped));
+    }
+
+    const QSize size = reader.size();
+    const QSize target = clampedSize(size, options.maxPixels);
+    if (target != size) {
+        reader.setScaledSize(target);
+    }
+    reader.setAutoTransform(true);
+
+    const QImage image = reader.read();
+    if (image.isNull()) {
+        return {};
+    }
+
+    Options remaining = options;
+    remaining.maxPixels = 0;
+
+    Result result = processImage(image, QFileInfo(path).completeBaseName(), remaining);
+    result.originalSize = file.size();
+
+    // An original which is already small enough and has nothing to strip is better than any re-encoding of it
+    const bool tooLarge = options.maxBytes > 0 && result.originalSize > options.maxBytes;
+    if (target == size && !metadata && !tooLarge && result.data.size() >= result.originalSize) {
+        return {};
+    }
+
+    return result;
+}
+
+ImageUploadProcessor::Result ImageUploadProcessor::processImage(const QImage &image, const QString &baseName, const Options &options)
+{
+    Result result;
+    if (image.isNull()) {
+        return result;
+    }
+
+    // There's no file to compare against, so the decoded size is the best we have
+    result.originalSize = image.sizeInBytes();
+
+    const QSize target = clampedSize(image.size(), options.maxPixels);
+    const bool opaque = isOpaque(image);
+    QImage source = withoutMetadata(target != image.size() ? image.scaled(target, Qt::IgnoreAspectRatio, Qt::SmoothTransformation) : image, opaque);
+
+    QByteArray format = options.format;
+    if (!QImageWriter::supportedImageFormats().contains(format)) {
+        format = QByteArrayLiteral("jpeg");
+    }
+    if (!opaque && format == "jpeg") {
+        format = QByteArrayLiteral("png");
+    }
+    const bool lossy = format != "png";
+
+    int quality = std::clamp(options.quality, 0, 100);
+    QByteArray data = encode(source, format, quality);
+
+    // Try harder if the server would reject it otherwise
+    for (int attempt = 0; options.maxBytes > 0 && data.size() > options.maxBytes && attempt < maxAttempts; attempt++) {
+        if (lossy && quality > minimumQuality) {
+            quality = std::max(minimumQuality, quality - 15);
+        } else {
+            source = source.scaled(source.size() * 0.75, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        }
+        data = encode(source, format, quality);
+    }
+
+    if (data.isEmpty()) {
+        return result;
+    }
+
+    const QString extension = format == "jpeg" ? u"jpg"_s : QString::fromLatin1(format);
+    result.data = data;
+    result.fileName = u"%1.%2"_s.arg(baseName, extension);
+    result.mimeType = u"image/%1"_s.arg(QString::fromLatin1(format));
+    return result;
+}
+
+QSize ImageUploadProcessor::clampedSize(const QSize &size, const qint64 maxPixels)
+{
+    if (maxPixels <= 0 || size.isEmpty() || static_cast<qint64>(size.width()) * size.height() <= maxPixels) {
+        return size;
+    }
+
+    // Rounding both down keeps it below the limit
+    const double scale = std::sqrt(static_cast<double>(maxPixels) / (static_cast<double>(size.width()) * size.height()));
+    int width = std::max(1, static_cast<int>(size.width() * scale));
+    int height = std::max(1, static_cast<int>(size.height() * scale));
+
+    // Unless one side had to be kept at a pixel, then the other one has to give
+    if (static_cast<qint64>(width) * height > maxPixels) {
+        if (width >= height) {
+            width = static_cast<int>(std::max<qint64>(1, maxPixels / height));
+        } else {
+            height = static_cast<int>(std::max<qint64>(1, maxPixels / width));
+        }
+    }
+    return {width, height};
+}
+
+bool ImageUploadProcessor::hasMetadata(const QByteArray &data)
+{
+    const auto byte = [&data](const qsizetype pos) {
+        return static_cast<uchar>(data[pos]);
+    };
+
+    if (data.startsWith("\xFF\xD8")) {
+        // Walk the segments before the image data, EXIF and XMP are stored in APP1 ones and IPTC in APP13
+        qsizetype pos = 2;
+        while (pos + 4 <= data.size() && byte(pos) == 0xFF) {
+            const uchar marker = byte(pos + 1);
+            if (marker == 0xDA) {
+                return false;
+            }
+            if (marker == 0xE1 || marker == 0xED) {
+                return true;
+            }
+            pos += 2 + ((byte(pos + 2) << 8) | byte(pos + 3));
+        }
+        // Cut off before the image data, or not what it should look like
+        return true;
+    }
+
+    if (data.startsWith("\x89PNG\r\n\x1A\n")) {
+        // Text chunks may come after the image data as well, so all of them are looked at
+        qsizetype pos = 8;
+        while (pos + 8 <= data.size()) {
+            const QByteArrayView type(data.constData() + pos + 4, 4);
+            if (type == "IEND") {
+                return false;
+            }
+            if (type == "eXIf" || type == "iTXt" || type == "tEXt" || type == "zTXt" || type == "tIME") {
+                return true;
+            }
+            const qint64 length = (qint64(byte(pos)) << 24) | (byte(pos + 1) << 16) | (byte(pos + 2) << 8) | byte(pos + 3);
+            pos += 12 + length;
+        }
+        return true;
+    }
+
+    if (data.startsWith("RIFF") && data.mid(8, 4) == "WEBP") {
+        qsizetype pos = 12;
+        while (pos + 8 <= data.size()) {
+            const QByteArrayView type(data.constData() + pos, 4);
+            if (type == "EXIF" || type == "XMP ") {
+                return true;
+            }
+            const qint64 length = byte(pos + 4) | (byte(pos + 5) << 8) | (byte(pos + 6) << 16) | (qint64(byte(pos + 7)) << 24);
+            // Chunks are padded to an even size
+            pos += 8 + length + (length % 2);
+        }
+        return pos != data.size();
+    }
+
+    // HEIF, AVIF, TIFF and others may carry it in too many places to look for, so they're always re-encoded
+    return true;
+}
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QByteArray>
+#include <QImage>
+#include <QString>
+
+/**
+ * @brief Shrinks images before they are uploaded.
+ *
+ * Images are scaled down to the instance's pixel limit, since the server would do that anyway after receiving all of it, and re-encoded in a lossy
+ * format. Metadata like EXIF, which often contains the location a photo was taken at, is not carried over. The orientation is applied to the pixels
+ * instead.
+ *
+ * Everything here is blocking, so call it from a worker thread.
+ */
+class ImageUploadProcessor
+{
+public:
+    struct Options {
+        qint64 maxPixels = 0; ///< The instance's image_matrix_limit, or 0 for none.
+        qint64 maxBytes = 0; ///< The instance's image_size_limit, or 0 for none.
+        int quality = 85; ///< From 0 to 100.
+        QByteArray format = QByteArrayLiteral("jpeg"); ///< Either jpeg or webp, images with transparency are kept as PNG if it's jpeg.
+    };
+
+    struct Result {
+        QByteArray data;
+        QString fileName;
+        QString mimeType;
+        qint64 originalSize = 0;
+
+        /**
+         * @return If there's nothing to upload, and the original should be uploaded as is.
+         */
+        [[nodiscard]] bool isNull() const
+        {
+            return data.isEmpty();
+        }
+
+        /**
+         * @return How many bytes smaller the upload is than the original.
+         */
+        [[nodiscard]] qint64 bytesSaved() const
+        {
+            return originalSize - data.size();
+        }
+    };
+
+    /**
+     * @brief Shrinks the image at @p path.
+     * @return A null result if it's not an image, is animated, or processing it wouldn't make it any better.
+     */
+    static Result processFile(const QString &path, const Options &options);
+
+    /**
+     * @brief Encodes @p image, for example from the clipboard, for uploading as @p baseName.
+     */
+    static Result processImage(const QImage &image, const QString &baseName, const Options &options);
+
+    /**
+     * @return @p size scaled down to not have more than @p maxPixels, keeping its aspect ratio.
+     */
+    static QSize clampedSize(const QSize &size, qint64 maxPixels);
+
+    /**
+     * @return If the image in @p data may have metadata like EXIF, XMP or text chunks. That's only known for JPEG, PNG and WebP, anything
+     * else is assumed to have some.
+     */
+    static bool hasMetadata(const QByteArray &data);
+};
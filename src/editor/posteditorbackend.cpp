@@ -45,6 +45,11 @@ void PostEditorBackend::setStatus(const QString &status)
     }
     m_status = status;
     Q_EMIT statusChanged();
+
+    if (m_analyzer.setText(m_status)) {
+        Q_EMIT entitiesChanged();
+    }
+    Q_EMIT charactersLeftChanged();
 }
 
 QString PostEditorBackend::spoilerText() const
@@ -58,7 +63,9 @@ void PostEditorBackend::setSpoilerText(const QString &spoilerText)
         return;
     }
     m_spoilerText = spoilerText;
+    m_spoilerTextLength = PostTextAnalyzer::characterCount(m_spoilerText);
     Q_EMIT spoilerTextChanged();
+    Q_EMIT charactersLeftChanged();
 }
 
 QString PostEditorBackend::inReplyTo() const
@@ -162,6 +169,7 @@ void PostEditorBackend::setAccount(AbstractAccount *account)
     }
     m_account = account;
     Q_EMIT accountChanged();
+    Q_EMIT charactersLeftChanged();
 }
 
 void PostEditorBackend::setHasExistingPoll(bool hasExisting)
@@ -178,18 +186,34 @@ int PostEditorBackend::charactersLeft() const
         return 0;
     }
 
-    QRegularExpression re{QStringLiteral(R"((http|https):\/\/([\w_-]+(?:(?:\.[\w_-]+)+))([\w.,@?^=%&:\/~+#-]*[\w@?^=%&\/~+#-]))")};
-    re.setPatternOptions(QRegularExpression::DontCaptureOption);
-
-    const auto matches = re.match(m_status).capturedTexts();
-
-    // We want to accumulate each link, and then "add back" the characters you should
-    // have, taking the difference from charactersPreservedPerUrl.
-    const int sum = std::accumulate(matches.constBegin(), matches.constEnd(), 0, [this](int sum, const QString &link) {
-        return sum + link.length() - m_account->charactersReservedPerUrl();
-    });
+    // The content warning counts towards the limit as well
+    const qsizetype length = m_analyzer.countedLength(static_cast<qsizetype>(m_account->charactersReservedPerUrl())) + m_spoilerTextLength;
+    return static_cast<int>(static_cast<qsizetype>(m_account->maxPostLength()) - length);
+}
 
-    return m_account->maxPostLength() - m_status.length() + sum;
+QVariantList PostEditorBackend::entities() const
+{
+    QVariantList entities;
+    entities.reserve(m_analyzer.entities().size());
+    for (const auto &entity : m_analyzer.entities()) {
+        QString type;
+        switch (entity.type) {
+        case PostTextAnalyzer::Url:
+            type = u"url"_s;
+            break;
+        case PostTextAnalyzer::Mention:
+            type = u"mention"_s;
+            break;
+        case PostTextAnalyzer::Hashtag:
+            type = u"hashtag"_s;
+            break;
+        case PostTextAnalyzer::CustomEmoji:
+            type = u"emoji"_s;
+            break;
+        }
+        entities.push_back(QVariantMap{{u"type"_s, type}, {u"start"_s, entity.start}, {u"length"_s, entity.length}});
+    }
+    return entities;
 }
 
 void PostEditorBackend::copyFromOther(PostEditorBackend *other)
@@ -274,6 +298,7 @@ void PostEditorBackend::save()
         true,
         this,
         [this](QNetworkReply *) {
+            forgetUploadedMedia();
             Q_EMIT posted(QStringLiteral(""));
         },
         [this](QNetworkReply *reply) {
@@ -300,10 +325,20 @@ void PostEditorBackend::edit()
         auto doc = QJsonDocument::fromJson(data);
         auto obj = doc.object();
 
+        forgetUploadedMedia();
         Q_EMIT editComplete(obj);
     });
 }
 
+void PostEditorBackend::forgetUploadedMedia()
+{
+    QStringList mediaIds;
+    for (const auto &att : std::as_const(m_attachmentEditorModel->attachments())) {
+        mediaIds.push_back(att->m_id);
+    }
+    m_account->mediaUploads()->forget(mediaIds);
+}
+
 void PostEditorBackend::saveDraft()
 {
     // Set it far in the future so it's a "draft"
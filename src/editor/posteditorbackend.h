@@ -6,6 +6,7 @@
 #include <QJsonDocument>
 
 #include "editor/polleditorbackend.h"
+#include "editor/posttextanalyzer.h"
 #include "timeline/post.h"
 
 class AttachmentEditorModel;
@@ -26,7 +27,8 @@ class PostEditorBackend : public QObject
     Q_PROPERTY(bool sensitive READ sensitive WRITE setSensitive NOTIFY sensitiveChanged)
     Q_PROPERTY(PollEditorBackend *poll MEMBER m_poll CONSTANT)
     Q_PROPERTY(bool pollEnabled MEMBER m_pollEnabled NOTIFY pollEnabledChanged)
-    Q_PROPERTY(int charactersLeft READ charactersLeft NOTIFY statusChanged)
+    Q_PROPERTY(int charactersLeft READ charactersLeft NOTIFY charactersLeftChanged)
+    Q_PROPERTY(QVariantList entities READ entities NOTIFY entitiesChanged)
 
     Q_PROPERTY(AbstractAccount *account READ account WRITE setAccount NOTIFY accountChanged)
 
@@ -70,6 +72,12 @@ public:
 
     [[nodiscard]] int charactersLeft() const;
 
+    /**
+     * @return The links, mentions, hashtags and custom emojis in the status, so they can be highlighted. Each one has a type ("url",
+     * "mention", "hashtag" or "emoji"), and a start and length in the status.
+     */
+    [[nodiscard]] QVariantList entities() const;
+
     Q_INVOKABLE void copyFromOther(PostEditorBackend *other);
 
     Q_INVOKABLE void setupReplyTo(Post *post);
@@ -107,13 +115,24 @@ Q_SIGNALS:
 
     void scheduledPostLoaded();
 
+    void charactersLeftChanged();
+
+    void entitiesChanged();
+
 private:
     [[nodiscard]] QJsonDocument toJsonDocument() const;
 
+    /**
+     * @brief Stop reusing the uploaded attachments for the same files, since they're part of a post now.
+     */
+    void forgetUploadedMedia();
+
     QString m_id;
     QString m_status;
     QString m_idenpotencyKey;
     QString m_spoilerText;
+    qsizetype m_spoilerTextLength = 0; ///< In characters.
+    PostTextAnalyzer m_analyzer;
     QString m_inReplyTo;
     QString m_language;
     QDateTime m_scheduledAt;
@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "editor/posttextanalyzer.h"
+
+#include <QRegularExpression>
+#include <QTextBoundaryFinder>
+
+#include <algorithm>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+// Whatever starts first wins, so hashtags or mentions in a link aren't picked up on their own. The rules follow the ones Mastodon counts
+// characters with.
+const QRegularExpression entityExp(uR"((?<url>https?://[\w-]+(?:\.[\w-]+)+(?:[\w.,@?^=%&:/~+#-]*[\w@?^=%&/~+#-])?))"
+                                   uR"(|(?<![=/\w])(?<mention>@\w+(?:[\w.-]*\w)?)(?<domain>@\w(?:[\w.-]*\w)?)?)"
+                                   uR"(|(?<![/)\w])(?<hashtag>#\w*[^\W\d_]\w*))"
+                                   uR"(|(?<![\w:])(?<emoji>:\w{2,}:)(?![\w:]))"_s,
+                                   QRegularExpression::UseUnicodePropertiesOption);
+
+// Whether the characters before and after @p position are in different graphemes, no matter what else is in the text. Whitespace ends
+// every longer sequence like flags or emojis joined together, so only the character right before it has to be looked at.
+bool isFixedBoundary(const QStringView text, const qsizetype position)
+{
+    if (position == 0 || position == text.size()) {
+        return true;
+    }
+    if (!text[position].isSpace()) {
+        return false;
+    }
+    QTextBoundaryFinder finder(QTextBoundaryFinder::Grapheme, text.sliced(position - 1, 2));
+    finder.setPosition(1);
+    return finder.isAtBoundary();
+}
+}
+
+bool PostTextAnalyzer::setText(const QString &text)
+{
+    const QStringView oldText(m_text);
+    const QStringView newText(text);
+
+    const qsizetype shorter = std::min(oldText.size(), newText.size());
+    const qsizetype prefix = std::mismatch(oldText.begin(), oldText.begin() + shorter, newText.begin()).first - oldText.begin();
+    if (prefix == oldText.size() && prefix == newText.size()) {
+        return false;
+    }
+    const qsizetype suffix = std::mismatch(oldText.rbegin(), oldText.rbegin() + (shorter - prefix), newText.rbegin()).first - oldText.rbegin();
+
+    const qsizetype oldEnd = oldText.size() - suffix;
+    const qsizetype newEnd = newText.size() - suffix;
+    const qsizetype delta = newText.size() - oldText.size();
+
+    // None of the entities can contain whitespace, so only the words touched by the edit have to be looked at again
+    qsizetype start = prefix;
+    while (start > 0 && !newText[start - 1].isSpace()) {
+        start--;
+    }
+    qsizetype end = newEnd;
+    while (end < newText.size() && !newText[end].isSpace()) {
+        end++;
+    }
+
+    // An edit can change the graphemes next to it, like a skin tone added to an emoji, so they're counted again from the whitespace around
+    // it. That whitespace has to split the text the same way before and after the edit.
+    qsizetype countStart = start;
+    while (!isFixedBoundary(oldText, countStart) || !isFixedBoundary(newText, countStart)) {
+        countStart--;
+    }
+    qsizetype countEnd = end;
+    while (!isFixedBoundary(oldText, countEnd - delta) || !isFixedBoundary(newText, countEnd)) {
+        countEnd++;
+    }
+    m_length += characterCount(newText.sliced(countStart, countEnd - countStart))
+        - characterCount(oldText.sliced(countStart, countEnd - delta - countStart));
+
+    const auto first = std::lower_bound(m_entities.begin(), m_entities.end(), start, [](const Entity &entity, const qsizetype position) {
+        return entity.start < position;
+    });
+    auto last = first;
+    while (last != m_entities.end() && last->start < end - delta) {
+        m_uncounted -= last->uncounted;
+        if (last->type == Url) {
+            m_urlCount--;
+        }
+        ++last;
+    }
+
+    const bool removed = first != last;
+    const qsizetype index = first - m_entities.begin();
+    m_entities.erase(first, last);
+
+    const bool moved = delta != 0 && index < m_entities.size();
+    for (qsizetype i = index; i < m_entities.size(); i++) {
+        m_entities[i].start += delta;
+    }
+
+    const QList<Entity> found = scan(newText.sliced(start, end - start), start);
+    for (qsizetype i = 0; i < found.size(); i++) {
+        m_uncounted += found[i].uncounted;
+        if (found[i].type == Url) {
+            m_urlCount++;
+        }
+        m_entities.insert(index + i, found[i]);
+    }
+
+    m_text = text;
+    return removed || moved || !found.isEmpty();
+}
+
+QString PostTextAnalyzer::text() const
+{
+    return m_text;
+}
+
+const QList<PostTextAnalyzer::Entity> &PostTextAnalyzer::entities() const
+{
+    return m_entities;
+}
+
+qsizetype PostTextAnalyzer::countedLength(const qsizetype charactersPerUrl) const
+{
+    return m_length - m_uncounted + m_urlCount * charactersPerUrl;
+}
+
+qsizetype PostTextAnalyzer::characterCount(const QStringView text)
+{
+    QTextBoundaryFinder finder(QTextBoundaryFinder::Grapheme, text);
+    qsizetype count = 0;
+    while (finder.toNextBoundary() != -1) {
+        count++;
+    }
+    return count;
+}
+
+QList<PostTextAnalyzer::Entity> PostTextAnalyzer::scan(const QStringView region, const qsizetype offset)
+{
+    // The region is surrounded by whitespace or the ends of the text, which looks the same to the lookarounds as its own ends
+    QList<Entity> found;
+    auto it = entityExp.globalMatchView(region);
+    while (it.hasNext()) {
+        const auto match = it.next();
+
+        Entity entity{Mention, offset + match.capturedStart(), match.capturedLength(), 0};
+        if (match.hasCaptured("url"_L1)) {
+            entity.type = Url;
+            entity.uncounted = characterCount(match.capturedView());
+        } else if (match.hasCaptured("hashtag"_L1)) {
+            entity.type = Hashtag;
+        } else if (match.hasCaptured("emoji"_L1)) {
+            entity.type = CustomEmoji;
+        } else if (match.hasCaptured("domain"_L1)) {
+            // Only the username of a mention counts, wherever the account is
+            entity.uncounted = characterCount(match.capturedView("domain"_L1));
+        }
+        found.push_back(entity);
+    }
+    return found;
+}
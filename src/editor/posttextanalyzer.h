@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QList>
+#include <QString>
+
+/**
+ * @brief Keeps track of the links, mentions, hashtags and custom emojis in the text of a post while it's being written.
+ *
+ * The composer hands over the whole text on every keystroke. Only the words around what changed are looked at again, so typing doesn't
+ * get slower the longer the post gets.
+ */
+class PostTextAnalyzer
+{
+public:
+    enum EntityType {
+        Url,
+        Mention,
+        Hashtag,
+        CustomEmoji,
+    };
+
+    struct Entity {
+        EntityType type;
+        qsizetype start; ///< In UTF-16 code units, like QString and the QML text fields.
+        qsizetype length;
+        qsizetype uncounted; ///< How many of its characters the server doesn't count, like the domain of a mention.
+    };
+
+    /**
+     * @brief Updates the entities for the new @p text.
+     * @return Whether any entity was added, removed or moved.
+     */
+    bool setText(const QString &text);
+
+    [[nodiscard]] QString text() const;
+
+    /**
+     * @return All entities in the text, in order.
+     */
+    [[nodiscard]] const QList<Entity> &entities() const;
+
+    /**
+     * @return The length of the text as the server counts it, where every link takes up @p charactersPerUrl.
+     */
+    [[nodiscard]] qsizetype countedLength(qsizetype charactersPerUrl) const;
+
+    /**
+     * @return The number of characters in @p text as the server counts them: graphemes, so an emoji with a skin tone or a letter with an
+     * accent made of two code points counts once.
+     */
+    [[nodiscard]] static qsizetype characterCount(QStringView text);
+
+private:
+    static QList<Entity> scan(QStringView region, qsizetype offset);
+
+    QString m_text;
+    QList<Entity> m_entities;
+    qsizetype m_length = 0; ///< In graphemes.
+    qsizetype m_uncounted = 0; ///< The sum of Entity::uncounted.
+    qsizetype m_urlCount = 0;
+};
@@ -43,6 +43,9 @@
 #include "tokodon_debug.h"
 #include "utils/blurhashimageprovider.h"
 #include "utils/colorschemer.h"
+#include "utils/imagecache.h"
+#include "utils/remoteimageprovider.h"
+#include "utils/startuptrace.h"
 
 #ifdef Q_OS_WINDOWS
 #include <Windows.h>
@@ -78,6 +81,8 @@ Q_DECL_EXPORT
 #endif
 int main(int argc, char *argv[])
 {
+    StartupTrace::instance().mark(QStringLiteral("app"), QStringLiteral("main"));
+
     KIconTheme::initTheme();
     QNetworkProxyFactory::setUseSystemConfiguration(true);
 
@@ -184,7 +189,7 @@ int main(int argc, char *argv[])
         // create the lazy instance
         AccountManager::instance().loadFromSettings();
 
-        QObject::connect(&AccountManager::instance(), &AccountManager::accountsReady, [] {
+        QObject::connect(&AccountManager::instance(), &AccountManager::allAccountsLoaded, [] {
             qInfo(TOKODON_LOG) << "Accounts have finished loading. Checking notification queue...";
             // queue notification
             AccountManager::instance().queueNotifications();
@@ -242,6 +247,10 @@ int main(int argc, char *argv[])
 
     engine.addImageProvider(QLatin1String("blurhash"), new BlurHashImageProvider);
 
+    // Created here so it lives in the main thread, images are requested from a loader thread
+    ImageCache::instance();
+    engine.addImageProvider(QLatin1String("remote"), new RemoteImageProvider);
+
 #ifdef TEST_MODE
     AccountManager::instance().setTestMode(true);
 
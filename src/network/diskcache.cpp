@@ -0,0 +1,444 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "network/diskcache.h"
+
+#include "config.h"
+#include "tokodon_http_debug.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QNetworkDiskCache>
+#include <QPointer>
+#include <QStandardPaths>
+
+#include <algorithm>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+constexpr qint64 mebibyte = 1024 * 1024;
+
+// Once a partition is full, entries are removed until it's down to this share of its quota, so it isn't full again right away
+constexpr qint64 evictionGoalPercent = 80;
+
+QString directoryName(const DiskCache::Partition partition)
+{
+    switch (partition) {
+    case DiskCache::Api:
+        return u"api"_s;
+    case DiskCache::Avatars:
+        return u"avatars"_s;
+    case DiskCache::Previews:
+        return u"previews"_s;
+    case DiskCache::Media:
+        return u"media"_s;
+    }
+    Q_UNREACHABLE();
+}
+
+qint64 configuredQuota(const DiskCache::Partition partition)
+{
+    switch (partition) {
+    case DiskCache::Api:
+        return Config::apiCacheSize() * mebibyte;
+    case DiskCache::Avatars:
+        return Config::avatarCacheSize() * mebibyte;
+    case DiskCache::Previews:
+        return Config::previewCacheSize() * mebibyte;
+    case DiskCache::Media:
+        return Config::mediaCacheSize() * mebibyte;
+    }
+    Q_UNREACHABLE();
+}
+}
+
+/**
+ * A QNetworkDiskCache which remembers how often its entries are read, and removes the ones worth the least when it's full.
+ */
+class DiskCachePartition : public QNetworkDiskCache
+{
+public:
+    DiskCachePartition(const QString &directory, const qint64 quota, QObject *parent)
+        : QNetworkDiskCache(parent)
+    {
+        setCacheDirectory(directory);
+        setMaximumCacheSize(quota);
+    }
+
+    QIODevice *data(const QUrl &url) override
+    {
+        const auto device = QNetworkDiskCache::data(url);
+        if (device) {
+            m_hits++;
+            m_reads[url]++;
+        } else {
+            m_misses++;
+        }
+        return device;
+    }
+
+    void insert(QIODevice *device) override
+    {
+        // The base class asks expire() for the new size right after storing it
+        if (m_size >= 0) {
+            m_size += device->size();
+        }
+        QNetworkDiskCache::insert(device);
+    }
+
+    bool remove(const QUrl &url) override
+    {
+        m_reads.remove(url);
+        const bool removed = QNetworkDiskCache::remove(url);
+        if (removed && m_size >= 0) {
+            m_size = QNetworkDiskCache::cacheSize();
+        }
+        return removed;
+    }
+
+    void clear() override
+    {
+        m_reads.clear();
+        QNetworkDiskCache::clear();
+    }
+
+    [[nodiscard]] int hits() const
+    {
+        return m_hits;
+    }
+
+    [[nodiscard]] int misses() const
+    {
+        return m_misses;
+    }
+
+protected:
+    qint64 expire() override
+    {
+        if (m_size >= 0 && m_size < maximumCacheSize()) {
+            return m_size;
+        }
+        return shrink(maximumCacheSize(), maximumCacheSize() * evictionGoalPercent / 100);
+    }
+
+private:
+    struct Entry {
+        QString path;
+        qint64 size = 0;
+        QDateTime created;
+        QUrl url;
+        int reads = 0;
+    };
+
+    // Counts what's on disk, and if that's at least limit, removes entries until it's down to goal
+    qint64 shrink(const qint64 limit, const qint64 goal)
+    {
+        QList<Entry> entries;
+        qint64 total = 0;
+
+        QDirIterator it(cacheDirectory(), {u"*.d"_s}, QDir::Files, QDirIterator::Subdirectories);
+        while (it.hasNext()) {
+            const QFileInfo info = it.nextFileInfo();
+            // Still being written
+            if (info.dir().dirName() == "prepared"_L1) {
+                continue;
+            }
+
+            const QDateTime created = info.fileTime(QFileDevice::FileBirthTime);
+            entries.push_back(Entry{
+                .path = info.filePath(),
+                .size = info.size(),
+                .created = created.isValid() ? created : info.fileTime(QFileDevice::FileMetadataChangeTime),
+            });
+            total += info.size();
+        }
+
+        m_size = total;
+        if (total < limit) {
+            return total;
+        }
+
+        // Only what was read this session has any reads, and finding out which file that is means reading its header
+        if (!m_reads.isEmpty()) {
+            for (auto &entry : entries) {
+                entry.url = fileMetaData(entry.path).url();
+                entry.reads = m_reads.value(entry.url);
+            }
+        }
+
+        // Worth the least are the entries which take up the most space per read, and the oldest of those
+        std::ranges::sort(entries, [](const Entry &a, const Entry &b) {
+            const qint64 aValue = (1 + a.reads) * b.size;
+            const qint64 bValue = (1 + b.reads) * a.size;
+            if (aValue != bValue) {
+                return aValue < bValue;
+            }
+            return a.created < b.created;
+        });
+
+        int removed = 0;
+        for (const auto &entry : std::as_const(entries)) {
+            if (total <= goal) {
+                break;
+            }
+            if (QFile::remove(entry.path)) {
+                total -= entry.size;
+                m_reads.remove(entry.url);
+                removed++;
+            }
+        }
+        qCDebug(TOKODON_HTTP) << "Removed" << removed << "entries from" << cacheDirectory() << "down to" << total << "bytes";
+
+        m_size = total;
+        return total;
+    }
+
+    qint64 m_size = -1; ///< On disk, or -1 before it was counted.
+    QHash<QUrl, int> m_reads;
+    int m_hits = 0;
+    int m_misses = 0;
+};
+
+/**
+ * The view of DiskCache a QNetworkAccessManager gets, which may live in another thread.
+ */
+class PartitionedCache : public QAbstractNetworkCache
+{
+public:
+    explicit PartitionedCache(DiskCache *cache)
+        : m_cache(cache)
+    {
+    }
+
+    QNetworkCacheMetaData metaData(const QUrl &url) override
+    {
+        if (!m_cache) {
+            return {};
+        }
+        QMutexLocker locker(&m_cache->m_mutex);
+        return m_cache->partition(url)->metaData(url);
+    }
+
+    void updateMetaData(const QNetworkCacheMetaData &metaData) override
+    {
+        if (!m_cache) {
+            return;
+        }
+        QMutexLocker locker(&m_cache->m_mutex);
+        m_cache->partition(metaData.url())->updateMetaData(metaData);
+    }
+
+    QIODevice *data(const QUrl &url) override
+    {
+        if (!m_cache) {
+            return nullptr;
+        }
+        QMutexLocker locker(&m_cache->m_mutex);
+        return m_cache->partition(url)->data(url);
+    }
+
+    bool remove(const QUrl &url) override
+    {
+        if (!m_cache) {
+            return false;
+        }
+        // Also drops what was being prepared for it, like when its download was aborted
+        m_preparing.removeIf([&url](const auto &it) {
+            return it.value().url == url;
+        });
+
+        QMutexLocker locker(&m_cache->m_mutex);
+        return m_cache->partition(url)->remove(url);
+    }
+
+    qint64 cacheSize() const override
+    {
+        if (!m_cache) {
+            return 0;
+        }
+
+        qint64 size = 0;
+        for (int i = 0; i < DiskCache::partitionCount; i++) {
+            size += m_cache->usage(static_cast<DiskCache::Partition>(i));
+        }
+        return size;
+    }
+
+    QIODevice *prepare(const QNetworkCacheMetaData &metaData) override
+    {
+        if (!m_cache) {
+            return nullptr;
+        }
+        QMutexLocker locker(&m_cache->m_mutex);
+        const auto partition = m_cache->partition(metaData.url());
+        const auto device = partition->prepare(metaData);
+        if (device) {
+            m_preparing.insert(device, {.partition = partition, .url = metaData.url()});
+            // The partition deletes it without telling us when it gives up on it
+            connect(device, &QObject::destroyed, this, [this, device] {
+                m_preparing.remove(device);
+            });
+        }
+        return device;
+    }
+
+    void insert(QIODevice *device) override
+    {
+        const auto partition = m_preparing.take(device).partition;
+        if (!m_cache || !partition) {
+            return;
+        }
+        QMutexLocker locker(&m_cache->m_mutex);
+        partition->insert(device);
+    }
+
+    void clear() override
+    {
+        if (m_cache) {
+            m_cache->clear();
+        }
+    }
+
+private:
+    struct Preparing {
+        DiskCachePartition *partition = nullptr;
+        QUrl url;
+    };
+
+    QPointer<DiskCache> m_cache;
+    QHash<QIODevice *, Preparing> m_preparing; ///< Which partition a device from prepare() goes back to.
+};
+
+DiskCache &DiskCache::instance()
+{
+    static DiskCache _instance([] {
+        const QDir directory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation));
+
+        // Everything used to share a single cache, which nothing reads anymore
+        for (const auto &name : {u"nam"_s, u"validators"_s}) {
+            if (directory.exists(name)) {
+                QDir(directory.filePath(name)).removeRecursively();
+            }
+        }
+
+        return directory.filePath(u"http"_s);
+    }());
+    return _instance;
+}
+
+DiskCache::DiskCache(const QString &directory, QObject *parent)
+    : QObject(parent)
+{
+    for (int i = 0; i < partitionCount; i++) {
+        const auto partition = static_cast<Partition>(i);
+        m_partitions[i] = new DiskCachePartition(QDir(directory).filePath(directoryName(partition)), configuredQuota(partition), this);
+    }
+}
+
+DiskCache::~DiskCache() = default;
+
+DiskCache::Partition DiskCache::partitionFor(const QUrl &url)
+{
+    const QString path = url.path();
+
+    if (path.startsWith("/api/"_L1) || path.startsWith("/nodeinfo/"_L1) || path.startsWith("/.well-known/"_L1)) {
+        return Api;
+    }
+    // Static avatars are under the avatars too, so this goes before the previews
+    if (path.contains("/avatars/"_L1) || path.contains("/custom_emojis/"_L1) || path.contains("/emoji"_L1)) {
+        return Avatars;
+    }
+    // Mastodon keeps attachment previews under small/, Pleroma and Akkoma under preview/
+    if (path.contains("/small/"_L1) || path.contains("/preview"_L1) || path.contains("/headers/"_L1)) {
+        return Previews;
+    }
+    return Media;
+}
+
+QAbstractNetworkCache *DiskCache::createCache()
+{
+    return new PartitionedCache(this);
+}
+
+qint64 DiskCache::quota(const Partition partition) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_partitions[partition]->maximumCacheSize();
+}
+
+void DiskCache::setQuota(const Partition partition, const qint64 bytes)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_partitions[partition]->setMaximumCacheSize(bytes);
+    }
+    Q_EMIT statisticsChanged();
+}
+
+qint64 DiskCache::usage(const Partition partition) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_partitions[partition]->cacheSize();
+}
+
+QVariantList DiskCache::statistics() const
+{
+    QMutexLocker locker(&m_mutex);
+
+    QVariantList statistics;
+    for (int i = 0; i < partitionCount; i++) {
+        const auto partition = m_partitions[i];
+        statistics.push_back(QVariantMap{
+            {u"partition"_s, i},
+            {u"usage"_s, partition->cacheSize()},
+            {u"quota"_s, partition->maximumCacheSize()},
+            {u"hits"_s, partition->hits()},
+            {u"misses"_s, partition->misses()},
+        });
+    }
+    return statistics;
+}
+
+void DiskCache::trim()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        for (const auto partition : m_partitions) {
+            // Lowering the quota is what makes it expire, and raising it again doesn't
+            const qint64 quota = partition->maximumCacheSize();
+            partition->setMaximumCacheSize(quota / 2);
+            partition->setMaximumCacheSize(quota);
+        }
+    }
+    Q_EMIT statisticsChanged();
+}
+
+void DiskCache::clear()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        for (const auto partition : m_partitions) {
+            partition->clear();
+        }
+    }
+    Q_EMIT statisticsChanged();
+}
+
+void DiskCache::clear(const Partition partition)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_partitions[partition]->clear();
+    }
+    Q_EMIT statisticsChanged();
+}
+
+DiskCachePartition *DiskCache::partition(const QUrl &url) const
+{
+    return m_partitions[partitionFor(url)];
+}
+
+#include "moc_diskcache.cpp"
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QMutex>
+#include <QObject>
+#include <QQmlEngine>
+
+#include <array>
+
+class DiskCachePartition;
+class QAbstractNetworkCache;
+class QIODevice;
+class QNetworkCacheMetaData;
+
+/**
+ * @brief The HTTP disk cache, split up into partitions for different kinds of content.
+ *
+ * Every partition has its own quota, so large media can't push out the avatars and emoji which are shown all the time. Once a partition is
+ * full, the entries worth the least are removed first: large ones that weren't reused go before small or often reused ones.
+ *
+ * Every QNetworkAccessManager gets its own view of it through createCache(), which puts each url in its partition. These can be used from any
+ * thread.
+ */
+class DiskCache : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+
+public:
+    enum Partition {
+        Api, /**< Responses of the API, and other metadata like nodeinfo. */
+        Avatars, /**< Avatars and custom emoji. */
+        Previews, /**< Previews of attachments and links, and profile headers. */
+        Media, /**< Attachments at their full size, and everything else. */
+    };
+    Q_ENUM(Partition)
+
+    static constexpr int partitionCount = Media + 1;
+
+    static DiskCache *create(QQmlEngine *, QJSEngine *)
+    {
+        auto inst = &instance();
+        QJSEngine::setObjectOwnership(inst, QJSEngine::ObjectOwnership::CppOwnership);
+        return inst;
+    }
+
+    static DiskCache &instance();
+
+    /**
+     * @brief Keeps the partitions in subdirectories of @p directory, with the quotas from the configuration.
+     */
+    explicit DiskCache(const QString &directory, QObject *parent = nullptr);
+    ~DiskCache() override;
+
+    /**
+     * @return The partition @p url is cached in.
+     */
+    [[nodiscard]] static Partition partitionFor(const QUrl &url);
+
+    /**
+     * @return A cache to give to QNetworkAccessManager::setCache(), which takes ownership of it.
+     */
+    [[nodiscard]] QAbstractNetworkCache *createCache();
+
+    /**
+     * @return How many bytes @p partition may take up on disk.
+     */
+    [[nodiscard]] qint64 quota(Partition partition) const;
+
+    /**
+     * @brief Let @p partition take up to @p bytes on disk, and remove entries right away if it's over that.
+     */
+    Q_INVOKABLE void setQuota(Partition partition, qint64 bytes);
+
+    /**
+     * @return How many bytes @p partition takes up on disk.
+     */
+    [[nodiscard]] qint64 usage(Partition partition) const;
+
+    /**
+     * @return For each partition its usage and quota in bytes, and how often something was found in it or not.
+     */
+    Q_INVOKABLE QVariantList statistics() const;
+
+    /**
+     * @brief Removes the entries worth the least from every partition, until each is well below half of its quota.
+     */
+    Q_INVOKABLE void trim();
+
+    /**
+     * @brief Removes everything from every partition.
+     */
+    Q_INVOKABLE void clear();
+
+    /**
+     * @brief Removes everything from @p partition.
+     */
+    void clear(Partition partition);
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when the usage or quotas changed because of trim(), clear() or setQuota().
+     */
+    void statisticsChanged();
+
+private:
+    friend class PartitionedCache;
+
+    [[nodiscard]] DiskCachePartition *partition(const QUrl &url) const;
+
+    mutable QMutex m_mutex;
+    std::array<DiskCachePartition *, partitionCount> m_partitions;
+};
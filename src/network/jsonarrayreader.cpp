@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "network/jsonarrayreader.h"
+
+#include <QJsonDocument>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+bool isWhitespace(const char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+}
+
+QJsonArray JsonArrayReader::feed(const QByteArrayView chunk)
+{
+    QJsonArray elements;
+
+    // Where the element being read starts in this chunk, if it's still being read
+    qsizetype elementStart = m_state == State::InElement ? 0 : -1;
+
+    for (qsizetype i = 0; i < chunk.size() && m_state != State::Error; i++) {
+        const char c = chunk[i];
+
+        switch (m_state) {
+        case State::BeforeArray:
+            if (c == '[') {
+                m_state = State::BeforeElement;
+            } else if (!isWhitespace(c)) {
+                setError(u"Expected an array"_s);
+            }
+            break;
+        case State::BeforeElement:
+            if (isWhitespace(c)) {
+                break;
+            }
+            if (c == ']' && m_elementCount == 0) {
+                m_state = State::AfterArray;
+            } else if (c == ']' || c == ',') {
+                setError(u"Expected an element"_s);
+            } else {
+                elementStart = i;
+                m_elementIsContainer = c == '{' || c == '[';
+                m_depth = m_elementIsContainer ? 1 : 0;
+                m_inString = c == '"';
+                m_escaped = false;
+                m_state = State::InElement;
+            }
+            break;
+        case State::InElement:
+            if (m_inString) {
+                if (m_escaped) {
+                    m_escaped = false;
+                } else if (c == '\\') {
+                    m_escaped = true;
+                } else if (c == '"') {
+                    m_inString = false;
+                    if (!m_elementIsContainer) {
+                        m_element.append(chunk.sliced(elementStart, i + 1 - elementStart));
+                        elementStart = -1;
+                        finishElement(elements);
+                    }
+                }
+            } else if (m_elementIsContainer) {
+                if (c == '"') {
+                    m_inString = true;
+                } else if (c == '{' || c == '[') {
+                    m_depth++;
+                } else if ((c == '}' || c == ']') && --m_depth == 0) {
+                    m_element.append(chunk.sliced(elementStart, i + 1 - elementStart));
+                    elementStart = -1;
+                    finishElement(elements);
+                }
+            } else if (isWhitespace(c) || c == ',' || c == ']') {
+                // Numbers, booleans and null only end with whatever comes after them
+                m_element.append(chunk.sliced(elementStart, i - elementStart));
+                elementStart = -1;
+                if (finishElement(elements)) {
+                    // Read the terminator again as what comes after the element
+                    i--;
+                }
+            }
+            break;
+        case State::AfterElement:
+            if (c == ',') {
+                m_state = State::BeforeElement;
+            } else if (c == ']') {
+                m_state = State::AfterArray;
+            } else if (!isWhitespace(c)) {
+                setError(u"Expected a comma or the end of the array"_s);
+            }
+            break;
+        case State::AfterArray:
+            if (!isWhitespace(c)) {
+                setError(u"Unexpected data after the array"_s);
+            }
+            break;
+        case State::Error:
+            break;
+        }
+    }
+
+    if (elementStart >= 0 && m_state == State::InElement) {
+        m_element.append(chunk.sliced(elementStart));
+    }
+
+    return elements;
+}
+
+bool JsonArrayReader::finishElement(QJsonArray &elements)
+{
+    QJsonParseError error;
+    if (m_elementIsContainer) {
+        const auto doc = QJsonDocument::fromJson(m_element, &error);
+        if (error.error == QJsonParseError::NoError) {
+            elements.push_back(doc.isObject() ? QJsonValue(doc.object()) : QJsonValue(doc.array()));
+        }
+    } else {
+        // QJsonDocument can't parse a bare value
+        const auto doc = QJsonDocument::fromJson('[' + m_element + ']', &error);
+        if (error.error == QJsonParseError::NoError) {
+            elements.push_back(doc.array().first());
+        }
+    }
+    m_element.clear();
+
+    if (error.error != QJsonParseError::NoError) {
+        setError(error.errorString());
+        return false;
+    }
+
+    m_elementCount++;
+    m_state = State::AfterElement;
+    return true;
+}
+
+void JsonArrayReader::setError(const QString &message)
+{
+    m_state = State::Error;
+    m_errorString = message;
+    m_element.clear();
+}
+
+bool JsonArrayReader::atEnd() const
+{
+    return m_state == State::AfterArray;
+}
+
+bool JsonArrayReader::hasError() const
+{
+    return m_state == State::Error;
+}
+
+QString JsonArrayReader::errorString() const
+{
+    return m_errorString;
+}
+
+qsizetype JsonArrayReader::elementCount() const
+{
+    return m_elementCount;
+}
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QByteArray>
+#include <QJsonArray>
+
+/**
+ * @brief Parses a JSON array incrementally, as its bytes arrive.
+ *
+ * Every element of the top-level array is handed out as soon as its last byte was fed, so a large response can be used before it is fully
+ * downloaded. Only the bytes of the element being read are kept around.
+ *
+ * @code
+ * JsonArrayReader reader;
+ * connect(reply, &QNetworkReply::readyRead, this, [&reader, reply] {
+ *     for (const auto &element : reader.feed(reply->readAll())) {
+ *         ...
+ *     }
+ * });
+ * @endcode
+ */
+class JsonArrayReader
+{
+public:
+    /**
+     * @brief Reads the next chunk of the document.
+     * @return The elements completed by @p chunk, which may be none.
+     */
+    QJsonArray feed(QByteArrayView chunk);
+
+    /**
+     * @return Whether the closing bracket of the array was read.
+     */
+    [[nodiscard]] bool atEnd() const;
+
+    /**
+     * @return Whether the document turned out not to be a valid JSON array. Nothing more is read after an error.
+     */
+    [[nodiscard]] bool hasError() const;
+
+    /**
+     * @return A description of the error, if hasError().
+     */
+    [[nodiscard]] QString errorString() const;
+
+    /**
+     * @return How many elements were read so far.
+     */
+    [[nodiscard]] qsizetype elementCount() const;
+
+private:
+    enum class State {
+        BeforeArray, ///< Nothing but whitespace so far.
+        BeforeElement, ///< After the opening bracket or a comma.
+        InElement, ///< Somewhere inside an element.
+        AfterElement, ///< Waiting for a comma or the closing bracket.
+        AfterArray,
+        Error,
+    };
+
+    bool finishElement(QJsonArray &elements);
+    void setError(const QString &message);
+
+    State m_state = State::BeforeArray;
+    QByteArray m_element;
+    int m_depth = 0;
+    bool m_inString = false;
+    bool m_escaped = false;
+    bool m_elementIsContainer = false;
+    qsizetype m_elementCount = 0;
+    QString m_errorString;
+};
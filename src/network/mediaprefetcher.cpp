@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "network/mediaprefetcher.h"
+
+#include "network/networkaccessmanagerfactory.h"
+#include "utils/imagecache.h"
+
+#include <QNetworkAccessManager>
+#include <QNetworkInformation>
+#include <QNetworkReply>
+
+namespace
+{
+// Forget what was prefetched after this many, so the set doesn't grow forever
+constexpr qsizetype maxRemembered = 1024;
+}
+
+MediaPrefetcher::MediaPrefetcher(QObject *parent)
+    : QObject(parent)
+{
+    if (QNetworkInformation::loadBackendByFeatures(QNetworkInformation::Feature::Metered)) {
+        // Another network has its own budget, and may be metered
+        connect(QNetworkInformation::instance(), &QNetworkInformation::transportMediumChanged, this, &MediaPrefetcher::resetBudget);
+        connect(QNetworkInformation::instance(), &QNetworkInformation::isMeteredChanged, this, [this](const bool metered) {
+            if (metered && !m_ignoreMetered) {
+                cancel();
+            }
+        });
+    }
+}
+
+void MediaPrefetcher::prefetch(const QList<Item> &items, const QObject *requester)
+{
+    m_queue.clear();
+    m_requester = requester;
+
+    if (isMetered()) {
+        cancel();
+        return;
+    }
+
+    QSet<QUrl> wanted;
+    for (const auto &item : items) {
+        if (item.url.isEmpty() || m_fetched.contains(item.url) || wanted.contains(item.url)) {
+            continue;
+        }
+        wanted.insert(item.url);
+
+        if (!m_inFlight.contains(item.url)) {
+            m_queue.push_back(item);
+        }
+    }
+
+    // Whatever is still downloading but isn't ahead anymore
+    for (const auto reply : m_inFlight.values()) {
+        if (!wanted.contains(reply->request().url())) {
+            m_cancelled++;
+            reply->abort();
+        }
+    }
+
+    startNext();
+}
+
+void MediaPrefetcher::cancel(const QObject *requester)
+{
+    if (requester && requester != m_requester) {
+        return;
+    }
+
+    m_queue.clear();
+
+    for (const auto reply : m_inFlight.values()) {
+        m_cancelled++;
+        reply->abort();
+    }
+}
+
+void MediaPrefetcher::setByteBudget(const qint64 bytes)
+{
+    m_byteBudget = bytes;
+}
+
+void MediaPrefetcher::setBudgetWindow(const std::chrono::milliseconds window)
+{
+    m_budgetWindow = window;
+}
+
+void MediaPrefetcher::setMaxConcurrent(const int count)
+{
+    m_maxConcurrent = std::max(count, 1);
+}
+
+void MediaPrefetcher::setIgnoreMetered(const bool ignore)
+{
+    m_ignoreMetered = ignore;
+}
+
+bool MediaPrefetcher::isMetered() const
+{
+    const auto information = QNetworkInformation::instance();
+    return !m_ignoreMetered && information && information->supports(QNetworkInformation::Feature::Metered) && information->isMetered();
+}
+
+qint64 MediaPrefetcher::fetchedBytes() const
+{
+    return m_fetchedBytes;
+}
+
+int MediaPrefetcher::cancelledCount() const
+{
+    return m_cancelled;
+}
+
+void MediaPrefetcher::startNext()
+{
+    while (m_inFlight.size() < m_maxConcurrent && !m_queue.isEmpty() && budgetLeft()) {
+        const Item item = m_queue.takeFirst();
+
+        if (!m_nam) {
+            m_nam = NetworkAccessManagerFactory().create(this);
+        }
+
+        QNetworkRequest request(item.url);
+        request.setPriority(QNetworkRequest::LowPriority);
+        request.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::PreferCache);
+
+        const auto reply = m_nam->get(request);
+        m_inFlight.insert(item.url, reply);
+
+        // Stop as soon as it's clear this one doesn't fit anymore, next to the others still downloading
+        connect(reply, &QNetworkReply::downloadProgress, this, [this, reply](const qint64 received, const qint64 total) {
+            if (reply->attribute(QNetworkRequest::SourceIsFromCacheAttribute).toBool()) {
+                return;
+            }
+
+            qint64 &reserved = m_reserved[reply];
+            const qint64 expected = std::max(received, total);
+            if (expected <= reserved) {
+                return;
+            }
+
+            if (m_budgetUsed + m_budgetReserved - reserved + expected > m_byteBudget) {
+                // Whatever comes after would probably not fit either
+                m_budgetUsed = m_byteBudget;
+                m_cancelled++;
+                reply->abort();
+                return;
+            }
+            m_budgetReserved += expected - reserved;
+            reserved = expected;
+        });
+        connect(reply, &QNetworkReply::finished, this, [this, reply, item] {
+            finished(reply);
+            if (item.decode && reply->error() == QNetworkReply::NoError) {
+                // Now on disk, so this only decodes
+                ImageCache::instance().request(item.url, item.size, this, [](const QImage &) { });
+            }
+        });
+    }
+
+    if (m_inFlight.isEmpty() && (m_queue.isEmpty() || !budgetLeft())) {
+        m_queue.clear();
+        Q_EMIT idle();
+    }
+}
+
+void MediaPrefetcher::finished(QNetworkReply *reply)
+{
+    reply->deleteLater();
+    m_inFlight.remove(reply->request().url());
+    m_budgetReserved -= m_reserved.take(reply);
+
+    if (reply->error() == QNetworkReply::NoError) {
+        // Reading it is what stores it in the disk cache
+        const qint64 size = reply->readAll().size();
+        if (!reply->attribute(QNetworkRequest::SourceIsFromCacheAttribute).toBool()) {
+            m_budgetUsed += size;
+            m_fetchedBytes += size;
+        }
+
+        if (m_fetched.size() >= maxRemembered) {
+            m_fetched.clear();
+        }
+        m_fetched.insert(reply->request().url());
+    }
+
+    startNext();
+}
+
+bool MediaPrefetcher::budgetLeft()
+{
+    if (!m_budgetTimer.isValid() || m_budgetTimer.durationElapsed() >= m_budgetWindow) {
+        resetBudget();
+    }
+    return m_budgetUsed + m_budgetReserved < m_byteBudget;
+}
+
+void MediaPrefetcher::resetBudget()
+{
+    m_budgetUsed = 0;
+    m_budgetTimer.start();
+}
+
+#include "moc_mediaprefetcher.cpp"
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+#include <QSize>
+#include <QUrl>
+
+#include <chrono>
+
+class QNetworkAccessManager;
+class QNetworkReply;
+
+/**
+ * @brief Downloads images a timeline is about to show, so they are there by the time it's scrolled to.
+ *
+ * Images are fetched into the HTTP disk cache with a low priority, a few at a time, and some are decoded into ImageCache as well. Every call to
+ * prefetch() replaces what's still waiting, and aborts downloads which aren't wanted anymore, so changing direction or timeline doesn't waste
+ * bandwidth on what's behind. There's one for each account, shared by all of its timelines.
+ *
+ * No more than a budget of bytes is downloaded in a given time, which starts over when the network changes. Nothing is prefetched on metered
+ * networks.
+ */
+class MediaPrefetcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Item {
+        QUrl url;
+        bool decode = false; ///< Also decode it into ImageCache.
+        QSize size; ///< What to decode it at, the same size it's shown at, or invalid for its original size.
+
+        bool operator==(const Item &other) const = default;
+    };
+
+    explicit MediaPrefetcher(QObject *parent = nullptr);
+
+    /**
+     * @brief Fetches @p items, the most urgent first, instead of what was asked before.
+     * @param requester Who asked for them, see cancel().
+     */
+    void prefetch(const QList<Item> &items, const QObject *requester = nullptr);
+
+    /**
+     * @brief Stops everything, for example because another timeline is shown.
+     * @param requester Only stop if what's being prefetched was last asked for by it, or always if it's null.
+     */
+    void cancel(const QObject *requester = nullptr);
+
+    /**
+     * @brief Download no more than @p bytes in each budget window.
+     * @see setBudgetWindow()
+     */
+    void setByteBudget(qint64 bytes);
+
+    /**
+     * @brief Start counting towards the byte budget again after @p window.
+     */
+    void setBudgetWindow(std::chrono::milliseconds window);
+
+    /**
+     * @brief Don't download more than @p count images at once.
+     */
+    void setMaxConcurrent(int count);
+
+    /**
+     * @brief Prefetch even if the network is metered, for tests.
+     */
+    void setIgnoreMetered(bool ignore);
+
+    /**
+     * @return Whether the network is metered, and nothing should be prefetched.
+     */
+    [[nodiscard]] bool isMetered() const;
+
+    /**
+     * @return How many bytes were prefetched in total.
+     */
+    [[nodiscard]] qint64 fetchedBytes() const;
+
+    /**
+     * @return How many downloads were aborted because they weren't needed anymore, or didn't fit the budget.
+     */
+    [[nodiscard]] int cancelledCount() const;
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when there's nothing left to prefetch.
+     */
+    void idle();
+
+private:
+    void startNext();
+    void finished(QNetworkReply *reply);
+    [[nodiscard]] bool budgetLeft();
+    void resetBudget();
+
+    QNetworkAccessManager *m_nam = nullptr; ///< Only created once something is prefetched.
+
+    QList<Item> m_queue;
+    QHash<QUrl, QNetworkReply *> m_inFlight;
+    QSet<QUrl> m_fetched; ///< Recently prefetched, to not ask the disk cache again and again.
+    QPointer<const QObject> m_requester; ///< Only compared against, never used.
+
+    qint64 m_byteBudget = 8 * 1024 * 1024;
+    qint64 m_budgetUsed = 0;
+    QHash<QNetworkReply *, qint64> m_reserved; ///< What each download is expected to take of the budget, so together they don't exceed it.
+    qint64 m_budgetReserved = 0;
+    std::chrono::milliseconds m_budgetWindow = std::chrono::minutes(1);
+    QElapsedTimer m_budgetTimer; ///< Since the budget was last reset.
+    int m_maxConcurrent = 4;
+    bool m_ignoreMetered = false;
+
+    qint64 m_fetchedBytes = 0;
+    int m_cancelled = 0;
+};
@@ -3,8 +3,9 @@
 
 #include "network/networkaccessmanagerfactory.h"
 
+#include "network/diskcache.h"
+
 #include <QNetworkAccessManager>
-#include <QNetworkDiskCache>
 #include <QStandardPaths>
 #include <QThread>
 
@@ -17,9 +18,7 @@ QNetworkAccessManager *NetworkAccessManagerFactory::create(QObject *parent)
     nam->enableStrictTransportSecurityStore(true, QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QLatin1String("/hsts/"));
     nam->setStrictTransportSecurityEnabled(true);
 
-    auto namDiskCache = new QNetworkDiskCache(nam);
-    namDiskCache->setCacheDirectory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QLatin1String("/nam/"));
-    nam->setCache(namDiskCache);
+    nam->setCache(DiskCache::instance().createCache());
 
     return nam;
 }
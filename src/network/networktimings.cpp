@@ -0,0 +1,496 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "network/networktimings.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QNetworkReply>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <limits>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+// Upper bounds of the histogram buckets, in milliseconds. Anything slower ends up in an extra last bucket.
+constexpr std::array histogramBounds{50, 100, 250, 500, 1000, 2500};
+
+constexpr qsizetype slowestEndpointCount = 5;
+
+double toMsecs(const qint64 usecs)
+{
+    return static_cast<double>(usecs) / 1000.0;
+}
+
+QString methodName(const QNetworkReply *reply)
+{
+    switch (reply->operation()) {
+    case QNetworkAccessManager::HeadOperation:
+        return u"HEAD"_s;
+    case QNetworkAccessManager::GetOperation:
+        return u"GET"_s;
+    case QNetworkAccessManager::PutOperation:
+        return u"PUT"_s;
+    case QNetworkAccessManager::PostOperation:
+        return u"POST"_s;
+    case QNetworkAccessManager::DeleteOperation:
+        return u"DELETE"_s;
+    case QNetworkAccessManager::CustomOperation:
+        return QString::fromLatin1(reply->request().attribute(QNetworkRequest::CustomVerbAttribute).toByteArray());
+    default:
+        return u"UNKNOWN"_s;
+    }
+}
+
+bool isIdentifier(const QStringView segment)
+{
+    if (segment.isEmpty()) {
+        return false;
+    }
+
+    const bool allDigits = std::ranges::all_of(segment, [](const QChar c) {
+        return c.isDigit();
+    });
+    if (allDigits) {
+        return true;
+    }
+
+    // Pleroma and Akkoma use flake ids, which are long alphanumeric strings
+    const bool alphanumeric = std::ranges::all_of(segment, [](const QChar c) {
+        return c.isLetterOrNumber();
+    });
+    const bool hasDigit = std::ranges::any_of(segment, [](const QChar c) {
+        return c.isDigit();
+    });
+    return alphanumeric && hasDigit && segment.size() >= 16;
+}
+
+qint64 percentile(const QList<qint64> &sorted, const double fraction)
+{
+    if (sorted.isEmpty()) {
+        return 0;
+    }
+    const auto index = static_cast<qsizetype>(fraction * static_cast<double>(sorted.size() - 1));
+    return sorted[index];
+}
+}
+
+qint64 RequestTiming::total() const
+{
+    return queueWait + connect + timeToFirstByte + transfer + callback;
+}
+
+QJsonObject RequestTiming::toJson() const
+{
+    return {
+        {u"method"_s, method},
+        {u"endpoint"_s, endpoint},
+        {u"priority"_s, priority},
+        {u"status"_s, status},
+        {u"bytes"_s, bytes},
+        {u"start"_s, toMsecs(start)},
+        {u"queueWait"_s, toMsecs(queueWait)},
+        {u"connect"_s, toMsecs(connect)},
+        {u"timeToFirstByte"_s, toMsecs(timeToFirstByte)},
+        {u"transfer"_s, toMsecs(transfer)},
+        {u"parse"_s, toMsecs(parse)},
+        {u"callback"_s, toMsecs(callback)},
+        {u"total"_s, toMsecs(total())},
+    };
+}
+
+NetworkTimings::NetworkTimings(QObject *parent)
+    : QAbstractListModel(parent)
+{
+    m_clock.start();
+}
+
+NetworkTimings &NetworkTimings::instance()
+{
+    static NetworkTimings _instance;
+    return _instance;
+}
+
+QString NetworkTimings::endpointTemplate(const QUrl &url)
+{
+    const QStringList segments = url.path().split(u'/');
+
+    QStringList result;
+    result.reserve(segments.size());
+    for (qsizetype i = 0; i < segments.size(); i++) {
+        const QString &segment = segments[i];
+        const QString previous = i > 0 ? segments[i - 1] : QString();
+
+        if (previous == "tag"_L1 || previous == "tags"_L1) {
+            result.push_back(u":tag"_s);
+        } else if (segment.startsWith(u'@')) {
+            result.push_back(u":acct"_s);
+        } else if (isIdentifier(segment)) {
+            result.push_back(u":id"_s);
+        } else {
+            result.push_back(segment);
+        }
+    }
+
+    return result.join(u'/');
+}
+
+qint64 NetworkTimings::elapsed() const
+{
+    return m_clock.nsecsElapsed() / 1000;
+}
+
+void NetworkTimings::track(QNetworkReply *reply)
+{
+    Pending pending;
+    pending.timing.method = methodName(reply);
+    pending.timing.endpoint = endpointTemplate(reply->url());
+    pending.timing.priority = reply->request().priority();
+    pending.timing.start = elapsed();
+    m_pending.insert(reply, pending);
+
+    const auto stamp = [this, reply](qint64 Pending::*field) {
+        const auto it = m_pending.find(reply);
+        if (it != m_pending.end() && it.value().*field < 0) {
+            it.value().*field = elapsed();
+        }
+    };
+
+    connect(reply, &QNetworkReply::socketStartedConnecting, this, [stamp] {
+        stamp(&Pending::connectStarted);
+    });
+    connect(reply, &QNetworkReply::requestSent, this, [stamp] {
+        stamp(&Pending::requestSent);
+    });
+    // Servers not sending any headers worth a metaDataChanged are covered by the first readyRead
+    connect(reply, &QNetworkReply::metaDataChanged, this, [stamp] {
+        stamp(&Pending::headersReceived);
+    });
+    connect(reply, &QNetworkReply::readyRead, this, [stamp] {
+        stamp(&Pending::headersReceived);
+    });
+    connect(reply, &QNetworkReply::downloadProgress, this, [this, reply](const qint64 bytesReceived) {
+        const auto it = m_pending.find(reply);
+        if (it != m_pending.end()) {
+            it.value().timing.bytes = bytesReceived;
+        }
+    });
+    connect(reply, &QNetworkReply::finished, this, [stamp] {
+        stamp(&Pending::finished);
+    });
+    connect(reply, &QObject::destroyed, this, [this, reply] {
+        m_pending.remove(reply);
+    });
+}
+
+QJsonDocument NetworkTimings::parseJson(const QNetworkReply *reply, const QByteArray &data)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    const auto doc = QJsonDocument::fromJson(data);
+    instance().recordParse(reply, timer.nsecsElapsed());
+
+    return doc;
+}
+
+void NetworkTimings::recordParse(const QNetworkReply *reply, const qint64 nsecs)
+{
+    const auto it = m_pending.find(reply);
+    if (it != m_pending.end()) {
+        it.value().timing.parse += nsecs / 1000;
+    }
+}
+
+void NetworkTimings::complete(const QNetworkReply *reply, const qint64 callbackNsecs)
+{
+    const auto it = m_pending.constFind(reply);
+    if (it == m_pending.constEnd()) {
+        return;
+    }
+
+    const Pending pending = it.value();
+    m_pending.erase(it);
+
+    RequestTiming timing = pending.timing;
+    const qint64 finished = pending.finished >= 0 ? pending.finished : elapsed();
+
+    // Requests reusing a connection never start connecting, and some (like redirects) are never reported as sent at all
+    qint64 pickedUp = finished;
+    for (const qint64 stamp : {pending.connectStarted, pending.requestSent, pending.headersReceived}) {
+        if (stamp >= 0) {
+            pickedUp = stamp;
+            break;
+        }
+    }
+    const qint64 sent = pending.requestSent >= 0 ? pending.requestSent : pickedUp;
+    const qint64 headers = pending.headersReceived >= 0 ? pending.headersReceived : finished;
+
+    timing.queueWait = pickedUp - timing.start;
+    timing.connect = pending.connectStarted >= 0 ? sent - pending.connectStarted : 0;
+    timing.timeToFirstByte = std::max<qint64>(headers - sent, 0);
+    timing.transfer = std::max<qint64>(finished - headers, 0);
+    timing.callback = callbackNsecs / 1000;
+    timing.status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (timing.bytes == 0) {
+        timing.bytes = reply->header(QNetworkRequest::ContentLengthHeader).toLongLong();
+    }
+
+    append(timing);
+}
+
+qsizetype NetworkTimings::capacity() const
+{
+    return m_capacity;
+}
+
+void NetworkTimings::setCapacity(const qsizetype capacity)
+{
+    Q_ASSERT(capacity > 0);
+
+    beginResetModel();
+    m_capacity = capacity;
+    m_records.clear();
+    m_next = 0;
+    m_count = 0;
+    endResetModel();
+
+    Q_EMIT timingsChanged();
+}
+
+qsizetype NetworkTimings::indexOf(const int row) const
+{
+    return (m_next - 1 - row + m_capacity) % m_capacity;
+}
+
+void NetworkTimings::append(const RequestTiming &timing)
+{
+    if (m_count == m_capacity) {
+        beginRemoveRows({}, m_count - 1, m_count - 1);
+        m_count--;
+        endRemoveRows();
+    }
+
+    beginInsertRows({}, 0, 0);
+    if (m_records.size() < m_capacity) {
+        m_records.push_back(timing);
+    } else {
+        m_records[m_next] = timing;
+    }
+    m_next = (m_next + 1) % m_capacity;
+    m_count++;
+    endInsertRows();
+
+    Q_EMIT timingsChanged();
+}
+
+RequestTiming NetworkTimings::record(const int row) const
+{
+    Q_ASSERT(row >= 0 && row < m_count);
+    return m_records[indexOf(row)];
+}
+
+QVariantMap NetworkTimings::summary() const
+{
+    QList<qint64> totals;
+    totals.reserve(m_count);
+
+    qint64 queueWait = 0;
+    qint64 connectTime = 0;
+    qint64 timeToFirstByte = 0;
+    qint64 transfer = 0;
+    qint64 parse = 0;
+    qint64 callback = 0;
+    qint64 bytes = 0;
+    qint64 windowStart = std::numeric_limits<qint64>::max();
+    qint64 windowEnd = 0;
+
+    struct EndpointStats {
+        int count = 0;
+        qint64 total = 0;
+    };
+    QHash<QString, EndpointStats> endpoints;
+
+    for (int row = 0; row < m_count; row++) {
+        const auto &timing = m_records[indexOf(row)];
+
+        totals.push_back(timing.total());
+        queueWait += timing.queueWait;
+        connectTime += timing.connect;
+        timeToFirstByte += timing.timeToFirstByte;
+        transfer += timing.transfer;
+        parse += timing.parse;
+        callback += timing.callback;
+        bytes += timing.bytes;
+        windowStart = std::min(windowStart, timing.start);
+        windowEnd = std::max(windowEnd, timing.start + timing.total());
+
+        auto &stats = endpoints[timing.method + u' ' + timing.endpoint];
+        stats.count++;
+        stats.total += timing.total();
+    }
+    std::ranges::sort(totals);
+
+    QList<std::pair<QString, EndpointStats>> slowest;
+    slowest.reserve(endpoints.size());
+    for (const auto &[endpoint, stats] : endpoints.asKeyValueRange()) {
+        slowest.push_back({endpoint, stats});
+    }
+    std::ranges::sort(slowest, [](const auto &a, const auto &b) {
+        return a.second.total / a.second.count > b.second.total / b.second.count;
+    });
+
+    QVariantList slowestEndpoints;
+    for (const auto &[endpoint, stats] : slowest.first(std::min(slowest.size(), slowestEndpointCount))) {
+        slowestEndpoints.push_back(QVariantMap{
+            {u"endpoint"_s, endpoint},
+            {u"count"_s, stats.count},
+            {u"average"_s, toMsecs(stats.total / stats.count)},
+        });
+    }
+
+    const auto average = [this](const qint64 sum) {
+        return m_count > 0 ? toMsecs(sum / m_count) : 0.0;
+    };
+
+    return {
+        {u"count"_s, m_count},
+        {u"bytes"_s, bytes},
+        {u"windowStart"_s, m_count > 0 ? toMsecs(windowStart) : 0.0},
+        {u"windowEnd"_s, toMsecs(windowEnd)},
+        {u"queueWait"_s, average(queueWait)},
+        {u"connect"_s, average(connectTime)},
+        {u"timeToFirstByte"_s, average(timeToFirstByte)},
+        {u"transfer"_s, average(transfer)},
+        {u"parse"_s, average(parse)},
+        {u"callback"_s, average(callback)},
+        {u"median"_s, toMsecs(percentile(totals, 0.5))},
+        {u"p95"_s, toMsecs(percentile(totals, 0.95))},
+        {u"slowestEndpoints"_s, slowestEndpoints},
+    };
+}
+
+QVariantList NetworkTimings::histogram() const
+{
+    std::array<int, histogramBounds.size() + 1> counts{};
+    for (int row = 0; row < m_count; row++) {
+        const double total = toMsecs(m_records[indexOf(row)].total());
+        const auto bound = std::ranges::find_if(histogramBounds, [total](const int bound) {
+            return total < bound;
+        });
+        counts[std::distance(histogramBounds.begin(), bound)]++;
+    }
+
+    QVariantList buckets;
+    for (size_t i = 0; i < counts.size(); i++) {
+        buckets.push_back(QVariantMap{
+            // The last bucket has no upper bound
+            {u"upperBound"_s, i < histogramBounds.size() ? histogramBounds[i] : -1},
+            {u"count"_s, counts[i]},
+        });
+    }
+    return buckets;
+}
+
+QString NetworkTimings::toJson() const
+{
+    QJsonArray requests;
+    for (int row = m_count - 1; row >= 0; row--) {
+        requests.push_back(m_records[indexOf(row)].toJson());
+    }
+
+    const QJsonObject root{
+        {u"summary"_s, QJsonObject::fromVariantMap(summary())},
+        {u"histogram"_s, QJsonArray::fromVariantList(histogram())},
+        {u"requests"_s, requests},
+    };
+    return QString::fromUtf8(QJsonDocument(root).toJson());
+}
+
+bool NetworkTimings::exportToFile(const QUrl &url) const
+{
+    QFile file(url.toLocalFile());
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    return file.write(toJson().toUtf8()) != -1;
+}
+
+void NetworkTimings::clear()
+{
+    beginResetModel();
+    m_records.clear();
+    m_next = 0;
+    m_count = 0;
+    endResetModel();
+
+    Q_EMIT timingsChanged();
+}
+
+int NetworkTimings::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_count;
+}
+
+QVariant NetworkTimings::data(const QModelIndex &index, const int role) const
+{
+    Q_ASSERT(checkIndex(index, QAbstractItemModel::CheckIndexOption::IndexIsValid));
+
+    const auto &timing = m_records[indexOf(index.row())];
+    switch (role) {
+    case MethodRole:
+        return timing.method;
+    case EndpointRole:
+        return timing.endpoint;
+    case PriorityRole:
+        return timing.priority;
+    case StatusRole:
+        return timing.status;
+    case BytesRole:
+        return timing.bytes;
+    case StartRole:
+        return toMsecs(timing.start);
+    case QueueWaitRole:
+        return toMsecs(timing.queueWait);
+    case ConnectRole:
+        return toMsecs(timing.connect);
+    case TimeToFirstByteRole:
+        return toMsecs(timing.timeToFirstByte);
+    case TransferRole:
+        return toMsecs(timing.transfer);
+    case ParseRole:
+        return toMsecs(timing.parse);
+    case CallbackRole:
+        return toMsecs(timing.callback);
+    case TotalRole:
+        return toMsecs(timing.total());
+    default:
+        return {};
+    }
+}
+
+QHash<int, QByteArray> NetworkTimings::roleNames() const
+{
+    return {
+        {MethodRole, "method"},
+        {EndpointRole, "endpoint"},
+        {PriorityRole, "priority"},
+        {StatusRole, "status"},
+        {BytesRole, "bytes"},
+        {StartRole, "start"},
+        {QueueWaitRole, "queueWait"},
+        {ConnectRole, "connect"},
+        {TimeToFirstByteRole, "timeToFirstByte"},
+        {TransferRole, "transfer"},
+        {ParseRole, "parse"},
+        {CallbackRole, "callback"},
+        {TotalRole, "total"},
+    };
+}
+
+#include "moc_networktimings.cpp"
@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QAbstractListModel>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QJsonObject>
+#include <QNetworkRequest>
+#include <QQmlEngine>
+
+class QJsonDocument;
+class QNetworkReply;
+
+/**
+ * @brief Where the time of a single request went, in microseconds.
+ *
+ * A phase is zero when it didn't happen, for example when an existing connection was reused there's no connect time.
+ */
+struct RequestTiming {
+    QString method;
+    QString endpoint;
+    int priority = QNetworkRequest::NormalPriority;
+    int status = 0;
+    qint64 bytes = 0;
+
+    qint64 start = 0; ///< When the request was issued, relative to the first request made.
+    qint64 queueWait = 0; ///< Until Qt picked the request up, either opening a connection or sending it on an existing one.
+    qint64 connect = 0; ///< DNS lookup, TCP and TLS handshakes.
+    qint64 timeToFirstByte = 0; ///< Until the response headers arrived.
+    qint64 transfer = 0; ///< Downloading the body.
+    qint64 parse = 0; ///< JSON parsing, as far as the callback reported it. Also counted in the callback time.
+    qint64 callback = 0; ///< Running the callback, which includes parsing and model insertion.
+
+    /**
+     * @return The time from issuing the request until its callback returned.
+     */
+    [[nodiscard]] qint64 total() const;
+
+    [[nodiscard]] QJsonObject toJson() const;
+};
+
+/**
+ * @brief Keeps timings of the most recent network requests, for diagnosing slowness.
+ *
+ * Every request made by Account is tracked from the moment it's issued until its callback returns. The last capacity() records are kept in a
+ * ring buffer, the newest one first.
+ *
+ * URLs are reduced to an endpoint template like "/api/v1/statuses/:id/context", so the records can be shared without leaking ids, tags or
+ * tokens.
+ */
+class NetworkTimings : public QAbstractListModel
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+
+    Q_PROPERTY(QVariantMap summary READ summary NOTIFY timingsChanged)
+    Q_PROPERTY(QVariantList histogram READ histogram NOTIFY timingsChanged)
+
+public:
+    enum CustomRoles {
+        MethodRole = Qt::UserRole + 1,
+        EndpointRole,
+        PriorityRole,
+        StatusRole,
+        BytesRole,
+        StartRole,
+        QueueWaitRole,
+        ConnectRole,
+        TimeToFirstByteRole,
+        TransferRole,
+        ParseRole,
+        CallbackRole,
+        TotalRole,
+    };
+    Q_ENUM(CustomRoles)
+
+    static NetworkTimings *create(QQmlEngine *, QJSEngine *)
+    {
+        auto inst = &instance();
+        QJSEngine::setObjectOwnership(inst, QJSEngine::ObjectOwnership::CppOwnership);
+        return inst;
+    }
+
+    static NetworkTimings &instance();
+
+    /**
+     * @return @p url reduced to its path, with ids, tags and other user specific segments replaced by placeholders.
+     */
+    [[nodiscard]] static QString endpointTemplate(const QUrl &url);
+
+    /**
+     * @brief Start tracking @p reply, which should have just been issued.
+     *
+     * The record is only kept once complete() is called.
+     */
+    void track(QNetworkReply *reply);
+
+    /**
+     * @brief Parses @p data as JSON, counting the time spent against @p reply.
+     *
+     * Meant to be used from the callbacks of requests returning large documents, like timelines.
+     */
+    [[nodiscard]] static QJsonDocument parseJson(const QNetworkReply *reply, const QByteArray &data);
+
+    /**
+     * @brief Counts @p nsecs spent parsing against @p reply, for callers parsing it themselves.
+     */
+    void recordParse(const QNetworkReply *reply, qint64 nsecs);
+
+    /**
+     * @brief Finishes the record of @p reply, after its callback took @p callbackNsecs.
+     */
+    void complete(const QNetworkReply *reply, qint64 callbackNsecs);
+
+    /**
+     * @return How many records are kept at most.
+     */
+    [[nodiscard]] qsizetype capacity() const;
+
+    /**
+     * @brief Keep up to @p capacity records. This clears the existing ones.
+     */
+    void setCapacity(qsizetype capacity);
+
+    /**
+     * @return The record at @p row, the newest one being at row 0.
+     */
+    [[nodiscard]] RequestTiming record(int row) const;
+
+    /**
+     * @return Request count, the span of time the records cover, the average of each phase, the median and 95th percentile of the total
+     * time, and the slowest endpoints. Times are in milliseconds.
+     */
+    [[nodiscard]] QVariantMap summary() const;
+
+    /**
+     * @return How many requests took how long in total, as a list of buckets with a label and a count.
+     */
+    [[nodiscard]] QVariantList histogram() const;
+
+    /**
+     * @return Every record, oldest first, along with the summary as a JSON document.
+     */
+    Q_INVOKABLE QString toJson() const;
+
+    /**
+     * @brief Writes toJson() to the local file at @p url.
+     * @return Whether it could be written.
+     */
+    Q_INVOKABLE bool exportToFile(const QUrl &url) const;
+
+    /**
+     * @brief Forget about every record.
+     */
+    Q_INVOKABLE void clear();
+
+    int rowCount(const QModelIndex &parent = {}) const override;
+    QVariant data(const QModelIndex &index, int role) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+Q_SIGNALS:
+    void timingsChanged();
+
+private:
+    explicit NetworkTimings(QObject *parent = nullptr);
+
+    struct Pending {
+        RequestTiming timing;
+        qint64 connectStarted = -1;
+        qint64 requestSent = -1;
+        qint64 headersReceived = -1;
+        qint64 finished = -1;
+    };
+
+    [[nodiscard]] qint64 elapsed() const;
+    [[nodiscard]] qsizetype indexOf(int row) const;
+    void append(const RequestTiming &timing);
+
+    QElapsedTimer m_clock;
+    QHash<const QNetworkReply *, Pending> m_pending;
+
+    QList<RequestTiming> m_records;
+    qsizetype m_capacity = 256;
+    qsizetype m_next = 0;
+    int m_count = 0;
+};
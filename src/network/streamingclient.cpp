@@ -0,0 +1,255 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "network/streamingclient.h"
+
+#include "network/networkcontroller.h"
+#include "tokodon-version.h"
+#include "tokodon_http_debug.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRandomGenerator>
+
+using namespace Qt::Literals::StringLiterals;
+
+static bool isHashtagStream(const QString &stream)
+{
+    return stream.startsWith("hashtag"_L1);
+}
+
+StreamingClient::StreamingClient(QObject *parent)
+    : QObject(parent)
+{
+    m_heartbeatTimer.setInterval(std::chrono::seconds(30));
+    m_reconnectTimer.setSingleShot(true);
+
+    connect(&m_socket, &QWebSocket::connected, this, &StreamingClient::handleConnected);
+    connect(&m_socket, &QWebSocket::stateChanged, this, [this](const QAbstractSocket::SocketState state) {
+        // Failed connection attempts never emit disconnected(), so watch the state instead
+        if (state == QAbstractSocket::UnconnectedState) {
+            handleUnconnected();
+        }
+    });
+    connect(&m_socket, &QWebSocket::textMessageReceived, this, &StreamingClient::handleMessage);
+    connect(&m_socket, &QWebSocket::pong, this, [this] {
+        m_receivedSinceHeartbeat = true;
+    });
+    connect(&m_socket, &QWebSocket::errorOccurred, this, [this](QAbstractSocket::SocketError) {
+        NetworkController::instance().logError(m_url.toString(), m_socket.errorString());
+    });
+    connect(&m_heartbeatTimer, &QTimer::timeout, this, &StreamingClient::checkHeartbeat);
+    connect(&m_reconnectTimer, &QTimer::timeout, this, &StreamingClient::open);
+}
+
+QString StreamingClient::streamKey(const QString &stream, const QString &parameter)
+{
+    if (parameter.isEmpty()) {
+        return stream;
+    }
+
+    // The server doesn't preserve the case of hashtags
+    return stream + ':'_L1 + (isHashtagStream(stream) ? parameter.toLower() : parameter);
+}
+
+void StreamingClient::setUrl(const QUrl &url)
+{
+    if (m_url == url) {
+        return;
+    }
+
+    m_url = url;
+
+    if (m_socket.state() != QAbstractSocket::UnconnectedState) {
+        m_socket.abort();
+    }
+    open();
+}
+
+QUrl StreamingClient::url() const
+{
+    return m_url;
+}
+
+void StreamingClient::subscribe(const QString &stream, const QString &parameter)
+{
+    auto &subscription = m_subscriptions[streamKey(stream, parameter)];
+    if (subscription.subscribers++ > 0) {
+        return;
+    }
+
+    subscription.stream = stream;
+    // Whoever unsubscribes last may spell the hashtag differently than whoever subscribed first
+    subscription.parameter = isHashtagStream(stream) ? parameter.toLower() : parameter;
+
+    if (isConnected()) {
+        sendSubscription(QStringLiteral("subscribe"), subscription);
+    } else {
+        open();
+    }
+}
+
+void StreamingClient::unsubscribe(const QString &stream, const QString &parameter)
+{
+    const auto it = m_subscriptions.find(streamKey(stream, parameter));
+    if (it == m_subscriptions.end() || --it->subscribers > 0) {
+        return;
+    }
+
+    if (isConnected()) {
+        sendSubscription(QStringLiteral("unsubscribe"), *it);
+    }
+    m_subscriptions.erase(it);
+
+    if (m_subscriptions.isEmpty()) {
+        m_socket.close();
+    }
+}
+
+int StreamingClient::subscriberCount(const QString &key) const
+{
+    return m_subscriptions.value(key).subscribers;
+}
+
+QStringList StreamingClient::subscriptions() const
+{
+    return m_subscriptions.keys();
+}
+
+bool StreamingClient::isConnected() const
+{
+    return m_socket.state() == QAbstractSocket::ConnectedState;
+}
+
+void StreamingClient::setHeartbeatInterval(const std::chrono::milliseconds interval)
+{
+    m_heartbeatTimer.setInterval(interval);
+}
+
+void StreamingClient::setReconnectDelay(const std::chrono::milliseconds initial, const std::chrono::milliseconds maximum)
+{
+    m_initialReconnectDelay = initial;
+    m_maximumReconnectDelay = maximum;
+}
+
+int StreamingClient::reconnectAttempts() const
+{
+    return m_reconnectAttempts;
+}
+
+void StreamingClient::open()
+{
+    if (m_url.isEmpty() || m_subscriptions.isEmpty() || m_socket.state() != QAbstractSocket::UnconnectedState) {
+        return;
+    }
+
+    m_reconnectTimer.stop();
+
+    QNetworkRequest request(m_url);
+    request.setHeader(QNetworkRequest::UserAgentHeader, QStringLiteral("Tokodon/").append(QStringLiteral(TOKODON_VERSION_STRING)));
+    m_socket.open(request);
+}
+
+void StreamingClient::sendSubscription(const QString &type, const Subscription &subscription)
+{
+    QJsonObject message{
+        {QStringLiteral("type"), type},
+        {QStringLiteral("stream"), subscription.stream},
+    };
+    if (!subscription.parameter.isEmpty()) {
+        message[isHashtagStream(subscription.stream) ? "tag"_L1 : "list"_L1] = subscription.parameter;
+    }
+
+    m_socket.sendTextMessage(QString::fromUtf8(QJsonDocument(message).toJson(QJsonDocument::Compact)));
+}
+
+void StreamingClient::handleConnected()
+{
+    m_connected = true;
+    m_receivedSinceHeartbeat = true;
+    m_heartbeatTimer.start();
+
+    for (const auto &subscription : std::as_const(m_subscriptions)) {
+        sendSubscription(QStringLiteral("subscribe"), subscription);
+    }
+    Q_EMIT connected();
+
+    if (m_wasConnected) {
+        qCDebug(TOKODON_HTTP) << "Streaming connection is back after" << m_reconnectAttempts << "attempts";
+        Q_EMIT reconnected();
+    }
+    m_wasConnected = true;
+    m_reconnectAttempts = 0;
+}
+
+void StreamingClient::handleUnconnected()
+{
+    m_heartbeatTimer.stop();
+
+    if (m_connected) {
+        m_connected = false;
+        Q_EMIT disconnected();
+    }
+
+    // Nothing to reconnect for, this was closed on purpose
+    if (m_url.isEmpty() || m_subscriptions.isEmpty()) {
+        m_wasConnected = false;
+        m_reconnectAttempts = 0;
+        return;
+    }
+
+    scheduleReconnect();
+}
+
+void StreamingClient::checkHeartbeat()
+{
+    if (!m_receivedSinceHeartbeat) {
+        qCDebug(TOKODON_HTTP) << "Streaming connection missed its heartbeat, dropping it";
+        m_socket.abort();
+        return;
+    }
+
+    m_receivedSinceHeartbeat = false;
+    m_socket.ping();
+}
+
+void StreamingClient::scheduleReconnect()
+{
+    if (m_reconnectTimer.isActive()) {
+        return;
+    }
+
+    // Double the delay for every failed attempt, with some jitter so every client of an instance doesn't come back at once
+    const auto backoff = m_initialReconnectDelay * (qint64{1} << std::min(m_reconnectAttempts, 20));
+    const double jitter = 0.8 + QRandomGenerator::global()->bounded(0.4);
+    const auto delay = std::min(std::chrono::milliseconds(qint64(double(backoff.count()) * jitter)), m_maximumReconnectDelay);
+
+    m_reconnectAttempts++;
+    m_reconnectTimer.start(delay);
+    Q_EMIT reconnectScheduled(delay);
+}
+
+void StreamingClient::handleMessage(const QString &message)
+{
+    m_receivedSinceHeartbeat = true;
+
+    const auto envelope = QJsonDocument::fromJson(message.toUtf8()).object();
+
+    if (envelope.contains("error"_L1)) {
+        qCWarning(TOKODON_HTTP) << "Streaming error:" << envelope["error"_L1].toString();
+        return;
+    }
+
+    if (!envelope.contains("event"_L1)) {
+        return;
+    }
+
+    // Servers which don't multiplex only send events for the user stream
+    const auto stream = envelope["stream"_L1].toArray();
+    const QString key = stream.isEmpty() ? QStringLiteral("user") : streamKey(stream.at(0).toString(), stream.at(1).toString());
+
+    Q_EMIT eventReceived(key, envelope["event"_L1].toString(), envelope["payload"_L1].toString().toUtf8());
+}
+
+#include "moc_streamingclient.cpp"
@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QObject>
+#include <QTimer>
+#include <QUrl>
+#include <QWebSocket>
+
+#include <chrono>
+
+/**
+ * @brief Multiplexes every streaming timeline of an account over a single WebSocket.
+ *
+ * Streams are reference counted, so several timelines can share a subscription. The server is only told to subscribe when a stream is first
+ * used, and to unsubscribe once nothing uses it anymore. Incoming events are routed by the "stream" field of their envelope.
+ *
+ * The connection is pinged regularly, and considered dead if nothing comes back. Dropped connections are retried with an exponential backoff,
+ * and every stream is subscribed to again once it's back. Events sent in the meantime are lost, see reconnected().
+ *
+ * @see https://docs.joinmastodon.org/methods/streaming/#websocket
+ */
+class StreamingClient : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit StreamingClient(QObject *parent = nullptr);
+
+    /**
+     * @return The key identifying @p stream, like "user", "public:local", "hashtag:kde" or "list:1".
+     * @param stream The stream name.
+     * @param parameter The hashtag or list id for streams which need one, otherwise empty.
+     */
+    [[nodiscard]] static QString streamKey(const QString &stream, const QString &parameter = {});
+
+    /**
+     * @brief Sets the streaming endpoint to connect to, including the access token.
+     *
+     * The socket is (re)opened if there are any subscriptions.
+     */
+    void setUrl(const QUrl &url);
+
+    /**
+     * @return The streaming endpoint.
+     */
+    [[nodiscard]] QUrl url() const;
+
+    /**
+     * @brief Starts using @p stream, subscribing to it if nothing else does already.
+     * @param stream The stream name.
+     * @param parameter The hashtag or list id for streams which need one, otherwise empty.
+     */
+    void subscribe(const QString &stream, const QString &parameter = {});
+
+    /**
+     * @brief Stops using @p stream, unsubscribing from it if nothing else uses it.
+     * @param stream The stream name.
+     * @param parameter The hashtag or list id for streams which need one, otherwise empty.
+     */
+    void unsubscribe(const QString &stream, const QString &parameter = {});
+
+    /**
+     * @return How many users the stream identified by @p key has.
+     */
+    [[nodiscard]] int subscriberCount(const QString &key) const;
+
+    /**
+     * @return The keys of every stream which is currently subscribed to.
+     */
+    [[nodiscard]] QStringList subscriptions() const;
+
+    /**
+     * @return If the socket is currently connected.
+     */
+    [[nodiscard]] bool isConnected() const;
+
+    /**
+     * @brief Sets how often the connection is pinged. It's dropped if nothing was received for two intervals.
+     */
+    void setHeartbeatInterval(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Sets the delay before the first reconnection attempt, which doubles with every failed attempt up to @p maximum.
+     */
+    void setReconnectDelay(std::chrono::milliseconds initial, std::chrono::milliseconds maximum);
+
+    /**
+     * @return How many reconnection attempts were made since the connection was lost.
+     */
+    [[nodiscard]] int reconnectAttempts() const;
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when an event has been received on the stream identified by @p streamKey.
+     * @param streamKey The key of the stream, see streamKey().
+     * @param event The name of the event, like "update" or "delete".
+     * @param payload The payload of the event.
+     */
+    void eventReceived(const QString &streamKey, const QString &event, const QByteArray &payload);
+
+    /**
+     * @brief Emitted when the socket has connected, and every stream has been subscribed to.
+     */
+    void connected();
+
+    /**
+     * @brief Emitted when the socket has disconnected.
+     */
+    void disconnected();
+
+    /**
+     * @brief Emitted when the connection is back after it was lost, and every stream has been subscribed to again.
+     *
+     * Anything that happened while disconnected has to be fetched again.
+     */
+    void reconnected();
+
+    /**
+     * @brief Emitted when the next reconnection attempt has been scheduled in @p delay.
+     */
+    void reconnectScheduled(std::chrono::milliseconds delay);
+
+private:
+    struct Subscription {
+        QString stream;
+        QString parameter;
+        int subscribers = 0;
+    };
+
+    void open();
+    void sendSubscription(const QString &type, const Subscription &subscription);
+    void handleMessage(const QString &message);
+    void handleConnected();
+    void handleUnconnected();
+    void checkHeartbeat();
+    void scheduleReconnect();
+
+    QWebSocket m_socket;
+    QUrl m_url;
+    QHash<QString, Subscription> m_subscriptions;
+
+    QTimer m_heartbeatTimer;
+    QTimer m_reconnectTimer;
+    std::chrono::milliseconds m_initialReconnectDelay = std::chrono::seconds(1);
+    std::chrono::milliseconds m_maximumReconnectDelay = std::chrono::minutes(5);
+    int m_reconnectAttempts = 0;
+    bool m_connected = false;
+    bool m_wasConnected = false;
+    bool m_receivedSinceHeartbeat = false;
+};
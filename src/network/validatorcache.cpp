@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "network/validatorcache.h"
+
+#include "network/diskcache.h"
+#include "tokodon_http_debug.h"
+
+#include <QAbstractNetworkCache>
+#include <QNetworkReply>
+
+ValidatorCache::ValidatorCache()
+    : m_diskCache(DiskCache::instance().createCache())
+{
+}
+
+ValidatorCache::~ValidatorCache() = default;
+
+ValidatorCache &ValidatorCache::instance()
+{
+    static ValidatorCache _instance;
+    return _instance;
+}
+
+QUrl ValidatorCache::cacheKey(const QUrl &url, const QString &accountName)
+{
+    // Authenticated responses differ between accounts on the same instance
+    QUrl key = url;
+    key.setUserName(accountName);
+    return key;
+}
+
+QHash<QByteArray, QByteArray> ValidatorCache::conditionalHeaders(const QUrl &key)
+{
+    const auto metaData = m_diskCache->metaData(key);
+    if (!metaData.isValid()) {
+        return {};
+    }
+
+    QHash<QByteArray, QByteArray> headers;
+    for (const auto &[name, value] : metaData.rawHeaders()) {
+        if (name == QByteArrayLiteral("ETag")) {
+            headers.insert(QByteArrayLiteral("If-None-Match"), value);
+        } else if (name == QByteArrayLiteral("Last-Modified")) {
+            headers.insert(QByteArrayLiteral("If-Modified-Since"), value);
+        }
+    }
+
+    return headers;
+}
+
+void ValidatorCache::insert(const QUrl &key, const QNetworkReply *reply, const QByteArray &body, const QJsonDocument &document)
+{
+    m_misses++;
+
+    QNetworkCacheMetaData::RawHeaderList validators;
+    for (const auto &name : {QByteArrayLiteral("ETag"), QByteArrayLiteral("Last-Modified")}) {
+        if (reply->hasRawHeader(name)) {
+            validators.push_back({name, reply->rawHeader(name)});
+        }
+    }
+
+    // Without validators there's nothing to revalidate against next time
+    if (validators.isEmpty() || document.isNull()) {
+        remove(key);
+        return;
+    }
+
+    QNetworkCacheMetaData metaData;
+    metaData.setUrl(key);
+    metaData.setRawHeaders(validators);
+    metaData.setSaveToDisk(true);
+
+    QIODevice *device = m_diskCache->prepare(metaData);
+    if (!device) {
+        remove(key);
+        return;
+    }
+
+    device->write(body);
+    m_diskCache->insert(device);
+
+    m_entries.insert(key, Entry{document, body.size()});
+}
+
+QJsonDocument ValidatorCache::notModified(const QUrl &key)
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        const std::unique_ptr<QIODevice> device(m_diskCache->data(key));
+        if (!device) {
+            return {};
+        }
+
+        const auto body = device->readAll();
+        it = m_entries.insert(key, Entry{QJsonDocument::fromJson(body), body.size()});
+    }
+
+    m_hits++;
+    m_bytesSaved += it->size;
+    qCDebug(TOKODON_HTTP) << "Not modified, reusing" << it->size << "cached bytes";
+
+    return it->document;
+}
+
+void ValidatorCache::remove(const QUrl &key)
+{
+    m_entries.remove(key);
+    m_diskCache->remove(key);
+}
+
+void ValidatorCache::clear()
+{
+    m_entries.clear();
+    DiskCache::instance().clear(DiskCache::Api);
+    m_bytesSaved = 0;
+    m_hits = 0;
+    m_misses = 0;
+}
+
+qint64 ValidatorCache::bytesSaved() const
+{
+    return m_bytesSaved;
+}
+
+int ValidatorCache::hits() const
+{
+    return m_hits;
+}
+
+int ValidatorCache::misses() const
+{
+    return m_misses;
+}
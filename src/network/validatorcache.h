@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QJsonDocument>
+
+#include <memory>
+
+class QAbstractNetworkCache;
+class QNetworkReply;
+
+/**
+ * @brief Remembers the HTTP validators (ETag and Last-Modified) of slow-changing API resources, so they can be revalidated instead of redownloaded.
+ *
+ * The response bodies are persisted in the API partition of DiskCache. Mastodon marks most API responses as private, which keeps them out of the
+ * regular cache, so this is done explicitly. Parsed documents are kept in memory for the rest of the session.
+ */
+class ValidatorCache
+{
+public:
+    static ValidatorCache &instance();
+
+    /**
+     * @return The key to store @p url under for the account named @p accountName.
+     */
+    [[nodiscard]] static QUrl cacheKey(const QUrl &url, const QString &accountName);
+
+    /**
+     * @return The If-None-Match and If-Modified-Since headers for @p key, or nothing if there's no cached response to fall back on.
+     */
+    [[nodiscard]] QHash<QByteArray, QByteArray> conditionalHeaders(const QUrl &key);
+
+    /**
+     * @brief Stores @p body and its parsed @p document under @p key, if @p reply has any validators.
+     */
+    void insert(const QUrl &key, const QNetworkReply *reply, const QByteArray &body, const QJsonDocument &document);
+
+    /**
+     * @brief Looks up the cached document for @p key after the server responded with 304 Not Modified.
+     * @return The cached document, or a null document if it was evicted in the meantime.
+     */
+    QJsonDocument notModified(const QUrl &key);
+
+    /**
+     * @brief Removes the cached response for @p key.
+     */
+    void remove(const QUrl &key);
+
+    /**
+     * @brief Removes all cached responses and resets the statistics.
+     */
+    void clear();
+
+    /**
+     * @return The number of body bytes that didn't have to be downloaded thanks to a 304 Not Modified response.
+     */
+    [[nodiscard]] qint64 bytesSaved() const;
+
+    /**
+     * @return The number of 304 Not Modified responses that were answered from the cache.
+     */
+    [[nodiscard]] int hits() const;
+
+    /**
+     * @return The number of responses that had to be downloaded in full.
+     */
+    [[nodiscard]] int misses() const;
+
+private:
+    ValidatorCache();
+    ~ValidatorCache();
+
+    struct Entry {
+        QJsonDocument document;
+        qint64 size = 0;
+    };
+
+    std::unique_ptr<QAbstractNetworkCache> m_diskCache;
+    QHash<QUrl, Entry> m_entries;
+    qint64 m_bytesSaved = 0;
+    int m_hits = 0;
+    int m_misses = 0;
+};
@@ -5,6 +5,7 @@
 
 #include "account/abstractaccount.h"
 #include "networkcontroller.h"
+#include "networktimings.h"
 #include "texthandler.h"
 
 #include <KLocalizedString>
@@ -18,10 +19,29 @@ NotificationModel::NotificationModel(QObject *parent)
     m_manager = &AccountManager::instance();
     m_account = m_manager->selectedAccount();
 
+    connect(this, &NotificationModel::modelAboutToBeReset, this, [this] {
+        m_generation++;
+    });
+
+    if (m_account) {
+        connect(m_account, &AbstractAccount::streamReconnected, this, &NotificationModel::backfill);
+        connect(m_account->interactionQueue(), &InteractionQueue::interactionChanged, this, &NotificationModel::handleInteraction);
+    }
+
     connect(m_manager, &AccountManager::accountSelected, this, [this](AbstractAccount *account) {
         if (m_account != account) {
+            if (m_account) {
+                disconnect(m_account, &AbstractAccount::streamReconnected, this, &NotificationModel::backfill);
+                disconnect(m_account->interactionQueue(), &InteractionQueue::interactionChanged, this, &NotificationModel::handleInteraction);
+            }
+
             m_account = account;
 
+            if (m_account) {
+                connect(m_account, &AbstractAccount::streamReconnected, this, &NotificationModel::backfill);
+                connect(m_account->interactionQueue(), &InteractionQueue::interactionChanged, this, &NotificationModel::handleInteraction);
+            }
+
             beginResetModel();
             m_notifications.clear();
             endResetModel();
@@ -92,7 +112,7 @@ void NotificationModel::fillTimeline(const QUrl &next)
         this,
         [this](QNetworkReply *reply) {
             const auto data = reply->readAll();
-            const auto doc = QJsonDocument::fromJson(data);
+            const auto doc = NetworkTimings::parseJson(reply, data);
 
             if (!doc.isArray()) {
                 m_account->errorOccured(i18n("Error occurred when fetching the latest notification."));
@@ -128,6 +148,69 @@ void NotificationModel::fillTimeline(const QUrl &next)
         });
 }
 
+void NotificationModel::backfill()
+{
+    if (!m_account || m_notifications.isEmpty()) {
+        return;
+    }
+
+    fetchNewerNotifications(QString::number(m_notifications.first()->id()));
+}
+
+void NotificationModel::fetchNewerNotifications(const QString &minId)
+{
+    // since_id would only return the newest page, and drop everything between it and minId
+    QUrl uri = m_account->apiUrl(QStringLiteral("/api/v1/notifications"));
+    QUrlQuery urlQuery(uri);
+    urlQuery.addQueryItem(QStringLiteral("min_id"), minId);
+    for (const auto &excludeType : std::as_const(m_excludeTypes)) {
+        urlQuery.addQueryItem(QStringLiteral("exclude_types[]"), excludeType);
+    }
+    uri.setQuery(urlQuery);
+
+    m_account->get(uri, true, this, [this, account = m_account, generation = m_generation](QNetworkReply *reply) {
+        if (m_account != account || m_generation != generation) {
+            return;
+        }
+
+        const auto values = QJsonDocument::fromJson(reply->readAll()).array();
+        if (values.isEmpty()) {
+            return;
+        }
+
+        // The page right after minId, but still with the newest notification first
+        const QString newestId = values.first().toObject()[QLatin1String("id")].toString();
+
+        QList<std::shared_ptr<Notification>> notifications;
+        for (const auto &value : values) {
+            const auto notification = std::make_shared<Notification>(m_account, value.toObject(), this);
+
+            // The stream may have delivered some of these already
+            const bool alreadyKnown = std::ranges::any_of(std::as_const(m_notifications), [&notification](const auto &existing) {
+                return existing->id() == notification->id();
+            });
+            if (!alreadyKnown) {
+                notifications.push_back(notification);
+            }
+        }
+
+        // Below anything streamed in the meantime
+        if (!notifications.isEmpty()) {
+            const int newest = newestId.toInt();
+            const auto it = std::ranges::find_if(std::as_const(m_notifications), [newest](const auto &notification) {
+                return notification->id() < newest;
+            });
+            const int row = static_cast<int>(it - m_notifications.cbegin());
+
+            beginInsertRows({}, row, row + notifications.count() - 1);
+            m_notifications = m_notifications.first(row) + notifications + m_notifications.sliced(row);
+            endInsertRows();
+        }
+
+        fetchNewerNotifications(newestId);
+    });
+}
+
 void NotificationModel::fetchMore(const QModelIndex &parent)
 {
     Q_UNUSED(parent);
@@ -199,7 +282,7 @@ QVariant NotificationModel::data(const QModelIndex &index, int role) const
         return QVariant::fromValue<AccountWarning>(*notification->accountWarning());
     default:
         if (post != nullptr) {
-            return postData(post, role);
+            return postData(index, post, role);
         }
     }
 
@@ -260,6 +343,17 @@ void NotificationModel::actionBookmark(const QModelIndex &index)
     }
 }
 
+void NotificationModel::handleInteraction(const QString &postId, const InteractionQueue::Kind kind, const bool enabled)
+{
+    for (qsizetype row = 0; row < m_notifications.size(); row++) {
+        const auto post = m_notifications[row]->post();
+        if (post != nullptr && post->postId() == postId) {
+            const int role = applyInteraction(post, kind, enabled);
+            Q_EMIT dataChanged(index(row, 0), index(row, 0), {role});
+        }
+    }
+}
+
 void NotificationModel::actionDelete(const QModelIndex &index)
 {
     const auto p = m_notifications[index.row()]->post();
@@ -33,6 +33,9 @@ public:
 
     virtual void fillTimeline(const QUrl &next = {});
 
+    /// Fetch the notifications which were missed while the streaming connection was down, and add them to the top
+    void backfill();
+
     /// Get a shared pointer to the underlying notification object at \p index
     [[nodiscard]] std::shared_ptr<Notification> internalData(const QModelIndex &index) const;
 
@@ -111,4 +114,13 @@ protected:
     QList<std::shared_ptr<Notification>> m_notifications;
     QStringList m_excludeTypes;
     std::optional<QUrl> m_next;
+
+private:
+    void handleInteraction(const QString &postId, InteractionQueue::Kind kind, bool enabled);
+
+    /// Fetch every notification newer than \p minId, a page at a time until there are none left
+    void fetchNewerNotifications(const QString &minId);
+
+    // Pages fetched before the model was reset are dropped
+    int m_generation = 0;
 };
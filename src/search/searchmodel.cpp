@@ -110,7 +110,7 @@ QVariant SearchModel::data(const QModelIndex &index, int role) const
 
     if (isStatus) {
         const auto post = m_statuses[row - m_accounts.count()];
-        return postData(post, role);
+        return postData(index, post, role);
     }
 
     if (isHashtag) {
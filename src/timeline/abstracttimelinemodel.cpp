@@ -6,14 +6,22 @@
 #include <QJsonDocument>
 
 #include "account/abstractaccount.h"
+#include "config.h"
 #include "editor/attachmenteditormodel.h"
 #include "editor/posteditorbackend.h"
+#include "utils/richtextcache.h"
 
 using namespace Qt::Literals::StringLiterals;
 
 AbstractTimelineModel::AbstractTimelineModel(QObject *parent)
     : QAbstractListModel(parent)
 {
+    connect(&RichTextCache::instance(), &RichTextCache::textReady, this, &AbstractTimelineModel::contentPrepared);
+    connect(&RichTextCache::instance(), &RichTextCache::fontChanged, this, &AbstractTimelineModel::contentInvalidated);
+    // Only the first model to hear about it changes anything
+    connect(Config::self(), &Config::defaultFontChanged, this, [] {
+        RichTextCache::instance().setFont(Config::defaultFont());
+    });
 }
 
 bool AbstractTimelineModel::loading() const
@@ -37,6 +45,7 @@ QHash<int, QByteArray> AbstractTimelineModel::roleNames() const
         {OriginalIdRole, QByteArrayLiteral("originalId")},
         {UrlRole, QByteArrayLiteral("url")},
         {ContentRole, QByteArrayLiteral("content")},
+        {DisplayContentRole, QByteArrayLiteral("displayContent")},
         {SpoilerTextRole, QByteArrayLiteral("spoilerText")},
         {AuthorIdentityRole, QByteArrayLiteral("authorIdentity")},
         {PublishedAtRole, QByteArrayLiteral("publishedAt")},
@@ -90,7 +99,7 @@ QHash<int, QByteArray> AbstractTimelineModel::roleNames() const
     };
 }
 
-QVariant AbstractTimelineModel::postData(Post *post, int role) const
+QVariant AbstractTimelineModel::postData(const QModelIndex &index, Post *post, int role) const
 {
     switch (role) {
     case IdRole:
@@ -101,6 +110,14 @@ QVariant AbstractTimelineModel::postData(Post *post, int role) const
         return post->mentions();
     case ContentRole:
         return post->content();
+    case DisplayContentRole:
+        if (const auto text = RichTextCache::instance().text(post->content(), Config::defaultFont())) {
+            return *text;
+        }
+        if (auto &rows = m_preparingContent[post->content()]; !rows.contains(index)) {
+            rows.push_back(index);
+        }
+        return QString();
     case AuthorIdentityRole:
         return QVariant::fromValue<Identity *>(post->authorIdentity().get());
     case IsBoostedRole:
@@ -183,30 +200,45 @@ QVariant AbstractTimelineModel::postData(Post *post, int role) const
     return {};
 }
 
+void AbstractTimelineModel::contentPrepared(const QString &html)
+{
+    // Rows which were removed in the meantime are invalid now
+    const auto rows = m_preparingContent.take(html);
+    for (const auto &row : rows) {
+        if (row.isValid()) {
+            Q_EMIT dataChanged(row, row, {DisplayContentRole});
+        }
+    }
+}
+
+void AbstractTimelineModel::contentInvalidated()
+{
+    // Whatever was still being prepared was for the old font, and won't be ready anymore
+    m_preparingContent.clear();
+    if (rowCount() > 0) {
+        Q_EMIT dataChanged(index(0), index(rowCount() - 1), {DisplayContentRole});
+    }
+}
+
 void AbstractTimelineModel::actionFavorite(const QModelIndex &index, Post *post)
 {
+    Q_UNUSED(index);
+    // The interaction queue updates the post in every model showing it
     if (!post->favourited()) {
         m_account->favorite(post);
-        post->setFavourited(true);
     } else {
         m_account->unfavorite(post);
-        post->setFavourited(false);
     }
-
-    Q_EMIT dataChanged(index, index, {FavouritedRole});
 }
 
 void AbstractTimelineModel::actionRepeat(const QModelIndex &index, Post *post)
 {
+    Q_UNUSED(index);
     if (!post->reblogged()) {
         m_account->repeat(post);
-        post->setReblogged(true);
     } else {
         m_account->unrepeat(post);
-        post->setReblogged(false);
     }
-
-    Q_EMIT dataChanged(index, index, {RebloggedRole});
 }
 
 void AbstractTimelineModel::actionRedraft(const QModelIndex &index, Post *post, bool isEdit)
@@ -250,28 +282,22 @@ void AbstractTimelineModel::actionRedraft(const QModelIndex &index, Post *post,
 
 void AbstractTimelineModel::actionBookmark(const QModelIndex &index, Post *post)
 {
+    Q_UNUSED(index);
     if (!post->bookmarked()) {
         m_account->bookmark(post);
-        post->setBookmarked(true);
     } else {
         m_account->unbookmark(post);
-        post->setBookmarked(false);
     }
-
-    Q_EMIT dataChanged(index, index, {BookmarkedRole});
 }
 
 void AbstractTimelineModel::actionPin(const QModelIndex &index, Post *post)
 {
+    Q_UNUSED(index);
     if (!post->pinned()) {
         m_account->pin(post);
-        post->setPinned(true);
     } else {
         m_account->unpin(post);
-        post->setPinned(false);
     }
-
-    Q_EMIT dataChanged(index, index, {PinnedRole});
 }
 
 void AbstractTimelineModel::actionDelete(const QModelIndex &index, Post *post)
@@ -282,15 +308,34 @@ void AbstractTimelineModel::actionDelete(const QModelIndex &index, Post *post)
 
 void AbstractTimelineModel::actionMute(const QModelIndex &index, Post *post)
 {
+    Q_UNUSED(index);
     if (!post->muted()) {
         m_account->mute(post);
-        post->setMuted(true);
     } else {
         m_account->unmute(post);
-        post->setMuted(false);
     }
+}
 
-    Q_EMIT dataChanged(index, index, {MutedRole});
+int AbstractTimelineModel::applyInteraction(Post *post, const InteractionQueue::Kind kind, const bool enabled)
+{
+    switch (kind) {
+    case InteractionQueue::Favourite:
+        post->setFavourited(enabled);
+        return FavouritedRole;
+    case InteractionQueue::Reblog:
+        post->setReblogged(enabled);
+        return RebloggedRole;
+    case InteractionQueue::Bookmark:
+        post->setBookmarked(enabled);
+        return BookmarkedRole;
+    case InteractionQueue::Pin:
+        post->setPinned(enabled);
+        return PinnedRole;
+    case InteractionQueue::Mute:
+        post->setMuted(enabled);
+        return MutedRole;
+    }
+    return -1;
 }
 
 #include "moc_abstracttimelinemodel.cpp"
@@ -5,6 +5,9 @@
 
 #include "account/accountmanager.h"
 
+#include <QHash>
+#include <QPointer>
+
 class AbstractAccount;
 class PostEditorBackend;
 
@@ -26,6 +29,7 @@ public:
         OriginalIdRole, /** Original post id (boosted posts generate their own id and live in IdRole) */
         UrlRole, /** Original URL of the post, can be from a different instance. */
         ContentRole, /** Content text of the post. */
+        DisplayContentRole, /** Content of the post prepared for displaying as rich text, which is empty until it's ready. */
         SpoilerTextRole, /** Spoiler label for the post. */
         AuthorIdentityRole, /** Identity of the author. */
         PublishedAtRole, /** Date that the post was published at. */
@@ -167,8 +171,21 @@ Q_SIGNALS:
     void atEndChanged();
 
 protected:
-    QVariant postData(Post *post, int role) const;
+    QVariant postData(const QModelIndex &index, Post *post, int role) const;
+
+    /**
+     * @brief Updates @p post after its @p kind of interaction changed to @p enabled.
+     * @return The role which changed.
+     */
+    static int applyInteraction(Post *post, InteractionQueue::Kind kind, bool enabled);
 
-    AbstractAccount *m_account = nullptr;
+    // Models can outlive the account they show, like when it's removed or on quit
+    QPointer<AbstractAccount> m_account;
     bool m_loading = false;
+
+private:
+    void contentPrepared(const QString &html);
+    void contentInvalidated();
+
+    mutable QHash<QString, QList<QPersistentModelIndex>> m_preparingContent; ///< Rows asked for while RichTextCache was still preparing their content.
 };
@@ -5,6 +5,7 @@
 
 #include "networkcontroller.h"
 #include "texthandler.h"
+#include "utils/startuptrace.h"
 
 #include <KLocalizedString>
 #include <QJsonDocument>
@@ -60,6 +61,7 @@ void MainTimelineModel::setListId(const QString &id)
     m_listId = id;
     Q_EMIT listIdChanged();
 
+    updateStream();
     fillTimeline({});
 }
 
@@ -88,9 +90,22 @@ void MainTimelineModel::setName(const QString &timelineName)
 
     m_timelineName = timelineName;
     Q_EMIT nameChanged();
+    updateStream();
     fillTimeline({});
 }
 
+void MainTimelineModel::updateStream()
+{
+    // Public timelines aren't streamed, as that is a firehose of posts nobody can keep up with
+    if (m_timelineName == QStringLiteral("home")) {
+        setStream(QStringLiteral("user"));
+    } else if (m_timelineName == QStringLiteral("list") && !m_listId.isEmpty()) {
+        setStream(QStringLiteral("list"), m_listId);
+    } else {
+        setStream({});
+    }
+}
+
 void MainTimelineModel::fillTimeline(const QString &fromId, bool backwards)
 {
     static const QSet validTimelines = {QStringLiteral("home"),
@@ -175,82 +190,122 @@ void MainTimelineModel::fillTimeline(const QString &fromId, bool backwards)
     }
     url.setQuery(query);
 
-    m_account->get(
+    // Only the first load is recorded, which is the one that matters for startup
+    const QString traceScope = StartupTrace::scope(m_account);
+    const QString tracePhase = QStringLiteral("%1 timeline").arg(m_timelineName);
+    StartupTrace::instance().begin(traceScope, tracePhase);
+
+    // Posts are inserted while the page is still downloading, except for pages of public timelines above what we have.
+    // Where those go depends on the whole page, see TimelineModel::fetchedTimeline().
+    const bool insertWholePage = publicTimelines.contains(m_timelineName) && backwards;
+
+    struct Page {
+        bool started = false;
+        QJsonArray pending;
+    };
+    const auto page = std::make_shared<Page>();
+
+    m_account->getArray(
         url,
         true,
         this,
-        [this, currentTimelineName = m_timelineName, account = m_account, backwards](QNetworkReply *reply) {
+        [this, currentTimelineName = m_timelineName, account = m_account, backwards, insertWholePage, page, traceScope, tracePhase](
+            const QNetworkReply *reply,
+            const QJsonArray &posts) {
             // This weird m_account != account is to protect against account switches that might happen while loading
             // Ditto for timeline name
             if (m_account != account || m_timelineName != currentTimelineName) {
-                setLoading(false);
                 return;
             }
 
-            // If the reply is empty, do NOT overwrite m_prev/m_next and wipe pagination. That just means the server has nothing more to give us, at the moment.
-            const auto data = reply->readAll();
-            const auto doc = QJsonDocument::fromJson(data);
-            if (doc.array().isEmpty()) {
-                setLoading(false);
+            // Only touch pagination once we know the page isn't empty. An empty page just means the server has nothing more to give us, at
+            // the moment.
+            if (!page->started) {
+                page->started = true;
+                updatePagination(reply, backwards);
+            }
+
+            if (insertWholePage) {
+                for (const auto &post : posts) {
+                    page->pending.push_back(post);
+                }
                 return;
             }
 
-            const auto linkHeader = QString::fromUtf8(reply->rawHeader(QByteArrayLiteral("Link")));
+            StartupTrace::instance().end(traceScope, tracePhase);
+            fetchedTimeline(posts, true);
+        },
+        [this, currentTimelineName = m_timelineName, account = m_account, page, traceScope, tracePhase](QNetworkReply *) {
+            StartupTrace::instance().end(traceScope, tracePhase);
 
-            // If we're going backwards we do NOT want to overwrite m_next if it exists.
-            // Otherwise pagination breaks and the user can't load anything further in their timeline.
-            if (!backwards || !m_next) {
-                m_next = TextHandler::getNextLink(linkHeader);
-            }
-            // Load m_prev initially, then make sure never to overwrite it if we're loading new stuff
-            if (backwards || !m_prev) {
-                m_prev = TextHandler::getPrevLink(linkHeader);
+            if (m_account != account || m_timelineName != currentTimelineName) {
+                setLoading(false);
+                return;
             }
-            Q_EMIT atEndChanged();
 
-            if (publicTimelines.contains(m_timelineName) && backwards) {
-                int const pos = fetchedTimeline(data);
+            if (!page->pending.isEmpty()) {
+                int const pos = fetchedTimeline(page->pending);
                 Q_EMIT repositionAt(pos);
-            } else {
-                fetchedTimeline(data, true);
             }
 
-            // hasPrevious depends not just on m_prev, but also m_timeline!
-            Q_EMIT hasPreviousChanged();
+            if (page->started) {
+                // hasPrevious depends not just on m_prev, but also m_timeline!
+                Q_EMIT hasPreviousChanged();
+            }
 
             setLoading(false);
         },
-        [this](const QNetworkReply *reply) {
+        [this, traceScope, tracePhase](const QNetworkReply *reply) {
+            StartupTrace::instance().end(traceScope, tracePhase);
             setLoading(false);
             Q_EMIT networkErrorOccurred(reply->errorString());
         });
 }
 
+void MainTimelineModel::updatePagination(const QNetworkReply *reply, const bool backwards)
+{
+    const auto linkHeader = QString::fromUtf8(reply->rawHeader(QByteArrayLiteral("Link")));
+
+    // If we're going backwards we do NOT want to overwrite m_next if it exists.
+    // Otherwise pagination breaks and the user can't load anything further in their timeline.
+    if (!backwards || !m_next) {
+        m_next = TextHandler::getNextLink(linkHeader);
+    }
+    // Load m_prev initially, then make sure never to overwrite it if we're loading new stuff
+    if (backwards || !m_prev) {
+        m_prev = TextHandler::getPrevLink(linkHeader);
+    }
+    Q_EMIT atEndChanged();
+}
+
 void MainTimelineModel::handleEvent(AbstractAccount::StreamingEventType eventType, const QByteArray &payload)
 {
     // Don't add streamed posts if we still have unread ones to go through
     if (!hasPrevious()) {
         TimelineModel::handleEvent(eventType, payload);
-        if (eventType == AbstractAccount::StreamingEventType::UpdateEvent && m_timelineName == QStringLiteral("home")) {
-            const auto doc = QJsonDocument::fromJson(payload);
-            const auto post = new Post(m_account, doc.object(), this);
-
-            // Make sure we aren't adding the same post we already have
-            const auto it = std::ranges::find_if(std::as_const(m_timeline), [post](const auto &timelinePost) {
-                return post->postId() == timelinePost->postId();
-            });
-            if (it == m_timeline.cend()) {
-                beginInsertRows({}, 0, 0);
-                m_timeline.push_front(post);
-                endInsertRows();
+        if (eventType == AbstractAccount::StreamingEventType::UpdateEvent) {
+            if (const auto post = insertStreamedPost(payload)) {
                 Q_EMIT streamedPostAdded(post->originalPostId());
-            } else {
-                delete post;
             }
         }
     }
 }
 
+void MainTimelineModel::backfill()
+{
+    const bool isHome = m_timelineName == QStringLiteral("home");
+    const bool isList = m_timelineName == QStringLiteral("list") && !m_listId.isEmpty();
+
+    // Only streamed timelines can miss posts, and unread posts above are paginated to anyway
+    if (!m_account || m_timeline.isEmpty() || hasPrevious() || !(isHome || isList)) {
+        return;
+    }
+
+    const QUrl url = isHome ? m_account->apiUrl(QStringLiteral("/api/v1/timelines/home"))
+                            : m_account->apiUrl(QStringLiteral("/api/v1/timelines/list/%1").arg(m_listId));
+    fetchNewerPosts(url, m_timeline.first()->postId());
+}
+
 bool MainTimelineModel::atEnd() const
 {
     // Trending doesnt have pagination
@@ -299,6 +354,7 @@ void MainTimelineModel::fetchLastReadId()
             const auto doc = QJsonDocument::fromJson(reply->readAll());
 
             m_lastReadId = doc.object()[QLatin1String("home")].toObject()[QLatin1String("last_read_id")].toString();
+            m_account->markerSync()->setKnownLastRead(QStringLiteral("home"), m_lastReadId);
             if (m_initialLastReadId.isEmpty()) {
                 m_initialLastReadId = m_lastReadId;
             }
@@ -63,6 +63,7 @@ public:
     [[nodiscard]] bool userHasTakenReadAction() const;
 
     void reset() override;
+    void backfill() override;
     bool loading() const override;
     bool atEnd() const override;
 
@@ -89,6 +90,8 @@ private:
     bool fetchedLastId = false;
 
     void fetchLastReadId();
+    void updateStream();
+    void updatePagination(const QNetworkReply *reply, bool backwards);
     QDateTime m_lastReadTime;
     bool m_userHasTakenReadAction = false;
 };
@@ -12,7 +12,7 @@ using namespace Qt::Literals::StringLiterals;
 
 Poll::Poll() = default;
 
-Poll::Poll(const QJsonObject &json)
+Poll::Poll(const QJsonObject &json, CustomEmojiCache *emojiCache)
 {
     m_id = json[QStringLiteral("id")].toString();
     m_expiresAt = QDateTime::fromString(json[QStringLiteral("expires_at")].toString(), Qt::ISODate);
@@ -26,7 +26,7 @@ Poll::Poll(const QJsonObject &json)
         return value.toInt();
     });
 
-    const auto emojis = CustomEmoji::parseCustomEmojis(json[QStringLiteral("emojis")].toArray());
+    const auto emojis = CustomEmoji::parseCustomEmojiUrls(json[QStringLiteral("emojis")].toArray(), emojiCache);
 
     const auto options = json[QStringLiteral("options")].toArray();
     std::ranges::transform(std::as_const(options), std::back_inserter(m_options), [emojis](const QJsonValue &value) -> QVariantMap {
@@ -5,6 +5,8 @@
 
 #include <QQmlEngine>
 
+class CustomEmojiCache;
+
 class Poll
 {
     Q_GADGET
@@ -21,7 +23,10 @@ class Poll
 
 public:
     Poll();
-    explicit Poll(const QJsonObject &json);
+    /**
+     * @param emojiCache The custom emoji of the account, which those in the options are looked up in and added to.
+     */
+    explicit Poll(const QJsonObject &json, CustomEmojiCache *emojiCache = nullptr);
 
     [[nodiscard]] QString id() const;
     [[nodiscard]] QDateTime expiresAt() const;
@@ -186,7 +186,7 @@ void Post::fromJson(QJsonObject obj)
     }
 
     if (obj.contains(QStringLiteral("poll")) && !obj[QStringLiteral("poll")].isNull()) {
-        m_poll = std::make_unique<Poll>(obj[QStringLiteral("poll")].toObject());
+        m_poll = std::make_unique<Poll>(obj[QStringLiteral("poll")].toObject(), &m_parent->customEmojiCache());
     }
 }
 
@@ -225,6 +225,14 @@ QString Post::content() const
     return m_content;
 }
 
+QString Post::plainContent() const
+{
+    if (!m_plainContent) {
+        m_plainContent = TextHandler::stripHtml(m_content);
+    }
+    return *m_plainContent;
+}
+
 bool Post::hasContent() const
 {
     return m_hasContent;
@@ -302,7 +310,7 @@ Poll *Post::poll() const
 
 void Post::setPollJson(const QJsonObject &object)
 {
-    m_poll = std::make_unique<Poll>(object);
+    m_poll = std::make_unique<Poll>(object, &m_parent->customEmojiCache());
     Q_EMIT pollChanged();
 }
 
@@ -457,7 +465,7 @@ void Post::processContent(const QJsonObject &obj)
     const QString originalHtml = obj["content"_L1].toString();
 
     // First, replace custom emojis with their HTML representations
-    const auto emojis = CustomEmoji::parseCustomEmojis(obj["emojis"_L1].toArray());
+    const auto emojis = CustomEmoji::parseCustomEmojiUrls(obj["emojis"_L1].toArray(), &m_parent->customEmojiCache());
     QString processedHtml = TextHandler::replaceCustomEmojis(emojis, originalHtml);
 
     // Then turn hashtags into proper links, so they link inside Tokodon
@@ -506,6 +514,7 @@ void Post::processContent(const QJsonObject &obj)
 
     m_hasContent = !standaloneContent.isEmpty();
     m_content = standaloneContent;
+    m_plainContent.reset();
 }
 
 Card::Card(AbstractAccount *account, QJsonObject card)
@@ -168,6 +168,12 @@ public:
      */
     [[nodiscard]] QString content() const;
 
+    /**
+     * @return The text of this post without any HTML, for previews and notifications.
+     * @see TextHandler::stripHtml()
+     */
+    [[nodiscard]] QString plainContent() const;
+
     /**
      * @return If the post has any text content.
      * @note Use this instead of checking the length of content() because it could contain useless HTML code.
@@ -394,6 +400,7 @@ private:
     QString m_originalPostId;
     QUrl m_url;
     QString m_content;
+    mutable std::optional<QString> m_plainContent; ///< Only converted the first time it's needed.
     bool m_hasContent;
     QString m_spoilerText;
     QString m_author;
@@ -32,6 +32,11 @@ void TagsTimelineModel::setHashtag(const QString &hashtag)
     }
     m_hashtag = hashtag;
     Q_EMIT hashtagChanged();
+    if (m_hashtag.isEmpty()) {
+        setStream({});
+    } else {
+        setStream(QStringLiteral("hashtag"), m_hashtag);
+    }
     fillTimeline({});
 }
 
@@ -58,6 +63,25 @@ QString TagsTimelineModel::displayName() const
     return QLatin1Char('#') + m_hashtag;
 }
 
+void TagsTimelineModel::handleEvent(AbstractAccount::StreamingEventType eventType, const QByteArray &payload)
+{
+    TimelineModel::handleEvent(eventType, payload);
+    if (eventType == AbstractAccount::StreamingEventType::UpdateEvent) {
+        if (const auto post = insertStreamedPost(payload)) {
+            Q_EMIT streamedPostAdded(post->originalPostId());
+        }
+    }
+}
+
+void TagsTimelineModel::backfill()
+{
+    if (!m_account || m_hashtag.isEmpty() || m_timeline.isEmpty()) {
+        return;
+    }
+
+    fetchNewerPosts(m_account->apiUrl(QStringLiteral("/api/v1/timelines/tag/%1").arg(m_hashtag)), m_timeline.first()->postId());
+}
+
 bool TagsTimelineModel::canFetchMore(const QModelIndex &parent) const
 {
     Q_UNUSED(parent)
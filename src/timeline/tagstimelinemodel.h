@@ -38,6 +38,8 @@ public:
     void setHashtag(const QString &hashtag);
 
     void reset() override;
+    void handleEvent(AbstractAccount::StreamingEventType eventType, const QByteArray &payload) override;
+    void backfill() override;
 
     /**
      * @return If the current account is following this hashtag.
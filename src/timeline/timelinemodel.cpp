@@ -4,15 +4,62 @@
 
 #include "timeline/timelinemodel.h"
 
+#include "config.h"
+#include "network/mediaprefetcher.h"
+#include "network/streamingclient.h"
+#include "utils/imagecache.h"
+
 #include <QJsonDocument>
 #include <QNetworkReply>
+#include <QUrlQuery>
+
+#include <cmath>
 
 using namespace Qt::Literals::StringLiterals;
 
+namespace
+{
+// How many posts past the visible ones to prefetch images for
+constexpr int prefetchRows = 10;
+
+// Post ids are numbers too large for an integer, but a longer one is always newer
+bool isNewer(const QString &id, const QString &other)
+{
+    return id.size() != other.size() ? id.size() > other.size() : id > other;
+}
+
+// The size AttachmentGrid gives to the attachments of a post in a timeline, where posts aren't expanded
+QSizeF attachmentGridSize(const QList<Attachment *> &attachments, const qreal width)
+{
+    if (!Config::cropMedia() && attachments.size() == 1) {
+        const auto attachment = attachments.first();
+        const qreal aspectRatio = attachment->m_sourceHeight == 0 ? 1.0 : attachment->m_sourceHeight / static_cast<qreal>(std::max(attachment->m_sourceWidth, 1));
+        return {width, std::ceil(width * aspectRatio)};
+    }
+    return {width, std::ceil(width * 9.0 / 16.0)};
+}
+}
+
 TimelineModel::TimelineModel(QObject *parent)
     : AbstractTimelineModel(parent)
     , m_manager(&AccountManager::instance())
 {
+    // What was ahead before doesn't say anything about the new posts
+    connect(this, &TimelineModel::modelAboutToBeReset, this, &TimelineModel::cancelPrefetch);
+    connect(this, &TimelineModel::modelAboutToBeReset, this, [this] {
+        m_generation++;
+    });
+}
+
+TimelineModel::~TimelineModel()
+{
+    if (!m_account) {
+        return;
+    }
+    m_account->mediaPrefetcher()->cancel(this);
+    if (!m_stream.isEmpty()) {
+        m_account->unsubscribeFromStream(m_stream, m_streamParameter);
+    }
 }
 
 void TimelineModel::init()
@@ -21,7 +68,7 @@ void TimelineModel::init()
     m_account = m_manager->selectedAccount();
 
     if (m_account) {
-        connect(m_account, &AbstractAccount::streamingEvent, this, &TimelineModel::handleEvent);
+        connectAccount();
     }
 
     connect(this, &TimelineModel::showBoostsChanged, this, [this] {
@@ -39,12 +86,12 @@ void TimelineModel::init()
         }
 
         if (m_account) {
-            disconnect(m_account, &AbstractAccount::streamingEvent, this, &TimelineModel::handleEvent);
+            disconnectAccount();
         }
 
         m_account = account;
 
-        connect(m_account, &AbstractAccount::streamingEvent, this, &TimelineModel::handleEvent);
+        connectAccount();
 
         reset();
 
@@ -59,20 +106,57 @@ void TimelineModel::init()
 
 int TimelineModel::fetchedTimeline(const QByteArray &data, bool alwaysAppendToEnd)
 {
-    QList<Post *> posts;
-
     const auto doc = QJsonDocument::fromJson(data);
 
     if (!doc.isArray()) {
         return 0;
     }
 
-    const auto array = doc.array();
+    return fetchedTimeline(doc.array(), alwaysAppendToEnd);
+}
+
+int TimelineModel::fetchedTimeline(const QJsonArray &array, bool alwaysAppendToEnd)
+{
+    const QList<Post *> posts = newPosts(array);
 
-    if (array.isEmpty()) {
+    // If we ended up removing all of the posts we were going to add, quit
+    if (posts.empty()) {
         return 0;
     }
 
+    if (!m_timeline.isEmpty()) {
+        if (alwaysAppendToEnd) {
+            beginInsertRows({}, m_timeline.size(), m_timeline.size() + posts.size() - 1);
+            m_timeline += posts;
+            endInsertRows();
+        } else {
+            const auto postOld = m_timeline.first();
+            const auto postNew = posts.first();
+            if (postOld->originalPostId() > postNew->originalPostId()) {
+                const int row = m_timeline.size();
+                const int last = row + posts.size() - 1;
+                beginInsertRows({}, row, last);
+                m_timeline += posts;
+                endInsertRows();
+            } else {
+                beginInsertRows({}, 0, posts.size() - 1);
+                m_timeline = posts + m_timeline;
+                endInsertRows();
+            }
+        }
+    } else {
+        beginInsertRows({}, 0, posts.size() - 1);
+        m_timeline = posts;
+        endInsertRows();
+    }
+
+    return posts.size();
+}
+
+QList<Post *> TimelineModel::newPosts(const QJsonArray &array)
+{
+    QList<Post *> posts;
+
     std::ranges::transform(std::as_const(array), std::back_inserter(posts), [this](const QJsonValue &value) -> Post * {
         auto post = new Post(m_account, value.toObject(), this);
         if (!post->hidden()) {
@@ -105,11 +189,6 @@ int TimelineModel::fetchedTimeline(const QByteArray &data, bool alwaysAppendToEn
                     .begin(),
                 posts.end());
 
-    // If we ended up removing all of the posts we were going to add, quit
-    if (posts.empty()) {
-        return 0;
-    }
-
     for (auto &post : posts) {
         // If we are still waiting on the reply identity, make sure to update it's row
         if (!post->inReplyTo().isEmpty() && post->replyIdentity() == nullptr) {
@@ -127,33 +206,7 @@ int TimelineModel::fetchedTimeline(const QByteArray &data, bool alwaysAppendToEn
         }
     }
 
-    if (!m_timeline.isEmpty()) {
-        if (alwaysAppendToEnd) {
-            beginInsertRows({}, m_timeline.size(), m_timeline.size() + posts.size() - 1);
-            m_timeline += posts;
-            endInsertRows();
-        } else {
-            const auto postOld = m_timeline.first();
-            const auto postNew = posts.first();
-            if (postOld->originalPostId() > postNew->originalPostId()) {
-                const int row = m_timeline.size();
-                const int last = row + posts.size() - 1;
-                beginInsertRows({}, row, last);
-                m_timeline += posts;
-                endInsertRows();
-            } else {
-                beginInsertRows({}, 0, posts.size() - 1);
-                m_timeline = posts + m_timeline;
-                endInsertRows();
-            }
-        }
-    } else {
-        beginInsertRows({}, 0, posts.size() - 1);
-        m_timeline = posts;
-        endInsertRows();
-    }
-
-    return posts.size();
+    return posts;
 }
 
 void TimelineModel::fetchMore(const QModelIndex &parent)
@@ -178,6 +231,59 @@ void TimelineModel::setShouldLoadMore(bool shouldLoadMore)
     m_shouldLoadMore = shouldLoadMore;
 }
 
+void TimelineModel::prefetch(const int firstVisible, const int lastVisible, const qreal gridWidth, const qreal devicePixelRatio)
+{
+    if (!m_account || firstVisible < 0 || lastVisible < firstVisible || m_timeline.isEmpty()) {
+        return;
+    }
+
+    // Only a change of direction invalidates what's being prefetched, just scrolling further updates it
+    if (m_lastFirstVisible != -1 && firstVisible != m_lastFirstVisible) {
+        const bool scrollingDown = firstVisible > m_lastFirstVisible;
+        if (scrollingDown != m_scrollingDown) {
+            m_scrollingDown = scrollingDown;
+            m_account->mediaPrefetcher()->cancel(this);
+        }
+    }
+    m_lastFirstVisible = firstVisible;
+
+    QList<MediaPrefetcher::Item> items;
+    const auto addPost = [&items, gridWidth, devicePixelRatio](const Post *post) {
+        const auto attachments = post->attachments();
+        const QSizeF gridSize = attachmentGridSize(attachments, gridWidth);
+        for (int i = 0; i < attachments.size(); i++) {
+            const auto attachment = attachments[i];
+            // The size AttachmentGrid asks for, so it finds it in ImageCache
+            const QSize size = ImageCache::attachmentSize(gridSize, static_cast<int>(attachments.size()), i, devicePixelRatio);
+            items.push_back({.url = QUrl(attachment->m_preview_url), .decode = attachment->m_type == Attachment::Image && size.isValid(), .size = size});
+        }
+        if (const auto identity = post->authorIdentity()) {
+            items.push_back({.url = identity->avatarUrl()});
+        }
+        if (const auto card = post->card(); card && !card->image().isEmpty()) {
+            items.push_back({.url = QUrl(card->image())});
+        }
+    };
+
+    // Nearest first, so what's shown next is there first
+    const int step = m_scrollingDown ? 1 : -1;
+    int row = m_scrollingDown ? lastVisible + 1 : firstVisible - 1;
+    for (int i = 0; i < prefetchRows && row >= 0 && row < m_timeline.size(); i++, row += step) {
+        addPost(m_timeline[row]);
+    }
+
+    m_account->mediaPrefetcher()->prefetch(items, this);
+}
+
+void TimelineModel::cancelPrefetch()
+{
+    m_lastFirstVisible = -1;
+    m_scrollingDown = true;
+    if (m_account) {
+        m_account->mediaPrefetcher()->cancel(this);
+    }
+}
+
 bool TimelineModel::canFetchMore(const QModelIndex &parent) const
 {
     Q_UNUSED(parent);
@@ -198,7 +304,7 @@ QVariant TimelineModel::data(const QModelIndex &index, int role) const
     if (role == TypeRole) {
         return false;
     }
-    return postData(m_timeline[index.row()], role);
+    return postData(index, m_timeline[index.row()], role);
 }
 
 void TimelineModel::actionReply(const QModelIndex &index)
@@ -297,6 +403,137 @@ void TimelineModel::actionMute(const QModelIndex &index)
     AbstractTimelineModel::actionMute(index, p);
 }
 
+void TimelineModel::setStream(const QString &stream, const QString &parameter)
+{
+    if (m_stream == stream && m_streamParameter == parameter) {
+        return;
+    }
+
+    if (m_account && !m_stream.isEmpty()) {
+        m_account->unsubscribeFromStream(m_stream, m_streamParameter);
+    }
+
+    m_stream = stream;
+    m_streamParameter = parameter;
+
+    if (m_account && !m_stream.isEmpty()) {
+        m_account->subscribeToStream(m_stream, m_streamParameter);
+    }
+}
+
+void TimelineModel::backfill()
+{
+}
+
+void TimelineModel::fetchNewerPosts(const QUrl &url, const QString &minId)
+{
+    // since_id would only return the newest page, and drop everything between it and minId
+    QUrl pageUrl = url;
+    QUrlQuery query(url);
+    query.addQueryItem(QStringLiteral("min_id"), minId);
+    pageUrl.setQuery(query);
+
+    m_account->get(pageUrl, true, this, [this, url, account = m_account, generation = m_generation](QNetworkReply *reply) {
+        if (m_account != account || m_generation != generation) {
+            return;
+        }
+
+        const auto array = QJsonDocument::fromJson(reply->readAll()).array();
+        if (array.isEmpty()) {
+            return;
+        }
+
+        // The page right after minId, but still with the newest post first
+        const QString newestId = array.first().toObject()["id"_L1].toString();
+
+        const QList<Post *> posts = newPosts(array);
+        if (!posts.isEmpty()) {
+            const auto it = std::ranges::find_if(std::as_const(m_timeline), [&newestId](const Post *post) {
+                return isNewer(newestId, post->postId());
+            });
+            const int row = static_cast<int>(it - m_timeline.cbegin());
+
+            beginInsertRows({}, row, row + posts.size() - 1);
+            m_timeline = m_timeline.first(row) + posts + m_timeline.sliced(row);
+            endInsertRows();
+        }
+
+        fetchNewerPosts(url, newestId);
+    });
+}
+
+Post *TimelineModel::insertStreamedPost(const QByteArray &payload)
+{
+    const auto doc = QJsonDocument::fromJson(payload);
+    const auto post = new Post(m_account, doc.object(), this);
+
+    // Make sure we aren't adding the same post we already have
+    const auto it = std::ranges::find_if(std::as_const(m_timeline), [post](const auto &timelinePost) {
+        return post->postId() == timelinePost->postId();
+    });
+    if (it != m_timeline.cend()) {
+        delete post;
+        return nullptr;
+    }
+
+    beginInsertRows({}, 0, 0);
+    m_timeline.push_front(post);
+    endInsertRows();
+
+    return post;
+}
+
+void TimelineModel::connectAccount()
+{
+    connect(m_account, &AbstractAccount::streamingEvent, this, &TimelineModel::handleUserStreamEvent);
+    connect(m_account, &AbstractAccount::streamEvent, this, &TimelineModel::handleStreamEvent);
+    connect(m_account, &AbstractAccount::streamReconnected, this, &TimelineModel::backfill);
+    connect(m_account->interactionQueue(), &InteractionQueue::interactionChanged, this, &TimelineModel::handleInteraction);
+
+    if (!m_stream.isEmpty()) {
+        m_account->subscribeToStream(m_stream, m_streamParameter);
+    }
+}
+
+void TimelineModel::disconnectAccount()
+{
+    disconnect(m_account, &AbstractAccount::streamingEvent, this, &TimelineModel::handleUserStreamEvent);
+    disconnect(m_account, &AbstractAccount::streamEvent, this, &TimelineModel::handleStreamEvent);
+    disconnect(m_account, &AbstractAccount::streamReconnected, this, &TimelineModel::backfill);
+    disconnect(m_account->interactionQueue(), &InteractionQueue::interactionChanged, this, &TimelineModel::handleInteraction);
+    m_account->mediaPrefetcher()->cancel(this);
+
+    if (!m_stream.isEmpty()) {
+        m_account->unsubscribeFromStream(m_stream, m_streamParameter);
+    }
+}
+
+void TimelineModel::handleInteraction(const QString &postId, const InteractionQueue::Kind kind, const bool enabled)
+{
+    // The same post can be in this timeline more than once, for example boosted by several people
+    for (qsizetype row = 0; row < m_timeline.size(); row++) {
+        if (m_timeline[row]->postId() == postId) {
+            const int role = applyInteraction(m_timeline[row], kind, enabled);
+            Q_EMIT dataChanged(index(row, 0), index(row, 0), {role});
+        }
+    }
+}
+
+void TimelineModel::handleUserStreamEvent(AbstractAccount::StreamingEventType eventType, const QByteArray &payload)
+{
+    handleStreamEvent(QStringLiteral("user"), eventType, payload);
+}
+
+void TimelineModel::handleStreamEvent(const QString &streamKey, AbstractAccount::StreamingEventType eventType, const QByteArray &payload)
+{
+    if (!m_stream.isEmpty() && streamKey == StreamingClient::streamKey(m_stream, m_streamParameter)) {
+        handleEvent(eventType, payload);
+    } else if (streamKey == "user"_L1) {
+        // Deletions on the user stream still apply to whatever timeline is open
+        TimelineModel::handleEvent(eventType, payload);
+    }
+}
+
 void TimelineModel::handleEvent(AbstractAccount::StreamingEventType eventType, const QByteArray &payload)
 {
     if (eventType == AbstractAccount::StreamingEventType::DeleteEvent) {
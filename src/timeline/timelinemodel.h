@@ -22,6 +22,7 @@ class TimelineModel : public AbstractTimelineModel
 
 public:
     explicit TimelineModel(QObject *parent = nullptr);
+    ~TimelineModel() override;
 
     [[nodiscard]] int rowCount(const QModelIndex &parent) const override;
     [[nodiscard]] QVariant data(const QModelIndex &index, int role) const override;
@@ -48,6 +49,20 @@ public:
 
     void setShouldLoadMore(bool shouldLoadMore);
 
+    /**
+     * @brief Prefetches the images of the posts after the visible ones, in the direction the timeline is scrolled in.
+     * @param firstVisible The first visible row.
+     * @param lastVisible The last visible row.
+     * @param gridWidth The width of the attachment grids, to decode images at the size they're shown at.
+     * @param devicePixelRatio The device pixel ratio of the screen the timeline is on.
+     */
+    Q_INVOKABLE void prefetch(int firstVisible, int lastVisible, qreal gridWidth = 0, qreal devicePixelRatio = 1);
+
+    /**
+     * @brief Stops prefetching, for example because the timeline isn't shown anymore.
+     */
+    Q_INVOKABLE void cancelPrefetch();
+
 public Q_SLOTS:
     /**
      * @brief Reply to the post at @p index.
@@ -125,6 +140,40 @@ protected:
      */
     int fetchedTimeline(const QByteArray &array, bool alwaysAppendToEnd = false);
 
+    /**
+     * @brief Adds the already parsed posts of @p array, which may be a partial page.
+     * @return The number of posts added to the timeline.
+     */
+    int fetchedTimeline(const QJsonArray &array, bool alwaysAppendToEnd = false);
+
+    /**
+     * @brief Sets the stream this timeline receives live updates from, or none if @p stream is empty.
+     * @param stream The stream name (e.g. user, list or hashtag).
+     * @param parameter The list id or hashtag for streams which need one, otherwise empty.
+     */
+    void setStream(const QString &stream, const QString &parameter = {});
+
+    /**
+     * @brief Fetches the posts which were missed while the streaming connection was down, and merges them into the timeline.
+     *
+     * Does nothing by default.
+     * @see fetchNewerPosts()
+     */
+    virtual void backfill();
+
+    /**
+     * @brief Fetches every post newer than @p minId from the timeline at @p url, a page at a time until there are none left.
+     *
+     * The pages are inserted above the posts they're newer than, which keeps anything streamed in the meantime on top.
+     */
+    void fetchNewerPosts(const QUrl &url, const QString &minId);
+
+    /**
+     * @brief Adds the post in @p payload to the top of the timeline, unless it's already in it.
+     * @return The added post, or nullptr if it was a duplicate.
+     */
+    Post *insertStreamedPost(const QByteArray &payload);
+
     AccountManager *m_manager = nullptr;
 
     QList<Post *> m_timeline;
@@ -133,4 +182,25 @@ protected:
     bool m_showReplies = true;
     bool m_showBoosts = true;
     friend class TimelineTest;
+
+private:
+    void connectAccount();
+    void disconnectAccount();
+    void handleUserStreamEvent(AbstractAccount::StreamingEventType eventType, const QByteArray &payload);
+    void handleStreamEvent(const QString &streamKey, AbstractAccount::StreamingEventType eventType, const QByteArray &payload);
+    void handleInteraction(const QString &postId, InteractionQueue::Kind kind, bool enabled);
+
+    /**
+     * @return The posts of @p array which should be shown and aren't in the timeline yet.
+     */
+    QList<Post *> newPosts(const QJsonArray &array);
+
+    QString m_stream;
+    QString m_streamParameter;
+
+    // Pages fetched for a timeline that was reset since are dropped
+    int m_generation = 0;
+
+    int m_lastFirstVisible = -1;
+    bool m_scrollingDown = true;
 };
@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: MIT
+
+#include "utils/asyncimageresponse.h"
+
+#include <QQuickTextureFactory>
+
+AsyncImageResponse::AsyncImageResponse(const QImage &image)
+    : m_image(image)
+{
+    // Whoever asked needs to connect to finished() first
+    QMetaObject::invokeMethod(this, &AsyncImageResponse::finished, Qt::QueuedConnection);
+}
+
+AsyncImageResponse::AsyncImageResponse(PendingImage *pending)
+{
+    connect(pending, &PendingImage::done, this, [this](const QImage &image) {
+        handleDone(image);
+    });
+}
+
+void AsyncImageResponse::handleDone(const QImage &image, const QString &errorString)
+{
+    m_image = image;
+    m_errorString = errorString;
+    Q_EMIT finished();
+}
+
+QQuickTextureFactory *AsyncImageResponse::textureFactory() const
+{
+    // QImage is implicitly shared and decoded images are already in a format Qt Quick takes as is, so this uses the pixels of the cache
+    return QQuickTextureFactory::textureFactoryForImage(m_image);
+}
+
+QString AsyncImageResponse::errorString() const
+{
+    return m_errorString;
+}
+
+#include "moc_asyncimageresponse.cpp"
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QImage>
+#include <QQuickImageResponse>
+
+/**
+ * @brief An image being downloaded or decoded, which every response waiting for it listens to.
+ *
+ * It lives in the thread which owns the cache, and emits done() from wherever the image is ready.
+ */
+class PendingImage : public QObject
+{
+    Q_OBJECT
+
+Q_SIGNALS:
+    void done(const QImage &image);
+};
+
+/**
+ * @brief The response of an image provider which loads its images in the background and caches them.
+ */
+class AsyncImageResponse final : public QQuickImageResponse
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief A response which is done once handleDone() is called.
+     */
+    AsyncImageResponse() = default;
+
+    /**
+     * @brief A response which is already done, with an @p image from the cache.
+     */
+    explicit AsyncImageResponse(const QImage &image);
+
+    /**
+     * @brief A response which is done once @p pending is.
+     */
+    explicit AsyncImageResponse(PendingImage *pending);
+
+    /**
+     * @brief Finishes with @p image, or fails with @p errorString if it isn't empty.
+     */
+    void handleDone(const QImage &image, const QString &errorString = {});
+
+    [[nodiscard]] QQuickTextureFactory *textureFactory() const override;
+    [[nodiscard]] QString errorString() const override;
+
+private:
+    QImage m_image;
+    QString m_errorString;
+};
@@ -5,21 +5,65 @@
 
 #include <QColorSpace>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string_view>
+
+namespace
+{
 // From https://github.com/woltapp/blurhash/blob/master/Algorithm.md#base-83
-const static QString b83Characters{QStringLiteral("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz#$%*+,-.:;=?@[]^_{|}~")};
+constexpr std::string_view b83Characters{"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz#$%*+,-.:;=?@[]^_{|}~"};
+
+// Maps ASCII to the value of the base 83 digit, or -1 if it isn't one
+constexpr auto b83Values = [] {
+    std::array<qint8, 128> values{};
+    values.fill(-1);
+    for (size_t i = 0; i < b83Characters.size(); i++) {
+        values[static_cast<unsigned char>(b83Characters[i])] = static_cast<qint8>(i);
+    }
+    return values;
+}();
+
+// Indexed by an 8-bit sRGB channel
+const auto toLinearSRGB = [] {
+    std::array<float, 256> values{};
+    for (size_t i = 0; i < values.size(); i++) {
+        const float value = static_cast<float>(i) / 255.0f;
+        values[i] = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+    }
+    return values;
+}();
+
+// Fine enough that neighbouring entries are never more than one 8-bit step apart, even in the dark end where the curve is steepest
+constexpr int fromLinearSteps = 4096;
+const auto fromLinearSRGB = [] {
+    std::array<uchar, fromLinearSteps> values{};
+    for (size_t i = 0; i < values.size(); i++) {
+        const float value = static_cast<float>(i) / (fromLinearSteps - 1);
+        const float srgb = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+        values[i] = static_cast<uchar>(std::lround(srgb * 255.0f));
+    }
+    return values;
+}();
 
-const static auto toLinearSRGB = QColorSpace(QColorSpace::SRgb).transformationToColorSpace(QColorSpace::SRgbLinear);
-const static auto fromLinearSRGB = QColorSpace(QColorSpace::SRgbLinear).transformationToColorSpace(QColorSpace::SRgb);
+uchar linearToSRGB(const float value)
+{
+    return fromLinearSRGB[static_cast<size_t>(std::clamp(value, 0.0f, 1.0f) * (fromLinearSteps - 1) + 0.5f)];
+}
+}
 
 QImage BlurHash::decode(const QString &blurhash, const QSize &size)
 {
     // 10 is the minimum length of a blurhash string
-    if (blurhash.length() < 10) {
+    if (blurhash.length() < 10 || size.isEmpty()) {
         return {};
     }
 
+    const QStringView hash(blurhash);
+
     // First character is the number of components
-    const auto components83 = decode83(blurhash.first(1));
+    const auto components83 = decode83(hash.first(1));
     if (!components83.has_value()) {
         return {};
     }
@@ -31,7 +75,7 @@ QImage BlurHash::decode(const QString &blurhash, const QSize &size)
     }
 
     // Second character is the maximum AC component value
-    const auto maxAC83 = decode83(blurhash.mid(1, 1));
+    const auto maxAC83 = decode83(hash.sliced(1, 1));
     if (!maxAC83.has_value()) {
         return {};
     }
@@ -39,20 +83,21 @@ QImage BlurHash::decode(const QString &blurhash, const QSize &size)
     const auto maxAC = decodeMaxAC(*maxAC83);
 
     // Third character onward is the average color of the image
-    const auto averageColor83 = decode83(blurhash.mid(2, 4));
+    const auto averageColor83 = decode83(hash.sliced(2, 4));
     if (!averageColor83.has_value()) {
         return {};
     }
 
-    const auto averageColor = toLinearSRGB.map(decodeAverageColor(*averageColor83));
+    const auto averageColor = decodeAverageColor(*averageColor83);
 
-    std::vector<ColorF> values = {ColorF{.r = averageColor.redF(), .g = averageColor.greenF(), .b = averageColor.blueF()}};
-    values.reserve(blurhash.size() - 7);
+    std::vector<ColorF> values = {
+        ColorF{.r = toLinearSRGB[averageColor.red()], .g = toLinearSRGB[averageColor.green()], .b = toLinearSRGB[averageColor.blue()]}};
+    values.reserve(components.x * components.y);
 
     // Iterate through the rest of the string for the color values
     // Each AC component is two characters each
     for (qsizetype c = 6; c < blurhash.size(); c += 2) {
-        const auto acComponent83 = decode83(blurhash.mid(c, 2));
+        const auto acComponent83 = decode83(hash.sliced(c, 2));
         if (!acComponent83.has_value()) {
             return {};
         }
@@ -60,47 +105,76 @@ QImage BlurHash::decode(const QString &blurhash, const QSize &size)
         values.push_back(decodeAC(*acComponent83, maxAC));
     }
 
-    QImage image(size, QImage::Format_RGB888);
-    image.setColorSpace(QColorSpace::SRgb);
-
-    const auto basisX = calculateWeights(size.width(), components.x);
-    const auto basisY = calculateWeights(size.height(), components.y);
-
-    for (int y = 0; y < size.height(); y++) {
-        for (int x = 0; x < size.width(); x++) {
-            float linearSumR = 0.0f;
-            float linearSumG = 0.0f;
-            float linearSumB = 0.0f;
+    const int width = size.width();
+    const int height = size.height();
+    const auto basisX = calculateWeights(width, components.x);
+    const auto basisY = calculateWeights(height, components.y);
+
+    // The cosine transform is separable, so first sum the horizontal components of each row of components.
+    // Channels are kept in separate planes, so the loops over x are plain multiply-adds the compiler can vectorize.
+    std::vector<float> rows(static_cast<size_t>(components.y) * 3 * width, 0.0f);
+    for (int ny = 0; ny < components.y; ny++) {
+        float *const rowR = rows.data() + (ny * 3 + 0) * width;
+        float *const rowG = rows.data() + (ny * 3 + 1) * width;
+        float *const rowB = rows.data() + (ny * 3 + 2) * width;
+
+        for (int nx = 0; nx < components.x; nx++) {
+            const ColorF color = values[nx + ny * components.x];
+            const float *const weights = basisX.constData() + nx * width;
+
+            for (int x = 0; x < width; x++) {
+                rowR[x] += color.r * weights[x];
+                rowG[x] += color.g * weights[x];
+                rowB[x] += color.b * weights[x];
+            }
+        }
+    }
 
-            for (int nx = 0; nx < components.x; nx++) {
-                for (int ny = 0; ny < components.y; ny++) {
-                    const float basis = basisX.value(x * components.x + nx) * basisY.value(y * components.y + ny);
-                    const auto colorValue = values.at(nx + ny * components.x);
+    // The format Qt Quick uploads as is, so cached images don't have to be converted for every texture
+    QImage image(size, QImage::Format_RGB32);
+    image.setColorSpace(QColorSpace::SRgb);
 
-                    linearSumR += colorValue.r * basis;
-                    linearSumG += colorValue.g * basis;
-                    linearSumB += colorValue.b * basis;
-                }
+    // Then each line of the image is a weighted sum of those rows
+    std::vector<float> line(static_cast<size_t>(width) * 3);
+    float *const lineR = line.data();
+    float *const lineG = line.data() + width;
+    float *const lineB = line.data() + 2 * width;
+
+    for (int y = 0; y < height; y++) {
+        std::ranges::fill(line, 0.0f);
+
+        for (int ny = 0; ny < components.y; ny++) {
+            const float weight = basisY[ny * height + y];
+            const float *const rowR = rows.data() + (ny * 3 + 0) * width;
+            const float *const rowG = rows.data() + (ny * 3 + 1) * width;
+            const float *const rowB = rows.data() + (ny * 3 + 2) * width;
+
+            for (int x = 0; x < width; x++) {
+                lineR[x] += weight * rowR[x];
+                lineG[x] += weight * rowG[x];
+                lineB[x] += weight * rowB[x];
             }
+        }
 
-            auto linearColor = QColor::fromRgbF(linearSumR, linearSumG, linearSumB);
-            image.setPixelColor(x, y, linearColor);
+        auto *const pixels = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < width; x++) {
+            pixels[x] = qRgb(linearToSRGB(lineR[x]), linearToSRGB(lineG[x]), linearToSRGB(lineB[x]));
         }
     }
 
-    return image.colorTransformed(fromLinearSRGB);
+    return image;
 }
 
-std::optional<int> BlurHash::decode83(const QString &encodedString)
+std::optional<int> BlurHash::decode83(const QStringView encodedString)
 {
     int temp = 0;
-    for (const QChar c : std::as_const(encodedString)) {
-        const auto index = b83Characters.indexOf(c);
+    for (const QChar c : encodedString) {
+        const auto index = c.unicode() < b83Values.size() ? b83Values[c.unicode()] : -1;
         if (index == -1) {
             return std::nullopt;
         }
 
-        temp = temp * 83 + static_cast<int>(index);
+        temp = temp * 83 + index;
     }
 
     return temp;
@@ -146,9 +220,9 @@ QList<float> BlurHash::calculateWeights(const qsizetype dimension, const qsizety
     QList<float> bases(dimension * components, 0.0f);
 
     const auto scale = static_cast<float>(M_PI) / static_cast<float>(dimension);
-    for (qsizetype x = 0; x < dimension; x++) {
-        for (qsizetype nx = 0; nx < components; nx++) {
-            bases[x * components + nx] = std::cos(scale * static_cast<float>(nx * x));
+    for (qsizetype nx = 0; nx < components; nx++) {
+        for (qsizetype x = 0; x < dimension; x++) {
+            bases[nx * dimension + x] = std::cos(scale * static_cast<float>(nx * x));
         }
     }
     return bases;
@@ -39,7 +39,7 @@ protected:
     /**
      * @brief Decodes a base 83 string to it's integer value. Returns std::nullopt if there's an invalid character in the blurhash.
      */
-    static std::optional<int> decode83(const QString &encodedString);
+    static std::optional<int> decode83(QStringView encodedString);
 
     /**
      * @brief Unpacks an integer to it's @c Components value.
@@ -69,6 +69,7 @@ protected:
 
     /**
      * @brief Calculates the weighted sum for @p dimension across @p components.
+     * @return The weights of each component one after the other, each @p dimension long.
      */
     static QList<float> calculateWeights(qsizetype dimension, qsizetype components);
 
@@ -4,6 +4,7 @@
 #include "blurhashimageprovider.h"
 
 #include "blurhash.h"
+#include "utils/asyncimageresponse.h"
 
 /*
  * Qt unfortunately re-encodes the base83 string in QML.
@@ -36,62 +37,115 @@ static const QMap<QLatin1String, QLatin1String> knownEncodings = {
 };
 // clang-format on
 
-class AsyncImageResponseRunnable : public QObject, public QRunnable
+class AsyncImageResponseRunnable : public QRunnable
 {
-    Q_OBJECT
-
-Q_SIGNALS:
-    void done(QImage image);
-
 public:
-    AsyncImageResponseRunnable(const QString &id, const QSize &requestedSize)
-        : m_id(id)
+    AsyncImageResponseRunnable(BlurHashImageProvider *provider, const QString &key, const QString &id, const QSize &requestedSize)
+        : m_provider(provider)
+        , m_key(key)
+        , m_id(id)
         , m_requestedSize(requestedSize)
     {
-        if (m_requestedSize.width() == -1)
-            m_requestedSize.setWidth(64);
-        if (m_requestedSize.height() == -1)
-            m_requestedSize.setHeight(64);
     }
 
     void run() override
     {
-        if (m_id.isEmpty())
-            return;
-
         QString decodedId = m_id;
         for (auto i = knownEncodings.constBegin(); i != knownEncodings.constEnd(); ++i)
             decodedId.replace(i.key(), i.value());
 
-        Q_EMIT done(BlurHash::decode(decodedId, m_requestedSize));
+        m_provider->decoded(m_key, BlurHash::decode(decodedId, m_requestedSize));
     }
 
 private:
+    BlurHashImageProvider *const m_provider;
+    QString m_key;
     QString m_id;
     QSize m_requestedSize;
 };
 
-AsyncImageResponse::AsyncImageResponse(const QString &id, const QSize &requestedSize, QThreadPool *pool)
+BlurHashImageProvider::BlurHashImageProvider(const qsizetype byteBudget)
+    : m_cache(byteBudget)
+{
+}
+
+BlurHashImageProvider::~BlurHashImageProvider()
 {
-    const auto runnable = new AsyncImageResponseRunnable(id, requestedSize);
-    connect(runnable, &AsyncImageResponseRunnable::done, this, &AsyncImageResponse::handleDone);
-    pool->start(runnable);
+    pool.waitForDone();
+}
+
+QQuickImageResponse *BlurHashImageProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
+{
+    if (id.isEmpty()) {
+        return new AsyncImageResponse(QImage{});
+    }
+
+    QSize size = requestedSize;
+    if (size.width() == -1)
+        size.setWidth(64);
+    if (size.height() == -1)
+        size.setHeight(64);
+
+    // The id is still URL-encoded, but it's just as unique
+    const QString key = QStringLiteral("%1@%2x%3").arg(id).arg(size.width()).arg(size.height());
+
+    QMutexLocker locker(&m_mutex);
+
+    if (const auto image = m_cache.object(key)) {
+        m_statistics.hits++;
+        return new AsyncImageResponse(*image);
+    }
+
+    if (const auto pending = m_pending.value(key)) {
+        m_statistics.joined++;
+        return new AsyncImageResponse(pending);
+    }
+
+    m_statistics.misses++;
+
+    const auto pending = new PendingImage;
+    m_pending.insert(key, pending);
+    const auto response = new AsyncImageResponse(pending);
+
+    pool.start(new AsyncImageResponseRunnable(this, key, id, size));
+
+    return response;
 }
 
-void AsyncImageResponse::handleDone(QImage image)
+BlurHashImageProvider::Statistics BlurHashImageProvider::statistics() const
 {
-    m_image = std::move(image);
-    Q_EMIT finished();
+    QMutexLocker locker(&m_mutex);
+
+    Statistics statistics = m_statistics;
+    statistics.count = m_cache.count();
+    statistics.bytes = m_cache.totalCost();
+    return statistics;
 }
 
-QQuickTextureFactory *AsyncImageResponse::textureFactory() const
+void BlurHashImageProvider::setByteBudget(const qsizetype bytes)
 {
-    return QQuickTextureFactory::textureFactoryForImage(m_image);
+    QMutexLocker locker(&m_mutex);
+    m_cache.setMaxCost(bytes);
 }
 
-QQuickImageResponse *BlurHashImageProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
+void BlurHashImageProvider::clear()
 {
-    return new AsyncImageResponse(id, requestedSize, &pool);
+    QMutexLocker locker(&m_mutex);
+    m_cache.clear();
 }
 
-#include "blurhashimageprovider.moc"
+void BlurHashImageProvider::decoded(const QString &key, const QImage &image)
+{
+    PendingImage *pending = nullptr;
+    {
+        QMutexLocker locker(&m_mutex);
+
+        // Invalid hashes are cached too, so they aren't decoded over and over again
+        m_cache.insert(key, new QImage(image), std::max<qsizetype>(image.sizeInBytes(), 1));
+        pending = m_pending.take(key);
+    }
+
+    // Responses live in the thread which asked, so this is delivered there
+    Q_EMIT pending->done(image);
+    pending->deleteLater();
+}
@@ -3,23 +3,61 @@
 
 #pragma once
 
+#include <QCache>
+#include <QHash>
+#include <QMutex>
 #include <QQuickAsyncImageProvider>
 #include <QThreadPool>
 
-class AsyncImageResponse final : public QQuickImageResponse
-{
-public:
-    AsyncImageResponse(const QString &id, const QSize &requestedSize, QThreadPool *pool);
-    void handleDone(QImage image);
-    [[nodiscard]] QQuickTextureFactory *textureFactory() const override;
-    QImage m_image;
-};
+class PendingImage;
 
+/**
+ * @brief Decodes BlurHashes for QML, with the "image://blurhash/" scheme.
+ *
+ * Decoded images are kept in a cache of limited size, since the same attachment shows up again when scrolling back, or in boosts, threads
+ * and media grids. Requests for an image which is still being decoded wait for that decode instead of starting another.
+ */
 class BlurHashImageProvider : public QQuickAsyncImageProvider
 {
 public:
+    struct Statistics {
+        qint64 hits = 0;
+        qint64 misses = 0;
+        qint64 joined = 0; ///< Requests which waited for a decode already in progress.
+        qsizetype count = 0;
+        qsizetype bytes = 0;
+    };
+
+    explicit BlurHashImageProvider(qsizetype byteBudget = 8 * 1024 * 1024);
+    ~BlurHashImageProvider() override;
+
     QQuickImageResponse *requestImageResponse(const QString &id, const QSize &requestedSize) override;
 
+    /**
+     * @return How well the cache is doing.
+     */
+    [[nodiscard]] Statistics statistics() const;
+
+    /**
+     * @brief Keep no more than @p bytes of decoded images, dropping the least recently used ones first.
+     */
+    void setByteBudget(qsizetype bytes);
+
+    /**
+     * @brief Drops every decoded image.
+     */
+    void clear();
+
 private:
+    void decoded(const QString &key, const QImage &image);
+
+    friend class AsyncImageResponseRunnable;
+
+    mutable QMutex m_mutex;
+    QCache<QString, QImage> m_cache;
+    QHash<QString, PendingImage *> m_pending;
+    Statistics m_statistics;
+
+    // Last, so running decodes are waited for before the rest is gone
     QThreadPool pool;
 };
@@ -21,4 +21,55 @@ QList<CustomEmoji> CustomEmoji::parseCustomEmojis(const QJsonArray &json)
     return emojis;
 }
 
+CustomEmojiUrls CustomEmoji::parseCustomEmojiUrls(const QJsonArray &json, CustomEmojiCache *cache)
+{
+    CustomEmojiUrls urls;
+    urls.reserve(json.size());
+    for (auto emojiObj : json) {
+        if (!emojiObj.isObject()) {
+            continue;
+        }
+
+        const QString shortcode = emojiObj[QStringLiteral("shortcode")].toString();
+        const QString url = emojiObj[QStringLiteral("static_url")].toString();
+        if (cache) {
+            const auto emoji = cache->intern(shortcode, url);
+            urls.insert(emoji.shortcode, emoji.url);
+        } else {
+            urls.insert(shortcode, url);
+        }
+    }
+
+    return urls;
+}
+
+namespace
+{
+// Beyond this, most of what's cached is probably from posts which are long gone
+constexpr qsizetype maximumCachedEmojis = 10000;
+}
+
+CustomEmoji CustomEmojiCache::intern(const QString &shortcode, const QString &url)
+{
+    const auto it = m_emojis.constFind(url);
+    if (it != m_emojis.constEnd() && it->shortcode == shortcode) {
+        return *it;
+    }
+
+    if (m_emojis.size() >= maximumCachedEmojis) {
+        m_emojis.clear();
+    }
+
+    CustomEmoji emoji{};
+    emoji.shortcode = shortcode;
+    emoji.url = url;
+    m_emojis.insert(url, emoji);
+    return emoji;
+}
+
+qsizetype CustomEmojiCache::size() const
+{
+    return m_emojis.size();
+}
+
 #include "moc_customemoji.cpp"
\ No newline at end of file
@@ -3,8 +3,16 @@
 
 #pragma once
 
+#include <QHash>
 #include <QJsonArray>
 
+class CustomEmojiCache;
+
+/**
+ * @brief The URLs of custom emoji by their shortcode, as used in a single post or profile.
+ */
+using CustomEmojiUrls = QHash<QString, QString>;
+
 /**
  * @brief A custom emoji on a server, usually represented with colons e.g. :kde:
  */
@@ -23,6 +31,13 @@ public:
      */
     static QList<CustomEmoji> parseCustomEmojis(const QJsonArray &json);
 
+    /**
+     * @brief Parses an array of custom emoji like parseCustomEmojis(), but into their URLs by shortcode.
+     * @param json The JSON array to parse.
+     * @param cache The emoji parsed before, whose strings are reused if they come up again.
+     */
+    static CustomEmojiUrls parseCustomEmojiUrls(const QJsonArray &json, CustomEmojiCache *cache = nullptr);
+
     /**
      * @brief The shortcode name. For example, :kde: would have a shortcode of "kde"
      */
@@ -38,3 +53,22 @@ public:
      */
     bool isCustom = true;
 };
+
+/**
+ * @brief The custom emoji an account came across, so that each is only stored once.
+ *
+ * Posts and profiles of the same people tend to use the same emoji over and over, which would otherwise be kept for every one of them.
+ */
+class CustomEmojiCache
+{
+public:
+    /**
+     * @return The emoji with @p url seen before, or a new one which is remembered from now on.
+     */
+    CustomEmoji intern(const QString &shortcode, const QString &url);
+
+    [[nodiscard]] qsizetype size() const;
+
+private:
+    QHash<QString, CustomEmoji> m_emojis; ///< By URL, as the same shortcode can be a different emoji on another server.
+};
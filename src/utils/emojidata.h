@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QStringView>
+
+/**
+ * @brief A Unicode emoji as stored in the tables generated from utils/emojis.txt.
+ *
+ * The strings are literals, so they can be used without copying them.
+ */
+struct EmojiRecord {
+    QStringView unicode;
+    QStringView shortName;
+    QStringView description;
+};
+
+/**
+ * @brief The skin tone variants of an emoji, which are the tones from first to first + count.
+ */
+struct EmojiToneGroup {
+    QStringView base; ///< The description of the emoji without a skin tone.
+    qsizetype first;
+    qsizetype count;
+};
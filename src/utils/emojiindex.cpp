@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/emojiindex.h"
+
+#include <algorithm>
+
+namespace
+{
+// Longer runs would make the index bigger, without narrowing it down much more
+constexpr qsizetype maxGramLength = 3;
+
+// Packs a run of up to three UTF-16 code units and its length into a single number, so no strings need to be created for it
+quint64 gram(const QStringView text)
+{
+    quint64 value = quint64(text.size()) << 48;
+    for (qsizetype i = 0; i < text.size(); i++) {
+        value |= quint64(text[i].unicode()) << (16 * (2 - i));
+    }
+    return value;
+}
+}
+
+void EmojiIndex::add(const QString &shortName, const QVariant &emoji)
+{
+    const qsizetype index = m_entries.size();
+    m_entries.push_back(Entry{shortName.toCaseFolded(), emoji});
+    if (!m_byShortName.contains(shortName)) {
+        m_byShortName.insert(shortName, index);
+    }
+
+    const QStringView key = m_entries.last().key;
+    for (qsizetype length = 1; length <= maxGramLength; length++) {
+        for (qsizetype start = 0; start + length <= key.size(); start++) {
+            auto &entries = m_grams[gram(key.sliced(start, length))];
+            // The same run may appear more than once in a name
+            if (entries.isEmpty() || entries.last() != index) {
+                entries.push_back(index);
+            }
+        }
+    }
+}
+
+void EmojiIndex::clear()
+{
+    m_entries.clear();
+    m_byShortName.clear();
+    m_grams.clear();
+}
+
+qsizetype EmojiIndex::size() const
+{
+    return m_entries.size();
+}
+
+QVariantList EmojiIndex::search(const QString &filter) const
+{
+    if (filter.isEmpty()) {
+        QVariantList all;
+        all.reserve(m_entries.size());
+        for (const auto &entry : m_entries) {
+            all.push_back(entry.emoji);
+        }
+        return all;
+    }
+
+    const QString needle = filter.toCaseFolded();
+    const qsizetype length = std::min(needle.size(), maxGramLength);
+
+    // Every match contains all runs of the filter, so the rarest one has the fewest to check
+    const QList<qsizetype> *candidates = nullptr;
+    for (qsizetype start = 0; start + length <= needle.size(); start++) {
+        const auto it = m_grams.constFind(gram(QStringView(needle).sliced(start, length)));
+        if (it == m_grams.constEnd()) {
+            return {};
+        }
+        if (!candidates || it->size() < candidates->size()) {
+            candidates = &it.value();
+        }
+    }
+
+    QVariantList starting;
+    QVariantList containing;
+    for (const qsizetype index : *candidates) {
+        const auto &entry = m_entries[index];
+        if (entry.key.startsWith(needle)) {
+            starting.push_back(entry.emoji);
+        } else if (length == needle.size() || entry.key.contains(needle)) {
+            containing.push_back(entry.emoji);
+        }
+    }
+
+    return starting + containing;
+}
+
+QVariant EmojiIndex::find(const QString &shortName) const
+{
+    const auto it = m_byShortName.constFind(shortName);
+    if (it == m_byShortName.constEnd()) {
+        return {};
+    }
+    return m_entries[*it].emoji;
+}
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QVariant>
+
+/**
+ * @brief A search index over the short names of emoji, either Unicode or custom ones.
+ *
+ * Short names are split up into every run of up to three characters, each pointing to the emoji containing it. Searching only has to look at
+ * the emoji of the rarest run in the filter, instead of all of them. Exact short names are looked up in a hash.
+ */
+class EmojiIndex
+{
+public:
+    /**
+     * @brief Adds @p emoji under @p shortName, after everything added so far.
+     */
+    void add(const QString &shortName, const QVariant &emoji);
+
+    void clear();
+
+    [[nodiscard]] qsizetype size() const;
+
+    /**
+     * @return The emoji whose short name contains @p filter, ignoring case. Those starting with it come first, otherwise they're in the order
+     * they were added. All of them if @p filter is empty.
+     */
+    [[nodiscard]] QVariantList search(const QString &filter) const;
+
+    /**
+     * @return The first emoji added as @p shortName, or an invalid QVariant if there's none.
+     */
+    [[nodiscard]] QVariant find(const QString &shortName) const;
+
+private:
+    struct Entry {
+        QString key; ///< The case folded short name.
+        QVariant emoji;
+    };
+
+    QList<Entry> m_entries;
+    QHash<QString, qsizetype> m_byShortName;
+    QHash<quint64, QList<qsizetype>> m_grams; ///< Entries containing each run of characters, see gram().
+};
@@ -7,18 +7,43 @@
 #include <KLocalizedString>
 
 #include "account/abstractaccount.h"
-#include "utils/emojitones.h"
+#include "emojitables.h"
+
+#include <algorithm>
 
 using namespace Qt::Literals::StringLiterals;
 
+namespace
+{
+QString fromTable(const QStringView text)
+{
+    // The tables are never unloaded, so there's no need to copy their strings
+    return QString::fromRawData(text.data(), text.size());
+}
+
+QVariant toVariant(const EmojiRecord &record)
+{
+    return QVariant::fromValue(Emoji{fromTable(record.unicode), fromTable(record.shortName), fromTable(record.description)});
+}
+}
+
 QHash<EmojiModel::Category, QVariantList> EmojiModel::_emojis;
 
 EmojiModel::EmojiModel(QObject *parent)
     : QObject(parent)
 {
-    if (_emojis.isEmpty()) {
-#include "utils/emojis.h"
-    }
+}
+
+const EmojiIndex &EmojiModel::unicodeIndex()
+{
+    static const EmojiIndex index = [] {
+        EmojiIndex index;
+        for (const auto &record : EmojiData::emojis) {
+            index.add(fromTable(record.shortName), toVariant(record));
+        }
+        return index;
+    }();
+    return index;
 }
 
 QVariantList EmojiModel::filterModel(AbstractAccount *account, const QString &filter)
@@ -31,18 +56,10 @@ QVariantList EmojiModel::emojis(AbstractAccount *account, Category category) con
     if (category == History) {
         QVariantList list;
         for (const auto &historicEmoji : history(account)) {
-            for (const auto &emojiCategory : _emojis) {
-                for (const auto &emoji : emojiCategory) {
-                    if (qvariant_cast<Emoji>(emoji).shortName == historicEmoji) {
-                        list.append(emoji);
-                    }
-                }
-            }
-
-            for (const auto &customEmoji : filterCustomModel(account, {})) {
-                if (qvariant_cast<CustomEmoji>(customEmoji).shortcode == historicEmoji) {
-                    list.append(customEmoji);
-                }
+            if (const auto emoji = unicodeIndex().find(historicEmoji); emoji.isValid()) {
+                list.append(emoji);
+            } else if (const auto customEmoji = account->customEmojiIndex().find(historicEmoji); customEmoji.isValid()) {
+                list.append(customEmoji);
             }
         }
 
@@ -51,16 +68,43 @@ QVariantList EmojiModel::emojis(AbstractAccount *account, Category category) con
         return filterCustomModel(account, {});
     }
 
-    return _emojis[category];
+    if (category < Smileys || category > Component) {
+        return {};
+    }
+
+    // Only the categories which are looked at are turned into variants
+    auto &list = _emojis[category];
+    if (list.isEmpty()) {
+        const qsizetype first = EmojiData::categoryOffsets[category - Smileys];
+        const qsizetype last = EmojiData::categoryOffsets[category - Smileys + 1];
+        list.reserve(last - first);
+        for (qsizetype i = first; i < last; i++) {
+            list.append(toVariant(EmojiData::emojis[i]));
+        }
+    }
+    return list;
 }
 
 QVariantList EmojiModel::tones(const QString &baseEmoji) const
 {
+    QStringView base = baseEmoji;
     if (baseEmoji.endsWith("tone"_L1)) {
-        return EmojiTones::_tones.values(baseEmoji.split(":"_L1)[0]);
+        base = base.left(base.indexOf(u':'));
     }
 
-    return EmojiTones::_tones.values(baseEmoji);
+    const auto group = std::lower_bound(std::begin(EmojiData::toneGroups), std::end(EmojiData::toneGroups), base, [](const EmojiToneGroup &group, const QStringView base) {
+        return group.base < base;
+    });
+    if (group == std::end(EmojiData::toneGroups) || group->base != base) {
+        return {};
+    }
+
+    QVariantList tones;
+    tones.reserve(group->count);
+    for (qsizetype i = group->first; i < group->first + group->count; i++) {
+        tones.append(toVariant(EmojiData::tones[i]));
+    }
+    return tones;
 }
 
 QStringList EmojiModel::history(AbstractAccount *account) const
@@ -74,18 +118,7 @@ QStringList EmojiModel::history(AbstractAccount *account) const
 
 QVariantList EmojiModel::filterModelNoCustom(const QString &filter)
 {
-    QVariantList result;
-
-    for (const auto &e : _emojis.values()) {
-        for (const auto &variant : e) {
-            const auto &emoji = qvariant_cast<Emoji>(variant);
-            if (emoji.shortName.contains(filter, Qt::CaseInsensitive)) {
-                result.append(variant);
-            }
-        }
-    }
-
-    return result;
+    return unicodeIndex().search(filter);
 }
 
 void EmojiModel::emojiUsed(AbstractAccount *account, const QString &shortcode)
@@ -186,14 +219,7 @@ QVariantList EmojiModel::filterCustomModel(AbstractAccount *account, const QStri
         return {};
     }
 
-    QVariantList result;
-    for (const auto &emoji : account->customEmojis()) {
-        if (emoji.shortcode.contains(filter, Qt::CaseInsensitive)) {
-            result.append(QVariant::fromValue(emoji));
-        }
-    }
-
-    return result;
+    return account->customEmojiIndex().search(filter);
 }
 
 #include "moc_emojimodel.cpp"
@@ -6,6 +6,8 @@
 
 #include <QQmlEngine>
 
+#include "utils/emojiindex.h"
+
 /**
  * @brief Defines the structure of a typical Unicode emoji.
  */
@@ -108,8 +110,16 @@ public Q_SLOTS:
     void emojiUsed(AbstractAccount *account, const QString &shortcode);
 
 private:
+    /**
+     * @brief The Unicode emoji of each category that was shown so far.
+     */
     static QHash<Category, QVariantList> _emojis;
 
+    /**
+     * @brief The index of every Unicode emoji, which is built the first time it's used.
+     */
+    static const EmojiIndex &unicodeIndex();
+
     [[nodiscard]] QVariantList categories() const;
 
     static QVariantList filterModelNoCustom(const QString &filter);
@@ -1,1857 +0,0 @@
-// SPDX-FileCopyrightText: None
-// SPDX-License-Identifier: LGPL-2.0-or-later
-// This file is auto-generated. All changes will be lost. See tools/update-emojis.py
-// clang-format off
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F600"), QStringLiteral("grinning"), QStringLiteral("grinning face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F603"), QStringLiteral("smiley"), QStringLiteral("grinning face with big eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F604"), QStringLiteral("smile"), QStringLiteral("grinning face with smiling eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F601"), QStringLiteral("grin"), QStringLiteral("beaming face with smiling eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F606"), QStringLiteral("laughing"), QStringLiteral("grinning squinting face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F605"), QStringLiteral("sweat_smile"), QStringLiteral("grinning face with sweat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F923"), QStringLiteral("rofl"), QStringLiteral("rolling on the floor laughing")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F602"), QStringLiteral("joy"), QStringLiteral("face with tears of joy")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F642"), QStringLiteral("slight_smile"), QStringLiteral("slightly smiling face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F643"), QStringLiteral("upside_down"), QStringLiteral("upside-down face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE0"), QStringLiteral("melting face"), QStringLiteral("melting face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F609"), QStringLiteral("wink"), QStringLiteral("winking face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F60A"), QStringLiteral("blush"), QStringLiteral("smiling face with smiling eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F607"), QStringLiteral("innocent"), QStringLiteral("smiling face with halo")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F970"), QStringLiteral("smiling_face_with_3_hearts"), QStringLiteral("smiling face with hearts")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F60D"), QStringLiteral("heart_eyes"), QStringLiteral("smiling face with heart-eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F929"), QStringLiteral("star_struck"), QStringLiteral("star-struck")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F618"), QStringLiteral("kissing_heart"), QStringLiteral("face blowing a kiss")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F617"), QStringLiteral("kissing"), QStringLiteral("kissing face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000263A\U0000FE0F"), QStringLiteral("smiling face"), QStringLiteral("smiling face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F61A"), QStringLiteral("kissing_closed_eyes"), QStringLiteral("kissing face with closed eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F619"), QStringLiteral("kissing_smiling_eyes"), QStringLiteral("kissing face with smiling eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F972"), QStringLiteral("smiling face with tear"), QStringLiteral("smiling face with tear")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F60B"), QStringLiteral("yum"), QStringLiteral("face savoring food")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F61B"), QStringLiteral("stuck_out_tongue"), QStringLiteral("face with tongue")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F61C"), QStringLiteral("stuck_out_tongue_winking_eye"), QStringLiteral("winking face with tongue")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F92A"), QStringLiteral("zany_face"), QStringLiteral("zany face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F61D"), QStringLiteral("stuck_out_tongue_closed_eyes"), QStringLiteral("squinting face with tongue")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F911"), QStringLiteral("money_mouth"), QStringLiteral("money-mouth face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F917"), QStringLiteral("hugging"), QStringLiteral("smiling face with open hands")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F92D"), QStringLiteral("face_with_hand_over_mouth"), QStringLiteral("face with hand over mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE2"), QStringLiteral("face with open eyes and hand over mouth"), QStringLiteral("face with open eyes and hand over mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE3"), QStringLiteral("face with peeking eye"), QStringLiteral("face with peeking eye")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F92B"), QStringLiteral("shushing_face"), QStringLiteral("shushing face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F914"), QStringLiteral("thinking"), QStringLiteral("thinking face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE1"), QStringLiteral("saluting face"), QStringLiteral("saluting face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F910"), QStringLiteral("zipper_mouth"), QStringLiteral("zipper-mouth face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F928"), QStringLiteral("face_with_raised_eyebrow"), QStringLiteral("face with raised eyebrow")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F610"), QStringLiteral("neutral_face"), QStringLiteral("neutral face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F611"), QStringLiteral("expressionless"), QStringLiteral("expressionless face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F636"), QStringLiteral("no_mouth"), QStringLiteral("face without mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE5"), QStringLiteral("dotted line face"), QStringLiteral("dotted line face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F636\U0000200D\U0001F32B\U0000FE0F"), QStringLiteral("face in clouds"), QStringLiteral("face in clouds")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F60F"), QStringLiteral("smirk"), QStringLiteral("smirking face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F612"), QStringLiteral("unamused"), QStringLiteral("unamused face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F644"), QStringLiteral("rolling_eyes"), QStringLiteral("face with rolling eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62C"), QStringLiteral("grimacing"), QStringLiteral("grimacing face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62E\U0000200D\U0001F4A8"), QStringLiteral("face exhaling"), QStringLiteral("face exhaling")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F925"), QStringLiteral("lying_face"), QStringLiteral("lying face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F60C"), QStringLiteral("relieved"), QStringLiteral("relieved face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F614"), QStringLiteral("pensive"), QStringLiteral("pensive face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62A"), QStringLiteral("sleepy"), QStringLiteral("sleepy face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F924"), QStringLiteral("drooling_face"), QStringLiteral("drooling face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F634"), QStringLiteral("sleeping"), QStringLiteral("sleeping face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F637"), QStringLiteral("mask"), QStringLiteral("face with medical mask")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F912"), QStringLiteral("thermometer_face"), QStringLiteral("face with thermometer")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F915"), QStringLiteral("head_bandage"), QStringLiteral("face with head-bandage")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F922"), QStringLiteral("nauseated_face"), QStringLiteral("nauseated face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F92E"), QStringLiteral("face_vomiting"), QStringLiteral("face vomiting")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F927"), QStringLiteral("sneezing_face"), QStringLiteral("sneezing face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F975"), QStringLiteral("hot_face"), QStringLiteral("hot face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F976"), QStringLiteral("cold_face"), QStringLiteral("cold face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F974"), QStringLiteral("woozy_face"), QStringLiteral("woozy face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F635"), QStringLiteral("dizzy_face"), QStringLiteral("face with crossed-out eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F635\U0000200D\U0001F4AB"), QStringLiteral("face with spiral eyes"), QStringLiteral("face with spiral eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F92F"), QStringLiteral("exploding_head"), QStringLiteral("exploding head")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F920"), QStringLiteral("cowboy"), QStringLiteral("cowboy hat face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F973"), QStringLiteral("partying_face"), QStringLiteral("partying face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F978"), QStringLiteral("disguised face"), QStringLiteral("disguised face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F60E"), QStringLiteral("sunglasses"), QStringLiteral("smiling face with sunglasses")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F913"), QStringLiteral("nerd"), QStringLiteral("nerd face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D0"), QStringLiteral("face_with_monocle"), QStringLiteral("face with monocle")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F615"), QStringLiteral("confused"), QStringLiteral("confused face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE4"), QStringLiteral("face with diagonal mouth"), QStringLiteral("face with diagonal mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F61F"), QStringLiteral("worried"), QStringLiteral("worried face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F641"), QStringLiteral("slight_frown"), QStringLiteral("slightly frowning face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002639\U0000FE0F"), QStringLiteral("frowning face"), QStringLiteral("frowning face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62E"), QStringLiteral("open_mouth"), QStringLiteral("face with open mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62F"), QStringLiteral("hushed"), QStringLiteral("hushed face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F632"), QStringLiteral("astonished"), QStringLiteral("astonished face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F633"), QStringLiteral("flushed"), QStringLiteral("flushed face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F97A"), QStringLiteral("pleading_face"), QStringLiteral("pleading face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F979"), QStringLiteral("face holding back tears"), QStringLiteral("face holding back tears")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F626"), QStringLiteral("frowning"), QStringLiteral("frowning face with open mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F627"), QStringLiteral("anguished"), QStringLiteral("anguished face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F628"), QStringLiteral("fearful"), QStringLiteral("fearful face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F630"), QStringLiteral("cold_sweat"), QStringLiteral("anxious face with sweat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F625"), QStringLiteral("disappointed_relieved"), QStringLiteral("sad but relieved face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F622"), QStringLiteral("cry"), QStringLiteral("crying face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62D"), QStringLiteral("sob"), QStringLiteral("loudly crying face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F631"), QStringLiteral("scream"), QStringLiteral("face screaming in fear")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F616"), QStringLiteral("confounded"), QStringLiteral("confounded face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F623"), QStringLiteral("persevere"), QStringLiteral("persevering face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F61E"), QStringLiteral("disappointed"), QStringLiteral("disappointed face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F613"), QStringLiteral("sweat"), QStringLiteral("downcast face with sweat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F629"), QStringLiteral("weary"), QStringLiteral("weary face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62B"), QStringLiteral("tired_face"), QStringLiteral("tired face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F971"), QStringLiteral("yawning face"), QStringLiteral("yawning face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F624"), QStringLiteral("triumph"), QStringLiteral("face with steam from nose")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F621"), QStringLiteral("rage"), QStringLiteral("pouting face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F620"), QStringLiteral("angry"), QStringLiteral("angry face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F92C"), QStringLiteral("face_with_symbols_over_mouth"), QStringLiteral("face with symbols on mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F608"), QStringLiteral("smiling_imp"), QStringLiteral("smiling face with horns")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47F"), QStringLiteral("imp"), QStringLiteral("angry face with horns")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F480"), QStringLiteral("skull"), QStringLiteral("skull")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002620\U0000FE0F"), QStringLiteral("skull and crossbones"), QStringLiteral("skull and crossbones")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A9"), QStringLiteral("poop"), QStringLiteral("pile of poo")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F921"), QStringLiteral("clown"), QStringLiteral("clown face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F479"), QStringLiteral("japanese_ogre"), QStringLiteral("ogre")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47A"), QStringLiteral("japanese_goblin"), QStringLiteral("goblin")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47B"), QStringLiteral("ghost"), QStringLiteral("ghost")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47D"), QStringLiteral("alien"), QStringLiteral("alien")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47E"), QStringLiteral("space_invader"), QStringLiteral("alien monster")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F916"), QStringLiteral("robot"), QStringLiteral("robot")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F63A"), QStringLiteral("smiley_cat"), QStringLiteral("grinning cat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F638"), QStringLiteral("smile_cat"), QStringLiteral("grinning cat with smiling eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F639"), QStringLiteral("joy_cat"), QStringLiteral("cat with tears of joy")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F63B"), QStringLiteral("heart_eyes_cat"), QStringLiteral("smiling cat with heart-eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F63C"), QStringLiteral("smirk_cat"), QStringLiteral("cat with wry smile")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F63D"), QStringLiteral("kissing_cat"), QStringLiteral("kissing cat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F640"), QStringLiteral("scream_cat"), QStringLiteral("weary cat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F63F"), QStringLiteral("crying_cat_face"), QStringLiteral("crying cat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F63E"), QStringLiteral("pouting_cat"), QStringLiteral("pouting cat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F648"), QStringLiteral("see_no_evil"), QStringLiteral("see-no-evil monkey")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F649"), QStringLiteral("hear_no_evil"), QStringLiteral("hear-no-evil monkey")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64A"), QStringLiteral("speak_no_evil"), QStringLiteral("speak-no-evil monkey")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48B"), QStringLiteral("kiss"), QStringLiteral("kiss mark")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48C"), QStringLiteral("love_letter"), QStringLiteral("love letter")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F498"), QStringLiteral("cupid"), QStringLiteral("heart with arrow")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F49D"), QStringLiteral("gift_heart"), QStringLiteral("heart with ribbon")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F496"), QStringLiteral("sparkling_heart"), QStringLiteral("sparkling heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F497"), QStringLiteral("heartpulse"), QStringLiteral("growing heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F493"), QStringLiteral("heartbeat"), QStringLiteral("beating heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F49E"), QStringLiteral("revolving_hearts"), QStringLiteral("revolving hearts")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F495"), QStringLiteral("two_hearts"), QStringLiteral("two hearts")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F49F"), QStringLiteral("heart_decoration"), QStringLiteral("heart decoration")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002763\U0000FE0F"), QStringLiteral("heart exclamation"), QStringLiteral("heart exclamation")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F494"), QStringLiteral("broken_heart"), QStringLiteral("broken heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002764\U0000FE0F\U0000200D\U0001F525"), QStringLiteral("heart on fire"), QStringLiteral("heart on fire")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002764\U0000FE0F\U0000200D\U0001FA79"), QStringLiteral("mending heart"), QStringLiteral("mending heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002764\U0000FE0F"), QStringLiteral("red heart"), QStringLiteral("red heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E1"), QStringLiteral("orange_heart"), QStringLiteral("orange heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F49B"), QStringLiteral("yellow_heart"), QStringLiteral("yellow heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F49A"), QStringLiteral("green_heart"), QStringLiteral("green heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F499"), QStringLiteral("blue_heart"), QStringLiteral("blue heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F49C"), QStringLiteral("purple_heart"), QStringLiteral("purple heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90E"), QStringLiteral("brown heart"), QStringLiteral("brown heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5A4"), QStringLiteral("black_heart"), QStringLiteral("black heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90D"), QStringLiteral("white heart"), QStringLiteral("white heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AF"), QStringLiteral("100"), QStringLiteral("hundred points")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A2"), QStringLiteral("anger"), QStringLiteral("anger symbol")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A5"), QStringLiteral("boom"), QStringLiteral("collision")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AB"), QStringLiteral("dizzy"), QStringLiteral("dizzy")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A6"), QStringLiteral("sweat_drops"), QStringLiteral("sweat droplets")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A8"), QStringLiteral("dash"), QStringLiteral("dashing away")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F573\U0000FE0F"), QStringLiteral("hole"), QStringLiteral("hole")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A3"), QStringLiteral("bomb"), QStringLiteral("bomb")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AC"), QStringLiteral("speech_balloon"), QStringLiteral("speech balloon")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F441\U0000FE0F\U0000200D\U0001F5E8\U0000FE0F"), QStringLiteral("eye in speech bubble"), QStringLiteral("eye in speech bubble")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5E8\U0000FE0F"), QStringLiteral("left speech bubble"), QStringLiteral("left speech bubble")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5EF\U0000FE0F"), QStringLiteral("right anger bubble"), QStringLiteral("right anger bubble")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AD"), QStringLiteral("thought_balloon"), QStringLiteral("thought balloon")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A4"), QStringLiteral("zzz"), QStringLiteral("zzz")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44B"), QStringLiteral("wave"), QStringLiteral("waving hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91A"), QStringLiteral("raised_back_of_hand"), QStringLiteral("raised back of hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F590\U0000FE0F"), QStringLiteral("hand with fingers splayed"), QStringLiteral("hand with fingers splayed")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270B"), QStringLiteral("raised_hand"), QStringLiteral("raised hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F596"), QStringLiteral("vulcan"), QStringLiteral("vulcan salute")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1"), QStringLiteral("rightwards hand"), QStringLiteral("rightwards hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF2"), QStringLiteral("leftwards hand"), QStringLiteral("leftwards hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF3"), QStringLiteral("palm down hand"), QStringLiteral("palm down hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF4"), QStringLiteral("palm up hand"), QStringLiteral("palm up hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44C"), QStringLiteral("ok_hand"), QStringLiteral("OK hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90C"), QStringLiteral("pinched fingers"), QStringLiteral("pinched fingers")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90F"), QStringLiteral("pinching hand"), QStringLiteral("pinching hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270C\U0000FE0F"), QStringLiteral("victory hand"), QStringLiteral("victory hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91E"), QStringLiteral("fingers_crossed"), QStringLiteral("crossed fingers")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF0"), QStringLiteral("hand with index finger and thumb crossed"), QStringLiteral("hand with index finger and thumb crossed")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91F"), QStringLiteral("love_you_gesture"), QStringLiteral("love-you gesture")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F918"), QStringLiteral("metal"), QStringLiteral("sign of the horns")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F919"), QStringLiteral("call_me"), QStringLiteral("call me hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F448"), QStringLiteral("point_left"), QStringLiteral("backhand index pointing left")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F449"), QStringLiteral("point_right"), QStringLiteral("backhand index pointing right")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F446"), QStringLiteral("point_up_2"), QStringLiteral("backhand index pointing up")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F595"), QStringLiteral("middle_finger"), QStringLiteral("middle finger")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F447"), QStringLiteral("point_down"), QStringLiteral("backhand index pointing down")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000261D\U0000FE0F"), QStringLiteral("index pointing up"), QStringLiteral("index pointing up")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF5"), QStringLiteral("index pointing at the viewer"), QStringLiteral("index pointing at the viewer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44D"), QStringLiteral("thumbsup"), QStringLiteral("thumbs up")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44E"), QStringLiteral("thumbsdown"), QStringLiteral("thumbs down")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270A"), QStringLiteral("fist"), QStringLiteral("raised fist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44A"), QStringLiteral("punch"), QStringLiteral("oncoming fist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91B"), QStringLiteral("left_facing_fist"), QStringLiteral("left-facing fist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91C"), QStringLiteral("right_facing_fist"), QStringLiteral("right-facing fist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44F"), QStringLiteral("clap"), QStringLiteral("clapping hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64C"), QStringLiteral("raised_hands"), QStringLiteral("raising hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF6"), QStringLiteral("heart hands"), QStringLiteral("heart hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F450"), QStringLiteral("open_hands"), QStringLiteral("open hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F932"), QStringLiteral("palms_up_together"), QStringLiteral("palms up together")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91D"), QStringLiteral("handshake"), QStringLiteral("handshake")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64F"), QStringLiteral("pray"), QStringLiteral("folded hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270D\U0000FE0F"), QStringLiteral("writing hand"), QStringLiteral("writing hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F485"), QStringLiteral("nail_care"), QStringLiteral("nail polish")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F933"), QStringLiteral("selfie"), QStringLiteral("selfie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AA"), QStringLiteral("muscle"), QStringLiteral("flexed biceps")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BE"), QStringLiteral("mechanical arm"), QStringLiteral("mechanical arm")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BF"), QStringLiteral("mechanical leg"), QStringLiteral("mechanical leg")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B5"), QStringLiteral("leg"), QStringLiteral("leg")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B6"), QStringLiteral("foot"), QStringLiteral("foot")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F442"), QStringLiteral("ear"), QStringLiteral("ear")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BB"), QStringLiteral("ear with hearing aid"), QStringLiteral("ear with hearing aid")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F443"), QStringLiteral("nose"), QStringLiteral("nose")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E0"), QStringLiteral("brain"), QStringLiteral("brain")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC0"), QStringLiteral("anatomical heart"), QStringLiteral("anatomical heart")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC1"), QStringLiteral("lungs"), QStringLiteral("lungs")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B7"), QStringLiteral("tooth"), QStringLiteral("tooth")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B4"), QStringLiteral("bone"), QStringLiteral("bone")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F440"), QStringLiteral("eyes"), QStringLiteral("eyes")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F441\U0000FE0F"), QStringLiteral("eye"), QStringLiteral("eye")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F445"), QStringLiteral("tongue"), QStringLiteral("tongue")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F444"), QStringLiteral("lips"), QStringLiteral("mouth")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE6"), QStringLiteral("biting lip"), QStringLiteral("biting lip")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F476"), QStringLiteral("baby"), QStringLiteral("baby")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D2"), QStringLiteral("child"), QStringLiteral("child")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F466"), QStringLiteral("boy"), QStringLiteral("boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F467"), QStringLiteral("girl"), QStringLiteral("girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1"), QStringLiteral("adult"), QStringLiteral("person")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471"), QStringLiteral("person_with_blond_hair"), QStringLiteral("person: blond hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468"), QStringLiteral("man"), QStringLiteral("man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4"), QStringLiteral("bearded_person"), QStringLiteral("person: beard")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: beard"), QStringLiteral("man: beard")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: beard"), QStringLiteral("woman: beard")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9B0"), QStringLiteral("man: red hair"), QStringLiteral("man: red hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9B1"), QStringLiteral("man: curly hair"), QStringLiteral("man: curly hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9B3"), QStringLiteral("man: white hair"), QStringLiteral("man: white hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9B2"), QStringLiteral("man: bald"), QStringLiteral("man: bald")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469"), QStringLiteral("woman"), QStringLiteral("woman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9B0"), QStringLiteral("woman: red hair"), QStringLiteral("woman: red hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9B0"), QStringLiteral("person: red hair"), QStringLiteral("person: red hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9B1"), QStringLiteral("woman: curly hair"), QStringLiteral("woman: curly hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9B1"), QStringLiteral("person: curly hair"), QStringLiteral("person: curly hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9B3"), QStringLiteral("woman: white hair"), QStringLiteral("woman: white hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9B3"), QStringLiteral("person: white hair"), QStringLiteral("person: white hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9B2"), QStringLiteral("woman: bald"), QStringLiteral("woman: bald")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9B2"), QStringLiteral("person: bald"), QStringLiteral("person: bald")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: blond hair"), QStringLiteral("woman: blond hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: blond hair"), QStringLiteral("man: blond hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D3"), QStringLiteral("older_adult"), QStringLiteral("older person")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F474"), QStringLiteral("older_man"), QStringLiteral("old man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F475"), QStringLiteral("older_woman"), QStringLiteral("old woman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D"), QStringLiteral("person_frowning"), QStringLiteral("person frowning")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man frowning"), QStringLiteral("man frowning")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman frowning"), QStringLiteral("woman frowning")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E"), QStringLiteral("person_with_pouting_face"), QStringLiteral("person pouting")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man pouting"), QStringLiteral("man pouting")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman pouting"), QStringLiteral("woman pouting")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645"), QStringLiteral("no_good"), QStringLiteral("person gesturing NO")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing NO"), QStringLiteral("man gesturing NO")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing NO"), QStringLiteral("woman gesturing NO")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646"), QStringLiteral("ok_woman"), QStringLiteral("person gesturing OK")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing OK"), QStringLiteral("man gesturing OK")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing OK"), QStringLiteral("woman gesturing OK")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481"), QStringLiteral("information_desk_person"), QStringLiteral("person tipping hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man tipping hand"), QStringLiteral("man tipping hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman tipping hand"), QStringLiteral("woman tipping hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B"), QStringLiteral("raising_hand"), QStringLiteral("person raising hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man raising hand"), QStringLiteral("man raising hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman raising hand"), QStringLiteral("woman raising hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF"), QStringLiteral("deaf person"), QStringLiteral("deaf person")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("deaf man"), QStringLiteral("deaf man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("deaf woman"), QStringLiteral("deaf woman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647"), QStringLiteral("bow"), QStringLiteral("person bowing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bowing"), QStringLiteral("man bowing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bowing"), QStringLiteral("woman bowing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926"), QStringLiteral("face_palm"), QStringLiteral("person facepalming")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man facepalming"), QStringLiteral("man facepalming")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman facepalming"), QStringLiteral("woman facepalming")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937"), QStringLiteral("shrug"), QStringLiteral("person shrugging")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man shrugging"), QStringLiteral("man shrugging")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman shrugging"), QStringLiteral("woman shrugging")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U00002695\U0000FE0F"), QStringLiteral("health worker"), QStringLiteral("health worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U00002695\U0000FE0F"), QStringLiteral("man health worker"), QStringLiteral("man health worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002695\U0000FE0F"), QStringLiteral("woman health worker"), QStringLiteral("woman health worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F393"), QStringLiteral("student"), QStringLiteral("student")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F393"), QStringLiteral("man student"), QStringLiteral("man student")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F393"), QStringLiteral("woman student"), QStringLiteral("woman student")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F3EB"), QStringLiteral("teacher"), QStringLiteral("teacher")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F3EB"), QStringLiteral("man teacher"), QStringLiteral("man teacher")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F3EB"), QStringLiteral("woman teacher"), QStringLiteral("woman teacher")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U00002696\U0000FE0F"), QStringLiteral("judge"), QStringLiteral("judge")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U00002696\U0000FE0F"), QStringLiteral("man judge"), QStringLiteral("man judge")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002696\U0000FE0F"), QStringLiteral("woman judge"), QStringLiteral("woman judge")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F33E"), QStringLiteral("farmer"), QStringLiteral("farmer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F33E"), QStringLiteral("man farmer"), QStringLiteral("man farmer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F33E"), QStringLiteral("woman farmer"), QStringLiteral("woman farmer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F373"), QStringLiteral("cook"), QStringLiteral("cook")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F373"), QStringLiteral("man cook"), QStringLiteral("man cook")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F373"), QStringLiteral("woman cook"), QStringLiteral("woman cook")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F527"), QStringLiteral("mechanic"), QStringLiteral("mechanic")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F527"), QStringLiteral("man mechanic"), QStringLiteral("man mechanic")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F527"), QStringLiteral("woman mechanic"), QStringLiteral("woman mechanic")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F3ED"), QStringLiteral("factory worker"), QStringLiteral("factory worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F3ED"), QStringLiteral("man factory worker"), QStringLiteral("man factory worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F3ED"), QStringLiteral("woman factory worker"), QStringLiteral("woman factory worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F4BC"), QStringLiteral("office worker"), QStringLiteral("office worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F4BC"), QStringLiteral("man office worker"), QStringLiteral("man office worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F4BC"), QStringLiteral("woman office worker"), QStringLiteral("woman office worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F52C"), QStringLiteral("scientist"), QStringLiteral("scientist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F52C"), QStringLiteral("man scientist"), QStringLiteral("man scientist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F52C"), QStringLiteral("woman scientist"), QStringLiteral("woman scientist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F4BB"), QStringLiteral("technologist"), QStringLiteral("technologist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F4BB"), QStringLiteral("man technologist"), QStringLiteral("man technologist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F4BB"), QStringLiteral("woman technologist"), QStringLiteral("woman technologist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F3A4"), QStringLiteral("singer"), QStringLiteral("singer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F3A4"), QStringLiteral("man singer"), QStringLiteral("man singer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F3A4"), QStringLiteral("woman singer"), QStringLiteral("woman singer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F3A8"), QStringLiteral("artist"), QStringLiteral("artist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F3A8"), QStringLiteral("man artist"), QStringLiteral("man artist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F3A8"), QStringLiteral("woman artist"), QStringLiteral("woman artist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U00002708\U0000FE0F"), QStringLiteral("pilot"), QStringLiteral("pilot")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U00002708\U0000FE0F"), QStringLiteral("man pilot"), QStringLiteral("man pilot")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002708\U0000FE0F"), QStringLiteral("woman pilot"), QStringLiteral("woman pilot")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F680"), QStringLiteral("astronaut"), QStringLiteral("astronaut")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F680"), QStringLiteral("man astronaut"), QStringLiteral("man astronaut")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F680"), QStringLiteral("woman astronaut"), QStringLiteral("woman astronaut")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F692"), QStringLiteral("firefighter"), QStringLiteral("firefighter")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F692"), QStringLiteral("man firefighter"), QStringLiteral("man firefighter")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F692"), QStringLiteral("woman firefighter"), QStringLiteral("woman firefighter")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E"), QStringLiteral("cop"), QStringLiteral("police officer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man police officer"), QStringLiteral("man police officer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman police officer"), QStringLiteral("woman police officer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0000FE0F"), QStringLiteral("detective"), QStringLiteral("detective")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0000FE0F\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man detective"), QStringLiteral("man detective")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0000FE0F\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman detective"), QStringLiteral("woman detective")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482"), QStringLiteral("guardsman"), QStringLiteral("guard")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man guard"), QStringLiteral("man guard")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman guard"), QStringLiteral("woman guard")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F977"), QStringLiteral("ninja"), QStringLiteral("ninja")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477"), QStringLiteral("construction_worker"), QStringLiteral("construction worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man construction worker"), QStringLiteral("man construction worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman construction worker"), QStringLiteral("woman construction worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC5"), QStringLiteral("person with crown"), QStringLiteral("person with crown")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F934"), QStringLiteral("prince"), QStringLiteral("prince")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F478"), QStringLiteral("princess"), QStringLiteral("princess")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473"), QStringLiteral("man_with_turban"), QStringLiteral("person wearing turban")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man wearing turban"), QStringLiteral("man wearing turban")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman wearing turban"), QStringLiteral("woman wearing turban")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F472"), QStringLiteral("man_with_gua_pi_mao"), QStringLiteral("person with skullcap")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D5"), QStringLiteral("woman_with_headscarf"), QStringLiteral("woman with headscarf")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935"), QStringLiteral("man_in_tuxedo"), QStringLiteral("person in tuxedo")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in tuxedo"), QStringLiteral("man in tuxedo")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in tuxedo"), QStringLiteral("woman in tuxedo")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470"), QStringLiteral("bride_with_veil"), QStringLiteral("person with veil")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man with veil"), QStringLiteral("man with veil")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman with veil"), QStringLiteral("woman with veil")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F930"), QStringLiteral("pregnant_woman"), QStringLiteral("pregnant woman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC3"), QStringLiteral("pregnant man"), QStringLiteral("pregnant man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC4"), QStringLiteral("pregnant person"), QStringLiteral("pregnant person")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F931"), QStringLiteral("breast_feeding"), QStringLiteral("breast-feeding")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F37C"), QStringLiteral("woman feeding baby"), QStringLiteral("woman feeding baby")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F37C"), QStringLiteral("man feeding baby"), QStringLiteral("man feeding baby")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F37C"), QStringLiteral("person feeding baby"), QStringLiteral("person feeding baby")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47C"), QStringLiteral("angel"), QStringLiteral("baby angel")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F385"), QStringLiteral("santa"), QStringLiteral("Santa Claus")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F936"), QStringLiteral("mrs_claus"), QStringLiteral("Mrs. Claus")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F384"), QStringLiteral("mx claus"), QStringLiteral("mx claus")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8"), QStringLiteral("superhero"), QStringLiteral("superhero")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man superhero"), QStringLiteral("man superhero")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman superhero"), QStringLiteral("woman superhero")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9"), QStringLiteral("supervillain"), QStringLiteral("supervillain")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man supervillain"), QStringLiteral("man supervillain")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman supervillain"), QStringLiteral("woman supervillain")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9"), QStringLiteral("mage"), QStringLiteral("mage")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mage"), QStringLiteral("man mage")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mage"), QStringLiteral("woman mage")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA"), QStringLiteral("fairy"), QStringLiteral("fairy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man fairy"), QStringLiteral("man fairy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman fairy"), QStringLiteral("woman fairy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB"), QStringLiteral("vampire"), QStringLiteral("vampire")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man vampire"), QStringLiteral("man vampire")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman vampire"), QStringLiteral("woman vampire")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC"), QStringLiteral("merperson"), QStringLiteral("merperson")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("merman"), QStringLiteral("merman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("mermaid"), QStringLiteral("mermaid")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD"), QStringLiteral("elf"), QStringLiteral("elf")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man elf"), QStringLiteral("man elf")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman elf"), QStringLiteral("woman elf")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DE"), QStringLiteral("genie"), QStringLiteral("genie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man genie"), QStringLiteral("man genie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman genie"), QStringLiteral("woman genie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DF"), QStringLiteral("zombie"), QStringLiteral("zombie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man zombie"), QStringLiteral("man zombie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman zombie"), QStringLiteral("woman zombie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CC"), QStringLiteral("troll"), QStringLiteral("troll")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486"), QStringLiteral("massage"), QStringLiteral("person getting massage")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting massage"), QStringLiteral("man getting massage")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting massage"), QStringLiteral("woman getting massage")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487"), QStringLiteral("haircut"), QStringLiteral("person getting haircut")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting haircut"), QStringLiteral("man getting haircut")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting haircut"), QStringLiteral("woman getting haircut")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6"), QStringLiteral("walking"), QStringLiteral("person walking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man walking"), QStringLiteral("man walking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman walking"), QStringLiteral("woman walking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD"), QStringLiteral("person standing"), QStringLiteral("person standing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man standing"), QStringLiteral("man standing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman standing"), QStringLiteral("woman standing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE"), QStringLiteral("person kneeling"), QStringLiteral("person kneeling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man kneeling"), QStringLiteral("man kneeling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman kneeling"), QStringLiteral("woman kneeling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9AF"), QStringLiteral("person with white cane"), QStringLiteral("person with white cane")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9AF"), QStringLiteral("man with white cane"), QStringLiteral("man with white cane")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9AF"), QStringLiteral("woman with white cane"), QStringLiteral("woman with white cane")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9BC"), QStringLiteral("person in motorized wheelchair"), QStringLiteral("person in motorized wheelchair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9BC"), QStringLiteral("man in motorized wheelchair"), QStringLiteral("man in motorized wheelchair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9BC"), QStringLiteral("woman in motorized wheelchair"), QStringLiteral("woman in motorized wheelchair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9BD"), QStringLiteral("person in manual wheelchair"), QStringLiteral("person in manual wheelchair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9BD"), QStringLiteral("man in manual wheelchair"), QStringLiteral("man in manual wheelchair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9BD"), QStringLiteral("woman in manual wheelchair"), QStringLiteral("woman in manual wheelchair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3"), QStringLiteral("runner"), QStringLiteral("person running")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man running"), QStringLiteral("man running")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman running"), QStringLiteral("woman running")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F483"), QStringLiteral("dancer"), QStringLiteral("woman dancing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F57A"), QStringLiteral("man_dancing"), QStringLiteral("man dancing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F574\U0000FE0F"), QStringLiteral("person in suit levitating"), QStringLiteral("person in suit levitating")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46F"), QStringLiteral("dancers"), QStringLiteral("people with bunny ears")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46F\U0000200D\U00002642\U0000FE0F"), QStringLiteral("men with bunny ears"), QStringLiteral("men with bunny ears")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46F\U0000200D\U00002640\U0000FE0F"), QStringLiteral("women with bunny ears"), QStringLiteral("women with bunny ears")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6"), QStringLiteral("person_in_steamy_room"), QStringLiteral("person in steamy room")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in steamy room"), QStringLiteral("man in steamy room")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in steamy room"), QStringLiteral("woman in steamy room")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7"), QStringLiteral("person_climbing"), QStringLiteral("person climbing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man climbing"), QStringLiteral("man climbing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman climbing"), QStringLiteral("woman climbing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93A"), QStringLiteral("fencer"), QStringLiteral("person fencing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C7"), QStringLiteral("horse_racing"), QStringLiteral("horse racing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F7\U0000FE0F"), QStringLiteral("skier"), QStringLiteral("skier")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C2"), QStringLiteral("snowboarder"), QStringLiteral("snowboarder")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0000FE0F"), QStringLiteral("person golfing"), QStringLiteral("person golfing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0000FE0F\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man golfing"), QStringLiteral("man golfing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0000FE0F\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman golfing"), QStringLiteral("woman golfing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4"), QStringLiteral("surfer"), QStringLiteral("person surfing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man surfing"), QStringLiteral("man surfing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman surfing"), QStringLiteral("woman surfing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3"), QStringLiteral("rowboat"), QStringLiteral("person rowing boat")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man rowing boat"), QStringLiteral("man rowing boat")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman rowing boat"), QStringLiteral("woman rowing boat")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA"), QStringLiteral("swimmer"), QStringLiteral("person swimming")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man swimming"), QStringLiteral("man swimming")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman swimming"), QStringLiteral("woman swimming")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0000FE0F"), QStringLiteral("person bouncing ball"), QStringLiteral("person bouncing ball")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0000FE0F\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bouncing ball"), QStringLiteral("man bouncing ball")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0000FE0F\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bouncing ball"), QStringLiteral("woman bouncing ball")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0000FE0F"), QStringLiteral("person lifting weights"), QStringLiteral("person lifting weights")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0000FE0F\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man lifting weights"), QStringLiteral("man lifting weights")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0000FE0F\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman lifting weights"), QStringLiteral("woman lifting weights")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4"), QStringLiteral("bicyclist"), QStringLiteral("person biking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man biking"), QStringLiteral("man biking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman biking"), QStringLiteral("woman biking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5"), QStringLiteral("mountain_bicyclist"), QStringLiteral("person mountain biking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mountain biking"), QStringLiteral("man mountain biking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mountain biking"), QStringLiteral("woman mountain biking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938"), QStringLiteral("cartwheel"), QStringLiteral("person cartwheeling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man cartwheeling"), QStringLiteral("man cartwheeling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman cartwheeling"), QStringLiteral("woman cartwheeling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93C"), QStringLiteral("wrestlers"), QStringLiteral("people wrestling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93C\U0000200D\U00002642\U0000FE0F"), QStringLiteral("men wrestling"), QStringLiteral("men wrestling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93C\U0000200D\U00002640\U0000FE0F"), QStringLiteral("women wrestling"), QStringLiteral("women wrestling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D"), QStringLiteral("water_polo"), QStringLiteral("person playing water polo")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing water polo"), QStringLiteral("man playing water polo")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing water polo"), QStringLiteral("woman playing water polo")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E"), QStringLiteral("handball"), QStringLiteral("person playing handball")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing handball"), QStringLiteral("man playing handball")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing handball"), QStringLiteral("woman playing handball")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939"), QStringLiteral("juggling"), QStringLiteral("person juggling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man juggling"), QStringLiteral("man juggling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman juggling"), QStringLiteral("woman juggling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8"), QStringLiteral("person_in_lotus_position"), QStringLiteral("person in lotus position")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in lotus position"), QStringLiteral("man in lotus position")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in lotus position"), QStringLiteral("woman in lotus position")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C0"), QStringLiteral("bath"), QStringLiteral("person taking bath")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CC"), QStringLiteral("sleeping_accommodation"), QStringLiteral("person in bed")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F91D\U0000200D\U0001F9D1"), QStringLiteral("people holding hands"), QStringLiteral("people holding hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46D"), QStringLiteral("two_women_holding_hands"), QStringLiteral("women holding hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46B"), QStringLiteral("couple"), QStringLiteral("woman and man holding hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46C"), QStringLiteral("two_men_holding_hands"), QStringLiteral("men holding hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48F"), QStringLiteral("couplekiss"), QStringLiteral("kiss")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468"), QStringLiteral("kiss: woman, man"), QStringLiteral("kiss: woman, man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468"), QStringLiteral("kiss: man, man"), QStringLiteral("kiss: man, man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469"), QStringLiteral("kiss: woman, woman"), QStringLiteral("kiss: woman, woman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F491"), QStringLiteral("couple_with_heart"), QStringLiteral("couple with heart")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468"), QStringLiteral("couple with heart: woman, man"), QStringLiteral("couple with heart: woman, man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468"), QStringLiteral("couple with heart: man, man"), QStringLiteral("couple with heart: man, man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469"), QStringLiteral("couple with heart: woman, woman"), QStringLiteral("couple with heart: woman, woman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46A"), QStringLiteral("family"), QStringLiteral("family")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F469\U0000200D\U0001F466"), QStringLiteral("family: man, woman, boy"), QStringLiteral("family: man, woman, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467"), QStringLiteral("family: man, woman, girl"), QStringLiteral("family: man, woman, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F466"), QStringLiteral("family: man, woman, girl, boy"), QStringLiteral("family: man, woman, girl, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F469\U0000200D\U0001F466\U0000200D\U0001F466"), QStringLiteral("family: man, woman, boy, boy"), QStringLiteral("family: man, woman, boy, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F467"), QStringLiteral("family: man, woman, girl, girl"), QStringLiteral("family: man, woman, girl, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F468\U0000200D\U0001F466"), QStringLiteral("family: man, man, boy"), QStringLiteral("family: man, man, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F468\U0000200D\U0001F467"), QStringLiteral("family: man, man, girl"), QStringLiteral("family: man, man, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F468\U0000200D\U0001F467\U0000200D\U0001F466"), QStringLiteral("family: man, man, girl, boy"), QStringLiteral("family: man, man, girl, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F468\U0000200D\U0001F466\U0000200D\U0001F466"), QStringLiteral("family: man, man, boy, boy"), QStringLiteral("family: man, man, boy, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F468\U0000200D\U0001F467\U0000200D\U0001F467"), QStringLiteral("family: man, man, girl, girl"), QStringLiteral("family: man, man, girl, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F469\U0000200D\U0001F466"), QStringLiteral("family: woman, woman, boy"), QStringLiteral("family: woman, woman, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F469\U0000200D\U0001F467"), QStringLiteral("family: woman, woman, girl"), QStringLiteral("family: woman, woman, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F466"), QStringLiteral("family: woman, woman, girl, boy"), QStringLiteral("family: woman, woman, girl, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F469\U0000200D\U0001F466\U0000200D\U0001F466"), QStringLiteral("family: woman, woman, boy, boy"), QStringLiteral("family: woman, woman, boy, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F467"), QStringLiteral("family: woman, woman, girl, girl"), QStringLiteral("family: woman, woman, girl, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F466"), QStringLiteral("family: man, boy"), QStringLiteral("family: man, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F466\U0000200D\U0001F466"), QStringLiteral("family: man, boy, boy"), QStringLiteral("family: man, boy, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F467"), QStringLiteral("family: man, girl"), QStringLiteral("family: man, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F467\U0000200D\U0001F466"), QStringLiteral("family: man, girl, boy"), QStringLiteral("family: man, girl, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F467\U0000200D\U0001F467"), QStringLiteral("family: man, girl, girl"), QStringLiteral("family: man, girl, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F466"), QStringLiteral("family: woman, boy"), QStringLiteral("family: woman, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F466\U0000200D\U0001F466"), QStringLiteral("family: woman, boy, boy"), QStringLiteral("family: woman, boy, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F467"), QStringLiteral("family: woman, girl"), QStringLiteral("family: woman, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F467\U0000200D\U0001F466"), QStringLiteral("family: woman, girl, boy"), QStringLiteral("family: woman, girl, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F467\U0000200D\U0001F467"), QStringLiteral("family: woman, girl, girl"), QStringLiteral("family: woman, girl, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5E3\U0000FE0F"), QStringLiteral("speaking head"), QStringLiteral("speaking head")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F464"), QStringLiteral("bust_in_silhouette"), QStringLiteral("bust in silhouette")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F465"), QStringLiteral("busts_in_silhouette"), QStringLiteral("busts in silhouette")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC2"), QStringLiteral("people hugging"), QStringLiteral("people hugging")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F463"), QStringLiteral("footprints"), QStringLiteral("footprints")}));
-_emojis[Component].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B0"), QStringLiteral("red_haired"), QStringLiteral("red hair")}));
-_emojis[Component].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B1"), QStringLiteral("curly_haired"), QStringLiteral("curly hair")}));
-_emojis[Component].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B3"), QStringLiteral("white_haired"), QStringLiteral("white hair")}));
-_emojis[Component].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B2"), QStringLiteral("bald"), QStringLiteral("bald")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F435"), QStringLiteral("monkey_face"), QStringLiteral("monkey face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F412"), QStringLiteral("monkey"), QStringLiteral("monkey")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F98D"), QStringLiteral("gorilla"), QStringLiteral("gorilla")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A7"), QStringLiteral("orangutan"), QStringLiteral("orangutan")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F436"), QStringLiteral("dog"), QStringLiteral("dog face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F415"), QStringLiteral("dog2"), QStringLiteral("dog")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9AE"), QStringLiteral("guide dog"), QStringLiteral("guide dog")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F415\U0000200D\U0001F9BA"), QStringLiteral("service dog"), QStringLiteral("service dog")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F429"), QStringLiteral("poodle"), QStringLiteral("poodle")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43A"), QStringLiteral("wolf"), QStringLiteral("wolf")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F98A"), QStringLiteral("fox"), QStringLiteral("fox")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F99D"), QStringLiteral("raccoon"), QStringLiteral("raccoon")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F431"), QStringLiteral("cat"), QStringLiteral("cat face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F408"), QStringLiteral("cat2"), QStringLiteral("cat")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F408\U0000200D\U00002B1B"), QStringLiteral("black cat"), QStringLiteral("black cat")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F981"), QStringLiteral("lion_face"), QStringLiteral("lion")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F42F"), QStringLiteral("tiger"), QStringLiteral("tiger face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F405"), QStringLiteral("tiger2"), QStringLiteral("tiger")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F406"), QStringLiteral("leopard"), QStringLiteral("leopard")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F434"), QStringLiteral("horse"), QStringLiteral("horse face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F40E"), QStringLiteral("racehorse"), QStringLiteral("horse")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F984"), QStringLiteral("unicorn"), QStringLiteral("unicorn")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F993"), QStringLiteral("zebra"), QStringLiteral("zebra")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F98C"), QStringLiteral("deer"), QStringLiteral("deer")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9AC"), QStringLiteral("bison"), QStringLiteral("bison")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F42E"), QStringLiteral("cow"), QStringLiteral("cow face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F402"), QStringLiteral("ox"), QStringLiteral("ox")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F403"), QStringLiteral("water_buffalo"), QStringLiteral("water buffalo")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F404"), QStringLiteral("cow2"), QStringLiteral("cow")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F437"), QStringLiteral("pig"), QStringLiteral("pig face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F416"), QStringLiteral("pig2"), QStringLiteral("pig")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F417"), QStringLiteral("boar"), QStringLiteral("boar")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43D"), QStringLiteral("pig_nose"), QStringLiteral("pig nose")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F40F"), QStringLiteral("ram"), QStringLiteral("ram")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F411"), QStringLiteral("sheep"), QStringLiteral("ewe")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F410"), QStringLiteral("goat"), QStringLiteral("goat")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F42A"), QStringLiteral("dromedary_camel"), QStringLiteral("camel")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F42B"), QStringLiteral("camel"), QStringLiteral("two-hump camel")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F999"), QStringLiteral("llama"), QStringLiteral("llama")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F992"), QStringLiteral("giraffe"), QStringLiteral("giraffe")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F418"), QStringLiteral("elephant"), QStringLiteral("elephant")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A3"), QStringLiteral("mammoth"), QStringLiteral("mammoth")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F98F"), QStringLiteral("rhino"), QStringLiteral("rhinoceros")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F99B"), QStringLiteral("hippopotamus"), QStringLiteral("hippopotamus")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F42D"), QStringLiteral("mouse"), QStringLiteral("mouse face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F401"), QStringLiteral("mouse2"), QStringLiteral("mouse")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F400"), QStringLiteral("rat"), QStringLiteral("rat")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F439"), QStringLiteral("hamster"), QStringLiteral("hamster")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F430"), QStringLiteral("rabbit"), QStringLiteral("rabbit face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F407"), QStringLiteral("rabbit2"), QStringLiteral("rabbit")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43F\U0000FE0F"), QStringLiteral("chipmunk"), QStringLiteral("chipmunk")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9AB"), QStringLiteral("beaver"), QStringLiteral("beaver")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F994"), QStringLiteral("hedgehog"), QStringLiteral("hedgehog")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F987"), QStringLiteral("bat"), QStringLiteral("bat")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43B"), QStringLiteral("bear"), QStringLiteral("bear")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43B\U0000200D\U00002744\U0000FE0F"), QStringLiteral("polar bear"), QStringLiteral("polar bear")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F428"), QStringLiteral("koala"), QStringLiteral("koala")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43C"), QStringLiteral("panda_face"), QStringLiteral("panda")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A5"), QStringLiteral("sloth"), QStringLiteral("sloth")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A6"), QStringLiteral("otter"), QStringLiteral("otter")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A8"), QStringLiteral("skunk"), QStringLiteral("skunk")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F998"), QStringLiteral("kangaroo"), QStringLiteral("kangaroo")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A1"), QStringLiteral("badger"), QStringLiteral("badger")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43E"), QStringLiteral("feet"), QStringLiteral("paw prints")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F983"), QStringLiteral("turkey"), QStringLiteral("turkey")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F414"), QStringLiteral("chicken"), QStringLiteral("chicken")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F413"), QStringLiteral("rooster"), QStringLiteral("rooster")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F423"), QStringLiteral("hatching_chick"), QStringLiteral("hatching chick")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F424"), QStringLiteral("baby_chick"), QStringLiteral("baby chick")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F425"), QStringLiteral("hatched_chick"), QStringLiteral("front-facing baby chick")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F426"), QStringLiteral("bird"), QStringLiteral("bird")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F427"), QStringLiteral("penguin"), QStringLiteral("penguin")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F54A\U0000FE0F"), QStringLiteral("dove"), QStringLiteral("dove")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F985"), QStringLiteral("eagle"), QStringLiteral("eagle")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F986"), QStringLiteral("duck"), QStringLiteral("duck")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A2"), QStringLiteral("swan"), QStringLiteral("swan")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F989"), QStringLiteral("owl"), QStringLiteral("owl")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A4"), QStringLiteral("dodo"), QStringLiteral("dodo")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB6"), QStringLiteral("feather"), QStringLiteral("feather")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A9"), QStringLiteral("flamingo"), QStringLiteral("flamingo")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F99A"), QStringLiteral("peacock"), QStringLiteral("peacock")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F99C"), QStringLiteral("parrot"), QStringLiteral("parrot")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F438"), QStringLiteral("frog"), QStringLiteral("frog")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F40A"), QStringLiteral("crocodile"), QStringLiteral("crocodile")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F422"), QStringLiteral("turtle"), QStringLiteral("turtle")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F98E"), QStringLiteral("lizard"), QStringLiteral("lizard")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F40D"), QStringLiteral("snake"), QStringLiteral("snake")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F432"), QStringLiteral("dragon_face"), QStringLiteral("dragon face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F409"), QStringLiteral("dragon"), QStringLiteral("dragon")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F995"), QStringLiteral("sauropod"), QStringLiteral("sauropod")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F996"), QStringLiteral("t_rex"), QStringLiteral("T-Rex")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F433"), QStringLiteral("whale"), QStringLiteral("spouting whale")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F40B"), QStringLiteral("whale2"), QStringLiteral("whale")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F42C"), QStringLiteral("dolphin"), QStringLiteral("dolphin")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9AD"), QStringLiteral("seal"), QStringLiteral("seal")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F41F"), QStringLiteral("fish"), QStringLiteral("fish")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F420"), QStringLiteral("tropical_fish"), QStringLiteral("tropical fish")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F421"), QStringLiteral("blowfish"), QStringLiteral("blowfish")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F988"), QStringLiteral("shark"), QStringLiteral("shark")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F419"), QStringLiteral("octopus"), QStringLiteral("octopus")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F41A"), QStringLiteral("shell"), QStringLiteral("spiral shell")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB8"), QStringLiteral("coral"), QStringLiteral("coral")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F40C"), QStringLiteral("snail"), QStringLiteral("snail")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F98B"), QStringLiteral("butterfly"), QStringLiteral("butterfly")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F41B"), QStringLiteral("bug"), QStringLiteral("bug")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F41C"), QStringLiteral("ant"), QStringLiteral("ant")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F41D"), QStringLiteral("bee"), QStringLiteral("honeybee")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB2"), QStringLiteral("beetle"), QStringLiteral("beetle")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F41E"), QStringLiteral("beetle"), QStringLiteral("lady beetle")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F997"), QStringLiteral("cricket"), QStringLiteral("cricket")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB3"), QStringLiteral("cockroach"), QStringLiteral("cockroach")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F577\U0000FE0F"), QStringLiteral("spider"), QStringLiteral("spider")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F578\U0000FE0F"), QStringLiteral("spider web"), QStringLiteral("spider web")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F982"), QStringLiteral("scorpion"), QStringLiteral("scorpion")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F99F"), QStringLiteral("mosquito"), QStringLiteral("mosquito")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB0"), QStringLiteral("fly"), QStringLiteral("fly")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB1"), QStringLiteral("worm"), QStringLiteral("worm")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A0"), QStringLiteral("microbe"), QStringLiteral("microbe")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F490"), QStringLiteral("bouquet"), QStringLiteral("bouquet")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F338"), QStringLiteral("cherry_blossom"), QStringLiteral("cherry blossom")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AE"), QStringLiteral("white_flower"), QStringLiteral("white flower")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB7"), QStringLiteral("lotus"), QStringLiteral("lotus")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F5\U0000FE0F"), QStringLiteral("rosette"), QStringLiteral("rosette")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F339"), QStringLiteral("rose"), QStringLiteral("rose")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F940"), QStringLiteral("wilted_rose"), QStringLiteral("wilted flower")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F33A"), QStringLiteral("hibiscus"), QStringLiteral("hibiscus")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F33B"), QStringLiteral("sunflower"), QStringLiteral("sunflower")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F33C"), QStringLiteral("blossom"), QStringLiteral("blossom")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F337"), QStringLiteral("tulip"), QStringLiteral("tulip")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F331"), QStringLiteral("seedling"), QStringLiteral("seedling")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB4"), QStringLiteral("potted plant"), QStringLiteral("potted plant")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F332"), QStringLiteral("evergreen_tree"), QStringLiteral("evergreen tree")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F333"), QStringLiteral("deciduous_tree"), QStringLiteral("deciduous tree")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F334"), QStringLiteral("palm_tree"), QStringLiteral("palm tree")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F335"), QStringLiteral("cactus"), QStringLiteral("cactus")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F33E"), QStringLiteral("ear_of_rice"), QStringLiteral("sheaf of rice")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F33F"), QStringLiteral("herb"), QStringLiteral("herb")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002618\U0000FE0F"), QStringLiteral("shamrock"), QStringLiteral("shamrock")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F340"), QStringLiteral("four_leaf_clover"), QStringLiteral("four leaf clover")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F341"), QStringLiteral("maple_leaf"), QStringLiteral("maple leaf")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F342"), QStringLiteral("fallen_leaf"), QStringLiteral("fallen leaf")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F343"), QStringLiteral("leaves"), QStringLiteral("leaf fluttering in wind")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB9"), QStringLiteral("empty nest"), QStringLiteral("empty nest")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FABA"), QStringLiteral("nest with eggs"), QStringLiteral("nest with eggs")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F347"), QStringLiteral("grapes"), QStringLiteral("grapes")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F348"), QStringLiteral("melon"), QStringLiteral("melon")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F349"), QStringLiteral("watermelon"), QStringLiteral("watermelon")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F34A"), QStringLiteral("tangerine"), QStringLiteral("tangerine")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F34B"), QStringLiteral("lemon"), QStringLiteral("lemon")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F34C"), QStringLiteral("banana"), QStringLiteral("banana")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F34D"), QStringLiteral("pineapple"), QStringLiteral("pineapple")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F96D"), QStringLiteral("mango"), QStringLiteral("mango")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F34E"), QStringLiteral("apple"), QStringLiteral("red apple")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F34F"), QStringLiteral("green_apple"), QStringLiteral("green apple")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F350"), QStringLiteral("pear"), QStringLiteral("pear")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F351"), QStringLiteral("peach"), QStringLiteral("peach")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F352"), QStringLiteral("cherries"), QStringLiteral("cherries")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F353"), QStringLiteral("strawberry"), QStringLiteral("strawberry")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD0"), QStringLiteral("blueberries"), QStringLiteral("blueberries")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F95D"), QStringLiteral("kiwi"), QStringLiteral("kiwi fruit")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F345"), QStringLiteral("tomato"), QStringLiteral("tomato")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD2"), QStringLiteral("olive"), QStringLiteral("olive")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F965"), QStringLiteral("coconut"), QStringLiteral("coconut")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F951"), QStringLiteral("avocado"), QStringLiteral("avocado")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F346"), QStringLiteral("eggplant"), QStringLiteral("eggplant")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F954"), QStringLiteral("potato"), QStringLiteral("potato")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F955"), QStringLiteral("carrot"), QStringLiteral("carrot")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F33D"), QStringLiteral("corn"), QStringLiteral("ear of corn")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F336\U0000FE0F"), QStringLiteral("hot pepper"), QStringLiteral("hot pepper")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD1"), QStringLiteral("bell pepper"), QStringLiteral("bell pepper")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F952"), QStringLiteral("cucumber"), QStringLiteral("cucumber")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F96C"), QStringLiteral("leafy_green"), QStringLiteral("leafy green")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F966"), QStringLiteral("broccoli"), QStringLiteral("broccoli")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C4"), QStringLiteral("garlic"), QStringLiteral("garlic")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C5"), QStringLiteral("onion"), QStringLiteral("onion")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F344"), QStringLiteral("mushroom"), QStringLiteral("mushroom")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F95C"), QStringLiteral("peanuts"), QStringLiteral("peanuts")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD8"), QStringLiteral("beans"), QStringLiteral("beans")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F330"), QStringLiteral("chestnut"), QStringLiteral("chestnut")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F35E"), QStringLiteral("bread"), QStringLiteral("bread")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F950"), QStringLiteral("croissant"), QStringLiteral("croissant")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F956"), QStringLiteral("french_bread"), QStringLiteral("baguette bread")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD3"), QStringLiteral("flatbread"), QStringLiteral("flatbread")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F968"), QStringLiteral("pretzel"), QStringLiteral("pretzel")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F96F"), QStringLiteral("bagel"), QStringLiteral("bagel")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F95E"), QStringLiteral("pancakes"), QStringLiteral("pancakes")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C7"), QStringLiteral("waffle"), QStringLiteral("waffle")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C0"), QStringLiteral("cheese"), QStringLiteral("cheese wedge")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F356"), QStringLiteral("meat_on_bone"), QStringLiteral("meat on bone")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F357"), QStringLiteral("poultry_leg"), QStringLiteral("poultry leg")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F969"), QStringLiteral("cut_of_meat"), QStringLiteral("cut of meat")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F953"), QStringLiteral("bacon"), QStringLiteral("bacon")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F354"), QStringLiteral("hamburger"), QStringLiteral("hamburger")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F35F"), QStringLiteral("fries"), QStringLiteral("french fries")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F355"), QStringLiteral("pizza"), QStringLiteral("pizza")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F32D"), QStringLiteral("hotdog"), QStringLiteral("hot dog")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F96A"), QStringLiteral("sandwich"), QStringLiteral("sandwich")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F32E"), QStringLiteral("taco"), QStringLiteral("taco")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F32F"), QStringLiteral("burrito"), QStringLiteral("burrito")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD4"), QStringLiteral("tamale"), QStringLiteral("tamale")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F959"), QStringLiteral("stuffed_flatbread"), QStringLiteral("stuffed flatbread")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C6"), QStringLiteral("falafel"), QStringLiteral("falafel")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F95A"), QStringLiteral("egg"), QStringLiteral("egg")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F373"), QStringLiteral("cooking"), QStringLiteral("cooking")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F958"), QStringLiteral("shallow_pan_of_food"), QStringLiteral("shallow pan of food")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F372"), QStringLiteral("stew"), QStringLiteral("pot of food")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD5"), QStringLiteral("fondue"), QStringLiteral("fondue")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F963"), QStringLiteral("bowl_with_spoon"), QStringLiteral("bowl with spoon")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F957"), QStringLiteral("salad"), QStringLiteral("green salad")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F37F"), QStringLiteral("popcorn"), QStringLiteral("popcorn")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C8"), QStringLiteral("butter"), QStringLiteral("butter")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C2"), QStringLiteral("salt"), QStringLiteral("salt")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F96B"), QStringLiteral("canned_food"), QStringLiteral("canned food")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F371"), QStringLiteral("bento"), QStringLiteral("bento box")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F358"), QStringLiteral("rice_cracker"), QStringLiteral("rice cracker")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F359"), QStringLiteral("rice_ball"), QStringLiteral("rice ball")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F35A"), QStringLiteral("rice"), QStringLiteral("cooked rice")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F35B"), QStringLiteral("curry"), QStringLiteral("curry rice")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F35C"), QStringLiteral("ramen"), QStringLiteral("steaming bowl")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F35D"), QStringLiteral("spaghetti"), QStringLiteral("spaghetti")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F360"), QStringLiteral("sweet_potato"), QStringLiteral("roasted sweet potato")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F362"), QStringLiteral("oden"), QStringLiteral("oden")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F363"), QStringLiteral("sushi"), QStringLiteral("sushi")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F364"), QStringLiteral("fried_shrimp"), QStringLiteral("fried shrimp")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F365"), QStringLiteral("fish_cake"), QStringLiteral("fish cake with swirl")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F96E"), QStringLiteral("moon_cake"), QStringLiteral("moon cake")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F361"), QStringLiteral("dango"), QStringLiteral("dango")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F95F"), QStringLiteral("dumpling"), QStringLiteral("dumpling")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F960"), QStringLiteral("fortune_cookie"), QStringLiteral("fortune cookie")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F961"), QStringLiteral("takeout_box"), QStringLiteral("takeout box")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F980"), QStringLiteral("crab"), QStringLiteral("crab")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F99E"), QStringLiteral("lobster"), QStringLiteral("lobster")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F990"), QStringLiteral("shrimp"), QStringLiteral("shrimp")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F991"), QStringLiteral("squid"), QStringLiteral("squid")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9AA"), QStringLiteral("oyster"), QStringLiteral("oyster")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F366"), QStringLiteral("icecream"), QStringLiteral("soft ice cream")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F367"), QStringLiteral("shaved_ice"), QStringLiteral("shaved ice")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F368"), QStringLiteral("ice_cream"), QStringLiteral("ice cream")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F369"), QStringLiteral("doughnut"), QStringLiteral("doughnut")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F36A"), QStringLiteral("cookie"), QStringLiteral("cookie")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F382"), QStringLiteral("birthday"), QStringLiteral("birthday cake")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F370"), QStringLiteral("cake"), QStringLiteral("shortcake")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C1"), QStringLiteral("cupcake"), QStringLiteral("cupcake")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F967"), QStringLiteral("pie"), QStringLiteral("pie")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F36B"), QStringLiteral("chocolate_bar"), QStringLiteral("chocolate bar")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F36C"), QStringLiteral("candy"), QStringLiteral("candy")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F36D"), QStringLiteral("lollipop"), QStringLiteral("lollipop")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F36E"), QStringLiteral("custard"), QStringLiteral("custard")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F36F"), QStringLiteral("honey_pot"), QStringLiteral("honey pot")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F37C"), QStringLiteral("baby_bottle"), QStringLiteral("baby bottle")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F95B"), QStringLiteral("milk"), QStringLiteral("glass of milk")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002615"), QStringLiteral("coffee"), QStringLiteral("hot beverage")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD6"), QStringLiteral("teapot"), QStringLiteral("teapot")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F375"), QStringLiteral("tea"), QStringLiteral("teacup without handle")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F376"), QStringLiteral("sake"), QStringLiteral("sake")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F37E"), QStringLiteral("champagne"), QStringLiteral("bottle with popping cork")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F377"), QStringLiteral("wine_glass"), QStringLiteral("wine glass")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F378"), QStringLiteral("cocktail"), QStringLiteral("cocktail glass")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F379"), QStringLiteral("tropical_drink"), QStringLiteral("tropical drink")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F37A"), QStringLiteral("beer"), QStringLiteral("beer mug")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F37B"), QStringLiteral("beers"), QStringLiteral("clinking beer mugs")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F942"), QStringLiteral("champagne_glass"), QStringLiteral("clinking glasses")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F943"), QStringLiteral("tumbler_glass"), QStringLiteral("tumbler glass")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD7"), QStringLiteral("pouring liquid"), QStringLiteral("pouring liquid")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F964"), QStringLiteral("cup_with_straw"), QStringLiteral("cup with straw")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CB"), QStringLiteral("bubble tea"), QStringLiteral("bubble tea")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C3"), QStringLiteral("beverage box"), QStringLiteral("beverage box")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C9"), QStringLiteral("mate"), QStringLiteral("mate")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CA"), QStringLiteral("ice"), QStringLiteral("ice")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F962"), QStringLiteral("chopsticks"), QStringLiteral("chopsticks")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F37D\U0000FE0F"), QStringLiteral("fork and knife with plate"), QStringLiteral("fork and knife with plate")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F374"), QStringLiteral("fork_and_knife"), QStringLiteral("fork and knife")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F944"), QStringLiteral("spoon"), QStringLiteral("spoon")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F52A"), QStringLiteral("knife"), QStringLiteral("kitchen knife")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD9"), QStringLiteral("jar"), QStringLiteral("jar")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3FA"), QStringLiteral("amphora"), QStringLiteral("amphora")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F30D"), QStringLiteral("earth_africa"), QStringLiteral("globe showing Europe-Africa")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F30E"), QStringLiteral("earth_americas"), QStringLiteral("globe showing Americas")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F30F"), QStringLiteral("earth_asia"), QStringLiteral("globe showing Asia-Australia")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F310"), QStringLiteral("globe_with_meridians"), QStringLiteral("globe with meridians")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5FA\U0000FE0F"), QStringLiteral("world map"), QStringLiteral("world map")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5FE"), QStringLiteral("japan"), QStringLiteral("map of Japan")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9ED"), QStringLiteral("compass"), QStringLiteral("compass")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D4\U0000FE0F"), QStringLiteral("snow-capped mountain"), QStringLiteral("snow-capped mountain")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F0\U0000FE0F"), QStringLiteral("mountain"), QStringLiteral("mountain")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F30B"), QStringLiteral("volcano"), QStringLiteral("volcano")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5FB"), QStringLiteral("mount_fuji"), QStringLiteral("mount fuji")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D5\U0000FE0F"), QStringLiteral("camping"), QStringLiteral("camping")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D6\U0000FE0F"), QStringLiteral("beach with umbrella"), QStringLiteral("beach with umbrella")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3DC\U0000FE0F"), QStringLiteral("desert"), QStringLiteral("desert")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3DD\U0000FE0F"), QStringLiteral("desert island"), QStringLiteral("desert island")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3DE\U0000FE0F"), QStringLiteral("national park"), QStringLiteral("national park")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3DF\U0000FE0F"), QStringLiteral("stadium"), QStringLiteral("stadium")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3DB\U0000FE0F"), QStringLiteral("classical building"), QStringLiteral("classical building")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D7\U0000FE0F"), QStringLiteral("building construction"), QStringLiteral("building construction")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F1"), QStringLiteral("bricks"), QStringLiteral("brick")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA8"), QStringLiteral("rock"), QStringLiteral("rock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB5"), QStringLiteral("wood"), QStringLiteral("wood")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6D6"), QStringLiteral("hut"), QStringLiteral("hut")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D8\U0000FE0F"), QStringLiteral("houses"), QStringLiteral("houses")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3DA\U0000FE0F"), QStringLiteral("derelict house"), QStringLiteral("derelict house")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E0"), QStringLiteral("house"), QStringLiteral("house")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E1"), QStringLiteral("house_with_garden"), QStringLiteral("house with garden")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E2"), QStringLiteral("office"), QStringLiteral("office building")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E3"), QStringLiteral("post_office"), QStringLiteral("Japanese post office")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E4"), QStringLiteral("european_post_office"), QStringLiteral("post office")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E5"), QStringLiteral("hospital"), QStringLiteral("hospital")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E6"), QStringLiteral("bank"), QStringLiteral("bank")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E8"), QStringLiteral("hotel"), QStringLiteral("hotel")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E9"), QStringLiteral("love_hotel"), QStringLiteral("love hotel")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3EA"), QStringLiteral("convenience_store"), QStringLiteral("convenience store")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3EB"), QStringLiteral("school"), QStringLiteral("school")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3EC"), QStringLiteral("department_store"), QStringLiteral("department store")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3ED"), QStringLiteral("factory"), QStringLiteral("factory")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3EF"), QStringLiteral("japanese_castle"), QStringLiteral("Japanese castle")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F0"), QStringLiteral("european_castle"), QStringLiteral("castle")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F492"), QStringLiteral("wedding"), QStringLiteral("wedding")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5FC"), QStringLiteral("tokyo_tower"), QStringLiteral("Tokyo tower")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5FD"), QStringLiteral("statue_of_liberty"), QStringLiteral("Statue of Liberty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026EA"), QStringLiteral("church"), QStringLiteral("church")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F54C"), QStringLiteral("mosque"), QStringLiteral("mosque")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6D5"), QStringLiteral("hindu temple"), QStringLiteral("hindu temple")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F54D"), QStringLiteral("synagogue"), QStringLiteral("synagogue")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026E9\U0000FE0F"), QStringLiteral("shinto shrine"), QStringLiteral("shinto shrine")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F54B"), QStringLiteral("kaaba"), QStringLiteral("kaaba")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F2"), QStringLiteral("fountain"), QStringLiteral("fountain")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026FA"), QStringLiteral("tent"), QStringLiteral("tent")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F301"), QStringLiteral("foggy"), QStringLiteral("foggy")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F303"), QStringLiteral("night_with_stars"), QStringLiteral("night with stars")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D9\U0000FE0F"), QStringLiteral("cityscape"), QStringLiteral("cityscape")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F304"), QStringLiteral("sunrise_over_mountains"), QStringLiteral("sunrise over mountains")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F305"), QStringLiteral("sunrise"), QStringLiteral("sunrise")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F306"), QStringLiteral("city_dusk"), QStringLiteral("cityscape at dusk")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F307"), QStringLiteral("city_sunset"), QStringLiteral("sunset")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F309"), QStringLiteral("bridge_at_night"), QStringLiteral("bridge at night")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002668\U0000FE0F"), QStringLiteral("hot springs"), QStringLiteral("hot springs")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A0"), QStringLiteral("carousel_horse"), QStringLiteral("carousel horse")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6DD"), QStringLiteral("playground slide"), QStringLiteral("playground slide")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A1"), QStringLiteral("ferris_wheel"), QStringLiteral("ferris wheel")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A2"), QStringLiteral("roller_coaster"), QStringLiteral("roller coaster")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F488"), QStringLiteral("barber"), QStringLiteral("barber pole")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3AA"), QStringLiteral("circus_tent"), QStringLiteral("circus tent")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F682"), QStringLiteral("steam_locomotive"), QStringLiteral("locomotive")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F683"), QStringLiteral("railway_car"), QStringLiteral("railway car")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F684"), QStringLiteral("bullettrain_side"), QStringLiteral("high-speed train")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F685"), QStringLiteral("bullettrain_front"), QStringLiteral("bullet train")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F686"), QStringLiteral("train2"), QStringLiteral("train")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F687"), QStringLiteral("metro"), QStringLiteral("metro")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F688"), QStringLiteral("light_rail"), QStringLiteral("light rail")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F689"), QStringLiteral("station"), QStringLiteral("station")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F68A"), QStringLiteral("tram"), QStringLiteral("tram")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F69D"), QStringLiteral("monorail"), QStringLiteral("monorail")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F69E"), QStringLiteral("mountain_railway"), QStringLiteral("mountain railway")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F68B"), QStringLiteral("train"), QStringLiteral("tram car")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F68C"), QStringLiteral("bus"), QStringLiteral("bus")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F68D"), QStringLiteral("oncoming_bus"), QStringLiteral("oncoming bus")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F68E"), QStringLiteral("trolleybus"), QStringLiteral("trolleybus")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F690"), QStringLiteral("minibus"), QStringLiteral("minibus")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F691"), QStringLiteral("ambulance"), QStringLiteral("ambulance")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F692"), QStringLiteral("fire_engine"), QStringLiteral("fire engine")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F693"), QStringLiteral("police_car"), QStringLiteral("police car")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F694"), QStringLiteral("oncoming_police_car"), QStringLiteral("oncoming police car")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F695"), QStringLiteral("taxi"), QStringLiteral("taxi")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F696"), QStringLiteral("oncoming_taxi"), QStringLiteral("oncoming taxi")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F697"), QStringLiteral("red_car"), QStringLiteral("automobile")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F698"), QStringLiteral("oncoming_automobile"), QStringLiteral("oncoming automobile")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F699"), QStringLiteral("blue_car"), QStringLiteral("sport utility vehicle")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6FB"), QStringLiteral("pickup truck"), QStringLiteral("pickup truck")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F69A"), QStringLiteral("truck"), QStringLiteral("delivery truck")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F69B"), QStringLiteral("articulated_lorry"), QStringLiteral("articulated lorry")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F69C"), QStringLiteral("tractor"), QStringLiteral("tractor")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CE\U0000FE0F"), QStringLiteral("racing car"), QStringLiteral("racing car")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CD\U0000FE0F"), QStringLiteral("motorcycle"), QStringLiteral("motorcycle")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F5"), QStringLiteral("motor_scooter"), QStringLiteral("motor scooter")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BD"), QStringLiteral("manual wheelchair"), QStringLiteral("manual wheelchair")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BC"), QStringLiteral("motorized wheelchair"), QStringLiteral("motorized wheelchair")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6FA"), QStringLiteral("auto rickshaw"), QStringLiteral("auto rickshaw")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B2"), QStringLiteral("bike"), QStringLiteral("bicycle")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F4"), QStringLiteral("scooter"), QStringLiteral("kick scooter")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F9"), QStringLiteral("skateboard"), QStringLiteral("skateboard")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6FC"), QStringLiteral("roller skate"), QStringLiteral("roller skate")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F68F"), QStringLiteral("busstop"), QStringLiteral("bus stop")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E3\U0000FE0F"), QStringLiteral("motorway"), QStringLiteral("motorway")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E4\U0000FE0F"), QStringLiteral("railway track"), QStringLiteral("railway track")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E2\U0000FE0F"), QStringLiteral("oil drum"), QStringLiteral("oil drum")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026FD"), QStringLiteral("fuelpump"), QStringLiteral("fuel pump")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6DE"), QStringLiteral("wheel"), QStringLiteral("wheel")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A8"), QStringLiteral("rotating_light"), QStringLiteral("police car light")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A5"), QStringLiteral("traffic_light"), QStringLiteral("horizontal traffic light")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A6"), QStringLiteral("vertical_traffic_light"), QStringLiteral("vertical traffic light")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6D1"), QStringLiteral("octagonal_sign"), QStringLiteral("stop sign")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A7"), QStringLiteral("construction"), QStringLiteral("construction")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002693"), QStringLiteral("anchor"), QStringLiteral("anchor")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6DF"), QStringLiteral("ring buoy"), QStringLiteral("ring buoy")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F5"), QStringLiteral("sailboat"), QStringLiteral("sailboat")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F6"), QStringLiteral("canoe"), QStringLiteral("canoe")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A4"), QStringLiteral("speedboat"), QStringLiteral("speedboat")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F3\U0000FE0F"), QStringLiteral("passenger ship"), QStringLiteral("passenger ship")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F4\U0000FE0F"), QStringLiteral("ferry"), QStringLiteral("ferry")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E5\U0000FE0F"), QStringLiteral("motor boat"), QStringLiteral("motor boat")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A2"), QStringLiteral("ship"), QStringLiteral("ship")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002708\U0000FE0F"), QStringLiteral("airplane"), QStringLiteral("airplane")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E9\U0000FE0F"), QStringLiteral("small airplane"), QStringLiteral("small airplane")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6EB"), QStringLiteral("airplane_departure"), QStringLiteral("airplane departure")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6EC"), QStringLiteral("airplane_arriving"), QStringLiteral("airplane arrival")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA82"), QStringLiteral("parachute"), QStringLiteral("parachute")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4BA"), QStringLiteral("seat"), QStringLiteral("seat")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F681"), QStringLiteral("helicopter"), QStringLiteral("helicopter")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F69F"), QStringLiteral("suspension_railway"), QStringLiteral("suspension railway")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A0"), QStringLiteral("mountain_cableway"), QStringLiteral("mountain cableway")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A1"), QStringLiteral("aerial_tramway"), QStringLiteral("aerial tramway")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F0\U0000FE0F"), QStringLiteral("satellite"), QStringLiteral("satellite")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F680"), QStringLiteral("rocket"), QStringLiteral("rocket")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F8"), QStringLiteral("flying_saucer"), QStringLiteral("flying saucer")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CE\U0000FE0F"), QStringLiteral("bellhop bell"), QStringLiteral("bellhop bell")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F3"), QStringLiteral("luggage"), QStringLiteral("luggage")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000231B"), QStringLiteral("hourglass"), QStringLiteral("hourglass done")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023F3"), QStringLiteral("hourglass_flowing_sand"), QStringLiteral("hourglass not done")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000231A"), QStringLiteral("watch"), QStringLiteral("watch")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023F0"), QStringLiteral("alarm_clock"), QStringLiteral("alarm clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023F1\U0000FE0F"), QStringLiteral("stopwatch"), QStringLiteral("stopwatch")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023F2\U0000FE0F"), QStringLiteral("timer clock"), QStringLiteral("timer clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F570\U0000FE0F"), QStringLiteral("mantelpiece clock"), QStringLiteral("mantelpiece clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F55B"), QStringLiteral("clock12"), QStringLiteral("twelve o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F567"), QStringLiteral("clock1230"), QStringLiteral("twelve-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F550"), QStringLiteral("clock1"), QStringLiteral("one o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F55C"), QStringLiteral("clock130"), QStringLiteral("one-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F551"), QStringLiteral("clock2"), QStringLiteral("two o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F55D"), QStringLiteral("clock230"), QStringLiteral("two-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F552"), QStringLiteral("clock3"), QStringLiteral("three o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F55E"), QStringLiteral("clock330"), QStringLiteral("three-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F553"), QStringLiteral("clock4"), QStringLiteral("four o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F55F"), QStringLiteral("clock430"), QStringLiteral("four-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F554"), QStringLiteral("clock5"), QStringLiteral("five o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F560"), QStringLiteral("clock530"), QStringLiteral("five-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F555"), QStringLiteral("clock6"), QStringLiteral("six o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F561"), QStringLiteral("clock630"), QStringLiteral("six-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F556"), QStringLiteral("clock7"), QStringLiteral("seven o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F562"), QStringLiteral("clock730"), QStringLiteral("seven-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F557"), QStringLiteral("clock8"), QStringLiteral("eight o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F563"), QStringLiteral("clock830"), QStringLiteral("eight-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F558"), QStringLiteral("clock9"), QStringLiteral("nine o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F564"), QStringLiteral("clock930"), QStringLiteral("nine-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F559"), QStringLiteral("clock10"), QStringLiteral("ten o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F565"), QStringLiteral("clock1030"), QStringLiteral("ten-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F55A"), QStringLiteral("clock11"), QStringLiteral("eleven o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F566"), QStringLiteral("clock1130"), QStringLiteral("eleven-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F311"), QStringLiteral("new_moon"), QStringLiteral("new moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F312"), QStringLiteral("waxing_crescent_moon"), QStringLiteral("waxing crescent moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F313"), QStringLiteral("first_quarter_moon"), QStringLiteral("first quarter moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F314"), QStringLiteral("waxing_gibbous_moon"), QStringLiteral("waxing gibbous moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F315"), QStringLiteral("full_moon"), QStringLiteral("full moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F316"), QStringLiteral("waning_gibbous_moon"), QStringLiteral("waning gibbous moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F317"), QStringLiteral("last_quarter_moon"), QStringLiteral("last quarter moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F318"), QStringLiteral("waning_crescent_moon"), QStringLiteral("waning crescent moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F319"), QStringLiteral("crescent_moon"), QStringLiteral("crescent moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F31A"), QStringLiteral("new_moon_with_face"), QStringLiteral("new moon face")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F31B"), QStringLiteral("first_quarter_moon_with_face"), QStringLiteral("first quarter moon face")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F31C"), QStringLiteral("last_quarter_moon_with_face"), QStringLiteral("last quarter moon face")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F321\U0000FE0F"), QStringLiteral("thermometer"), QStringLiteral("thermometer")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002600\U0000FE0F"), QStringLiteral("sun"), QStringLiteral("sun")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F31D"), QStringLiteral("full_moon_with_face"), QStringLiteral("full moon face")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F31E"), QStringLiteral("sun_with_face"), QStringLiteral("sun with face")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA90"), QStringLiteral("ringed planet"), QStringLiteral("ringed planet")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B50"), QStringLiteral("star"), QStringLiteral("star")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F31F"), QStringLiteral("star2"), QStringLiteral("glowing star")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F320"), QStringLiteral("stars"), QStringLiteral("shooting star")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F30C"), QStringLiteral("milky_way"), QStringLiteral("milky way")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002601\U0000FE0F"), QStringLiteral("cloud"), QStringLiteral("cloud")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026C5"), QStringLiteral("partly_sunny"), QStringLiteral("sun behind cloud")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026C8\U0000FE0F"), QStringLiteral("cloud with lightning and rain"), QStringLiteral("cloud with lightning and rain")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F324\U0000FE0F"), QStringLiteral("sun behind small cloud"), QStringLiteral("sun behind small cloud")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F325\U0000FE0F"), QStringLiteral("sun behind large cloud"), QStringLiteral("sun behind large cloud")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F326\U0000FE0F"), QStringLiteral("sun behind rain cloud"), QStringLiteral("sun behind rain cloud")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F327\U0000FE0F"), QStringLiteral("cloud with rain"), QStringLiteral("cloud with rain")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F328\U0000FE0F"), QStringLiteral("cloud with snow"), QStringLiteral("cloud with snow")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F329\U0000FE0F"), QStringLiteral("cloud with lightning"), QStringLiteral("cloud with lightning")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F32A\U0000FE0F"), QStringLiteral("tornado"), QStringLiteral("tornado")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F32B\U0000FE0F"), QStringLiteral("fog"), QStringLiteral("fog")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F32C\U0000FE0F"), QStringLiteral("wind face"), QStringLiteral("wind face")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F300"), QStringLiteral("cyclone"), QStringLiteral("cyclone")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F308"), QStringLiteral("rainbow"), QStringLiteral("rainbow")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F302"), QStringLiteral("closed_umbrella"), QStringLiteral("closed umbrella")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002602\U0000FE0F"), QStringLiteral("umbrella"), QStringLiteral("umbrella")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002614"), QStringLiteral("umbrella"), QStringLiteral("umbrella with rain drops")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F1\U0000FE0F"), QStringLiteral("umbrella on ground"), QStringLiteral("umbrella on ground")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026A1"), QStringLiteral("zap"), QStringLiteral("high voltage")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002744\U0000FE0F"), QStringLiteral("snowflake"), QStringLiteral("snowflake")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002603\U0000FE0F"), QStringLiteral("snowman"), QStringLiteral("snowman")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026C4"), QStringLiteral("snowman"), QStringLiteral("snowman without snow")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002604\U0000FE0F"), QStringLiteral("comet"), QStringLiteral("comet")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F525"), QStringLiteral("fire"), QStringLiteral("fire")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A7"), QStringLiteral("droplet"), QStringLiteral("droplet")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F30A"), QStringLiteral("ocean"), QStringLiteral("water wave")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F383"), QStringLiteral("jack_o_lantern"), QStringLiteral("jack-o-lantern")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F384"), QStringLiteral("christmas_tree"), QStringLiteral("Christmas tree")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F386"), QStringLiteral("fireworks"), QStringLiteral("fireworks")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F387"), QStringLiteral("sparkler"), QStringLiteral("sparkler")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E8"), QStringLiteral("firecracker"), QStringLiteral("firecracker")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002728"), QStringLiteral("sparkles"), QStringLiteral("sparkles")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F388"), QStringLiteral("balloon"), QStringLiteral("balloon")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F389"), QStringLiteral("tada"), QStringLiteral("party popper")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F38A"), QStringLiteral("confetti_ball"), QStringLiteral("confetti ball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F38B"), QStringLiteral("tanabata_tree"), QStringLiteral("tanabata tree")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F38D"), QStringLiteral("bamboo"), QStringLiteral("pine decoration")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F38E"), QStringLiteral("dolls"), QStringLiteral("Japanese dolls")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F38F"), QStringLiteral("flags"), QStringLiteral("carp streamer")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F390"), QStringLiteral("wind_chime"), QStringLiteral("wind chime")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F391"), QStringLiteral("rice_scene"), QStringLiteral("moon viewing ceremony")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E7"), QStringLiteral("red_envelope"), QStringLiteral("red envelope")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F380"), QStringLiteral("ribbon"), QStringLiteral("ribbon")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F381"), QStringLiteral("gift"), QStringLiteral("wrapped gift")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F397\U0000FE0F"), QStringLiteral("reminder ribbon"), QStringLiteral("reminder ribbon")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F39F\U0000FE0F"), QStringLiteral("admission tickets"), QStringLiteral("admission tickets")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3AB"), QStringLiteral("ticket"), QStringLiteral("ticket")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F396\U0000FE0F"), QStringLiteral("military medal"), QStringLiteral("military medal")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C6"), QStringLiteral("trophy"), QStringLiteral("trophy")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C5"), QStringLiteral("medal"), QStringLiteral("sports medal")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F947"), QStringLiteral("first_place"), QStringLiteral("1st place medal")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F948"), QStringLiteral("second_place"), QStringLiteral("2nd place medal")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F949"), QStringLiteral("third_place"), QStringLiteral("3rd place medal")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026BD"), QStringLiteral("soccer"), QStringLiteral("soccer ball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026BE"), QStringLiteral("baseball"), QStringLiteral("baseball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F94E"), QStringLiteral("softball"), QStringLiteral("softball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C0"), QStringLiteral("basketball"), QStringLiteral("basketball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D0"), QStringLiteral("volleyball"), QStringLiteral("volleyball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C8"), QStringLiteral("football"), QStringLiteral("american football")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C9"), QStringLiteral("rugby_football"), QStringLiteral("rugby football")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3BE"), QStringLiteral("tennis"), QStringLiteral("tennis")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F94F"), QStringLiteral("flying_disc"), QStringLiteral("flying disc")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B3"), QStringLiteral("bowling"), QStringLiteral("bowling")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CF"), QStringLiteral("cricket game"), QStringLiteral("cricket game")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D1"), QStringLiteral("field_hockey"), QStringLiteral("field hockey")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D2"), QStringLiteral("hockey"), QStringLiteral("ice hockey")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F94D"), QStringLiteral("lacrosse"), QStringLiteral("lacrosse")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D3"), QStringLiteral("ping_pong"), QStringLiteral("ping pong")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F8"), QStringLiteral("badminton"), QStringLiteral("badminton")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F94A"), QStringLiteral("boxing_glove"), QStringLiteral("boxing glove")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F94B"), QStringLiteral("martial_arts_uniform"), QStringLiteral("martial arts uniform")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F945"), QStringLiteral("goal"), QStringLiteral("goal net")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F3"), QStringLiteral("golf"), QStringLiteral("flag in hole")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F8\U0000FE0F"), QStringLiteral("ice skate"), QStringLiteral("ice skate")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A3"), QStringLiteral("fishing_pole_and_fish"), QStringLiteral("fishing pole")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93F"), QStringLiteral("diving mask"), QStringLiteral("diving mask")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3BD"), QStringLiteral("running_shirt_with_sash"), QStringLiteral("running shirt")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3BF"), QStringLiteral("ski"), QStringLiteral("skis")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F7"), QStringLiteral("sled"), QStringLiteral("sled")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F94C"), QStringLiteral("curling_stone"), QStringLiteral("curling stone")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3AF"), QStringLiteral("dart"), QStringLiteral("bullseye")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA80"), QStringLiteral("yo-yo"), QStringLiteral("yo-yo")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA81"), QStringLiteral("kite"), QStringLiteral("kite")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B1"), QStringLiteral("8ball"), QStringLiteral("pool 8 ball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F52E"), QStringLiteral("crystal_ball"), QStringLiteral("crystal ball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA84"), QStringLiteral("magic wand"), QStringLiteral("magic wand")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9FF"), QStringLiteral("nazar_amulet"), QStringLiteral("nazar amulet")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAAC"), QStringLiteral("hamsa"), QStringLiteral("hamsa")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3AE"), QStringLiteral("video_game"), QStringLiteral("video game")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F579\U0000FE0F"), QStringLiteral("joystick"), QStringLiteral("joystick")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B0"), QStringLiteral("slot_machine"), QStringLiteral("slot machine")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B2"), QStringLiteral("game_die"), QStringLiteral("game die")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E9"), QStringLiteral("jigsaw"), QStringLiteral("puzzle piece")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F8"), QStringLiteral("teddy_bear"), QStringLiteral("teddy bear")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA85"), QStringLiteral("piñata"), QStringLiteral("piñata")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA9"), QStringLiteral("mirror ball"), QStringLiteral("mirror ball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA86"), QStringLiteral("nesting dolls"), QStringLiteral("nesting dolls")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002660\U0000FE0F"), QStringLiteral("spade suit"), QStringLiteral("spade suit")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002665\U0000FE0F"), QStringLiteral("heart suit"), QStringLiteral("heart suit")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002666\U0000FE0F"), QStringLiteral("diamond suit"), QStringLiteral("diamond suit")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002663\U0000FE0F"), QStringLiteral("club suit"), QStringLiteral("club suit")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000265F\U0000FE0F"), QStringLiteral("chess pawn"), QStringLiteral("chess pawn")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F0CF"), QStringLiteral("black_joker"), QStringLiteral("joker")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F004"), QStringLiteral("mahjong"), QStringLiteral("mahjong red dragon")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B4"), QStringLiteral("flower_playing_cards"), QStringLiteral("flower playing cards")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3AD"), QStringLiteral("performing_arts"), QStringLiteral("performing arts")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5BC\U0000FE0F"), QStringLiteral("framed picture"), QStringLiteral("framed picture")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A8"), QStringLiteral("art"), QStringLiteral("artist palette")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F5"), QStringLiteral("thread"), QStringLiteral("thread")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA1"), QStringLiteral("sewing needle"), QStringLiteral("sewing needle")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F6"), QStringLiteral("yarn"), QStringLiteral("yarn")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA2"), QStringLiteral("knot"), QStringLiteral("knot")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F453"), QStringLiteral("eyeglasses"), QStringLiteral("glasses")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F576\U0000FE0F"), QStringLiteral("sunglasses"), QStringLiteral("sunglasses")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F97D"), QStringLiteral("goggles"), QStringLiteral("goggles")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F97C"), QStringLiteral("lab_coat"), QStringLiteral("lab coat")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BA"), QStringLiteral("safety vest"), QStringLiteral("safety vest")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F454"), QStringLiteral("necktie"), QStringLiteral("necktie")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F455"), QStringLiteral("shirt"), QStringLiteral("t-shirt")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F456"), QStringLiteral("jeans"), QStringLiteral("jeans")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E3"), QStringLiteral("scarf"), QStringLiteral("scarf")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E4"), QStringLiteral("gloves"), QStringLiteral("gloves")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E5"), QStringLiteral("coat"), QStringLiteral("coat")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E6"), QStringLiteral("socks"), QStringLiteral("socks")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F457"), QStringLiteral("dress"), QStringLiteral("dress")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F458"), QStringLiteral("kimono"), QStringLiteral("kimono")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F97B"), QStringLiteral("sari"), QStringLiteral("sari")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA71"), QStringLiteral("one-piece swimsuit"), QStringLiteral("one-piece swimsuit")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA72"), QStringLiteral("briefs"), QStringLiteral("briefs")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA73"), QStringLiteral("shorts"), QStringLiteral("shorts")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F459"), QStringLiteral("bikini"), QStringLiteral("bikini")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F45A"), QStringLiteral("womans_clothes"), QStringLiteral("woman’s clothes")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F45B"), QStringLiteral("purse"), QStringLiteral("purse")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F45C"), QStringLiteral("handbag"), QStringLiteral("handbag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F45D"), QStringLiteral("pouch"), QStringLiteral("clutch bag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CD\U0000FE0F"), QStringLiteral("shopping bags"), QStringLiteral("shopping bags")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F392"), QStringLiteral("school_satchel"), QStringLiteral("backpack")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA74"), QStringLiteral("thong sandal"), QStringLiteral("thong sandal")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F45E"), QStringLiteral("mans_shoe"), QStringLiteral("man’s shoe")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F45F"), QStringLiteral("athletic_shoe"), QStringLiteral("running shoe")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F97E"), QStringLiteral("hiking_boot"), QStringLiteral("hiking boot")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F97F"), QStringLiteral("womans_flat_shoe"), QStringLiteral("flat shoe")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F460"), QStringLiteral("high_heel"), QStringLiteral("high-heeled shoe")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F461"), QStringLiteral("sandal"), QStringLiteral("woman’s sandal")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA70"), QStringLiteral("ballet shoes"), QStringLiteral("ballet shoes")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F462"), QStringLiteral("boot"), QStringLiteral("woman’s boot")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F451"), QStringLiteral("crown"), QStringLiteral("crown")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F452"), QStringLiteral("womans_hat"), QStringLiteral("woman’s hat")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A9"), QStringLiteral("tophat"), QStringLiteral("top hat")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F393"), QStringLiteral("mortar_board"), QStringLiteral("graduation cap")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E2"), QStringLiteral("billed_cap"), QStringLiteral("billed cap")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA96"), QStringLiteral("military helmet"), QStringLiteral("military helmet")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026D1\U0000FE0F"), QStringLiteral("rescue worker’s helmet"), QStringLiteral("rescue worker’s helmet")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4FF"), QStringLiteral("prayer_beads"), QStringLiteral("prayer beads")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F484"), QStringLiteral("lipstick"), QStringLiteral("lipstick")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48D"), QStringLiteral("ring"), QStringLiteral("ring")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48E"), QStringLiteral("gem"), QStringLiteral("gem stone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F507"), QStringLiteral("mute"), QStringLiteral("muted speaker")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F508"), QStringLiteral("speaker"), QStringLiteral("speaker low volume")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F509"), QStringLiteral("sound"), QStringLiteral("speaker medium volume")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F50A"), QStringLiteral("loud_sound"), QStringLiteral("speaker high volume")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E2"), QStringLiteral("loudspeaker"), QStringLiteral("loudspeaker")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E3"), QStringLiteral("mega"), QStringLiteral("megaphone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4EF"), QStringLiteral("postal_horn"), QStringLiteral("postal horn")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F514"), QStringLiteral("bell"), QStringLiteral("bell")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F515"), QStringLiteral("no_bell"), QStringLiteral("bell with slash")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3BC"), QStringLiteral("musical_score"), QStringLiteral("musical score")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B5"), QStringLiteral("musical_note"), QStringLiteral("musical note")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B6"), QStringLiteral("notes"), QStringLiteral("musical notes")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F399\U0000FE0F"), QStringLiteral("studio microphone"), QStringLiteral("studio microphone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F39A\U0000FE0F"), QStringLiteral("level slider"), QStringLiteral("level slider")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F39B\U0000FE0F"), QStringLiteral("control knobs"), QStringLiteral("control knobs")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A4"), QStringLiteral("microphone"), QStringLiteral("microphone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A7"), QStringLiteral("headphones"), QStringLiteral("headphone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4FB"), QStringLiteral("radio"), QStringLiteral("radio")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B7"), QStringLiteral("saxophone"), QStringLiteral("saxophone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA97"), QStringLiteral("accordion"), QStringLiteral("accordion")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B8"), QStringLiteral("guitar"), QStringLiteral("guitar")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B9"), QStringLiteral("musical_keyboard"), QStringLiteral("musical keyboard")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3BA"), QStringLiteral("trumpet"), QStringLiteral("trumpet")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3BB"), QStringLiteral("violin"), QStringLiteral("violin")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA95"), QStringLiteral("banjo"), QStringLiteral("banjo")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F941"), QStringLiteral("drum"), QStringLiteral("drum")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA98"), QStringLiteral("long drum"), QStringLiteral("long drum")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F1"), QStringLiteral("iphone"), QStringLiteral("mobile phone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F2"), QStringLiteral("calling"), QStringLiteral("mobile phone with arrow")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000260E\U0000FE0F"), QStringLiteral("telephone"), QStringLiteral("telephone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4DE"), QStringLiteral("telephone_receiver"), QStringLiteral("telephone receiver")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4DF"), QStringLiteral("pager"), QStringLiteral("pager")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E0"), QStringLiteral("fax"), QStringLiteral("fax machine")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F50B"), QStringLiteral("battery"), QStringLiteral("battery")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAAB"), QStringLiteral("low battery"), QStringLiteral("low battery")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F50C"), QStringLiteral("electric_plug"), QStringLiteral("electric plug")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4BB"), QStringLiteral("computer"), QStringLiteral("laptop")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5A5\U0000FE0F"), QStringLiteral("desktop computer"), QStringLiteral("desktop computer")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5A8\U0000FE0F"), QStringLiteral("printer"), QStringLiteral("printer")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002328\U0000FE0F"), QStringLiteral("keyboard"), QStringLiteral("keyboard")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5B1\U0000FE0F"), QStringLiteral("computer mouse"), QStringLiteral("computer mouse")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5B2\U0000FE0F"), QStringLiteral("trackball"), QStringLiteral("trackball")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4BD"), QStringLiteral("minidisc"), QStringLiteral("computer disk")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4BE"), QStringLiteral("floppy_disk"), QStringLiteral("floppy disk")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4BF"), QStringLiteral("cd"), QStringLiteral("optical disk")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C0"), QStringLiteral("dvd"), QStringLiteral("dvd")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9EE"), QStringLiteral("abacus"), QStringLiteral("abacus")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A5"), QStringLiteral("movie_camera"), QStringLiteral("movie camera")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F39E\U0000FE0F"), QStringLiteral("film frames"), QStringLiteral("film frames")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4FD\U0000FE0F"), QStringLiteral("film projector"), QStringLiteral("film projector")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3AC"), QStringLiteral("clapper"), QStringLiteral("clapper board")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4FA"), QStringLiteral("tv"), QStringLiteral("television")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F7"), QStringLiteral("camera"), QStringLiteral("camera")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F8"), QStringLiteral("camera_with_flash"), QStringLiteral("camera with flash")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F9"), QStringLiteral("video_camera"), QStringLiteral("video camera")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4FC"), QStringLiteral("vhs"), QStringLiteral("videocassette")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F50D"), QStringLiteral("mag"), QStringLiteral("magnifying glass tilted left")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F50E"), QStringLiteral("mag_right"), QStringLiteral("magnifying glass tilted right")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F56F\U0000FE0F"), QStringLiteral("candle"), QStringLiteral("candle")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A1"), QStringLiteral("bulb"), QStringLiteral("light bulb")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F526"), QStringLiteral("flashlight"), QStringLiteral("flashlight")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3EE"), QStringLiteral("izakaya_lantern"), QStringLiteral("red paper lantern")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA94"), QStringLiteral("diya lamp"), QStringLiteral("diya lamp")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D4"), QStringLiteral("notebook_with_decorative_cover"), QStringLiteral("notebook with decorative cover")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D5"), QStringLiteral("closed_book"), QStringLiteral("closed book")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D6"), QStringLiteral("book"), QStringLiteral("open book")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D7"), QStringLiteral("green_book"), QStringLiteral("green book")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D8"), QStringLiteral("blue_book"), QStringLiteral("blue book")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D9"), QStringLiteral("orange_book"), QStringLiteral("orange book")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4DA"), QStringLiteral("books"), QStringLiteral("books")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D3"), QStringLiteral("notebook"), QStringLiteral("notebook")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D2"), QStringLiteral("ledger"), QStringLiteral("ledger")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C3"), QStringLiteral("page_with_curl"), QStringLiteral("page with curl")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4DC"), QStringLiteral("scroll"), QStringLiteral("scroll")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C4"), QStringLiteral("page_facing_up"), QStringLiteral("page facing up")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F0"), QStringLiteral("newspaper"), QStringLiteral("newspaper")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5DE\U0000FE0F"), QStringLiteral("rolled-up newspaper"), QStringLiteral("rolled-up newspaper")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D1"), QStringLiteral("bookmark_tabs"), QStringLiteral("bookmark tabs")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F516"), QStringLiteral("bookmark"), QStringLiteral("bookmark")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F7\U0000FE0F"), QStringLiteral("label"), QStringLiteral("label")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B0"), QStringLiteral("moneybag"), QStringLiteral("money bag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA99"), QStringLiteral("coin"), QStringLiteral("coin")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B4"), QStringLiteral("yen"), QStringLiteral("yen banknote")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B5"), QStringLiteral("dollar"), QStringLiteral("dollar banknote")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B6"), QStringLiteral("euro"), QStringLiteral("euro banknote")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B7"), QStringLiteral("pound"), QStringLiteral("pound banknote")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B8"), QStringLiteral("money_with_wings"), QStringLiteral("money with wings")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B3"), QStringLiteral("credit_card"), QStringLiteral("credit card")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9FE"), QStringLiteral("receipt"), QStringLiteral("receipt")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B9"), QStringLiteral("chart"), QStringLiteral("chart increasing with yen")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002709\U0000FE0F"), QStringLiteral("envelope"), QStringLiteral("envelope")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E7"), QStringLiteral("e-mail"), QStringLiteral("e-mail")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E8"), QStringLiteral("incoming_envelope"), QStringLiteral("incoming envelope")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E9"), QStringLiteral("envelope_with_arrow"), QStringLiteral("envelope with arrow")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E4"), QStringLiteral("outbox_tray"), QStringLiteral("outbox tray")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E5"), QStringLiteral("inbox_tray"), QStringLiteral("inbox tray")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E6"), QStringLiteral("package"), QStringLiteral("package")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4EB"), QStringLiteral("mailbox"), QStringLiteral("closed mailbox with raised flag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4EA"), QStringLiteral("mailbox_closed"), QStringLiteral("closed mailbox with lowered flag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4EC"), QStringLiteral("mailbox_with_mail"), QStringLiteral("open mailbox with raised flag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4ED"), QStringLiteral("mailbox_with_no_mail"), QStringLiteral("open mailbox with lowered flag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4EE"), QStringLiteral("postbox"), QStringLiteral("postbox")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5F3\U0000FE0F"), QStringLiteral("ballot box with ballot"), QStringLiteral("ballot box with ballot")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270F\U0000FE0F"), QStringLiteral("pencil"), QStringLiteral("pencil")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002712\U0000FE0F"), QStringLiteral("black nib"), QStringLiteral("black nib")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F58B\U0000FE0F"), QStringLiteral("fountain pen"), QStringLiteral("fountain pen")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F58A\U0000FE0F"), QStringLiteral("pen"), QStringLiteral("pen")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F58C\U0000FE0F"), QStringLiteral("paintbrush"), QStringLiteral("paintbrush")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F58D\U0000FE0F"), QStringLiteral("crayon"), QStringLiteral("crayon")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4DD"), QStringLiteral("pencil"), QStringLiteral("memo")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4BC"), QStringLiteral("briefcase"), QStringLiteral("briefcase")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C1"), QStringLiteral("file_folder"), QStringLiteral("file folder")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C2"), QStringLiteral("open_file_folder"), QStringLiteral("open file folder")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5C2\U0000FE0F"), QStringLiteral("card index dividers"), QStringLiteral("card index dividers")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C5"), QStringLiteral("date"), QStringLiteral("calendar")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C6"), QStringLiteral("calendar"), QStringLiteral("tear-off calendar")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5D2\U0000FE0F"), QStringLiteral("spiral notepad"), QStringLiteral("spiral notepad")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5D3\U0000FE0F"), QStringLiteral("spiral calendar"), QStringLiteral("spiral calendar")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C7"), QStringLiteral("card_index"), QStringLiteral("card index")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C8"), QStringLiteral("chart_with_upwards_trend"), QStringLiteral("chart increasing")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C9"), QStringLiteral("chart_with_downwards_trend"), QStringLiteral("chart decreasing")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4CA"), QStringLiteral("bar_chart"), QStringLiteral("bar chart")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4CB"), QStringLiteral("clipboard"), QStringLiteral("clipboard")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4CC"), QStringLiteral("pushpin"), QStringLiteral("pushpin")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4CD"), QStringLiteral("round_pushpin"), QStringLiteral("round pushpin")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4CE"), QStringLiteral("paperclip"), QStringLiteral("paperclip")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F587\U0000FE0F"), QStringLiteral("linked paperclips"), QStringLiteral("linked paperclips")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4CF"), QStringLiteral("straight_ruler"), QStringLiteral("straight ruler")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D0"), QStringLiteral("triangular_ruler"), QStringLiteral("triangular ruler")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002702\U0000FE0F"), QStringLiteral("scissors"), QStringLiteral("scissors")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5C3\U0000FE0F"), QStringLiteral("card file box"), QStringLiteral("card file box")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5C4\U0000FE0F"), QStringLiteral("file cabinet"), QStringLiteral("file cabinet")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5D1\U0000FE0F"), QStringLiteral("wastebasket"), QStringLiteral("wastebasket")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F512"), QStringLiteral("lock"), QStringLiteral("locked")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F513"), QStringLiteral("unlock"), QStringLiteral("unlocked")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F50F"), QStringLiteral("lock_with_ink_pen"), QStringLiteral("locked with pen")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F510"), QStringLiteral("closed_lock_with_key"), QStringLiteral("locked with key")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F511"), QStringLiteral("key"), QStringLiteral("key")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5DD\U0000FE0F"), QStringLiteral("old key"), QStringLiteral("old key")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F528"), QStringLiteral("hammer"), QStringLiteral("hammer")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA93"), QStringLiteral("axe"), QStringLiteral("axe")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026CF\U0000FE0F"), QStringLiteral("pick"), QStringLiteral("pick")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002692\U0000FE0F"), QStringLiteral("hammer and pick"), QStringLiteral("hammer and pick")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E0\U0000FE0F"), QStringLiteral("hammer and wrench"), QStringLiteral("hammer and wrench")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5E1\U0000FE0F"), QStringLiteral("dagger"), QStringLiteral("dagger")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002694\U0000FE0F"), QStringLiteral("crossed swords"), QStringLiteral("crossed swords")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F52B"), QStringLiteral("gun"), QStringLiteral("water pistol")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA83"), QStringLiteral("boomerang"), QStringLiteral("boomerang")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F9"), QStringLiteral("bow_and_arrow"), QStringLiteral("bow and arrow")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E1\U0000FE0F"), QStringLiteral("shield"), QStringLiteral("shield")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA9A"), QStringLiteral("carpentry saw"), QStringLiteral("carpentry saw")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F527"), QStringLiteral("wrench"), QStringLiteral("wrench")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA9B"), QStringLiteral("screwdriver"), QStringLiteral("screwdriver")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F529"), QStringLiteral("nut_and_bolt"), QStringLiteral("nut and bolt")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002699\U0000FE0F"), QStringLiteral("gear"), QStringLiteral("gear")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5DC\U0000FE0F"), QStringLiteral("clamp"), QStringLiteral("clamp")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002696\U0000FE0F"), QStringLiteral("balance scale"), QStringLiteral("balance scale")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9AF"), QStringLiteral("white cane"), QStringLiteral("white cane")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F517"), QStringLiteral("link"), QStringLiteral("link")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026D3\U0000FE0F"), QStringLiteral("chains"), QStringLiteral("chains")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA9D"), QStringLiteral("hook"), QStringLiteral("hook")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F0"), QStringLiteral("toolbox"), QStringLiteral("toolbox")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F2"), QStringLiteral("magnet"), QStringLiteral("magnet")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA9C"), QStringLiteral("ladder"), QStringLiteral("ladder")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002697\U0000FE0F"), QStringLiteral("alembic"), QStringLiteral("alembic")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9EA"), QStringLiteral("test_tube"), QStringLiteral("test tube")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9EB"), QStringLiteral("petri_dish"), QStringLiteral("petri dish")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9EC"), QStringLiteral("dna"), QStringLiteral("dna")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F52C"), QStringLiteral("microscope"), QStringLiteral("microscope")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F52D"), QStringLiteral("telescope"), QStringLiteral("telescope")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E1"), QStringLiteral("satellite"), QStringLiteral("satellite antenna")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F489"), QStringLiteral("syringe"), QStringLiteral("syringe")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA78"), QStringLiteral("drop of blood"), QStringLiteral("drop of blood")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48A"), QStringLiteral("pill"), QStringLiteral("pill")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA79"), QStringLiteral("adhesive bandage"), QStringLiteral("adhesive bandage")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA7C"), QStringLiteral("crutch"), QStringLiteral("crutch")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA7A"), QStringLiteral("stethoscope"), QStringLiteral("stethoscope")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA7B"), QStringLiteral("x-ray"), QStringLiteral("x-ray")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6AA"), QStringLiteral("door"), QStringLiteral("door")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6D7"), QStringLiteral("elevator"), QStringLiteral("elevator")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA9E"), QStringLiteral("mirror"), QStringLiteral("mirror")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA9F"), QStringLiteral("window"), QStringLiteral("window")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CF\U0000FE0F"), QStringLiteral("bed"), QStringLiteral("bed")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CB\U0000FE0F"), QStringLiteral("couch and lamp"), QStringLiteral("couch and lamp")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA91"), QStringLiteral("chair"), QStringLiteral("chair")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6BD"), QStringLiteral("toilet"), QStringLiteral("toilet")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA0"), QStringLiteral("plunger"), QStringLiteral("plunger")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6BF"), QStringLiteral("shower"), QStringLiteral("shower")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C1"), QStringLiteral("bathtub"), QStringLiteral("bathtub")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA4"), QStringLiteral("mouse trap"), QStringLiteral("mouse trap")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA92"), QStringLiteral("razor"), QStringLiteral("razor")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F4"), QStringLiteral("squeeze_bottle"), QStringLiteral("lotion bottle")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F7"), QStringLiteral("safety_pin"), QStringLiteral("safety pin")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F9"), QStringLiteral("broom"), QStringLiteral("broom")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9FA"), QStringLiteral("basket"), QStringLiteral("basket")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9FB"), QStringLiteral("roll_of_paper"), QStringLiteral("roll of paper")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA3"), QStringLiteral("bucket"), QStringLiteral("bucket")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9FC"), QStringLiteral("soap"), QStringLiteral("soap")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE7"), QStringLiteral("bubbles"), QStringLiteral("bubbles")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA5"), QStringLiteral("toothbrush"), QStringLiteral("toothbrush")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9FD"), QStringLiteral("sponge"), QStringLiteral("sponge")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9EF"), QStringLiteral("fire_extinguisher"), QStringLiteral("fire extinguisher")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6D2"), QStringLiteral("shopping_cart"), QStringLiteral("shopping cart")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6AC"), QStringLiteral("smoking"), QStringLiteral("cigarette")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026B0\U0000FE0F"), QStringLiteral("coffin"), QStringLiteral("coffin")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA6"), QStringLiteral("headstone"), QStringLiteral("headstone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026B1\U0000FE0F"), QStringLiteral("funeral urn"), QStringLiteral("funeral urn")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5FF"), QStringLiteral("moyai"), QStringLiteral("moai")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA7"), QStringLiteral("placard"), QStringLiteral("placard")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAAA"), QStringLiteral("identification card"), QStringLiteral("identification card")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E7"), QStringLiteral("atm"), QStringLiteral("ATM sign")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6AE"), QStringLiteral("put_litter_in_its_place"), QStringLiteral("litter in bin sign")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B0"), QStringLiteral("potable_water"), QStringLiteral("potable water")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000267F"), QStringLiteral("wheelchair"), QStringLiteral("wheelchair symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B9"), QStringLiteral("mens"), QStringLiteral("men’s room")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6BA"), QStringLiteral("womens"), QStringLiteral("women’s room")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6BB"), QStringLiteral("restroom"), QStringLiteral("restroom")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6BC"), QStringLiteral("baby_symbol"), QStringLiteral("baby symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6BE"), QStringLiteral("wc"), QStringLiteral("water closet")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C2"), QStringLiteral("passport_control"), QStringLiteral("passport control")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C3"), QStringLiteral("customs"), QStringLiteral("customs")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C4"), QStringLiteral("baggage_claim"), QStringLiteral("baggage claim")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C5"), QStringLiteral("left_luggage"), QStringLiteral("left luggage")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026A0\U0000FE0F"), QStringLiteral("warning"), QStringLiteral("warning")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B8"), QStringLiteral("children_crossing"), QStringLiteral("children crossing")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026D4"), QStringLiteral("no_entry"), QStringLiteral("no entry")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6AB"), QStringLiteral("no_entry_sign"), QStringLiteral("prohibited")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B3"), QStringLiteral("no_bicycles"), QStringLiteral("no bicycles")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6AD"), QStringLiteral("no_smoking"), QStringLiteral("no smoking")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6AF"), QStringLiteral("do_not_litter"), QStringLiteral("no littering")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B1"), QStringLiteral("non-potable_water"), QStringLiteral("non-potable water")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B7"), QStringLiteral("no_pedestrians"), QStringLiteral("no pedestrians")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F5"), QStringLiteral("no_mobile_phones"), QStringLiteral("no mobile phones")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F51E"), QStringLiteral("underage"), QStringLiteral("no one under eighteen")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002622\U0000FE0F"), QStringLiteral("radioactive"), QStringLiteral("radioactive")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002623\U0000FE0F"), QStringLiteral("biohazard"), QStringLiteral("biohazard")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B06\U0000FE0F"), QStringLiteral("up arrow"), QStringLiteral("up arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002197\U0000FE0F"), QStringLiteral("up-right arrow"), QStringLiteral("up-right arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000027A1\U0000FE0F"), QStringLiteral("right arrow"), QStringLiteral("right arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002198\U0000FE0F"), QStringLiteral("down-right arrow"), QStringLiteral("down-right arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B07\U0000FE0F"), QStringLiteral("down arrow"), QStringLiteral("down arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002199\U0000FE0F"), QStringLiteral("down-left arrow"), QStringLiteral("down-left arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B05\U0000FE0F"), QStringLiteral("left arrow"), QStringLiteral("left arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002196\U0000FE0F"), QStringLiteral("up-left arrow"), QStringLiteral("up-left arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002195\U0000FE0F"), QStringLiteral("up-down arrow"), QStringLiteral("up-down arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002194\U0000FE0F"), QStringLiteral("left-right arrow"), QStringLiteral("left-right arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000021A9\U0000FE0F"), QStringLiteral("right arrow curving left"), QStringLiteral("right arrow curving left")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000021AA\U0000FE0F"), QStringLiteral("left arrow curving right"), QStringLiteral("left arrow curving right")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002934\U0000FE0F"), QStringLiteral("right arrow curving up"), QStringLiteral("right arrow curving up")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002935\U0000FE0F"), QStringLiteral("right arrow curving down"), QStringLiteral("right arrow curving down")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F503"), QStringLiteral("arrows_clockwise"), QStringLiteral("clockwise vertical arrows")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F504"), QStringLiteral("arrows_counterclockwise"), QStringLiteral("counterclockwise arrows button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F519"), QStringLiteral("back"), QStringLiteral("BACK arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F51A"), QStringLiteral("end"), QStringLiteral("END arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F51B"), QStringLiteral("on"), QStringLiteral("ON! arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F51C"), QStringLiteral("soon"), QStringLiteral("SOON arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F51D"), QStringLiteral("top"), QStringLiteral("TOP arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6D0"), QStringLiteral("place_of_worship"), QStringLiteral("place of worship")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000269B\U0000FE0F"), QStringLiteral("atom symbol"), QStringLiteral("atom symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F549\U0000FE0F"), QStringLiteral("om"), QStringLiteral("om")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002721\U0000FE0F"), QStringLiteral("star of David"), QStringLiteral("star of David")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002638\U0000FE0F"), QStringLiteral("wheel of dharma"), QStringLiteral("wheel of dharma")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000262F\U0000FE0F"), QStringLiteral("yin yang"), QStringLiteral("yin yang")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000271D\U0000FE0F"), QStringLiteral("latin cross"), QStringLiteral("latin cross")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002626\U0000FE0F"), QStringLiteral("orthodox cross"), QStringLiteral("orthodox cross")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000262A\U0000FE0F"), QStringLiteral("star and crescent"), QStringLiteral("star and crescent")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000262E\U0000FE0F"), QStringLiteral("peace symbol"), QStringLiteral("peace symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F54E"), QStringLiteral("menorah"), QStringLiteral("menorah")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F52F"), QStringLiteral("six_pointed_star"), QStringLiteral("dotted six-pointed star")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002648"), QStringLiteral("aries"), QStringLiteral("Aries")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002649"), QStringLiteral("taurus"), QStringLiteral("Taurus")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000264A"), QStringLiteral("gemini"), QStringLiteral("Gemini")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000264B"), QStringLiteral("cancer"), QStringLiteral("Cancer")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000264C"), QStringLiteral("leo"), QStringLiteral("Leo")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000264D"), QStringLiteral("virgo"), QStringLiteral("Virgo")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000264E"), QStringLiteral("libra"), QStringLiteral("Libra")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000264F"), QStringLiteral("scorpius"), QStringLiteral("Scorpio")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002650"), QStringLiteral("sagittarius"), QStringLiteral("Sagittarius")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002651"), QStringLiteral("capricorn"), QStringLiteral("Capricorn")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002652"), QStringLiteral("aquarius"), QStringLiteral("Aquarius")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002653"), QStringLiteral("pisces"), QStringLiteral("Pisces")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026CE"), QStringLiteral("ophiuchus"), QStringLiteral("Ophiuchus")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F500"), QStringLiteral("twisted_rightwards_arrows"), QStringLiteral("shuffle tracks button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F501"), QStringLiteral("repeat"), QStringLiteral("repeat button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F502"), QStringLiteral("repeat_one"), QStringLiteral("repeat single button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025B6\U0000FE0F"), QStringLiteral("play button"), QStringLiteral("play button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023E9"), QStringLiteral("fast_forward"), QStringLiteral("fast-forward button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023ED\U0000FE0F"), QStringLiteral("next track button"), QStringLiteral("next track button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023EF\U0000FE0F"), QStringLiteral("play or pause button"), QStringLiteral("play or pause button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025C0\U0000FE0F"), QStringLiteral("reverse button"), QStringLiteral("reverse button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023EA"), QStringLiteral("rewind"), QStringLiteral("fast reverse button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023EE\U0000FE0F"), QStringLiteral("last track button"), QStringLiteral("last track button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F53C"), QStringLiteral("arrow_up_small"), QStringLiteral("upwards button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023EB"), QStringLiteral("arrow_double_up"), QStringLiteral("fast up button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F53D"), QStringLiteral("arrow_down_small"), QStringLiteral("downwards button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023EC"), QStringLiteral("arrow_double_down"), QStringLiteral("fast down button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023F8\U0000FE0F"), QStringLiteral("pause button"), QStringLiteral("pause button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023F9\U0000FE0F"), QStringLiteral("stop button"), QStringLiteral("stop button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023FA\U0000FE0F"), QStringLiteral("record button"), QStringLiteral("record button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023CF\U0000FE0F"), QStringLiteral("eject button"), QStringLiteral("eject button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A6"), QStringLiteral("cinema"), QStringLiteral("cinema")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F505"), QStringLiteral("low_brightness"), QStringLiteral("dim button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F506"), QStringLiteral("high_brightness"), QStringLiteral("bright button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F6"), QStringLiteral("signal_strength"), QStringLiteral("antenna bars")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F3"), QStringLiteral("vibration_mode"), QStringLiteral("vibration mode")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F4"), QStringLiteral("mobile_phone_off"), QStringLiteral("mobile phone off")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002640\U0000FE0F"), QStringLiteral("female sign"), QStringLiteral("female sign")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002642\U0000FE0F"), QStringLiteral("male sign"), QStringLiteral("male sign")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026A7\U0000FE0F"), QStringLiteral("transgender symbol"), QStringLiteral("transgender symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002716\U0000FE0F"), QStringLiteral("multiply"), QStringLiteral("multiply")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002795"), QStringLiteral("heavy_plus_sign"), QStringLiteral("plus")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002796"), QStringLiteral("heavy_minus_sign"), QStringLiteral("minus")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002797"), QStringLiteral("heavy_division_sign"), QStringLiteral("divide")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7F0"), QStringLiteral("heavy equals sign"), QStringLiteral("heavy equals sign")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000267E\U0000FE0F"), QStringLiteral("infinity"), QStringLiteral("infinity")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000203C\U0000FE0F"), QStringLiteral("double exclamation mark"), QStringLiteral("double exclamation mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002049\U0000FE0F"), QStringLiteral("exclamation question mark"), QStringLiteral("exclamation question mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002753"), QStringLiteral("question"), QStringLiteral("red question mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002754"), QStringLiteral("grey_question"), QStringLiteral("white question mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002755"), QStringLiteral("grey_exclamation"), QStringLiteral("white exclamation mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002757"), QStringLiteral("exclamation"), QStringLiteral("red exclamation mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00003030\U0000FE0F"), QStringLiteral("wavy dash"), QStringLiteral("wavy dash")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B1"), QStringLiteral("currency_exchange"), QStringLiteral("currency exchange")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B2"), QStringLiteral("heavy_dollar_sign"), QStringLiteral("heavy dollar sign")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002695\U0000FE0F"), QStringLiteral("medical symbol"), QStringLiteral("medical symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000267B\U0000FE0F"), QStringLiteral("recycling symbol"), QStringLiteral("recycling symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000269C\U0000FE0F"), QStringLiteral("fleur-de-lis"), QStringLiteral("fleur-de-lis")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F531"), QStringLiteral("trident"), QStringLiteral("trident emblem")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4DB"), QStringLiteral("name_badge"), QStringLiteral("name badge")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F530"), QStringLiteral("beginner"), QStringLiteral("Japanese symbol for beginner")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B55"), QStringLiteral("o"), QStringLiteral("hollow red circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002705"), QStringLiteral("white_check_mark"), QStringLiteral("check mark button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002611\U0000FE0F"), QStringLiteral("check box with check"), QStringLiteral("check box with check")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002714\U0000FE0F"), QStringLiteral("check mark"), QStringLiteral("check mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000274C"), QStringLiteral("x"), QStringLiteral("cross mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000274E"), QStringLiteral("negative_squared_cross_mark"), QStringLiteral("cross mark button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000027B0"), QStringLiteral("curly_loop"), QStringLiteral("curly loop")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000027BF"), QStringLiteral("loop"), QStringLiteral("double curly loop")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000303D\U0000FE0F"), QStringLiteral("part alternation mark"), QStringLiteral("part alternation mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002733\U0000FE0F"), QStringLiteral("eight-spoked asterisk"), QStringLiteral("eight-spoked asterisk")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002734\U0000FE0F"), QStringLiteral("eight-pointed star"), QStringLiteral("eight-pointed star")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002747\U0000FE0F"), QStringLiteral("sparkle"), QStringLiteral("sparkle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000000A9\U0000FE0F"), QStringLiteral("copyright"), QStringLiteral("copyright")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000000AE\U0000FE0F"), QStringLiteral("registered"), QStringLiteral("registered")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002122\U0000FE0F"), QStringLiteral("trade mark"), QStringLiteral("trade mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000023\U0000FE0F\U000020E3"), QStringLiteral("keycap: #"), QStringLiteral("keycap: #")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000002A\U0000FE0F\U000020E3"), QStringLiteral("keycap: *"), QStringLiteral("keycap: *")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000030\U0000FE0F\U000020E3"), QStringLiteral("keycap: 0"), QStringLiteral("keycap: 0")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000031\U0000FE0F\U000020E3"), QStringLiteral("keycap: 1"), QStringLiteral("keycap: 1")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000032\U0000FE0F\U000020E3"), QStringLiteral("keycap: 2"), QStringLiteral("keycap: 2")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000033\U0000FE0F\U000020E3"), QStringLiteral("keycap: 3"), QStringLiteral("keycap: 3")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000034\U0000FE0F\U000020E3"), QStringLiteral("keycap: 4"), QStringLiteral("keycap: 4")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000035\U0000FE0F\U000020E3"), QStringLiteral("keycap: 5"), QStringLiteral("keycap: 5")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000036\U0000FE0F\U000020E3"), QStringLiteral("keycap: 6"), QStringLiteral("keycap: 6")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000037\U0000FE0F\U000020E3"), QStringLiteral("keycap: 7"), QStringLiteral("keycap: 7")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000038\U0000FE0F\U000020E3"), QStringLiteral("keycap: 8"), QStringLiteral("keycap: 8")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000039\U0000FE0F\U000020E3"), QStringLiteral("keycap: 9"), QStringLiteral("keycap: 9")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F51F"), QStringLiteral("ten"), QStringLiteral("keycap: 10")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F520"), QStringLiteral("capital_abcd"), QStringLiteral("input latin uppercase")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F521"), QStringLiteral("abcd"), QStringLiteral("input latin lowercase")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F522"), QStringLiteral("1234"), QStringLiteral("input numbers")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F523"), QStringLiteral("symbols"), QStringLiteral("input symbols")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F524"), QStringLiteral("abc"), QStringLiteral("input latin letters")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F170\U0000FE0F"), QStringLiteral("A button (blood type)"), QStringLiteral("A button (blood type)")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F18E"), QStringLiteral("ab"), QStringLiteral("AB button (blood type)")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F171\U0000FE0F"), QStringLiteral("B button (blood type)"), QStringLiteral("B button (blood type)")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F191"), QStringLiteral("cl"), QStringLiteral("CL button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F192"), QStringLiteral("cool"), QStringLiteral("COOL button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F193"), QStringLiteral("free"), QStringLiteral("FREE button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002139\U0000FE0F"), QStringLiteral("information"), QStringLiteral("information")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F194"), QStringLiteral("id"), QStringLiteral("ID button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000024C2\U0000FE0F"), QStringLiteral("circled M"), QStringLiteral("circled M")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F195"), QStringLiteral("new"), QStringLiteral("NEW button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F196"), QStringLiteral("ng"), QStringLiteral("NG button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F17E\U0000FE0F"), QStringLiteral("O button (blood type)"), QStringLiteral("O button (blood type)")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F197"), QStringLiteral("ok"), QStringLiteral("OK button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F17F\U0000FE0F"), QStringLiteral("P button"), QStringLiteral("P button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F198"), QStringLiteral("sos"), QStringLiteral("SOS button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F199"), QStringLiteral("up"), QStringLiteral("UP! button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F19A"), QStringLiteral("vs"), QStringLiteral("VS button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F201"), QStringLiteral("koko"), QStringLiteral("Japanese “here” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F202\U0000FE0F"), QStringLiteral("Japanese “service charge” button"), QStringLiteral("Japanese “service charge” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F237\U0000FE0F"), QStringLiteral("Japanese “monthly amount” button"), QStringLiteral("Japanese “monthly amount” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F236"), QStringLiteral("u6709"), QStringLiteral("Japanese “not free of charge” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F22F"), QStringLiteral("u6307"), QStringLiteral("Japanese “reserved” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F250"), QStringLiteral("ideograph_advantage"), QStringLiteral("Japanese “bargain” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F239"), QStringLiteral("u5272"), QStringLiteral("Japanese “discount” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F21A"), QStringLiteral("u7121"), QStringLiteral("Japanese “free of charge” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F232"), QStringLiteral("u7981"), QStringLiteral("Japanese “prohibited” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F251"), QStringLiteral("accept"), QStringLiteral("Japanese “acceptable” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F238"), QStringLiteral("u7533"), QStringLiteral("Japanese “application” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F234"), QStringLiteral("u5408"), QStringLiteral("Japanese “passing grade” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F233"), QStringLiteral("u7a7a"), QStringLiteral("Japanese “vacancy” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00003297\U0000FE0F"), QStringLiteral("Japanese “congratulations” button"), QStringLiteral("Japanese “congratulations” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00003299\U0000FE0F"), QStringLiteral("Japanese “secret” button"), QStringLiteral("Japanese “secret” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F23A"), QStringLiteral("u55b6"), QStringLiteral("Japanese “open for business” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F235"), QStringLiteral("u6e80"), QStringLiteral("Japanese “no vacancy” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F534"), QStringLiteral("red_circle"), QStringLiteral("red circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E0"), QStringLiteral("orange circle"), QStringLiteral("orange circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E1"), QStringLiteral("yellow circle"), QStringLiteral("yellow circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E2"), QStringLiteral("green circle"), QStringLiteral("green circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F535"), QStringLiteral("blue_circle"), QStringLiteral("blue circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E3"), QStringLiteral("purple circle"), QStringLiteral("purple circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E4"), QStringLiteral("brown circle"), QStringLiteral("brown circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026AB"), QStringLiteral("black_circle"), QStringLiteral("black circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026AA"), QStringLiteral("white_circle"), QStringLiteral("white circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E5"), QStringLiteral("red square"), QStringLiteral("red square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E7"), QStringLiteral("orange square"), QStringLiteral("orange square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E8"), QStringLiteral("yellow square"), QStringLiteral("yellow square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E9"), QStringLiteral("green square"), QStringLiteral("green square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E6"), QStringLiteral("blue square"), QStringLiteral("blue square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7EA"), QStringLiteral("purple square"), QStringLiteral("purple square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7EB"), QStringLiteral("brown square"), QStringLiteral("brown square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B1B"), QStringLiteral("black_large_square"), QStringLiteral("black large square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B1C"), QStringLiteral("white_large_square"), QStringLiteral("white large square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025FC\U0000FE0F"), QStringLiteral("black medium square"), QStringLiteral("black medium square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025FB\U0000FE0F"), QStringLiteral("white medium square"), QStringLiteral("white medium square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025FE"), QStringLiteral("black_medium_small_square"), QStringLiteral("black medium-small square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025FD"), QStringLiteral("white_medium_small_square"), QStringLiteral("white medium-small square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025AA\U0000FE0F"), QStringLiteral("black small square"), QStringLiteral("black small square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025AB\U0000FE0F"), QStringLiteral("white small square"), QStringLiteral("white small square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F536"), QStringLiteral("large_orange_diamond"), QStringLiteral("large orange diamond")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F537"), QStringLiteral("large_blue_diamond"), QStringLiteral("large blue diamond")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F538"), QStringLiteral("small_orange_diamond"), QStringLiteral("small orange diamond")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F539"), QStringLiteral("small_blue_diamond"), QStringLiteral("small blue diamond")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F53A"), QStringLiteral("small_red_triangle"), QStringLiteral("red triangle pointed up")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F53B"), QStringLiteral("small_red_triangle_down"), QStringLiteral("red triangle pointed down")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A0"), QStringLiteral("diamond_shape_with_a_dot_inside"), QStringLiteral("diamond with a dot")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F518"), QStringLiteral("radio_button"), QStringLiteral("radio button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F533"), QStringLiteral("white_square_button"), QStringLiteral("white square button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F532"), QStringLiteral("black_square_button"), QStringLiteral("black square button")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C1"), QStringLiteral("checkered_flag"), QStringLiteral("chequered flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A9"), QStringLiteral("triangular_flag_on_post"), QStringLiteral("triangular flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F38C"), QStringLiteral("crossed_flags"), QStringLiteral("crossed flags")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F4"), QStringLiteral("flag_black"), QStringLiteral("black flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F3\U0000FE0F"), QStringLiteral("white flag"), QStringLiteral("white flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F3\U0000FE0F\U0000200D\U0001F308"), QStringLiteral("rainbow flag"), QStringLiteral("rainbow flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F3\U0000FE0F\U0000200D\U000026A7\U0000FE0F"), QStringLiteral("transgender flag"), QStringLiteral("transgender flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F4\U0000200D\U00002620\U0000FE0F"), QStringLiteral("pirate flag"), QStringLiteral("pirate flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1E8"), QStringLiteral("flag_ac"), QStringLiteral("Flag of Ascension Island")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1E9"), QStringLiteral("flag_ad"), QStringLiteral("Flag of Andorra")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1EA"), QStringLiteral("flag_ae"), QStringLiteral("Flag of United Arab Emirates")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1EB"), QStringLiteral("flag_af"), QStringLiteral("Flag of Afghanistan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1EC"), QStringLiteral("flag_ag"), QStringLiteral("Flag of Antigua & Barbuda")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1EE"), QStringLiteral("flag_ai"), QStringLiteral("Flag of Anguilla")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F1"), QStringLiteral("flag_al"), QStringLiteral("Flag of Albania")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F2"), QStringLiteral("flag_am"), QStringLiteral("Flag of Armenia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F4"), QStringLiteral("flag_ao"), QStringLiteral("Flag of Angola")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F6"), QStringLiteral("flag_aq"), QStringLiteral("Flag of Antarctica")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F7"), QStringLiteral("flag_ar"), QStringLiteral("Flag of Argentina")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F8"), QStringLiteral("flag_as"), QStringLiteral("Flag of American Samoa")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F9"), QStringLiteral("flag_at"), QStringLiteral("Flag of Austria")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1FA"), QStringLiteral("flag_au"), QStringLiteral("Flag of Australia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1FC"), QStringLiteral("flag_aw"), QStringLiteral("Flag of Aruba")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1FD"), QStringLiteral("flag_ax"), QStringLiteral("Flag of Åland Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1FF"), QStringLiteral("flag_az"), QStringLiteral("Flag of Azerbaijan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1E6"), QStringLiteral("flag_ba"), QStringLiteral("Flag of Bosnia & Herzegovina")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1E7"), QStringLiteral("flag_bb"), QStringLiteral("Flag of Barbados")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1E9"), QStringLiteral("flag_bd"), QStringLiteral("Flag of Bangladesh")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1EA"), QStringLiteral("flag_be"), QStringLiteral("Flag of Belgium")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1EB"), QStringLiteral("flag_bf"), QStringLiteral("Flag of Burkina Faso")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1EC"), QStringLiteral("flag_bg"), QStringLiteral("Flag of Bulgaria")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1ED"), QStringLiteral("flag_bh"), QStringLiteral("Flag of Bahrain")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1EE"), QStringLiteral("flag_bi"), QStringLiteral("Flag of Burundi")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1EF"), QStringLiteral("flag_bj"), QStringLiteral("Flag of Benin")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F1"), QStringLiteral("flag_bl"), QStringLiteral("Flag of St. Barthélemy")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F2"), QStringLiteral("flag_bm"), QStringLiteral("Flag of Bermuda")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F3"), QStringLiteral("flag_bn"), QStringLiteral("Flag of Brunei")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F4"), QStringLiteral("flag_bo"), QStringLiteral("Flag of Bolivia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F6"), QStringLiteral("flag_bq"), QStringLiteral("Flag of Caribbean Netherlands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F7"), QStringLiteral("flag_br"), QStringLiteral("Flag of Brazil")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F8"), QStringLiteral("flag_bs"), QStringLiteral("Flag of Bahamas")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F9"), QStringLiteral("flag_bt"), QStringLiteral("Flag of Bhutan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1FB"), QStringLiteral("flag_bv"), QStringLiteral("Flag of Bouvet Island")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1FC"), QStringLiteral("flag_bw"), QStringLiteral("Flag of Botswana")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1FE"), QStringLiteral("flag_by"), QStringLiteral("Flag of Belarus")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1FF"), QStringLiteral("flag_bz"), QStringLiteral("Flag of Belize")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1E6"), QStringLiteral("flag_ca"), QStringLiteral("Flag of Canada")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1E8"), QStringLiteral("flag_cc"), QStringLiteral("Flag of Cocos (Keeling) Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1E9"), QStringLiteral("flag_cd"), QStringLiteral("Flag of Congo - Kinshasa")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1EB"), QStringLiteral("flag_cf"), QStringLiteral("Flag of Central African Republic")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1EC"), QStringLiteral("flag_cg"), QStringLiteral("Flag of Congo - Brazzaville")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1ED"), QStringLiteral("flag_ch"), QStringLiteral("Flag of Switzerland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1EE"), QStringLiteral("flag_ci"), QStringLiteral("Flag of Côte d’Ivoire")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F0"), QStringLiteral("flag_ck"), QStringLiteral("Flag of Cook Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F1"), QStringLiteral("flag_cl"), QStringLiteral("Flag of Chile")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F2"), QStringLiteral("flag_cm"), QStringLiteral("Flag of Cameroon")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F3"), QStringLiteral("flag_cn"), QStringLiteral("Flag of China")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F4"), QStringLiteral("flag_co"), QStringLiteral("Flag of Colombia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F5"), QStringLiteral("flag_cp"), QStringLiteral("Flag of Clipperton Island")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F7"), QStringLiteral("flag_cr"), QStringLiteral("Flag of Costa Rica")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1FA"), QStringLiteral("flag_cu"), QStringLiteral("Flag of Cuba")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1FB"), QStringLiteral("flag_cv"), QStringLiteral("Flag of Cape Verde")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1FC"), QStringLiteral("flag_cw"), QStringLiteral("Flag of Curaçao")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1FD"), QStringLiteral("flag_cx"), QStringLiteral("Flag of Christmas Island")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1FE"), QStringLiteral("flag_cy"), QStringLiteral("Flag of Cyprus")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1FF"), QStringLiteral("flag_cz"), QStringLiteral("Flag of Czechia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1EA"), QStringLiteral("flag_de"), QStringLiteral("Flag of Germany")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1EC"), QStringLiteral("flag_dg"), QStringLiteral("Flag of Diego Garcia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1EF"), QStringLiteral("flag_dj"), QStringLiteral("Flag of Djibouti")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1F0"), QStringLiteral("flag_dk"), QStringLiteral("Flag of Denmark")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1F2"), QStringLiteral("flag_dm"), QStringLiteral("Flag of Dominica")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1F4"), QStringLiteral("flag_do"), QStringLiteral("Flag of Dominican Republic")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1FF"), QStringLiteral("flag_dz"), QStringLiteral("Flag of Algeria")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1E6"), QStringLiteral("flag_ea"), QStringLiteral("Flag of Ceuta & Melilla")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1E8"), QStringLiteral("flag_ec"), QStringLiteral("Flag of Ecuador")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1EA"), QStringLiteral("flag_ee"), QStringLiteral("Flag of Estonia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1EC"), QStringLiteral("flag_eg"), QStringLiteral("Flag of Egypt")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1ED"), QStringLiteral("flag_eh"), QStringLiteral("Flag of Western Sahara")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1F7"), QStringLiteral("flag_er"), QStringLiteral("Flag of Eritrea")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1F8"), QStringLiteral("flag_es"), QStringLiteral("Flag of Spain")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1F9"), QStringLiteral("flag_et"), QStringLiteral("Flag of Ethiopia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1FA"), QStringLiteral("flag_eu"), QStringLiteral("Flag of European Union")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EB\U0001F1EE"), QStringLiteral("flag_fi"), QStringLiteral("Flag of Finland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EB\U0001F1EF"), QStringLiteral("flag_fj"), QStringLiteral("Flag of Fiji")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EB\U0001F1F0"), QStringLiteral("flag_fk"), QStringLiteral("Flag of Falkland Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EB\U0001F1F2"), QStringLiteral("flag_fm"), QStringLiteral("Flag of Micronesia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EB\U0001F1F4"), QStringLiteral("flag_fo"), QStringLiteral("Flag of Faroe Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EB\U0001F1F7"), QStringLiteral("flag_fr"), QStringLiteral("Flag of France")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1E6"), QStringLiteral("flag_ga"), QStringLiteral("Flag of Gabon")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1E7"), QStringLiteral("flag_gb"), QStringLiteral("Flag of United Kingdom")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1E9"), QStringLiteral("flag_gd"), QStringLiteral("Flag of Grenada")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1EA"), QStringLiteral("flag_ge"), QStringLiteral("Flag of Georgia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1EB"), QStringLiteral("flag_gf"), QStringLiteral("Flag of French Guiana")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1EC"), QStringLiteral("flag_gg"), QStringLiteral("Flag of Guernsey")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1ED"), QStringLiteral("flag_gh"), QStringLiteral("Flag of Ghana")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1EE"), QStringLiteral("flag_gi"), QStringLiteral("Flag of Gibraltar")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F1"), QStringLiteral("flag_gl"), QStringLiteral("Flag of Greenland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F2"), QStringLiteral("flag_gm"), QStringLiteral("Flag of Gambia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F3"), QStringLiteral("flag_gn"), QStringLiteral("Flag of Guinea")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F5"), QStringLiteral("flag_gp"), QStringLiteral("Flag of Guadeloupe")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F6"), QStringLiteral("flag_gq"), QStringLiteral("Flag of Equatorial Guinea")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F7"), QStringLiteral("flag_gr"), QStringLiteral("Flag of Greece")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F8"), QStringLiteral("flag_gs"), QStringLiteral("Flag of South Georgia & South Sandwich Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F9"), QStringLiteral("flag_gt"), QStringLiteral("Flag of Guatemala")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1FA"), QStringLiteral("flag_gu"), QStringLiteral("Flag of Guam")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1FC"), QStringLiteral("flag_gw"), QStringLiteral("Flag of Guinea-Bissau")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1FE"), QStringLiteral("flag_gy"), QStringLiteral("Flag of Guyana")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1ED\U0001F1F0"), QStringLiteral("flag_hk"), QStringLiteral("Flag of Hong Kong SAR China")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1ED\U0001F1F2"), QStringLiteral("flag_hm"), QStringLiteral("Flag of Heard & McDonald Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1ED\U0001F1F3"), QStringLiteral("flag_hn"), QStringLiteral("Flag of Honduras")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1ED\U0001F1F7"), QStringLiteral("flag_hr"), QStringLiteral("Flag of Croatia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1ED\U0001F1F9"), QStringLiteral("flag_ht"), QStringLiteral("Flag of Haiti")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1ED\U0001F1FA"), QStringLiteral("flag_hu"), QStringLiteral("Flag of Hungary")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1E8"), QStringLiteral("flag_ic"), QStringLiteral("Flag of Canary Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1E9"), QStringLiteral("flag_id"), QStringLiteral("Flag of Indonesia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1EA"), QStringLiteral("flag_ie"), QStringLiteral("Flag of Ireland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F1"), QStringLiteral("flag_il"), QStringLiteral("Flag of Israel")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F2"), QStringLiteral("flag_im"), QStringLiteral("Flag of Isle of Man")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F3"), QStringLiteral("flag_in"), QStringLiteral("Flag of India")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F4"), QStringLiteral("flag_io"), QStringLiteral("Flag of British Indian Ocean Territory")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F6"), QStringLiteral("flag_iq"), QStringLiteral("Flag of Iraq")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F7"), QStringLiteral("flag_ir"), QStringLiteral("Flag of Iran")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F8"), QStringLiteral("flag_is"), QStringLiteral("Flag of Iceland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F9"), QStringLiteral("flag_it"), QStringLiteral("Flag of Italy")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EF\U0001F1EA"), QStringLiteral("flag_je"), QStringLiteral("Flag of Jersey")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EF\U0001F1F2"), QStringLiteral("flag_jm"), QStringLiteral("Flag of Jamaica")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EF\U0001F1F4"), QStringLiteral("flag_jo"), QStringLiteral("Flag of Jordan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EF\U0001F1F5"), QStringLiteral("flag_jp"), QStringLiteral("Flag of Japan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1EA"), QStringLiteral("flag_ke"), QStringLiteral("Flag of Kenya")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1EC"), QStringLiteral("flag_kg"), QStringLiteral("Flag of Kyrgyzstan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1ED"), QStringLiteral("flag_kh"), QStringLiteral("Flag of Cambodia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1EE"), QStringLiteral("flag_ki"), QStringLiteral("Flag of Kiribati")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1F2"), QStringLiteral("flag_km"), QStringLiteral("Flag of Comoros")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1F3"), QStringLiteral("flag_kn"), QStringLiteral("Flag of St. Kitts & Nevis")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1F5"), QStringLiteral("flag_kp"), QStringLiteral("Flag of North Korea")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1F7"), QStringLiteral("flag_kr"), QStringLiteral("Flag of South Korea")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1FC"), QStringLiteral("flag_kw"), QStringLiteral("Flag of Kuwait")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1FE"), QStringLiteral("flag_ky"), QStringLiteral("Flag of Cayman Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1FF"), QStringLiteral("flag_kz"), QStringLiteral("Flag of Kazakhstan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1E6"), QStringLiteral("flag_la"), QStringLiteral("Flag of Laos")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1E7"), QStringLiteral("flag_lb"), QStringLiteral("Flag of Lebanon")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1E8"), QStringLiteral("flag_lc"), QStringLiteral("Flag of St. Lucia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1EE"), QStringLiteral("flag_li"), QStringLiteral("Flag of Liechtenstein")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1F0"), QStringLiteral("flag_lk"), QStringLiteral("Flag of Sri Lanka")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1F7"), QStringLiteral("flag_lr"), QStringLiteral("Flag of Liberia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1F8"), QStringLiteral("flag_ls"), QStringLiteral("Flag of Lesotho")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1F9"), QStringLiteral("flag_lt"), QStringLiteral("Flag of Lithuania")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1FA"), QStringLiteral("flag_lu"), QStringLiteral("Flag of Luxembourg")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1FB"), QStringLiteral("flag_lv"), QStringLiteral("Flag of Latvia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1FE"), QStringLiteral("flag_ly"), QStringLiteral("Flag of Libya")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1E6"), QStringLiteral("flag_ma"), QStringLiteral("Flag of Morocco")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1E8"), QStringLiteral("flag_mc"), QStringLiteral("Flag of Monaco")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1E9"), QStringLiteral("flag_md"), QStringLiteral("Flag of Moldova")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1EA"), QStringLiteral("flag_me"), QStringLiteral("Flag of Montenegro")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1EB"), QStringLiteral("flag_mf"), QStringLiteral("Flag of St. Martin")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1EC"), QStringLiteral("flag_mg"), QStringLiteral("Flag of Madagascar")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1ED"), QStringLiteral("flag_mh"), QStringLiteral("Flag of Marshall Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F0"), QStringLiteral("flag_mk"), QStringLiteral("Flag of North Macedonia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F1"), QStringLiteral("flag_ml"), QStringLiteral("Flag of Mali")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F2"), QStringLiteral("flag_mm"), QStringLiteral("Flag of Myanmar (Burma)")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F3"), QStringLiteral("flag_mn"), QStringLiteral("Flag of Mongolia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F4"), QStringLiteral("flag_mo"), QStringLiteral("Flag of Macao SAR China")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F5"), QStringLiteral("flag_mp"), QStringLiteral("Flag of Northern Mariana Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F6"), QStringLiteral("flag_mq"), QStringLiteral("Flag of Martinique")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F7"), QStringLiteral("flag_mr"), QStringLiteral("Flag of Mauritania")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F8"), QStringLiteral("flag_ms"), QStringLiteral("Flag of Montserrat")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F9"), QStringLiteral("flag_mt"), QStringLiteral("Flag of Malta")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1FA"), QStringLiteral("flag_mu"), QStringLiteral("Flag of Mauritius")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1FB"), QStringLiteral("flag_mv"), QStringLiteral("Flag of Maldives")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1FC"), QStringLiteral("flag_mw"), QStringLiteral("Flag of Malawi")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1FD"), QStringLiteral("flag_mx"), QStringLiteral("Flag of Mexico")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1FE"), QStringLiteral("flag_my"), QStringLiteral("Flag of Malaysia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1FF"), QStringLiteral("flag_mz"), QStringLiteral("Flag of Mozambique")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1E6"), QStringLiteral("flag_na"), QStringLiteral("Flag of Namibia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1E8"), QStringLiteral("flag_nc"), QStringLiteral("Flag of New Caledonia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1EA"), QStringLiteral("flag_ne"), QStringLiteral("Flag of Niger")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1EB"), QStringLiteral("flag_nf"), QStringLiteral("Flag of Norfolk Island")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1EC"), QStringLiteral("flag_ng"), QStringLiteral("Flag of Nigeria")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1EE"), QStringLiteral("flag_ni"), QStringLiteral("Flag of Nicaragua")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1F1"), QStringLiteral("flag_nl"), QStringLiteral("Flag of Netherlands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1F4"), QStringLiteral("flag_no"), QStringLiteral("Flag of Norway")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1F5"), QStringLiteral("flag_np"), QStringLiteral("Flag of Nepal")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1F7"), QStringLiteral("flag_nr"), QStringLiteral("Flag of Nauru")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1FA"), QStringLiteral("flag_nu"), QStringLiteral("Flag of Niue")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1FF"), QStringLiteral("flag_nz"), QStringLiteral("Flag of New Zealand")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F4\U0001F1F2"), QStringLiteral("flag_om"), QStringLiteral("Flag of Oman")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1E6"), QStringLiteral("flag_pa"), QStringLiteral("Flag of Panama")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1EA"), QStringLiteral("flag_pe"), QStringLiteral("Flag of Peru")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1EB"), QStringLiteral("flag_pf"), QStringLiteral("Flag of French Polynesia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1EC"), QStringLiteral("flag_pg"), QStringLiteral("Flag of Papua New Guinea")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1ED"), QStringLiteral("flag_ph"), QStringLiteral("Flag of Philippines")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F0"), QStringLiteral("flag_pk"), QStringLiteral("Flag of Pakistan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F1"), QStringLiteral("flag_pl"), QStringLiteral("Flag of Poland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F2"), QStringLiteral("flag_pm"), QStringLiteral("Flag of St. Pierre & Miquelon")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F3"), QStringLiteral("flag_pn"), QStringLiteral("Flag of Pitcairn Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F7"), QStringLiteral("flag_pr"), QStringLiteral("Flag of Puerto Rico")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F8"), QStringLiteral("flag_ps"), QStringLiteral("Flag of Palestinian Territories")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F9"), QStringLiteral("flag_pt"), QStringLiteral("Flag of Portugal")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1FC"), QStringLiteral("flag_pw"), QStringLiteral("Flag of Palau")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1FE"), QStringLiteral("flag_py"), QStringLiteral("Flag of Paraguay")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F6\U0001F1E6"), QStringLiteral("flag_qa"), QStringLiteral("Flag of Qatar")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F7\U0001F1EA"), QStringLiteral("flag_re"), QStringLiteral("Flag of Réunion")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F7\U0001F1F4"), QStringLiteral("flag_ro"), QStringLiteral("Flag of Romania")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F7\U0001F1F8"), QStringLiteral("flag_rs"), QStringLiteral("Flag of Serbia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F7\U0001F1FA"), QStringLiteral("flag_ru"), QStringLiteral("Flag of Russia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F7\U0001F1FC"), QStringLiteral("flag_rw"), QStringLiteral("Flag of Rwanda")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1E6"), QStringLiteral("flag_sa"), QStringLiteral("Flag of Saudi Arabia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1E7"), QStringLiteral("flag_sb"), QStringLiteral("Flag of Solomon Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1E8"), QStringLiteral("flag_sc"), QStringLiteral("Flag of Seychelles")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1E9"), QStringLiteral("flag_sd"), QStringLiteral("Flag of Sudan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1EA"), QStringLiteral("flag_se"), QStringLiteral("Flag of Sweden")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1EC"), QStringLiteral("flag_sg"), QStringLiteral("Flag of Singapore")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1ED"), QStringLiteral("flag_sh"), QStringLiteral("Flag of St. Helena")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1EE"), QStringLiteral("flag_si"), QStringLiteral("Flag of Slovenia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1EF"), QStringLiteral("flag_sj"), QStringLiteral("Flag of Svalbard & Jan Mayen")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F0"), QStringLiteral("flag_sk"), QStringLiteral("Flag of Slovakia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F1"), QStringLiteral("flag_sl"), QStringLiteral("Flag of Sierra Leone")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F2"), QStringLiteral("flag_sm"), QStringLiteral("Flag of San Marino")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F3"), QStringLiteral("flag_sn"), QStringLiteral("Flag of Senegal")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F4"), QStringLiteral("flag_so"), QStringLiteral("Flag of Somalia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F7"), QStringLiteral("flag_sr"), QStringLiteral("Flag of Suriname")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F8"), QStringLiteral("flag_ss"), QStringLiteral("Flag of South Sudan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F9"), QStringLiteral("flag_st"), QStringLiteral("Flag of São Tomé & Príncipe")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1FB"), QStringLiteral("flag_sv"), QStringLiteral("Flag of El Salvador")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1FD"), QStringLiteral("flag_sx"), QStringLiteral("Flag of Sint Maarten")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1FE"), QStringLiteral("flag_sy"), QStringLiteral("Flag of Syria")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1FF"), QStringLiteral("flag_sz"), QStringLiteral("Flag of Eswatini")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1E6"), QStringLiteral("flag_ta"), QStringLiteral("Flag of Tristan da Cunha")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1E8"), QStringLiteral("flag_tc"), QStringLiteral("Flag of Turks & Caicos Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1E9"), QStringLiteral("flag_td"), QStringLiteral("Flag of Chad")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1EB"), QStringLiteral("flag_tf"), QStringLiteral("Flag of French Southern Territories")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1EC"), QStringLiteral("flag_tg"), QStringLiteral("Flag of Togo")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1ED"), QStringLiteral("flag_th"), QStringLiteral("Flag of Thailand")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1EF"), QStringLiteral("flag_tj"), QStringLiteral("Flag of Tajikistan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F0"), QStringLiteral("flag_tk"), QStringLiteral("Flag of Tokelau")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F1"), QStringLiteral("flag_tl"), QStringLiteral("Flag of Timor-Leste")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F2"), QStringLiteral("flag_tm"), QStringLiteral("Flag of Turkmenistan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F3"), QStringLiteral("flag_tn"), QStringLiteral("Flag of Tunisia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F4"), QStringLiteral("flag_to"), QStringLiteral("Flag of Tonga")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F7"), QStringLiteral("flag_tr"), QStringLiteral("Flag of Turkey")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F9"), QStringLiteral("flag_tt"), QStringLiteral("Flag of Trinidad & Tobago")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1FB"), QStringLiteral("flag_tv"), QStringLiteral("Flag of Tuvalu")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1FC"), QStringLiteral("flag_tw"), QStringLiteral("Flag of Taiwan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1FF"), QStringLiteral("flag_tz"), QStringLiteral("Flag of Tanzania")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1E6"), QStringLiteral("flag_ua"), QStringLiteral("Flag of Ukraine")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1EC"), QStringLiteral("flag_ug"), QStringLiteral("Flag of Uganda")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1F2"), QStringLiteral("flag_um"), QStringLiteral("Flag of U.S. Outlying Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1F3"), QStringLiteral("united_nations"), QStringLiteral("Flag of United Nations")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1F8"), QStringLiteral("flag_us"), QStringLiteral("Flag of United States")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1FE"), QStringLiteral("flag_uy"), QStringLiteral("Flag of Uruguay")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1FF"), QStringLiteral("flag_uz"), QStringLiteral("Flag of Uzbekistan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1E6"), QStringLiteral("flag_va"), QStringLiteral("Flag of Vatican City")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1E8"), QStringLiteral("flag_vc"), QStringLiteral("Flag of St. Vincent & Grenadines")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1EA"), QStringLiteral("flag_ve"), QStringLiteral("Flag of Venezuela")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1EC"), QStringLiteral("flag_vg"), QStringLiteral("Flag of British Virgin Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1EE"), QStringLiteral("flag_vi"), QStringLiteral("Flag of U.S. Virgin Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1F3"), QStringLiteral("flag_vn"), QStringLiteral("Flag of Vietnam")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1FA"), QStringLiteral("flag_vu"), QStringLiteral("Flag of Vanuatu")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FC\U0001F1EB"), QStringLiteral("flag_wf"), QStringLiteral("Flag of Wallis & Futuna")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FC\U0001F1F8"), QStringLiteral("flag_ws"), QStringLiteral("Flag of Samoa")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FD\U0001F1F0"), QStringLiteral("flag_xk"), QStringLiteral("Flag of Kosovo")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FE\U0001F1EA"), QStringLiteral("flag_ye"), QStringLiteral("Flag of Yemen")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FE\U0001F1F9"), QStringLiteral("flag_yt"), QStringLiteral("Flag of Mayotte")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FF\U0001F1E6"), QStringLiteral("flag_za"), QStringLiteral("Flag of South Africa")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FF\U0001F1F2"), QStringLiteral("flag_zm"), QStringLiteral("Flag of Zambia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FF\U0001F1FC"), QStringLiteral("flag_zw"), QStringLiteral("Flag of Zimbabwe")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F4\U000E0067\U000E0062\U000E0065\U000E006E\U000E0067\U000E007F"), QStringLiteral("england"), QStringLiteral("Flag of England")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F4\U000E0067\U000E0062\U000E0073\U000E0063\U000E0074\U000E007F"), QStringLiteral("scotland"), QStringLiteral("Flag of Scotland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F4\U000E0067\U000E0062\U000E0077\U000E006C\U000E0073\U000E007F"), QStringLiteral("wales"), QStringLiteral("Flag of Wales")}));
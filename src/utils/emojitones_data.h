@@ -1,1784 +0,0 @@
-// SPDX-FileCopyrightText: None
-// SPDX-License-Identifier: LGPL-2.0-or-later
-// This file is auto-generated. All changes will be lost. See tools/update-emojis.py
-// clang-format off
-{QStringLiteral("waving hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44B\U0001F3FB"), QStringLiteral("wave_tone1"), QStringLiteral("waving hand: light skin tone")})},
-{QStringLiteral("waving hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44B\U0001F3FC"), QStringLiteral("wave_tone2"), QStringLiteral("waving hand: medium-light skin tone")})},
-{QStringLiteral("waving hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44B\U0001F3FD"), QStringLiteral("wave_tone3"), QStringLiteral("waving hand: medium skin tone")})},
-{QStringLiteral("waving hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44B\U0001F3FE"), QStringLiteral("wave_tone4"), QStringLiteral("waving hand: medium-dark skin tone")})},
-{QStringLiteral("waving hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44B\U0001F3FF"), QStringLiteral("wave_tone5"), QStringLiteral("waving hand: dark skin tone")})},
-{QStringLiteral("raised back of hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91A\U0001F3FB"), QStringLiteral("raised_back_of_hand_tone1"), QStringLiteral("raised back of hand: light skin tone")})},
-{QStringLiteral("raised back of hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91A\U0001F3FC"), QStringLiteral("raised_back_of_hand_tone2"), QStringLiteral("raised back of hand: medium-light skin tone")})},
-{QStringLiteral("raised back of hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91A\U0001F3FD"), QStringLiteral("raised_back_of_hand_tone3"), QStringLiteral("raised back of hand: medium skin tone")})},
-{QStringLiteral("raised back of hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91A\U0001F3FE"), QStringLiteral("raised_back_of_hand_tone4"), QStringLiteral("raised back of hand: medium-dark skin tone")})},
-{QStringLiteral("raised back of hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91A\U0001F3FF"), QStringLiteral("raised_back_of_hand_tone5"), QStringLiteral("raised back of hand: dark skin tone")})},
-{QStringLiteral("hand with fingers splayed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F590\U0001F3FB"), QStringLiteral("hand_splayed_tone1"), QStringLiteral("hand with fingers splayed: light skin tone")})},
-{QStringLiteral("hand with fingers splayed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F590\U0001F3FC"), QStringLiteral("hand_splayed_tone2"), QStringLiteral("hand with fingers splayed: medium-light skin tone")})},
-{QStringLiteral("hand with fingers splayed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F590\U0001F3FD"), QStringLiteral("hand_splayed_tone3"), QStringLiteral("hand with fingers splayed: medium skin tone")})},
-{QStringLiteral("hand with fingers splayed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F590\U0001F3FE"), QStringLiteral("hand_splayed_tone4"), QStringLiteral("hand with fingers splayed: medium-dark skin tone")})},
-{QStringLiteral("hand with fingers splayed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F590\U0001F3FF"), QStringLiteral("hand_splayed_tone5"), QStringLiteral("hand with fingers splayed: dark skin tone")})},
-{QStringLiteral("raised hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270B\U0001F3FB"), QStringLiteral("raised_hand_tone1"), QStringLiteral("raised hand: light skin tone")})},
-{QStringLiteral("raised hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270B\U0001F3FC"), QStringLiteral("raised_hand_tone2"), QStringLiteral("raised hand: medium-light skin tone")})},
-{QStringLiteral("raised hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270B\U0001F3FD"), QStringLiteral("raised_hand_tone3"), QStringLiteral("raised hand: medium skin tone")})},
-{QStringLiteral("raised hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270B\U0001F3FE"), QStringLiteral("raised_hand_tone4"), QStringLiteral("raised hand: medium-dark skin tone")})},
-{QStringLiteral("raised hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270B\U0001F3FF"), QStringLiteral("raised_hand_tone5"), QStringLiteral("raised hand: dark skin tone")})},
-{QStringLiteral("vulcan salute"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F596\U0001F3FB"), QStringLiteral("vulcan_tone1"), QStringLiteral("vulcan salute: light skin tone")})},
-{QStringLiteral("vulcan salute"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F596\U0001F3FC"), QStringLiteral("vulcan_tone2"), QStringLiteral("vulcan salute: medium-light skin tone")})},
-{QStringLiteral("vulcan salute"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F596\U0001F3FD"), QStringLiteral("vulcan_tone3"), QStringLiteral("vulcan salute: medium skin tone")})},
-{QStringLiteral("vulcan salute"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F596\U0001F3FE"), QStringLiteral("vulcan_tone4"), QStringLiteral("vulcan salute: medium-dark skin tone")})},
-{QStringLiteral("vulcan salute"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F596\U0001F3FF"), QStringLiteral("vulcan_tone5"), QStringLiteral("vulcan salute: dark skin tone")})},
-{QStringLiteral("rightwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FB"), QStringLiteral("rightwards hand: light skin tone"), QStringLiteral("rightwards hand: light skin tone")})},
-{QStringLiteral("rightwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FC"), QStringLiteral("rightwards hand: medium-light skin tone"), QStringLiteral("rightwards hand: medium-light skin tone")})},
-{QStringLiteral("rightwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FD"), QStringLiteral("rightwards hand: medium skin tone"), QStringLiteral("rightwards hand: medium skin tone")})},
-{QStringLiteral("rightwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FE"), QStringLiteral("rightwards hand: medium-dark skin tone"), QStringLiteral("rightwards hand: medium-dark skin tone")})},
-{QStringLiteral("rightwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FF"), QStringLiteral("rightwards hand: dark skin tone"), QStringLiteral("rightwards hand: dark skin tone")})},
-{QStringLiteral("leftwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF2\U0001F3FB"), QStringLiteral("leftwards hand: light skin tone"), QStringLiteral("leftwards hand: light skin tone")})},
-{QStringLiteral("leftwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF2\U0001F3FC"), QStringLiteral("leftwards hand: medium-light skin tone"), QStringLiteral("leftwards hand: medium-light skin tone")})},
-{QStringLiteral("leftwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF2\U0001F3FD"), QStringLiteral("leftwards hand: medium skin tone"), QStringLiteral("leftwards hand: medium skin tone")})},
-{QStringLiteral("leftwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF2\U0001F3FE"), QStringLiteral("leftwards hand: medium-dark skin tone"), QStringLiteral("leftwards hand: medium-dark skin tone")})},
-{QStringLiteral("leftwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF2\U0001F3FF"), QStringLiteral("leftwards hand: dark skin tone"), QStringLiteral("leftwards hand: dark skin tone")})},
-{QStringLiteral("palm down hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF3\U0001F3FB"), QStringLiteral("palm down hand: light skin tone"), QStringLiteral("palm down hand: light skin tone")})},
-{QStringLiteral("palm down hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF3\U0001F3FC"), QStringLiteral("palm down hand: medium-light skin tone"), QStringLiteral("palm down hand: medium-light skin tone")})},
-{QStringLiteral("palm down hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF3\U0001F3FD"), QStringLiteral("palm down hand: medium skin tone"), QStringLiteral("palm down hand: medium skin tone")})},
-{QStringLiteral("palm down hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF3\U0001F3FE"), QStringLiteral("palm down hand: medium-dark skin tone"), QStringLiteral("palm down hand: medium-dark skin tone")})},
-{QStringLiteral("palm down hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF3\U0001F3FF"), QStringLiteral("palm down hand: dark skin tone"), QStringLiteral("palm down hand: dark skin tone")})},
-{QStringLiteral("palm up hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF4\U0001F3FB"), QStringLiteral("palm up hand: light skin tone"), QStringLiteral("palm up hand: light skin tone")})},
-{QStringLiteral("palm up hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF4\U0001F3FC"), QStringLiteral("palm up hand: medium-light skin tone"), QStringLiteral("palm up hand: medium-light skin tone")})},
-{QStringLiteral("palm up hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF4\U0001F3FD"), QStringLiteral("palm up hand: medium skin tone"), QStringLiteral("palm up hand: medium skin tone")})},
-{QStringLiteral("palm up hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF4\U0001F3FE"), QStringLiteral("palm up hand: medium-dark skin tone"), QStringLiteral("palm up hand: medium-dark skin tone")})},
-{QStringLiteral("palm up hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF4\U0001F3FF"), QStringLiteral("palm up hand: dark skin tone"), QStringLiteral("palm up hand: dark skin tone")})},
-{QStringLiteral("OK hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44C\U0001F3FB"), QStringLiteral("ok_hand_tone1"), QStringLiteral("OK hand: light skin tone")})},
-{QStringLiteral("OK hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44C\U0001F3FC"), QStringLiteral("ok_hand_tone2"), QStringLiteral("OK hand: medium-light skin tone")})},
-{QStringLiteral("OK hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44C\U0001F3FD"), QStringLiteral("ok_hand_tone3"), QStringLiteral("OK hand: medium skin tone")})},
-{QStringLiteral("OK hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44C\U0001F3FE"), QStringLiteral("ok_hand_tone4"), QStringLiteral("OK hand: medium-dark skin tone")})},
-{QStringLiteral("OK hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44C\U0001F3FF"), QStringLiteral("ok_hand_tone5"), QStringLiteral("OK hand: dark skin tone")})},
-{QStringLiteral("pinched fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90C\U0001F3FB"), QStringLiteral("pinched fingers: light skin tone"), QStringLiteral("pinched fingers: light skin tone")})},
-{QStringLiteral("pinched fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90C\U0001F3FC"), QStringLiteral("pinched fingers: medium-light skin tone"), QStringLiteral("pinched fingers: medium-light skin tone")})},
-{QStringLiteral("pinched fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90C\U0001F3FD"), QStringLiteral("pinched fingers: medium skin tone"), QStringLiteral("pinched fingers: medium skin tone")})},
-{QStringLiteral("pinched fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90C\U0001F3FE"), QStringLiteral("pinched fingers: medium-dark skin tone"), QStringLiteral("pinched fingers: medium-dark skin tone")})},
-{QStringLiteral("pinched fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90C\U0001F3FF"), QStringLiteral("pinched fingers: dark skin tone"), QStringLiteral("pinched fingers: dark skin tone")})},
-{QStringLiteral("pinching hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90F\U0001F3FB"), QStringLiteral("pinching hand: light skin tone"), QStringLiteral("pinching hand: light skin tone")})},
-{QStringLiteral("pinching hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90F\U0001F3FC"), QStringLiteral("pinching hand: medium-light skin tone"), QStringLiteral("pinching hand: medium-light skin tone")})},
-{QStringLiteral("pinching hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90F\U0001F3FD"), QStringLiteral("pinching hand: medium skin tone"), QStringLiteral("pinching hand: medium skin tone")})},
-{QStringLiteral("pinching hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90F\U0001F3FE"), QStringLiteral("pinching hand: medium-dark skin tone"), QStringLiteral("pinching hand: medium-dark skin tone")})},
-{QStringLiteral("pinching hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90F\U0001F3FF"), QStringLiteral("pinching hand: dark skin tone"), QStringLiteral("pinching hand: dark skin tone")})},
-{QStringLiteral("victory hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270C\U0001F3FB"), QStringLiteral("v_tone1"), QStringLiteral("victory hand: light skin tone")})},
-{QStringLiteral("victory hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270C\U0001F3FC"), QStringLiteral("v_tone2"), QStringLiteral("victory hand: medium-light skin tone")})},
-{QStringLiteral("victory hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270C\U0001F3FD"), QStringLiteral("v_tone3"), QStringLiteral("victory hand: medium skin tone")})},
-{QStringLiteral("victory hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270C\U0001F3FE"), QStringLiteral("v_tone4"), QStringLiteral("victory hand: medium-dark skin tone")})},
-{QStringLiteral("victory hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270C\U0001F3FF"), QStringLiteral("v_tone5"), QStringLiteral("victory hand: dark skin tone")})},
-{QStringLiteral("crossed fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91E\U0001F3FB"), QStringLiteral("fingers_crossed_tone1"), QStringLiteral("crossed fingers: light skin tone")})},
-{QStringLiteral("crossed fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91E\U0001F3FC"), QStringLiteral("fingers_crossed_tone2"), QStringLiteral("crossed fingers: medium-light skin tone")})},
-{QStringLiteral("crossed fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91E\U0001F3FD"), QStringLiteral("fingers_crossed_tone3"), QStringLiteral("crossed fingers: medium skin tone")})},
-{QStringLiteral("crossed fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91E\U0001F3FE"), QStringLiteral("fingers_crossed_tone4"), QStringLiteral("crossed fingers: medium-dark skin tone")})},
-{QStringLiteral("crossed fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91E\U0001F3FF"), QStringLiteral("fingers_crossed_tone5"), QStringLiteral("crossed fingers: dark skin tone")})},
-{QStringLiteral("hand with index finger and thumb crossed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF0\U0001F3FB"), QStringLiteral("hand with index finger and thumb crossed: light skin tone"), QStringLiteral("hand with index finger and thumb crossed: light skin tone")})},
-{QStringLiteral("hand with index finger and thumb crossed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF0\U0001F3FC"), QStringLiteral("hand with index finger and thumb crossed: medium-light skin tone"), QStringLiteral("hand with index finger and thumb crossed: medium-light skin tone")})},
-{QStringLiteral("hand with index finger and thumb crossed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF0\U0001F3FD"), QStringLiteral("hand with index finger and thumb crossed: medium skin tone"), QStringLiteral("hand with index finger and thumb crossed: medium skin tone")})},
-{QStringLiteral("hand with index finger and thumb crossed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF0\U0001F3FE"), QStringLiteral("hand with index finger and thumb crossed: medium-dark skin tone"), QStringLiteral("hand with index finger and thumb crossed: medium-dark skin tone")})},
-{QStringLiteral("hand with index finger and thumb crossed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF0\U0001F3FF"), QStringLiteral("hand with index finger and thumb crossed: dark skin tone"), QStringLiteral("hand with index finger and thumb crossed: dark skin tone")})},
-{QStringLiteral("love-you gesture"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91F\U0001F3FB"), QStringLiteral("love_you_gesture_tone1"), QStringLiteral("love-you gesture: light skin tone")})},
-{QStringLiteral("love-you gesture"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91F\U0001F3FC"), QStringLiteral("love_you_gesture_tone2"), QStringLiteral("love-you gesture: medium-light skin tone")})},
-{QStringLiteral("love-you gesture"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91F\U0001F3FD"), QStringLiteral("love_you_gesture_tone3"), QStringLiteral("love-you gesture: medium skin tone")})},
-{QStringLiteral("love-you gesture"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91F\U0001F3FE"), QStringLiteral("love_you_gesture_tone4"), QStringLiteral("love-you gesture: medium-dark skin tone")})},
-{QStringLiteral("love-you gesture"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91F\U0001F3FF"), QStringLiteral("love_you_gesture_tone5"), QStringLiteral("love-you gesture: dark skin tone")})},
-{QStringLiteral("sign of the horns"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F918\U0001F3FB"), QStringLiteral("metal_tone1"), QStringLiteral("sign of the horns: light skin tone")})},
-{QStringLiteral("sign of the horns"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F918\U0001F3FC"), QStringLiteral("metal_tone2"), QStringLiteral("sign of the horns: medium-light skin tone")})},
-{QStringLiteral("sign of the horns"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F918\U0001F3FD"), QStringLiteral("metal_tone3"), QStringLiteral("sign of the horns: medium skin tone")})},
-{QStringLiteral("sign of the horns"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F918\U0001F3FE"), QStringLiteral("metal_tone4"), QStringLiteral("sign of the horns: medium-dark skin tone")})},
-{QStringLiteral("sign of the horns"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F918\U0001F3FF"), QStringLiteral("metal_tone5"), QStringLiteral("sign of the horns: dark skin tone")})},
-{QStringLiteral("call me hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F919\U0001F3FB"), QStringLiteral("call_me_tone1"), QStringLiteral("call me hand: light skin tone")})},
-{QStringLiteral("call me hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F919\U0001F3FC"), QStringLiteral("call_me_tone2"), QStringLiteral("call me hand: medium-light skin tone")})},
-{QStringLiteral("call me hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F919\U0001F3FD"), QStringLiteral("call_me_tone3"), QStringLiteral("call me hand: medium skin tone")})},
-{QStringLiteral("call me hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F919\U0001F3FE"), QStringLiteral("call_me_tone4"), QStringLiteral("call me hand: medium-dark skin tone")})},
-{QStringLiteral("call me hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F919\U0001F3FF"), QStringLiteral("call_me_tone5"), QStringLiteral("call me hand: dark skin tone")})},
-{QStringLiteral("backhand index pointing left"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F448\U0001F3FB"), QStringLiteral("point_left_tone1"), QStringLiteral("backhand index pointing left: light skin tone")})},
-{QStringLiteral("backhand index pointing left"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F448\U0001F3FC"), QStringLiteral("point_left_tone2"), QStringLiteral("backhand index pointing left: medium-light skin tone")})},
-{QStringLiteral("backhand index pointing left"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F448\U0001F3FD"), QStringLiteral("point_left_tone3"), QStringLiteral("backhand index pointing left: medium skin tone")})},
-{QStringLiteral("backhand index pointing left"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F448\U0001F3FE"), QStringLiteral("point_left_tone4"), QStringLiteral("backhand index pointing left: medium-dark skin tone")})},
-{QStringLiteral("backhand index pointing left"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F448\U0001F3FF"), QStringLiteral("point_left_tone5"), QStringLiteral("backhand index pointing left: dark skin tone")})},
-{QStringLiteral("backhand index pointing right"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F449\U0001F3FB"), QStringLiteral("point_right_tone1"), QStringLiteral("backhand index pointing right: light skin tone")})},
-{QStringLiteral("backhand index pointing right"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F449\U0001F3FC"), QStringLiteral("point_right_tone2"), QStringLiteral("backhand index pointing right: medium-light skin tone")})},
-{QStringLiteral("backhand index pointing right"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F449\U0001F3FD"), QStringLiteral("point_right_tone3"), QStringLiteral("backhand index pointing right: medium skin tone")})},
-{QStringLiteral("backhand index pointing right"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F449\U0001F3FE"), QStringLiteral("point_right_tone4"), QStringLiteral("backhand index pointing right: medium-dark skin tone")})},
-{QStringLiteral("backhand index pointing right"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F449\U0001F3FF"), QStringLiteral("point_right_tone5"), QStringLiteral("backhand index pointing right: dark skin tone")})},
-{QStringLiteral("backhand index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F446\U0001F3FB"), QStringLiteral("point_up_2_tone1"), QStringLiteral("backhand index pointing up: light skin tone")})},
-{QStringLiteral("backhand index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F446\U0001F3FC"), QStringLiteral("point_up_2_tone2"), QStringLiteral("backhand index pointing up: medium-light skin tone")})},
-{QStringLiteral("backhand index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F446\U0001F3FD"), QStringLiteral("point_up_2_tone3"), QStringLiteral("backhand index pointing up: medium skin tone")})},
-{QStringLiteral("backhand index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F446\U0001F3FE"), QStringLiteral("point_up_2_tone4"), QStringLiteral("backhand index pointing up: medium-dark skin tone")})},
-{QStringLiteral("backhand index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F446\U0001F3FF"), QStringLiteral("point_up_2_tone5"), QStringLiteral("backhand index pointing up: dark skin tone")})},
-{QStringLiteral("middle finger"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F595\U0001F3FB"), QStringLiteral("middle_finger_tone1"), QStringLiteral("middle finger: light skin tone")})},
-{QStringLiteral("middle finger"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F595\U0001F3FC"), QStringLiteral("middle_finger_tone2"), QStringLiteral("middle finger: medium-light skin tone")})},
-{QStringLiteral("middle finger"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F595\U0001F3FD"), QStringLiteral("middle_finger_tone3"), QStringLiteral("middle finger: medium skin tone")})},
-{QStringLiteral("middle finger"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F595\U0001F3FE"), QStringLiteral("middle_finger_tone4"), QStringLiteral("middle finger: medium-dark skin tone")})},
-{QStringLiteral("middle finger"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F595\U0001F3FF"), QStringLiteral("middle_finger_tone5"), QStringLiteral("middle finger: dark skin tone")})},
-{QStringLiteral("backhand index pointing down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F447\U0001F3FB"), QStringLiteral("point_down_tone1"), QStringLiteral("backhand index pointing down: light skin tone")})},
-{QStringLiteral("backhand index pointing down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F447\U0001F3FC"), QStringLiteral("point_down_tone2"), QStringLiteral("backhand index pointing down: medium-light skin tone")})},
-{QStringLiteral("backhand index pointing down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F447\U0001F3FD"), QStringLiteral("point_down_tone3"), QStringLiteral("backhand index pointing down: medium skin tone")})},
-{QStringLiteral("backhand index pointing down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F447\U0001F3FE"), QStringLiteral("point_down_tone4"), QStringLiteral("backhand index pointing down: medium-dark skin tone")})},
-{QStringLiteral("backhand index pointing down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F447\U0001F3FF"), QStringLiteral("point_down_tone5"), QStringLiteral("backhand index pointing down: dark skin tone")})},
-{QStringLiteral("index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000261D\U0001F3FB"), QStringLiteral("point_up_tone1"), QStringLiteral("index pointing up: light skin tone")})},
-{QStringLiteral("index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000261D\U0001F3FC"), QStringLiteral("point_up_tone2"), QStringLiteral("index pointing up: medium-light skin tone")})},
-{QStringLiteral("index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000261D\U0001F3FD"), QStringLiteral("point_up_tone3"), QStringLiteral("index pointing up: medium skin tone")})},
-{QStringLiteral("index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000261D\U0001F3FE"), QStringLiteral("point_up_tone4"), QStringLiteral("index pointing up: medium-dark skin tone")})},
-{QStringLiteral("index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000261D\U0001F3FF"), QStringLiteral("point_up_tone5"), QStringLiteral("index pointing up: dark skin tone")})},
-{QStringLiteral("index pointing at the viewer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF5\U0001F3FB"), QStringLiteral("index pointing at the viewer: light skin tone"), QStringLiteral("index pointing at the viewer: light skin tone")})},
-{QStringLiteral("index pointing at the viewer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF5\U0001F3FC"), QStringLiteral("index pointing at the viewer: medium-light skin tone"), QStringLiteral("index pointing at the viewer: medium-light skin tone")})},
-{QStringLiteral("index pointing at the viewer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF5\U0001F3FD"), QStringLiteral("index pointing at the viewer: medium skin tone"), QStringLiteral("index pointing at the viewer: medium skin tone")})},
-{QStringLiteral("index pointing at the viewer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF5\U0001F3FE"), QStringLiteral("index pointing at the viewer: medium-dark skin tone"), QStringLiteral("index pointing at the viewer: medium-dark skin tone")})},
-{QStringLiteral("index pointing at the viewer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF5\U0001F3FF"), QStringLiteral("index pointing at the viewer: dark skin tone"), QStringLiteral("index pointing at the viewer: dark skin tone")})},
-{QStringLiteral("thumbs up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44D\U0001F3FB"), QStringLiteral("thumbsup_tone1"), QStringLiteral("thumbs up: light skin tone")})},
-{QStringLiteral("thumbs up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44D\U0001F3FC"), QStringLiteral("thumbsup_tone2"), QStringLiteral("thumbs up: medium-light skin tone")})},
-{QStringLiteral("thumbs up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44D\U0001F3FD"), QStringLiteral("thumbsup_tone3"), QStringLiteral("thumbs up: medium skin tone")})},
-{QStringLiteral("thumbs up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44D\U0001F3FE"), QStringLiteral("thumbsup_tone4"), QStringLiteral("thumbs up: medium-dark skin tone")})},
-{QStringLiteral("thumbs up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44D\U0001F3FF"), QStringLiteral("thumbsup_tone5"), QStringLiteral("thumbs up: dark skin tone")})},
-{QStringLiteral("thumbs down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44E\U0001F3FB"), QStringLiteral("thumbsdown_tone1"), QStringLiteral("thumbs down: light skin tone")})},
-{QStringLiteral("thumbs down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44E\U0001F3FC"), QStringLiteral("thumbsdown_tone2"), QStringLiteral("thumbs down: medium-light skin tone")})},
-{QStringLiteral("thumbs down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44E\U0001F3FD"), QStringLiteral("thumbsdown_tone3"), QStringLiteral("thumbs down: medium skin tone")})},
-{QStringLiteral("thumbs down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44E\U0001F3FE"), QStringLiteral("thumbsdown_tone4"), QStringLiteral("thumbs down: medium-dark skin tone")})},
-{QStringLiteral("thumbs down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44E\U0001F3FF"), QStringLiteral("thumbsdown_tone5"), QStringLiteral("thumbs down: dark skin tone")})},
-{QStringLiteral("raised fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270A\U0001F3FB"), QStringLiteral("fist_tone1"), QStringLiteral("raised fist: light skin tone")})},
-{QStringLiteral("raised fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270A\U0001F3FC"), QStringLiteral("fist_tone2"), QStringLiteral("raised fist: medium-light skin tone")})},
-{QStringLiteral("raised fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270A\U0001F3FD"), QStringLiteral("fist_tone3"), QStringLiteral("raised fist: medium skin tone")})},
-{QStringLiteral("raised fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270A\U0001F3FE"), QStringLiteral("fist_tone4"), QStringLiteral("raised fist: medium-dark skin tone")})},
-{QStringLiteral("raised fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270A\U0001F3FF"), QStringLiteral("fist_tone5"), QStringLiteral("raised fist: dark skin tone")})},
-{QStringLiteral("oncoming fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44A\U0001F3FB"), QStringLiteral("punch_tone1"), QStringLiteral("oncoming fist: light skin tone")})},
-{QStringLiteral("oncoming fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44A\U0001F3FC"), QStringLiteral("punch_tone2"), QStringLiteral("oncoming fist: medium-light skin tone")})},
-{QStringLiteral("oncoming fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44A\U0001F3FD"), QStringLiteral("punch_tone3"), QStringLiteral("oncoming fist: medium skin tone")})},
-{QStringLiteral("oncoming fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44A\U0001F3FE"), QStringLiteral("punch_tone4"), QStringLiteral("oncoming fist: medium-dark skin tone")})},
-{QStringLiteral("oncoming fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44A\U0001F3FF"), QStringLiteral("punch_tone5"), QStringLiteral("oncoming fist: dark skin tone")})},
-{QStringLiteral("left-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91B\U0001F3FB"), QStringLiteral("left_facing_fist_tone1"), QStringLiteral("left-facing fist: light skin tone")})},
-{QStringLiteral("left-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91B\U0001F3FC"), QStringLiteral("left_facing_fist_tone2"), QStringLiteral("left-facing fist: medium-light skin tone")})},
-{QStringLiteral("left-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91B\U0001F3FD"), QStringLiteral("left_facing_fist_tone3"), QStringLiteral("left-facing fist: medium skin tone")})},
-{QStringLiteral("left-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91B\U0001F3FE"), QStringLiteral("left_facing_fist_tone4"), QStringLiteral("left-facing fist: medium-dark skin tone")})},
-{QStringLiteral("left-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91B\U0001F3FF"), QStringLiteral("left_facing_fist_tone5"), QStringLiteral("left-facing fist: dark skin tone")})},
-{QStringLiteral("right-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91C\U0001F3FB"), QStringLiteral("right_facing_fist_tone1"), QStringLiteral("right-facing fist: light skin tone")})},
-{QStringLiteral("right-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91C\U0001F3FC"), QStringLiteral("right_facing_fist_tone2"), QStringLiteral("right-facing fist: medium-light skin tone")})},
-{QStringLiteral("right-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91C\U0001F3FD"), QStringLiteral("right_facing_fist_tone3"), QStringLiteral("right-facing fist: medium skin tone")})},
-{QStringLiteral("right-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91C\U0001F3FE"), QStringLiteral("right_facing_fist_tone4"), QStringLiteral("right-facing fist: medium-dark skin tone")})},
-{QStringLiteral("right-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91C\U0001F3FF"), QStringLiteral("right_facing_fist_tone5"), QStringLiteral("right-facing fist: dark skin tone")})},
-{QStringLiteral("clapping hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44F\U0001F3FB"), QStringLiteral("clap_tone1"), QStringLiteral("clapping hands: light skin tone")})},
-{QStringLiteral("clapping hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44F\U0001F3FC"), QStringLiteral("clap_tone2"), QStringLiteral("clapping hands: medium-light skin tone")})},
-{QStringLiteral("clapping hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44F\U0001F3FD"), QStringLiteral("clap_tone3"), QStringLiteral("clapping hands: medium skin tone")})},
-{QStringLiteral("clapping hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44F\U0001F3FE"), QStringLiteral("clap_tone4"), QStringLiteral("clapping hands: medium-dark skin tone")})},
-{QStringLiteral("clapping hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44F\U0001F3FF"), QStringLiteral("clap_tone5"), QStringLiteral("clapping hands: dark skin tone")})},
-{QStringLiteral("raising hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64C\U0001F3FB"), QStringLiteral("raised_hands_tone1"), QStringLiteral("raising hands: light skin tone")})},
-{QStringLiteral("raising hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64C\U0001F3FC"), QStringLiteral("raised_hands_tone2"), QStringLiteral("raising hands: medium-light skin tone")})},
-{QStringLiteral("raising hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64C\U0001F3FD"), QStringLiteral("raised_hands_tone3"), QStringLiteral("raising hands: medium skin tone")})},
-{QStringLiteral("raising hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64C\U0001F3FE"), QStringLiteral("raised_hands_tone4"), QStringLiteral("raising hands: medium-dark skin tone")})},
-{QStringLiteral("raising hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64C\U0001F3FF"), QStringLiteral("raised_hands_tone5"), QStringLiteral("raising hands: dark skin tone")})},
-{QStringLiteral("heart hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF6\U0001F3FB"), QStringLiteral("heart hands: light skin tone"), QStringLiteral("heart hands: light skin tone")})},
-{QStringLiteral("heart hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF6\U0001F3FC"), QStringLiteral("heart hands: medium-light skin tone"), QStringLiteral("heart hands: medium-light skin tone")})},
-{QStringLiteral("heart hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF6\U0001F3FD"), QStringLiteral("heart hands: medium skin tone"), QStringLiteral("heart hands: medium skin tone")})},
-{QStringLiteral("heart hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF6\U0001F3FE"), QStringLiteral("heart hands: medium-dark skin tone"), QStringLiteral("heart hands: medium-dark skin tone")})},
-{QStringLiteral("heart hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF6\U0001F3FF"), QStringLiteral("heart hands: dark skin tone"), QStringLiteral("heart hands: dark skin tone")})},
-{QStringLiteral("open hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F450\U0001F3FB"), QStringLiteral("open_hands_tone1"), QStringLiteral("open hands: light skin tone")})},
-{QStringLiteral("open hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F450\U0001F3FC"), QStringLiteral("open_hands_tone2"), QStringLiteral("open hands: medium-light skin tone")})},
-{QStringLiteral("open hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F450\U0001F3FD"), QStringLiteral("open_hands_tone3"), QStringLiteral("open hands: medium skin tone")})},
-{QStringLiteral("open hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F450\U0001F3FE"), QStringLiteral("open_hands_tone4"), QStringLiteral("open hands: medium-dark skin tone")})},
-{QStringLiteral("open hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F450\U0001F3FF"), QStringLiteral("open_hands_tone5"), QStringLiteral("open hands: dark skin tone")})},
-{QStringLiteral("palms up together"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F932\U0001F3FB"), QStringLiteral("palms_up_together_tone1"), QStringLiteral("palms up together: light skin tone")})},
-{QStringLiteral("palms up together"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F932\U0001F3FC"), QStringLiteral("palms_up_together_tone2"), QStringLiteral("palms up together: medium-light skin tone")})},
-{QStringLiteral("palms up together"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F932\U0001F3FD"), QStringLiteral("palms_up_together_tone3"), QStringLiteral("palms up together: medium skin tone")})},
-{QStringLiteral("palms up together"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F932\U0001F3FE"), QStringLiteral("palms_up_together_tone4"), QStringLiteral("palms up together: medium-dark skin tone")})},
-{QStringLiteral("palms up together"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F932\U0001F3FF"), QStringLiteral("palms_up_together_tone5"), QStringLiteral("palms up together: dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91D\U0001F3FB"), QStringLiteral("handshake: light skin tone"), QStringLiteral("handshake: light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91D\U0001F3FC"), QStringLiteral("handshake: medium-light skin tone"), QStringLiteral("handshake: medium-light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91D\U0001F3FD"), QStringLiteral("handshake: medium skin tone"), QStringLiteral("handshake: medium skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91D\U0001F3FE"), QStringLiteral("handshake: medium-dark skin tone"), QStringLiteral("handshake: medium-dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91D\U0001F3FF"), QStringLiteral("handshake: dark skin tone"), QStringLiteral("handshake: dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FC"), QStringLiteral("handshake: light skin tone, medium-light skin tone"), QStringLiteral("handshake: light skin tone, medium-light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FD"), QStringLiteral("handshake: light skin tone, medium skin tone"), QStringLiteral("handshake: light skin tone, medium skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FE"), QStringLiteral("handshake: light skin tone, medium-dark skin tone"), QStringLiteral("handshake: light skin tone, medium-dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FF"), QStringLiteral("handshake: light skin tone, dark skin tone"), QStringLiteral("handshake: light skin tone, dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FB"), QStringLiteral("handshake: medium-light skin tone, light skin tone"), QStringLiteral("handshake: medium-light skin tone, light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FD"), QStringLiteral("handshake: medium-light skin tone, medium skin tone"), QStringLiteral("handshake: medium-light skin tone, medium skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FE"), QStringLiteral("handshake: medium-light skin tone, medium-dark skin tone"), QStringLiteral("handshake: medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FF"), QStringLiteral("handshake: medium-light skin tone, dark skin tone"), QStringLiteral("handshake: medium-light skin tone, dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FB"), QStringLiteral("handshake: medium skin tone, light skin tone"), QStringLiteral("handshake: medium skin tone, light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FC"), QStringLiteral("handshake: medium skin tone, medium-light skin tone"), QStringLiteral("handshake: medium skin tone, medium-light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FE"), QStringLiteral("handshake: medium skin tone, medium-dark skin tone"), QStringLiteral("handshake: medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FF"), QStringLiteral("handshake: medium skin tone, dark skin tone"), QStringLiteral("handshake: medium skin tone, dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FB"), QStringLiteral("handshake: medium-dark skin tone, light skin tone"), QStringLiteral("handshake: medium-dark skin tone, light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FC"), QStringLiteral("handshake: medium-dark skin tone, medium-light skin tone"), QStringLiteral("handshake: medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FD"), QStringLiteral("handshake: medium-dark skin tone, medium skin tone"), QStringLiteral("handshake: medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FF"), QStringLiteral("handshake: medium-dark skin tone, dark skin tone"), QStringLiteral("handshake: medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FB"), QStringLiteral("handshake: dark skin tone, light skin tone"), QStringLiteral("handshake: dark skin tone, light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FC"), QStringLiteral("handshake: dark skin tone, medium-light skin tone"), QStringLiteral("handshake: dark skin tone, medium-light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FD"), QStringLiteral("handshake: dark skin tone, medium skin tone"), QStringLiteral("handshake: dark skin tone, medium skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FE"), QStringLiteral("handshake: dark skin tone, medium-dark skin tone"), QStringLiteral("handshake: dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("folded hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64F\U0001F3FB"), QStringLiteral("pray_tone1"), QStringLiteral("folded hands: light skin tone")})},
-{QStringLiteral("folded hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64F\U0001F3FC"), QStringLiteral("pray_tone2"), QStringLiteral("folded hands: medium-light skin tone")})},
-{QStringLiteral("folded hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64F\U0001F3FD"), QStringLiteral("pray_tone3"), QStringLiteral("folded hands: medium skin tone")})},
-{QStringLiteral("folded hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64F\U0001F3FE"), QStringLiteral("pray_tone4"), QStringLiteral("folded hands: medium-dark skin tone")})},
-{QStringLiteral("folded hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64F\U0001F3FF"), QStringLiteral("pray_tone5"), QStringLiteral("folded hands: dark skin tone")})},
-{QStringLiteral("writing hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270D\U0001F3FB"), QStringLiteral("writing_hand_tone1"), QStringLiteral("writing hand: light skin tone")})},
-{QStringLiteral("writing hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270D\U0001F3FC"), QStringLiteral("writing_hand_tone2"), QStringLiteral("writing hand: medium-light skin tone")})},
-{QStringLiteral("writing hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270D\U0001F3FD"), QStringLiteral("writing_hand_tone3"), QStringLiteral("writing hand: medium skin tone")})},
-{QStringLiteral("writing hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270D\U0001F3FE"), QStringLiteral("writing_hand_tone4"), QStringLiteral("writing hand: medium-dark skin tone")})},
-{QStringLiteral("writing hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270D\U0001F3FF"), QStringLiteral("writing_hand_tone5"), QStringLiteral("writing hand: dark skin tone")})},
-{QStringLiteral("nail polish"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F485\U0001F3FB"), QStringLiteral("nail_care_tone1"), QStringLiteral("nail polish: light skin tone")})},
-{QStringLiteral("nail polish"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F485\U0001F3FC"), QStringLiteral("nail_care_tone2"), QStringLiteral("nail polish: medium-light skin tone")})},
-{QStringLiteral("nail polish"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F485\U0001F3FD"), QStringLiteral("nail_care_tone3"), QStringLiteral("nail polish: medium skin tone")})},
-{QStringLiteral("nail polish"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F485\U0001F3FE"), QStringLiteral("nail_care_tone4"), QStringLiteral("nail polish: medium-dark skin tone")})},
-{QStringLiteral("nail polish"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F485\U0001F3FF"), QStringLiteral("nail_care_tone5"), QStringLiteral("nail polish: dark skin tone")})},
-{QStringLiteral("selfie"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F933\U0001F3FB"), QStringLiteral("selfie_tone1"), QStringLiteral("selfie: light skin tone")})},
-{QStringLiteral("selfie"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F933\U0001F3FC"), QStringLiteral("selfie_tone2"), QStringLiteral("selfie: medium-light skin tone")})},
-{QStringLiteral("selfie"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F933\U0001F3FD"), QStringLiteral("selfie_tone3"), QStringLiteral("selfie: medium skin tone")})},
-{QStringLiteral("selfie"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F933\U0001F3FE"), QStringLiteral("selfie_tone4"), QStringLiteral("selfie: medium-dark skin tone")})},
-{QStringLiteral("selfie"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F933\U0001F3FF"), QStringLiteral("selfie_tone5"), QStringLiteral("selfie: dark skin tone")})},
-{QStringLiteral("flexed biceps"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AA\U0001F3FB"), QStringLiteral("muscle_tone1"), QStringLiteral("flexed biceps: light skin tone")})},
-{QStringLiteral("flexed biceps"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AA\U0001F3FC"), QStringLiteral("muscle_tone2"), QStringLiteral("flexed biceps: medium-light skin tone")})},
-{QStringLiteral("flexed biceps"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AA\U0001F3FD"), QStringLiteral("muscle_tone3"), QStringLiteral("flexed biceps: medium skin tone")})},
-{QStringLiteral("flexed biceps"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AA\U0001F3FE"), QStringLiteral("muscle_tone4"), QStringLiteral("flexed biceps: medium-dark skin tone")})},
-{QStringLiteral("flexed biceps"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AA\U0001F3FF"), QStringLiteral("muscle_tone5"), QStringLiteral("flexed biceps: dark skin tone")})},
-{QStringLiteral("leg"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B5\U0001F3FB"), QStringLiteral("leg_tone1"), QStringLiteral("leg: light skin tone")})},
-{QStringLiteral("leg"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B5\U0001F3FC"), QStringLiteral("leg_tone2"), QStringLiteral("leg: medium-light skin tone")})},
-{QStringLiteral("leg"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B5\U0001F3FD"), QStringLiteral("leg_tone3"), QStringLiteral("leg: medium skin tone")})},
-{QStringLiteral("leg"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B5\U0001F3FE"), QStringLiteral("leg_tone4"), QStringLiteral("leg: medium-dark skin tone")})},
-{QStringLiteral("leg"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B5\U0001F3FF"), QStringLiteral("leg_tone5"), QStringLiteral("leg: dark skin tone")})},
-{QStringLiteral("foot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B6\U0001F3FB"), QStringLiteral("foot_tone1"), QStringLiteral("foot: light skin tone")})},
-{QStringLiteral("foot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B6\U0001F3FC"), QStringLiteral("foot_tone2"), QStringLiteral("foot: medium-light skin tone")})},
-{QStringLiteral("foot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B6\U0001F3FD"), QStringLiteral("foot_tone3"), QStringLiteral("foot: medium skin tone")})},
-{QStringLiteral("foot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B6\U0001F3FE"), QStringLiteral("foot_tone4"), QStringLiteral("foot: medium-dark skin tone")})},
-{QStringLiteral("foot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B6\U0001F3FF"), QStringLiteral("foot_tone5"), QStringLiteral("foot: dark skin tone")})},
-{QStringLiteral("ear"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F442\U0001F3FB"), QStringLiteral("ear_tone1"), QStringLiteral("ear: light skin tone")})},
-{QStringLiteral("ear"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F442\U0001F3FC"), QStringLiteral("ear_tone2"), QStringLiteral("ear: medium-light skin tone")})},
-{QStringLiteral("ear"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F442\U0001F3FD"), QStringLiteral("ear_tone3"), QStringLiteral("ear: medium skin tone")})},
-{QStringLiteral("ear"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F442\U0001F3FE"), QStringLiteral("ear_tone4"), QStringLiteral("ear: medium-dark skin tone")})},
-{QStringLiteral("ear"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F442\U0001F3FF"), QStringLiteral("ear_tone5"), QStringLiteral("ear: dark skin tone")})},
-{QStringLiteral("ear with hearing aid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BB\U0001F3FB"), QStringLiteral("ear with hearing aid: light skin tone"), QStringLiteral("ear with hearing aid: light skin tone")})},
-{QStringLiteral("ear with hearing aid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BB\U0001F3FC"), QStringLiteral("ear with hearing aid: medium-light skin tone"), QStringLiteral("ear with hearing aid: medium-light skin tone")})},
-{QStringLiteral("ear with hearing aid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BB\U0001F3FD"), QStringLiteral("ear with hearing aid: medium skin tone"), QStringLiteral("ear with hearing aid: medium skin tone")})},
-{QStringLiteral("ear with hearing aid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BB\U0001F3FE"), QStringLiteral("ear with hearing aid: medium-dark skin tone"), QStringLiteral("ear with hearing aid: medium-dark skin tone")})},
-{QStringLiteral("ear with hearing aid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BB\U0001F3FF"), QStringLiteral("ear with hearing aid: dark skin tone"), QStringLiteral("ear with hearing aid: dark skin tone")})},
-{QStringLiteral("nose"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F443\U0001F3FB"), QStringLiteral("nose_tone1"), QStringLiteral("nose: light skin tone")})},
-{QStringLiteral("nose"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F443\U0001F3FC"), QStringLiteral("nose_tone2"), QStringLiteral("nose: medium-light skin tone")})},
-{QStringLiteral("nose"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F443\U0001F3FD"), QStringLiteral("nose_tone3"), QStringLiteral("nose: medium skin tone")})},
-{QStringLiteral("nose"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F443\U0001F3FE"), QStringLiteral("nose_tone4"), QStringLiteral("nose: medium-dark skin tone")})},
-{QStringLiteral("nose"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F443\U0001F3FF"), QStringLiteral("nose_tone5"), QStringLiteral("nose: dark skin tone")})},
-{QStringLiteral("baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F476\U0001F3FB"), QStringLiteral("baby_tone1"), QStringLiteral("baby: light skin tone")})},
-{QStringLiteral("baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F476\U0001F3FC"), QStringLiteral("baby_tone2"), QStringLiteral("baby: medium-light skin tone")})},
-{QStringLiteral("baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F476\U0001F3FD"), QStringLiteral("baby_tone3"), QStringLiteral("baby: medium skin tone")})},
-{QStringLiteral("baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F476\U0001F3FE"), QStringLiteral("baby_tone4"), QStringLiteral("baby: medium-dark skin tone")})},
-{QStringLiteral("baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F476\U0001F3FF"), QStringLiteral("baby_tone5"), QStringLiteral("baby: dark skin tone")})},
-{QStringLiteral("child"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D2\U0001F3FB"), QStringLiteral("child_tone1"), QStringLiteral("child: light skin tone")})},
-{QStringLiteral("child"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D2\U0001F3FC"), QStringLiteral("child_tone2"), QStringLiteral("child: medium-light skin tone")})},
-{QStringLiteral("child"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D2\U0001F3FD"), QStringLiteral("child_tone3"), QStringLiteral("child: medium skin tone")})},
-{QStringLiteral("child"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D2\U0001F3FE"), QStringLiteral("child_tone4"), QStringLiteral("child: medium-dark skin tone")})},
-{QStringLiteral("child"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D2\U0001F3FF"), QStringLiteral("child_tone5"), QStringLiteral("child: dark skin tone")})},
-{QStringLiteral("boy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F466\U0001F3FB"), QStringLiteral("boy_tone1"), QStringLiteral("boy: light skin tone")})},
-{QStringLiteral("boy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F466\U0001F3FC"), QStringLiteral("boy_tone2"), QStringLiteral("boy: medium-light skin tone")})},
-{QStringLiteral("boy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F466\U0001F3FD"), QStringLiteral("boy_tone3"), QStringLiteral("boy: medium skin tone")})},
-{QStringLiteral("boy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F466\U0001F3FE"), QStringLiteral("boy_tone4"), QStringLiteral("boy: medium-dark skin tone")})},
-{QStringLiteral("boy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F466\U0001F3FF"), QStringLiteral("boy_tone5"), QStringLiteral("boy: dark skin tone")})},
-{QStringLiteral("girl"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F467\U0001F3FB"), QStringLiteral("girl_tone1"), QStringLiteral("girl: light skin tone")})},
-{QStringLiteral("girl"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F467\U0001F3FC"), QStringLiteral("girl_tone2"), QStringLiteral("girl: medium-light skin tone")})},
-{QStringLiteral("girl"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F467\U0001F3FD"), QStringLiteral("girl_tone3"), QStringLiteral("girl: medium skin tone")})},
-{QStringLiteral("girl"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F467\U0001F3FE"), QStringLiteral("girl_tone4"), QStringLiteral("girl: medium-dark skin tone")})},
-{QStringLiteral("girl"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F467\U0001F3FF"), QStringLiteral("girl_tone5"), QStringLiteral("girl: dark skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB"), QStringLiteral("adult_tone1"), QStringLiteral("person: light skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC"), QStringLiteral("adult_tone2"), QStringLiteral("person: medium-light skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD"), QStringLiteral("adult_tone3"), QStringLiteral("person: medium skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE"), QStringLiteral("adult_tone4"), QStringLiteral("person: medium-dark skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF"), QStringLiteral("adult_tone5"), QStringLiteral("person: dark skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FB"), QStringLiteral("person_with_blond_hair_tone1"), QStringLiteral("person: light skin tone, blond hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FC"), QStringLiteral("person_with_blond_hair_tone2"), QStringLiteral("person: medium-light skin tone, blond hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FD"), QStringLiteral("person_with_blond_hair_tone3"), QStringLiteral("person: medium skin tone, blond hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FE"), QStringLiteral("person_with_blond_hair_tone4"), QStringLiteral("person: medium-dark skin tone, blond hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FF"), QStringLiteral("person_with_blond_hair_tone5"), QStringLiteral("person: dark skin tone, blond hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB"), QStringLiteral("man_tone1"), QStringLiteral("man: light skin tone")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC"), QStringLiteral("man_tone2"), QStringLiteral("man: medium-light skin tone")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD"), QStringLiteral("man_tone3"), QStringLiteral("man: medium skin tone")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE"), QStringLiteral("man_tone4"), QStringLiteral("man: medium-dark skin tone")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF"), QStringLiteral("man_tone5"), QStringLiteral("man: dark skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FB"), QStringLiteral("bearded_person_tone1"), QStringLiteral("person: light skin tone, beard")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FC"), QStringLiteral("bearded_person_tone2"), QStringLiteral("person: medium-light skin tone, beard")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FD"), QStringLiteral("bearded_person_tone3"), QStringLiteral("person: medium skin tone, beard")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FE"), QStringLiteral("bearded_person_tone4"), QStringLiteral("person: medium-dark skin tone, beard")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FF"), QStringLiteral("bearded_person_tone5"), QStringLiteral("person: dark skin tone, beard")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: light skin tone, beard"), QStringLiteral("man: light skin tone, beard")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: medium-light skin tone, beard"), QStringLiteral("man: medium-light skin tone, beard")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: medium skin tone, beard"), QStringLiteral("man: medium skin tone, beard")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: medium-dark skin tone, beard"), QStringLiteral("man: medium-dark skin tone, beard")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: dark skin tone, beard"), QStringLiteral("man: dark skin tone, beard")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: light skin tone, beard"), QStringLiteral("woman: light skin tone, beard")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: medium-light skin tone, beard"), QStringLiteral("woman: medium-light skin tone, beard")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: medium skin tone, beard"), QStringLiteral("woman: medium skin tone, beard")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: medium-dark skin tone, beard"), QStringLiteral("woman: medium-dark skin tone, beard")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: dark skin tone, beard"), QStringLiteral("woman: dark skin tone, beard")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9B0"), QStringLiteral("man: light skin tone, red hair"), QStringLiteral("man: light skin tone, red hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9B0"), QStringLiteral("man: medium-light skin tone, red hair"), QStringLiteral("man: medium-light skin tone, red hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9B0"), QStringLiteral("man: medium skin tone, red hair"), QStringLiteral("man: medium skin tone, red hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9B0"), QStringLiteral("man: medium-dark skin tone, red hair"), QStringLiteral("man: medium-dark skin tone, red hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9B0"), QStringLiteral("man: dark skin tone, red hair"), QStringLiteral("man: dark skin tone, red hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9B1"), QStringLiteral("man: light skin tone, curly hair"), QStringLiteral("man: light skin tone, curly hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9B1"), QStringLiteral("man: medium-light skin tone, curly hair"), QStringLiteral("man: medium-light skin tone, curly hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9B1"), QStringLiteral("man: medium skin tone, curly hair"), QStringLiteral("man: medium skin tone, curly hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9B1"), QStringLiteral("man: medium-dark skin tone, curly hair"), QStringLiteral("man: medium-dark skin tone, curly hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9B1"), QStringLiteral("man: dark skin tone, curly hair"), QStringLiteral("man: dark skin tone, curly hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9B3"), QStringLiteral("man: light skin tone, white hair"), QStringLiteral("man: light skin tone, white hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9B3"), QStringLiteral("man: medium-light skin tone, white hair"), QStringLiteral("man: medium-light skin tone, white hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9B3"), QStringLiteral("man: medium skin tone, white hair"), QStringLiteral("man: medium skin tone, white hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9B3"), QStringLiteral("man: medium-dark skin tone, white hair"), QStringLiteral("man: medium-dark skin tone, white hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9B3"), QStringLiteral("man: dark skin tone, white hair"), QStringLiteral("man: dark skin tone, white hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9B2"), QStringLiteral("man: light skin tone, bald"), QStringLiteral("man: light skin tone, bald")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9B2"), QStringLiteral("man: medium-light skin tone, bald"), QStringLiteral("man: medium-light skin tone, bald")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9B2"), QStringLiteral("man: medium skin tone, bald"), QStringLiteral("man: medium skin tone, bald")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9B2"), QStringLiteral("man: medium-dark skin tone, bald"), QStringLiteral("man: medium-dark skin tone, bald")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9B2"), QStringLiteral("man: dark skin tone, bald"), QStringLiteral("man: dark skin tone, bald")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB"), QStringLiteral("woman_tone1"), QStringLiteral("woman: light skin tone")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC"), QStringLiteral("woman_tone2"), QStringLiteral("woman: medium-light skin tone")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD"), QStringLiteral("woman_tone3"), QStringLiteral("woman: medium skin tone")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE"), QStringLiteral("woman_tone4"), QStringLiteral("woman: medium-dark skin tone")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF"), QStringLiteral("woman_tone5"), QStringLiteral("woman: dark skin tone")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9B0"), QStringLiteral("woman: light skin tone, red hair"), QStringLiteral("woman: light skin tone, red hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9B0"), QStringLiteral("woman: medium-light skin tone, red hair"), QStringLiteral("woman: medium-light skin tone, red hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9B0"), QStringLiteral("woman: medium skin tone, red hair"), QStringLiteral("woman: medium skin tone, red hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9B0"), QStringLiteral("woman: medium-dark skin tone, red hair"), QStringLiteral("woman: medium-dark skin tone, red hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9B0"), QStringLiteral("woman: dark skin tone, red hair"), QStringLiteral("woman: dark skin tone, red hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9B0"), QStringLiteral("person: light skin tone, red hair"), QStringLiteral("person: light skin tone, red hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9B0"), QStringLiteral("person: medium-light skin tone, red hair"), QStringLiteral("person: medium-light skin tone, red hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9B0"), QStringLiteral("person: medium skin tone, red hair"), QStringLiteral("person: medium skin tone, red hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9B0"), QStringLiteral("person: medium-dark skin tone, red hair"), QStringLiteral("person: medium-dark skin tone, red hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9B0"), QStringLiteral("person: dark skin tone, red hair"), QStringLiteral("person: dark skin tone, red hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9B1"), QStringLiteral("woman: light skin tone, curly hair"), QStringLiteral("woman: light skin tone, curly hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9B1"), QStringLiteral("woman: medium-light skin tone, curly hair"), QStringLiteral("woman: medium-light skin tone, curly hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9B1"), QStringLiteral("woman: medium skin tone, curly hair"), QStringLiteral("woman: medium skin tone, curly hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9B1"), QStringLiteral("woman: medium-dark skin tone, curly hair"), QStringLiteral("woman: medium-dark skin tone, curly hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9B1"), QStringLiteral("woman: dark skin tone, curly hair"), QStringLiteral("woman: dark skin tone, curly hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9B1"), QStringLiteral("person: light skin tone, curly hair"), QStringLiteral("person: light skin tone, curly hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9B1"), QStringLiteral("person: medium-light skin tone, curly hair"), QStringLiteral("person: medium-light skin tone, curly hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9B1"), QStringLiteral("person: medium skin tone, curly hair"), QStringLiteral("person: medium skin tone, curly hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9B1"), QStringLiteral("person: medium-dark skin tone, curly hair"), QStringLiteral("person: medium-dark skin tone, curly hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9B1"), QStringLiteral("person: dark skin tone, curly hair"), QStringLiteral("person: dark skin tone, curly hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9B3"), QStringLiteral("woman: light skin tone, white hair"), QStringLiteral("woman: light skin tone, white hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9B3"), QStringLiteral("woman: medium-light skin tone, white hair"), QStringLiteral("woman: medium-light skin tone, white hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9B3"), QStringLiteral("woman: medium skin tone, white hair"), QStringLiteral("woman: medium skin tone, white hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9B3"), QStringLiteral("woman: medium-dark skin tone, white hair"), QStringLiteral("woman: medium-dark skin tone, white hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9B3"), QStringLiteral("woman: dark skin tone, white hair"), QStringLiteral("woman: dark skin tone, white hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9B3"), QStringLiteral("person: light skin tone, white hair"), QStringLiteral("person: light skin tone, white hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9B3"), QStringLiteral("person: medium-light skin tone, white hair"), QStringLiteral("person: medium-light skin tone, white hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9B3"), QStringLiteral("person: medium skin tone, white hair"), QStringLiteral("person: medium skin tone, white hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9B3"), QStringLiteral("person: medium-dark skin tone, white hair"), QStringLiteral("person: medium-dark skin tone, white hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9B3"), QStringLiteral("person: dark skin tone, white hair"), QStringLiteral("person: dark skin tone, white hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9B2"), QStringLiteral("woman: light skin tone, bald"), QStringLiteral("woman: light skin tone, bald")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9B2"), QStringLiteral("woman: medium-light skin tone, bald"), QStringLiteral("woman: medium-light skin tone, bald")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9B2"), QStringLiteral("woman: medium skin tone, bald"), QStringLiteral("woman: medium skin tone, bald")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9B2"), QStringLiteral("woman: medium-dark skin tone, bald"), QStringLiteral("woman: medium-dark skin tone, bald")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9B2"), QStringLiteral("woman: dark skin tone, bald"), QStringLiteral("woman: dark skin tone, bald")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9B2"), QStringLiteral("person: light skin tone, bald"), QStringLiteral("person: light skin tone, bald")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9B2"), QStringLiteral("person: medium-light skin tone, bald"), QStringLiteral("person: medium-light skin tone, bald")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9B2"), QStringLiteral("person: medium skin tone, bald"), QStringLiteral("person: medium skin tone, bald")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9B2"), QStringLiteral("person: medium-dark skin tone, bald"), QStringLiteral("person: medium-dark skin tone, bald")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9B2"), QStringLiteral("person: dark skin tone, bald"), QStringLiteral("person: dark skin tone, bald")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: light skin tone, blond hair"), QStringLiteral("woman: light skin tone, blond hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: medium-light skin tone, blond hair"), QStringLiteral("woman: medium-light skin tone, blond hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: medium skin tone, blond hair"), QStringLiteral("woman: medium skin tone, blond hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: medium-dark skin tone, blond hair"), QStringLiteral("woman: medium-dark skin tone, blond hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: dark skin tone, blond hair"), QStringLiteral("woman: dark skin tone, blond hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: light skin tone, blond hair"), QStringLiteral("man: light skin tone, blond hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: medium-light skin tone, blond hair"), QStringLiteral("man: medium-light skin tone, blond hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: medium skin tone, blond hair"), QStringLiteral("man: medium skin tone, blond hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: medium-dark skin tone, blond hair"), QStringLiteral("man: medium-dark skin tone, blond hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: dark skin tone, blond hair"), QStringLiteral("man: dark skin tone, blond hair")})},
-{QStringLiteral("older person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D3\U0001F3FB"), QStringLiteral("older_adult_tone1"), QStringLiteral("older person: light skin tone")})},
-{QStringLiteral("older person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D3\U0001F3FC"), QStringLiteral("older_adult_tone2"), QStringLiteral("older person: medium-light skin tone")})},
-{QStringLiteral("older person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D3\U0001F3FD"), QStringLiteral("older_adult_tone3"), QStringLiteral("older person: medium skin tone")})},
-{QStringLiteral("older person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D3\U0001F3FE"), QStringLiteral("older_adult_tone4"), QStringLiteral("older person: medium-dark skin tone")})},
-{QStringLiteral("older person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D3\U0001F3FF"), QStringLiteral("older_adult_tone5"), QStringLiteral("older person: dark skin tone")})},
-{QStringLiteral("old man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F474\U0001F3FB"), QStringLiteral("older_man_tone1"), QStringLiteral("old man: light skin tone")})},
-{QStringLiteral("old man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F474\U0001F3FC"), QStringLiteral("older_man_tone2"), QStringLiteral("old man: medium-light skin tone")})},
-{QStringLiteral("old man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F474\U0001F3FD"), QStringLiteral("older_man_tone3"), QStringLiteral("old man: medium skin tone")})},
-{QStringLiteral("old man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F474\U0001F3FE"), QStringLiteral("older_man_tone4"), QStringLiteral("old man: medium-dark skin tone")})},
-{QStringLiteral("old man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F474\U0001F3FF"), QStringLiteral("older_man_tone5"), QStringLiteral("old man: dark skin tone")})},
-{QStringLiteral("old woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F475\U0001F3FB"), QStringLiteral("older_woman_tone1"), QStringLiteral("old woman: light skin tone")})},
-{QStringLiteral("old woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F475\U0001F3FC"), QStringLiteral("older_woman_tone2"), QStringLiteral("old woman: medium-light skin tone")})},
-{QStringLiteral("old woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F475\U0001F3FD"), QStringLiteral("older_woman_tone3"), QStringLiteral("old woman: medium skin tone")})},
-{QStringLiteral("old woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F475\U0001F3FE"), QStringLiteral("older_woman_tone4"), QStringLiteral("old woman: medium-dark skin tone")})},
-{QStringLiteral("old woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F475\U0001F3FF"), QStringLiteral("older_woman_tone5"), QStringLiteral("old woman: dark skin tone")})},
-{QStringLiteral("person frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FB"), QStringLiteral("person_frowning_tone1"), QStringLiteral("person frowning: light skin tone")})},
-{QStringLiteral("person frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FC"), QStringLiteral("person_frowning_tone2"), QStringLiteral("person frowning: medium-light skin tone")})},
-{QStringLiteral("person frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FD"), QStringLiteral("person_frowning_tone3"), QStringLiteral("person frowning: medium skin tone")})},
-{QStringLiteral("person frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FE"), QStringLiteral("person_frowning_tone4"), QStringLiteral("person frowning: medium-dark skin tone")})},
-{QStringLiteral("person frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FF"), QStringLiteral("person_frowning_tone5"), QStringLiteral("person frowning: dark skin tone")})},
-{QStringLiteral("man frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man frowning: light skin tone"), QStringLiteral("man frowning: light skin tone")})},
-{QStringLiteral("man frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man frowning: medium-light skin tone"), QStringLiteral("man frowning: medium-light skin tone")})},
-{QStringLiteral("man frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man frowning: medium skin tone"), QStringLiteral("man frowning: medium skin tone")})},
-{QStringLiteral("man frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man frowning: medium-dark skin tone"), QStringLiteral("man frowning: medium-dark skin tone")})},
-{QStringLiteral("man frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man frowning: dark skin tone"), QStringLiteral("man frowning: dark skin tone")})},
-{QStringLiteral("woman frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman frowning: light skin tone"), QStringLiteral("woman frowning: light skin tone")})},
-{QStringLiteral("woman frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman frowning: medium-light skin tone"), QStringLiteral("woman frowning: medium-light skin tone")})},
-{QStringLiteral("woman frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman frowning: medium skin tone"), QStringLiteral("woman frowning: medium skin tone")})},
-{QStringLiteral("woman frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman frowning: medium-dark skin tone"), QStringLiteral("woman frowning: medium-dark skin tone")})},
-{QStringLiteral("woman frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman frowning: dark skin tone"), QStringLiteral("woman frowning: dark skin tone")})},
-{QStringLiteral("person pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FB"), QStringLiteral("person_with_pouting_face_tone1"), QStringLiteral("person pouting: light skin tone")})},
-{QStringLiteral("person pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FC"), QStringLiteral("person_with_pouting_face_tone2"), QStringLiteral("person pouting: medium-light skin tone")})},
-{QStringLiteral("person pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FD"), QStringLiteral("person_with_pouting_face_tone3"), QStringLiteral("person pouting: medium skin tone")})},
-{QStringLiteral("person pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FE"), QStringLiteral("person_with_pouting_face_tone4"), QStringLiteral("person pouting: medium-dark skin tone")})},
-{QStringLiteral("person pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FF"), QStringLiteral("person_with_pouting_face_tone5"), QStringLiteral("person pouting: dark skin tone")})},
-{QStringLiteral("man pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man pouting: light skin tone"), QStringLiteral("man pouting: light skin tone")})},
-{QStringLiteral("man pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man pouting: medium-light skin tone"), QStringLiteral("man pouting: medium-light skin tone")})},
-{QStringLiteral("man pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man pouting: medium skin tone"), QStringLiteral("man pouting: medium skin tone")})},
-{QStringLiteral("man pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man pouting: medium-dark skin tone"), QStringLiteral("man pouting: medium-dark skin tone")})},
-{QStringLiteral("man pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man pouting: dark skin tone"), QStringLiteral("man pouting: dark skin tone")})},
-{QStringLiteral("woman pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman pouting: light skin tone"), QStringLiteral("woman pouting: light skin tone")})},
-{QStringLiteral("woman pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman pouting: medium-light skin tone"), QStringLiteral("woman pouting: medium-light skin tone")})},
-{QStringLiteral("woman pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman pouting: medium skin tone"), QStringLiteral("woman pouting: medium skin tone")})},
-{QStringLiteral("woman pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman pouting: medium-dark skin tone"), QStringLiteral("woman pouting: medium-dark skin tone")})},
-{QStringLiteral("woman pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman pouting: dark skin tone"), QStringLiteral("woman pouting: dark skin tone")})},
-{QStringLiteral("person gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FB"), QStringLiteral("no_good_tone1"), QStringLiteral("person gesturing NO: light skin tone")})},
-{QStringLiteral("person gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FC"), QStringLiteral("no_good_tone2"), QStringLiteral("person gesturing NO: medium-light skin tone")})},
-{QStringLiteral("person gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FD"), QStringLiteral("no_good_tone3"), QStringLiteral("person gesturing NO: medium skin tone")})},
-{QStringLiteral("person gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FE"), QStringLiteral("no_good_tone4"), QStringLiteral("person gesturing NO: medium-dark skin tone")})},
-{QStringLiteral("person gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FF"), QStringLiteral("no_good_tone5"), QStringLiteral("person gesturing NO: dark skin tone")})},
-{QStringLiteral("man gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing NO: light skin tone"), QStringLiteral("man gesturing NO: light skin tone")})},
-{QStringLiteral("man gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing NO: medium-light skin tone"), QStringLiteral("man gesturing NO: medium-light skin tone")})},
-{QStringLiteral("man gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing NO: medium skin tone"), QStringLiteral("man gesturing NO: medium skin tone")})},
-{QStringLiteral("man gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing NO: medium-dark skin tone"), QStringLiteral("man gesturing NO: medium-dark skin tone")})},
-{QStringLiteral("man gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing NO: dark skin tone"), QStringLiteral("man gesturing NO: dark skin tone")})},
-{QStringLiteral("woman gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing NO: light skin tone"), QStringLiteral("woman gesturing NO: light skin tone")})},
-{QStringLiteral("woman gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing NO: medium-light skin tone"), QStringLiteral("woman gesturing NO: medium-light skin tone")})},
-{QStringLiteral("woman gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing NO: medium skin tone"), QStringLiteral("woman gesturing NO: medium skin tone")})},
-{QStringLiteral("woman gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing NO: medium-dark skin tone"), QStringLiteral("woman gesturing NO: medium-dark skin tone")})},
-{QStringLiteral("woman gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing NO: dark skin tone"), QStringLiteral("woman gesturing NO: dark skin tone")})},
-{QStringLiteral("person gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FB"), QStringLiteral("ok_woman_tone1"), QStringLiteral("person gesturing OK: light skin tone")})},
-{QStringLiteral("person gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FC"), QStringLiteral("ok_woman_tone2"), QStringLiteral("person gesturing OK: medium-light skin tone")})},
-{QStringLiteral("person gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FD"), QStringLiteral("ok_woman_tone3"), QStringLiteral("person gesturing OK: medium skin tone")})},
-{QStringLiteral("person gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FE"), QStringLiteral("ok_woman_tone4"), QStringLiteral("person gesturing OK: medium-dark skin tone")})},
-{QStringLiteral("person gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FF"), QStringLiteral("ok_woman_tone5"), QStringLiteral("person gesturing OK: dark skin tone")})},
-{QStringLiteral("man gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing OK: light skin tone"), QStringLiteral("man gesturing OK: light skin tone")})},
-{QStringLiteral("man gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing OK: medium-light skin tone"), QStringLiteral("man gesturing OK: medium-light skin tone")})},
-{QStringLiteral("man gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing OK: medium skin tone"), QStringLiteral("man gesturing OK: medium skin tone")})},
-{QStringLiteral("man gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing OK: medium-dark skin tone"), QStringLiteral("man gesturing OK: medium-dark skin tone")})},
-{QStringLiteral("man gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing OK: dark skin tone"), QStringLiteral("man gesturing OK: dark skin tone")})},
-{QStringLiteral("woman gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing OK: light skin tone"), QStringLiteral("woman gesturing OK: light skin tone")})},
-{QStringLiteral("woman gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing OK: medium-light skin tone"), QStringLiteral("woman gesturing OK: medium-light skin tone")})},
-{QStringLiteral("woman gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing OK: medium skin tone"), QStringLiteral("woman gesturing OK: medium skin tone")})},
-{QStringLiteral("woman gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing OK: medium-dark skin tone"), QStringLiteral("woman gesturing OK: medium-dark skin tone")})},
-{QStringLiteral("woman gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing OK: dark skin tone"), QStringLiteral("woman gesturing OK: dark skin tone")})},
-{QStringLiteral("person tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FB"), QStringLiteral("information_desk_person_tone1"), QStringLiteral("person tipping hand: light skin tone")})},
-{QStringLiteral("person tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FC"), QStringLiteral("information_desk_person_tone2"), QStringLiteral("person tipping hand: medium-light skin tone")})},
-{QStringLiteral("person tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FD"), QStringLiteral("information_desk_person_tone3"), QStringLiteral("person tipping hand: medium skin tone")})},
-{QStringLiteral("person tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FE"), QStringLiteral("information_desk_person_tone4"), QStringLiteral("person tipping hand: medium-dark skin tone")})},
-{QStringLiteral("person tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FF"), QStringLiteral("information_desk_person_tone5"), QStringLiteral("person tipping hand: dark skin tone")})},
-{QStringLiteral("man tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man tipping hand: light skin tone"), QStringLiteral("man tipping hand: light skin tone")})},
-{QStringLiteral("man tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man tipping hand: medium-light skin tone"), QStringLiteral("man tipping hand: medium-light skin tone")})},
-{QStringLiteral("man tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man tipping hand: medium skin tone"), QStringLiteral("man tipping hand: medium skin tone")})},
-{QStringLiteral("man tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man tipping hand: medium-dark skin tone"), QStringLiteral("man tipping hand: medium-dark skin tone")})},
-{QStringLiteral("man tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man tipping hand: dark skin tone"), QStringLiteral("man tipping hand: dark skin tone")})},
-{QStringLiteral("woman tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman tipping hand: light skin tone"), QStringLiteral("woman tipping hand: light skin tone")})},
-{QStringLiteral("woman tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman tipping hand: medium-light skin tone"), QStringLiteral("woman tipping hand: medium-light skin tone")})},
-{QStringLiteral("woman tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman tipping hand: medium skin tone"), QStringLiteral("woman tipping hand: medium skin tone")})},
-{QStringLiteral("woman tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman tipping hand: medium-dark skin tone"), QStringLiteral("woman tipping hand: medium-dark skin tone")})},
-{QStringLiteral("woman tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman tipping hand: dark skin tone"), QStringLiteral("woman tipping hand: dark skin tone")})},
-{QStringLiteral("person raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FB"), QStringLiteral("raising_hand_tone1"), QStringLiteral("person raising hand: light skin tone")})},
-{QStringLiteral("person raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FC"), QStringLiteral("raising_hand_tone2"), QStringLiteral("person raising hand: medium-light skin tone")})},
-{QStringLiteral("person raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FD"), QStringLiteral("raising_hand_tone3"), QStringLiteral("person raising hand: medium skin tone")})},
-{QStringLiteral("person raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FE"), QStringLiteral("raising_hand_tone4"), QStringLiteral("person raising hand: medium-dark skin tone")})},
-{QStringLiteral("person raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FF"), QStringLiteral("raising_hand_tone5"), QStringLiteral("person raising hand: dark skin tone")})},
-{QStringLiteral("man raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man raising hand: light skin tone"), QStringLiteral("man raising hand: light skin tone")})},
-{QStringLiteral("man raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man raising hand: medium-light skin tone"), QStringLiteral("man raising hand: medium-light skin tone")})},
-{QStringLiteral("man raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man raising hand: medium skin tone"), QStringLiteral("man raising hand: medium skin tone")})},
-{QStringLiteral("man raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man raising hand: medium-dark skin tone"), QStringLiteral("man raising hand: medium-dark skin tone")})},
-{QStringLiteral("man raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man raising hand: dark skin tone"), QStringLiteral("man raising hand: dark skin tone")})},
-{QStringLiteral("woman raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman raising hand: light skin tone"), QStringLiteral("woman raising hand: light skin tone")})},
-{QStringLiteral("woman raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman raising hand: medium-light skin tone"), QStringLiteral("woman raising hand: medium-light skin tone")})},
-{QStringLiteral("woman raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman raising hand: medium skin tone"), QStringLiteral("woman raising hand: medium skin tone")})},
-{QStringLiteral("woman raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman raising hand: medium-dark skin tone"), QStringLiteral("woman raising hand: medium-dark skin tone")})},
-{QStringLiteral("woman raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman raising hand: dark skin tone"), QStringLiteral("woman raising hand: dark skin tone")})},
-{QStringLiteral("deaf person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FB"), QStringLiteral("deaf person: light skin tone"), QStringLiteral("deaf person: light skin tone")})},
-{QStringLiteral("deaf person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FC"), QStringLiteral("deaf person: medium-light skin tone"), QStringLiteral("deaf person: medium-light skin tone")})},
-{QStringLiteral("deaf person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FD"), QStringLiteral("deaf person: medium skin tone"), QStringLiteral("deaf person: medium skin tone")})},
-{QStringLiteral("deaf person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FE"), QStringLiteral("deaf person: medium-dark skin tone"), QStringLiteral("deaf person: medium-dark skin tone")})},
-{QStringLiteral("deaf person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FF"), QStringLiteral("deaf person: dark skin tone"), QStringLiteral("deaf person: dark skin tone")})},
-{QStringLiteral("deaf man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("deaf man: light skin tone"), QStringLiteral("deaf man: light skin tone")})},
-{QStringLiteral("deaf man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("deaf man: medium-light skin tone"), QStringLiteral("deaf man: medium-light skin tone")})},
-{QStringLiteral("deaf man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("deaf man: medium skin tone"), QStringLiteral("deaf man: medium skin tone")})},
-{QStringLiteral("deaf man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("deaf man: medium-dark skin tone"), QStringLiteral("deaf man: medium-dark skin tone")})},
-{QStringLiteral("deaf man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("deaf man: dark skin tone"), QStringLiteral("deaf man: dark skin tone")})},
-{QStringLiteral("deaf woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("deaf woman: light skin tone"), QStringLiteral("deaf woman: light skin tone")})},
-{QStringLiteral("deaf woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("deaf woman: medium-light skin tone"), QStringLiteral("deaf woman: medium-light skin tone")})},
-{QStringLiteral("deaf woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("deaf woman: medium skin tone"), QStringLiteral("deaf woman: medium skin tone")})},
-{QStringLiteral("deaf woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("deaf woman: medium-dark skin tone"), QStringLiteral("deaf woman: medium-dark skin tone")})},
-{QStringLiteral("deaf woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("deaf woman: dark skin tone"), QStringLiteral("deaf woman: dark skin tone")})},
-{QStringLiteral("person bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FB"), QStringLiteral("bow_tone1"), QStringLiteral("person bowing: light skin tone")})},
-{QStringLiteral("person bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FC"), QStringLiteral("bow_tone2"), QStringLiteral("person bowing: medium-light skin tone")})},
-{QStringLiteral("person bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FD"), QStringLiteral("bow_tone3"), QStringLiteral("person bowing: medium skin tone")})},
-{QStringLiteral("person bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FE"), QStringLiteral("bow_tone4"), QStringLiteral("person bowing: medium-dark skin tone")})},
-{QStringLiteral("person bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FF"), QStringLiteral("bow_tone5"), QStringLiteral("person bowing: dark skin tone")})},
-{QStringLiteral("man bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bowing: light skin tone"), QStringLiteral("man bowing: light skin tone")})},
-{QStringLiteral("man bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bowing: medium-light skin tone"), QStringLiteral("man bowing: medium-light skin tone")})},
-{QStringLiteral("man bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bowing: medium skin tone"), QStringLiteral("man bowing: medium skin tone")})},
-{QStringLiteral("man bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bowing: medium-dark skin tone"), QStringLiteral("man bowing: medium-dark skin tone")})},
-{QStringLiteral("man bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bowing: dark skin tone"), QStringLiteral("man bowing: dark skin tone")})},
-{QStringLiteral("woman bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bowing: light skin tone"), QStringLiteral("woman bowing: light skin tone")})},
-{QStringLiteral("woman bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bowing: medium-light skin tone"), QStringLiteral("woman bowing: medium-light skin tone")})},
-{QStringLiteral("woman bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bowing: medium skin tone"), QStringLiteral("woman bowing: medium skin tone")})},
-{QStringLiteral("woman bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bowing: medium-dark skin tone"), QStringLiteral("woman bowing: medium-dark skin tone")})},
-{QStringLiteral("woman bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bowing: dark skin tone"), QStringLiteral("woman bowing: dark skin tone")})},
-{QStringLiteral("person facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FB"), QStringLiteral("face_palm_tone1"), QStringLiteral("person facepalming: light skin tone")})},
-{QStringLiteral("person facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FC"), QStringLiteral("face_palm_tone2"), QStringLiteral("person facepalming: medium-light skin tone")})},
-{QStringLiteral("person facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FD"), QStringLiteral("face_palm_tone3"), QStringLiteral("person facepalming: medium skin tone")})},
-{QStringLiteral("person facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FE"), QStringLiteral("face_palm_tone4"), QStringLiteral("person facepalming: medium-dark skin tone")})},
-{QStringLiteral("person facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FF"), QStringLiteral("face_palm_tone5"), QStringLiteral("person facepalming: dark skin tone")})},
-{QStringLiteral("man facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man facepalming: light skin tone"), QStringLiteral("man facepalming: light skin tone")})},
-{QStringLiteral("man facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man facepalming: medium-light skin tone"), QStringLiteral("man facepalming: medium-light skin tone")})},
-{QStringLiteral("man facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man facepalming: medium skin tone"), QStringLiteral("man facepalming: medium skin tone")})},
-{QStringLiteral("man facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man facepalming: medium-dark skin tone"), QStringLiteral("man facepalming: medium-dark skin tone")})},
-{QStringLiteral("man facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man facepalming: dark skin tone"), QStringLiteral("man facepalming: dark skin tone")})},
-{QStringLiteral("woman facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman facepalming: light skin tone"), QStringLiteral("woman facepalming: light skin tone")})},
-{QStringLiteral("woman facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman facepalming: medium-light skin tone"), QStringLiteral("woman facepalming: medium-light skin tone")})},
-{QStringLiteral("woman facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman facepalming: medium skin tone"), QStringLiteral("woman facepalming: medium skin tone")})},
-{QStringLiteral("woman facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman facepalming: medium-dark skin tone"), QStringLiteral("woman facepalming: medium-dark skin tone")})},
-{QStringLiteral("woman facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman facepalming: dark skin tone"), QStringLiteral("woman facepalming: dark skin tone")})},
-{QStringLiteral("person shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FB"), QStringLiteral("shrug_tone1"), QStringLiteral("person shrugging: light skin tone")})},
-{QStringLiteral("person shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FC"), QStringLiteral("shrug_tone2"), QStringLiteral("person shrugging: medium-light skin tone")})},
-{QStringLiteral("person shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FD"), QStringLiteral("shrug_tone3"), QStringLiteral("person shrugging: medium skin tone")})},
-{QStringLiteral("person shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FE"), QStringLiteral("shrug_tone4"), QStringLiteral("person shrugging: medium-dark skin tone")})},
-{QStringLiteral("person shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FF"), QStringLiteral("shrug_tone5"), QStringLiteral("person shrugging: dark skin tone")})},
-{QStringLiteral("man shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man shrugging: light skin tone"), QStringLiteral("man shrugging: light skin tone")})},
-{QStringLiteral("man shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man shrugging: medium-light skin tone"), QStringLiteral("man shrugging: medium-light skin tone")})},
-{QStringLiteral("man shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man shrugging: medium skin tone"), QStringLiteral("man shrugging: medium skin tone")})},
-{QStringLiteral("man shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man shrugging: medium-dark skin tone"), QStringLiteral("man shrugging: medium-dark skin tone")})},
-{QStringLiteral("man shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man shrugging: dark skin tone"), QStringLiteral("man shrugging: dark skin tone")})},
-{QStringLiteral("woman shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman shrugging: light skin tone"), QStringLiteral("woman shrugging: light skin tone")})},
-{QStringLiteral("woman shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman shrugging: medium-light skin tone"), QStringLiteral("woman shrugging: medium-light skin tone")})},
-{QStringLiteral("woman shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman shrugging: medium skin tone"), QStringLiteral("woman shrugging: medium skin tone")})},
-{QStringLiteral("woman shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman shrugging: medium-dark skin tone"), QStringLiteral("woman shrugging: medium-dark skin tone")})},
-{QStringLiteral("woman shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman shrugging: dark skin tone"), QStringLiteral("woman shrugging: dark skin tone")})},
-{QStringLiteral("health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002695\U0000FE0F"), QStringLiteral("health worker: light skin tone"), QStringLiteral("health worker: light skin tone")})},
-{QStringLiteral("health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002695\U0000FE0F"), QStringLiteral("health worker: medium-light skin tone"), QStringLiteral("health worker: medium-light skin tone")})},
-{QStringLiteral("health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002695\U0000FE0F"), QStringLiteral("health worker: medium skin tone"), QStringLiteral("health worker: medium skin tone")})},
-{QStringLiteral("health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002695\U0000FE0F"), QStringLiteral("health worker: medium-dark skin tone"), QStringLiteral("health worker: medium-dark skin tone")})},
-{QStringLiteral("health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002695\U0000FE0F"), QStringLiteral("health worker: dark skin tone"), QStringLiteral("health worker: dark skin tone")})},
-{QStringLiteral("man health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002695\U0000FE0F"), QStringLiteral("man health worker: light skin tone"), QStringLiteral("man health worker: light skin tone")})},
-{QStringLiteral("man health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002695\U0000FE0F"), QStringLiteral("man health worker: medium-light skin tone"), QStringLiteral("man health worker: medium-light skin tone")})},
-{QStringLiteral("man health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002695\U0000FE0F"), QStringLiteral("man health worker: medium skin tone"), QStringLiteral("man health worker: medium skin tone")})},
-{QStringLiteral("man health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002695\U0000FE0F"), QStringLiteral("man health worker: medium-dark skin tone"), QStringLiteral("man health worker: medium-dark skin tone")})},
-{QStringLiteral("man health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002695\U0000FE0F"), QStringLiteral("man health worker: dark skin tone"), QStringLiteral("man health worker: dark skin tone")})},
-{QStringLiteral("woman health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002695\U0000FE0F"), QStringLiteral("woman health worker: light skin tone"), QStringLiteral("woman health worker: light skin tone")})},
-{QStringLiteral("woman health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002695\U0000FE0F"), QStringLiteral("woman health worker: medium-light skin tone"), QStringLiteral("woman health worker: medium-light skin tone")})},
-{QStringLiteral("woman health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002695\U0000FE0F"), QStringLiteral("woman health worker: medium skin tone"), QStringLiteral("woman health worker: medium skin tone")})},
-{QStringLiteral("woman health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002695\U0000FE0F"), QStringLiteral("woman health worker: medium-dark skin tone"), QStringLiteral("woman health worker: medium-dark skin tone")})},
-{QStringLiteral("woman health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002695\U0000FE0F"), QStringLiteral("woman health worker: dark skin tone"), QStringLiteral("woman health worker: dark skin tone")})},
-{QStringLiteral("student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F393"), QStringLiteral("student: light skin tone"), QStringLiteral("student: light skin tone")})},
-{QStringLiteral("student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F393"), QStringLiteral("student: medium-light skin tone"), QStringLiteral("student: medium-light skin tone")})},
-{QStringLiteral("student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F393"), QStringLiteral("student: medium skin tone"), QStringLiteral("student: medium skin tone")})},
-{QStringLiteral("student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F393"), QStringLiteral("student: medium-dark skin tone"), QStringLiteral("student: medium-dark skin tone")})},
-{QStringLiteral("student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F393"), QStringLiteral("student: dark skin tone"), QStringLiteral("student: dark skin tone")})},
-{QStringLiteral("man student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F393"), QStringLiteral("man student: light skin tone"), QStringLiteral("man student: light skin tone")})},
-{QStringLiteral("man student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F393"), QStringLiteral("man student: medium-light skin tone"), QStringLiteral("man student: medium-light skin tone")})},
-{QStringLiteral("man student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F393"), QStringLiteral("man student: medium skin tone"), QStringLiteral("man student: medium skin tone")})},
-{QStringLiteral("man student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F393"), QStringLiteral("man student: medium-dark skin tone"), QStringLiteral("man student: medium-dark skin tone")})},
-{QStringLiteral("man student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F393"), QStringLiteral("man student: dark skin tone"), QStringLiteral("man student: dark skin tone")})},
-{QStringLiteral("woman student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F393"), QStringLiteral("woman student: light skin tone"), QStringLiteral("woman student: light skin tone")})},
-{QStringLiteral("woman student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F393"), QStringLiteral("woman student: medium-light skin tone"), QStringLiteral("woman student: medium-light skin tone")})},
-{QStringLiteral("woman student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F393"), QStringLiteral("woman student: medium skin tone"), QStringLiteral("woman student: medium skin tone")})},
-{QStringLiteral("woman student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F393"), QStringLiteral("woman student: medium-dark skin tone"), QStringLiteral("woman student: medium-dark skin tone")})},
-{QStringLiteral("woman student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F393"), QStringLiteral("woman student: dark skin tone"), QStringLiteral("woman student: dark skin tone")})},
-{QStringLiteral("teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F3EB"), QStringLiteral("teacher: light skin tone"), QStringLiteral("teacher: light skin tone")})},
-{QStringLiteral("teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F3EB"), QStringLiteral("teacher: medium-light skin tone"), QStringLiteral("teacher: medium-light skin tone")})},
-{QStringLiteral("teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F3EB"), QStringLiteral("teacher: medium skin tone"), QStringLiteral("teacher: medium skin tone")})},
-{QStringLiteral("teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F3EB"), QStringLiteral("teacher: medium-dark skin tone"), QStringLiteral("teacher: medium-dark skin tone")})},
-{QStringLiteral("teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F3EB"), QStringLiteral("teacher: dark skin tone"), QStringLiteral("teacher: dark skin tone")})},
-{QStringLiteral("man teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F3EB"), QStringLiteral("man teacher: light skin tone"), QStringLiteral("man teacher: light skin tone")})},
-{QStringLiteral("man teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F3EB"), QStringLiteral("man teacher: medium-light skin tone"), QStringLiteral("man teacher: medium-light skin tone")})},
-{QStringLiteral("man teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F3EB"), QStringLiteral("man teacher: medium skin tone"), QStringLiteral("man teacher: medium skin tone")})},
-{QStringLiteral("man teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F3EB"), QStringLiteral("man teacher: medium-dark skin tone"), QStringLiteral("man teacher: medium-dark skin tone")})},
-{QStringLiteral("man teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F3EB"), QStringLiteral("man teacher: dark skin tone"), QStringLiteral("man teacher: dark skin tone")})},
-{QStringLiteral("woman teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F3EB"), QStringLiteral("woman teacher: light skin tone"), QStringLiteral("woman teacher: light skin tone")})},
-{QStringLiteral("woman teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F3EB"), QStringLiteral("woman teacher: medium-light skin tone"), QStringLiteral("woman teacher: medium-light skin tone")})},
-{QStringLiteral("woman teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F3EB"), QStringLiteral("woman teacher: medium skin tone"), QStringLiteral("woman teacher: medium skin tone")})},
-{QStringLiteral("woman teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F3EB"), QStringLiteral("woman teacher: medium-dark skin tone"), QStringLiteral("woman teacher: medium-dark skin tone")})},
-{QStringLiteral("woman teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F3EB"), QStringLiteral("woman teacher: dark skin tone"), QStringLiteral("woman teacher: dark skin tone")})},
-{QStringLiteral("judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002696\U0000FE0F"), QStringLiteral("judge: light skin tone"), QStringLiteral("judge: light skin tone")})},
-{QStringLiteral("judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002696\U0000FE0F"), QStringLiteral("judge: medium-light skin tone"), QStringLiteral("judge: medium-light skin tone")})},
-{QStringLiteral("judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002696\U0000FE0F"), QStringLiteral("judge: medium skin tone"), QStringLiteral("judge: medium skin tone")})},
-{QStringLiteral("judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002696\U0000FE0F"), QStringLiteral("judge: medium-dark skin tone"), QStringLiteral("judge: medium-dark skin tone")})},
-{QStringLiteral("judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002696\U0000FE0F"), QStringLiteral("judge: dark skin tone"), QStringLiteral("judge: dark skin tone")})},
-{QStringLiteral("man judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002696\U0000FE0F"), QStringLiteral("man judge: light skin tone"), QStringLiteral("man judge: light skin tone")})},
-{QStringLiteral("man judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002696\U0000FE0F"), QStringLiteral("man judge: medium-light skin tone"), QStringLiteral("man judge: medium-light skin tone")})},
-{QStringLiteral("man judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002696\U0000FE0F"), QStringLiteral("man judge: medium skin tone"), QStringLiteral("man judge: medium skin tone")})},
-{QStringLiteral("man judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002696\U0000FE0F"), QStringLiteral("man judge: medium-dark skin tone"), QStringLiteral("man judge: medium-dark skin tone")})},
-{QStringLiteral("man judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002696\U0000FE0F"), QStringLiteral("man judge: dark skin tone"), QStringLiteral("man judge: dark skin tone")})},
-{QStringLiteral("woman judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002696\U0000FE0F"), QStringLiteral("woman judge: light skin tone"), QStringLiteral("woman judge: light skin tone")})},
-{QStringLiteral("woman judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002696\U0000FE0F"), QStringLiteral("woman judge: medium-light skin tone"), QStringLiteral("woman judge: medium-light skin tone")})},
-{QStringLiteral("woman judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002696\U0000FE0F"), QStringLiteral("woman judge: medium skin tone"), QStringLiteral("woman judge: medium skin tone")})},
-{QStringLiteral("woman judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002696\U0000FE0F"), QStringLiteral("woman judge: medium-dark skin tone"), QStringLiteral("woman judge: medium-dark skin tone")})},
-{QStringLiteral("woman judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002696\U0000FE0F"), QStringLiteral("woman judge: dark skin tone"), QStringLiteral("woman judge: dark skin tone")})},
-{QStringLiteral("farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F33E"), QStringLiteral("farmer: light skin tone"), QStringLiteral("farmer: light skin tone")})},
-{QStringLiteral("farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F33E"), QStringLiteral("farmer: medium-light skin tone"), QStringLiteral("farmer: medium-light skin tone")})},
-{QStringLiteral("farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F33E"), QStringLiteral("farmer: medium skin tone"), QStringLiteral("farmer: medium skin tone")})},
-{QStringLiteral("farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F33E"), QStringLiteral("farmer: medium-dark skin tone"), QStringLiteral("farmer: medium-dark skin tone")})},
-{QStringLiteral("farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F33E"), QStringLiteral("farmer: dark skin tone"), QStringLiteral("farmer: dark skin tone")})},
-{QStringLiteral("man farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F33E"), QStringLiteral("man farmer: light skin tone"), QStringLiteral("man farmer: light skin tone")})},
-{QStringLiteral("man farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F33E"), QStringLiteral("man farmer: medium-light skin tone"), QStringLiteral("man farmer: medium-light skin tone")})},
-{QStringLiteral("man farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F33E"), QStringLiteral("man farmer: medium skin tone"), QStringLiteral("man farmer: medium skin tone")})},
-{QStringLiteral("man farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F33E"), QStringLiteral("man farmer: medium-dark skin tone"), QStringLiteral("man farmer: medium-dark skin tone")})},
-{QStringLiteral("man farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F33E"), QStringLiteral("man farmer: dark skin tone"), QStringLiteral("man farmer: dark skin tone")})},
-{QStringLiteral("woman farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F33E"), QStringLiteral("woman farmer: light skin tone"), QStringLiteral("woman farmer: light skin tone")})},
-{QStringLiteral("woman farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F33E"), QStringLiteral("woman farmer: medium-light skin tone"), QStringLiteral("woman farmer: medium-light skin tone")})},
-{QStringLiteral("woman farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F33E"), QStringLiteral("woman farmer: medium skin tone"), QStringLiteral("woman farmer: medium skin tone")})},
-{QStringLiteral("woman farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F33E"), QStringLiteral("woman farmer: medium-dark skin tone"), QStringLiteral("woman farmer: medium-dark skin tone")})},
-{QStringLiteral("woman farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F33E"), QStringLiteral("woman farmer: dark skin tone"), QStringLiteral("woman farmer: dark skin tone")})},
-{QStringLiteral("cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F373"), QStringLiteral("cook: light skin tone"), QStringLiteral("cook: light skin tone")})},
-{QStringLiteral("cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F373"), QStringLiteral("cook: medium-light skin tone"), QStringLiteral("cook: medium-light skin tone")})},
-{QStringLiteral("cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F373"), QStringLiteral("cook: medium skin tone"), QStringLiteral("cook: medium skin tone")})},
-{QStringLiteral("cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F373"), QStringLiteral("cook: medium-dark skin tone"), QStringLiteral("cook: medium-dark skin tone")})},
-{QStringLiteral("cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F373"), QStringLiteral("cook: dark skin tone"), QStringLiteral("cook: dark skin tone")})},
-{QStringLiteral("man cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F373"), QStringLiteral("man cook: light skin tone"), QStringLiteral("man cook: light skin tone")})},
-{QStringLiteral("man cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F373"), QStringLiteral("man cook: medium-light skin tone"), QStringLiteral("man cook: medium-light skin tone")})},
-{QStringLiteral("man cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F373"), QStringLiteral("man cook: medium skin tone"), QStringLiteral("man cook: medium skin tone")})},
-{QStringLiteral("man cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F373"), QStringLiteral("man cook: medium-dark skin tone"), QStringLiteral("man cook: medium-dark skin tone")})},
-{QStringLiteral("man cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F373"), QStringLiteral("man cook: dark skin tone"), QStringLiteral("man cook: dark skin tone")})},
-{QStringLiteral("woman cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F373"), QStringLiteral("woman cook: light skin tone"), QStringLiteral("woman cook: light skin tone")})},
-{QStringLiteral("woman cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F373"), QStringLiteral("woman cook: medium-light skin tone"), QStringLiteral("woman cook: medium-light skin tone")})},
-{QStringLiteral("woman cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F373"), QStringLiteral("woman cook: medium skin tone"), QStringLiteral("woman cook: medium skin tone")})},
-{QStringLiteral("woman cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F373"), QStringLiteral("woman cook: medium-dark skin tone"), QStringLiteral("woman cook: medium-dark skin tone")})},
-{QStringLiteral("woman cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F373"), QStringLiteral("woman cook: dark skin tone"), QStringLiteral("woman cook: dark skin tone")})},
-{QStringLiteral("mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F527"), QStringLiteral("mechanic: light skin tone"), QStringLiteral("mechanic: light skin tone")})},
-{QStringLiteral("mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F527"), QStringLiteral("mechanic: medium-light skin tone"), QStringLiteral("mechanic: medium-light skin tone")})},
-{QStringLiteral("mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F527"), QStringLiteral("mechanic: medium skin tone"), QStringLiteral("mechanic: medium skin tone")})},
-{QStringLiteral("mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F527"), QStringLiteral("mechanic: medium-dark skin tone"), QStringLiteral("mechanic: medium-dark skin tone")})},
-{QStringLiteral("mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F527"), QStringLiteral("mechanic: dark skin tone"), QStringLiteral("mechanic: dark skin tone")})},
-{QStringLiteral("man mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F527"), QStringLiteral("man mechanic: light skin tone"), QStringLiteral("man mechanic: light skin tone")})},
-{QStringLiteral("man mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F527"), QStringLiteral("man mechanic: medium-light skin tone"), QStringLiteral("man mechanic: medium-light skin tone")})},
-{QStringLiteral("man mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F527"), QStringLiteral("man mechanic: medium skin tone"), QStringLiteral("man mechanic: medium skin tone")})},
-{QStringLiteral("man mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F527"), QStringLiteral("man mechanic: medium-dark skin tone"), QStringLiteral("man mechanic: medium-dark skin tone")})},
-{QStringLiteral("man mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F527"), QStringLiteral("man mechanic: dark skin tone"), QStringLiteral("man mechanic: dark skin tone")})},
-{QStringLiteral("woman mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F527"), QStringLiteral("woman mechanic: light skin tone"), QStringLiteral("woman mechanic: light skin tone")})},
-{QStringLiteral("woman mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F527"), QStringLiteral("woman mechanic: medium-light skin tone"), QStringLiteral("woman mechanic: medium-light skin tone")})},
-{QStringLiteral("woman mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F527"), QStringLiteral("woman mechanic: medium skin tone"), QStringLiteral("woman mechanic: medium skin tone")})},
-{QStringLiteral("woman mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F527"), QStringLiteral("woman mechanic: medium-dark skin tone"), QStringLiteral("woman mechanic: medium-dark skin tone")})},
-{QStringLiteral("woman mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F527"), QStringLiteral("woman mechanic: dark skin tone"), QStringLiteral("woman mechanic: dark skin tone")})},
-{QStringLiteral("factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F3ED"), QStringLiteral("factory worker: light skin tone"), QStringLiteral("factory worker: light skin tone")})},
-{QStringLiteral("factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F3ED"), QStringLiteral("factory worker: medium-light skin tone"), QStringLiteral("factory worker: medium-light skin tone")})},
-{QStringLiteral("factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F3ED"), QStringLiteral("factory worker: medium skin tone"), QStringLiteral("factory worker: medium skin tone")})},
-{QStringLiteral("factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F3ED"), QStringLiteral("factory worker: medium-dark skin tone"), QStringLiteral("factory worker: medium-dark skin tone")})},
-{QStringLiteral("factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F3ED"), QStringLiteral("factory worker: dark skin tone"), QStringLiteral("factory worker: dark skin tone")})},
-{QStringLiteral("man factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F3ED"), QStringLiteral("man factory worker: light skin tone"), QStringLiteral("man factory worker: light skin tone")})},
-{QStringLiteral("man factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F3ED"), QStringLiteral("man factory worker: medium-light skin tone"), QStringLiteral("man factory worker: medium-light skin tone")})},
-{QStringLiteral("man factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F3ED"), QStringLiteral("man factory worker: medium skin tone"), QStringLiteral("man factory worker: medium skin tone")})},
-{QStringLiteral("man factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F3ED"), QStringLiteral("man factory worker: medium-dark skin tone"), QStringLiteral("man factory worker: medium-dark skin tone")})},
-{QStringLiteral("man factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F3ED"), QStringLiteral("man factory worker: dark skin tone"), QStringLiteral("man factory worker: dark skin tone")})},
-{QStringLiteral("woman factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F3ED"), QStringLiteral("woman factory worker: light skin tone"), QStringLiteral("woman factory worker: light skin tone")})},
-{QStringLiteral("woman factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F3ED"), QStringLiteral("woman factory worker: medium-light skin tone"), QStringLiteral("woman factory worker: medium-light skin tone")})},
-{QStringLiteral("woman factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F3ED"), QStringLiteral("woman factory worker: medium skin tone"), QStringLiteral("woman factory worker: medium skin tone")})},
-{QStringLiteral("woman factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F3ED"), QStringLiteral("woman factory worker: medium-dark skin tone"), QStringLiteral("woman factory worker: medium-dark skin tone")})},
-{QStringLiteral("woman factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F3ED"), QStringLiteral("woman factory worker: dark skin tone"), QStringLiteral("woman factory worker: dark skin tone")})},
-{QStringLiteral("office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F4BC"), QStringLiteral("office worker: light skin tone"), QStringLiteral("office worker: light skin tone")})},
-{QStringLiteral("office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F4BC"), QStringLiteral("office worker: medium-light skin tone"), QStringLiteral("office worker: medium-light skin tone")})},
-{QStringLiteral("office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F4BC"), QStringLiteral("office worker: medium skin tone"), QStringLiteral("office worker: medium skin tone")})},
-{QStringLiteral("office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F4BC"), QStringLiteral("office worker: medium-dark skin tone"), QStringLiteral("office worker: medium-dark skin tone")})},
-{QStringLiteral("office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F4BC"), QStringLiteral("office worker: dark skin tone"), QStringLiteral("office worker: dark skin tone")})},
-{QStringLiteral("man office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F4BC"), QStringLiteral("man office worker: light skin tone"), QStringLiteral("man office worker: light skin tone")})},
-{QStringLiteral("man office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F4BC"), QStringLiteral("man office worker: medium-light skin tone"), QStringLiteral("man office worker: medium-light skin tone")})},
-{QStringLiteral("man office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F4BC"), QStringLiteral("man office worker: medium skin tone"), QStringLiteral("man office worker: medium skin tone")})},
-{QStringLiteral("man office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F4BC"), QStringLiteral("man office worker: medium-dark skin tone"), QStringLiteral("man office worker: medium-dark skin tone")})},
-{QStringLiteral("man office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F4BC"), QStringLiteral("man office worker: dark skin tone"), QStringLiteral("man office worker: dark skin tone")})},
-{QStringLiteral("woman office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F4BC"), QStringLiteral("woman office worker: light skin tone"), QStringLiteral("woman office worker: light skin tone")})},
-{QStringLiteral("woman office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F4BC"), QStringLiteral("woman office worker: medium-light skin tone"), QStringLiteral("woman office worker: medium-light skin tone")})},
-{QStringLiteral("woman office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F4BC"), QStringLiteral("woman office worker: medium skin tone"), QStringLiteral("woman office worker: medium skin tone")})},
-{QStringLiteral("woman office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F4BC"), QStringLiteral("woman office worker: medium-dark skin tone"), QStringLiteral("woman office worker: medium-dark skin tone")})},
-{QStringLiteral("woman office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F4BC"), QStringLiteral("woman office worker: dark skin tone"), QStringLiteral("woman office worker: dark skin tone")})},
-{QStringLiteral("scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F52C"), QStringLiteral("scientist: light skin tone"), QStringLiteral("scientist: light skin tone")})},
-{QStringLiteral("scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F52C"), QStringLiteral("scientist: medium-light skin tone"), QStringLiteral("scientist: medium-light skin tone")})},
-{QStringLiteral("scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F52C"), QStringLiteral("scientist: medium skin tone"), QStringLiteral("scientist: medium skin tone")})},
-{QStringLiteral("scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F52C"), QStringLiteral("scientist: medium-dark skin tone"), QStringLiteral("scientist: medium-dark skin tone")})},
-{QStringLiteral("scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F52C"), QStringLiteral("scientist: dark skin tone"), QStringLiteral("scientist: dark skin tone")})},
-{QStringLiteral("man scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F52C"), QStringLiteral("man scientist: light skin tone"), QStringLiteral("man scientist: light skin tone")})},
-{QStringLiteral("man scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F52C"), QStringLiteral("man scientist: medium-light skin tone"), QStringLiteral("man scientist: medium-light skin tone")})},
-{QStringLiteral("man scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F52C"), QStringLiteral("man scientist: medium skin tone"), QStringLiteral("man scientist: medium skin tone")})},
-{QStringLiteral("man scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F52C"), QStringLiteral("man scientist: medium-dark skin tone"), QStringLiteral("man scientist: medium-dark skin tone")})},
-{QStringLiteral("man scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F52C"), QStringLiteral("man scientist: dark skin tone"), QStringLiteral("man scientist: dark skin tone")})},
-{QStringLiteral("woman scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F52C"), QStringLiteral("woman scientist: light skin tone"), QStringLiteral("woman scientist: light skin tone")})},
-{QStringLiteral("woman scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F52C"), QStringLiteral("woman scientist: medium-light skin tone"), QStringLiteral("woman scientist: medium-light skin tone")})},
-{QStringLiteral("woman scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F52C"), QStringLiteral("woman scientist: medium skin tone"), QStringLiteral("woman scientist: medium skin tone")})},
-{QStringLiteral("woman scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F52C"), QStringLiteral("woman scientist: medium-dark skin tone"), QStringLiteral("woman scientist: medium-dark skin tone")})},
-{QStringLiteral("woman scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F52C"), QStringLiteral("woman scientist: dark skin tone"), QStringLiteral("woman scientist: dark skin tone")})},
-{QStringLiteral("technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F4BB"), QStringLiteral("technologist: light skin tone"), QStringLiteral("technologist: light skin tone")})},
-{QStringLiteral("technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F4BB"), QStringLiteral("technologist: medium-light skin tone"), QStringLiteral("technologist: medium-light skin tone")})},
-{QStringLiteral("technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F4BB"), QStringLiteral("technologist: medium skin tone"), QStringLiteral("technologist: medium skin tone")})},
-{QStringLiteral("technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F4BB"), QStringLiteral("technologist: medium-dark skin tone"), QStringLiteral("technologist: medium-dark skin tone")})},
-{QStringLiteral("technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F4BB"), QStringLiteral("technologist: dark skin tone"), QStringLiteral("technologist: dark skin tone")})},
-{QStringLiteral("man technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F4BB"), QStringLiteral("man technologist: light skin tone"), QStringLiteral("man technologist: light skin tone")})},
-{QStringLiteral("man technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F4BB"), QStringLiteral("man technologist: medium-light skin tone"), QStringLiteral("man technologist: medium-light skin tone")})},
-{QStringLiteral("man technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F4BB"), QStringLiteral("man technologist: medium skin tone"), QStringLiteral("man technologist: medium skin tone")})},
-{QStringLiteral("man technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F4BB"), QStringLiteral("man technologist: medium-dark skin tone"), QStringLiteral("man technologist: medium-dark skin tone")})},
-{QStringLiteral("man technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F4BB"), QStringLiteral("man technologist: dark skin tone"), QStringLiteral("man technologist: dark skin tone")})},
-{QStringLiteral("woman technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F4BB"), QStringLiteral("woman technologist: light skin tone"), QStringLiteral("woman technologist: light skin tone")})},
-{QStringLiteral("woman technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F4BB"), QStringLiteral("woman technologist: medium-light skin tone"), QStringLiteral("woman technologist: medium-light skin tone")})},
-{QStringLiteral("woman technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F4BB"), QStringLiteral("woman technologist: medium skin tone"), QStringLiteral("woman technologist: medium skin tone")})},
-{QStringLiteral("woman technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F4BB"), QStringLiteral("woman technologist: medium-dark skin tone"), QStringLiteral("woman technologist: medium-dark skin tone")})},
-{QStringLiteral("woman technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F4BB"), QStringLiteral("woman technologist: dark skin tone"), QStringLiteral("woman technologist: dark skin tone")})},
-{QStringLiteral("singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F3A4"), QStringLiteral("singer: light skin tone"), QStringLiteral("singer: light skin tone")})},
-{QStringLiteral("singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F3A4"), QStringLiteral("singer: medium-light skin tone"), QStringLiteral("singer: medium-light skin tone")})},
-{QStringLiteral("singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F3A4"), QStringLiteral("singer: medium skin tone"), QStringLiteral("singer: medium skin tone")})},
-{QStringLiteral("singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F3A4"), QStringLiteral("singer: medium-dark skin tone"), QStringLiteral("singer: medium-dark skin tone")})},
-{QStringLiteral("singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F3A4"), QStringLiteral("singer: dark skin tone"), QStringLiteral("singer: dark skin tone")})},
-{QStringLiteral("man singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F3A4"), QStringLiteral("man singer: light skin tone"), QStringLiteral("man singer: light skin tone")})},
-{QStringLiteral("man singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F3A4"), QStringLiteral("man singer: medium-light skin tone"), QStringLiteral("man singer: medium-light skin tone")})},
-{QStringLiteral("man singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F3A4"), QStringLiteral("man singer: medium skin tone"), QStringLiteral("man singer: medium skin tone")})},
-{QStringLiteral("man singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F3A4"), QStringLiteral("man singer: medium-dark skin tone"), QStringLiteral("man singer: medium-dark skin tone")})},
-{QStringLiteral("man singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F3A4"), QStringLiteral("man singer: dark skin tone"), QStringLiteral("man singer: dark skin tone")})},
-{QStringLiteral("woman singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F3A4"), QStringLiteral("woman singer: light skin tone"), QStringLiteral("woman singer: light skin tone")})},
-{QStringLiteral("woman singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F3A4"), QStringLiteral("woman singer: medium-light skin tone"), QStringLiteral("woman singer: medium-light skin tone")})},
-{QStringLiteral("woman singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F3A4"), QStringLiteral("woman singer: medium skin tone"), QStringLiteral("woman singer: medium skin tone")})},
-{QStringLiteral("woman singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F3A4"), QStringLiteral("woman singer: medium-dark skin tone"), QStringLiteral("woman singer: medium-dark skin tone")})},
-{QStringLiteral("woman singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F3A4"), QStringLiteral("woman singer: dark skin tone"), QStringLiteral("woman singer: dark skin tone")})},
-{QStringLiteral("artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F3A8"), QStringLiteral("artist: light skin tone"), QStringLiteral("artist: light skin tone")})},
-{QStringLiteral("artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F3A8"), QStringLiteral("artist: medium-light skin tone"), QStringLiteral("artist: medium-light skin tone")})},
-{QStringLiteral("artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F3A8"), QStringLiteral("artist: medium skin tone"), QStringLiteral("artist: medium skin tone")})},
-{QStringLiteral("artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F3A8"), QStringLiteral("artist: medium-dark skin tone"), QStringLiteral("artist: medium-dark skin tone")})},
-{QStringLiteral("artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F3A8"), QStringLiteral("artist: dark skin tone"), QStringLiteral("artist: dark skin tone")})},
-{QStringLiteral("man artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F3A8"), QStringLiteral("man artist: light skin tone"), QStringLiteral("man artist: light skin tone")})},
-{QStringLiteral("man artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F3A8"), QStringLiteral("man artist: medium-light skin tone"), QStringLiteral("man artist: medium-light skin tone")})},
-{QStringLiteral("man artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F3A8"), QStringLiteral("man artist: medium skin tone"), QStringLiteral("man artist: medium skin tone")})},
-{QStringLiteral("man artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F3A8"), QStringLiteral("man artist: medium-dark skin tone"), QStringLiteral("man artist: medium-dark skin tone")})},
-{QStringLiteral("man artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F3A8"), QStringLiteral("man artist: dark skin tone"), QStringLiteral("man artist: dark skin tone")})},
-{QStringLiteral("woman artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F3A8"), QStringLiteral("woman artist: light skin tone"), QStringLiteral("woman artist: light skin tone")})},
-{QStringLiteral("woman artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F3A8"), QStringLiteral("woman artist: medium-light skin tone"), QStringLiteral("woman artist: medium-light skin tone")})},
-{QStringLiteral("woman artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F3A8"), QStringLiteral("woman artist: medium skin tone"), QStringLiteral("woman artist: medium skin tone")})},
-{QStringLiteral("woman artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F3A8"), QStringLiteral("woman artist: medium-dark skin tone"), QStringLiteral("woman artist: medium-dark skin tone")})},
-{QStringLiteral("woman artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F3A8"), QStringLiteral("woman artist: dark skin tone"), QStringLiteral("woman artist: dark skin tone")})},
-{QStringLiteral("pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002708\U0000FE0F"), QStringLiteral("pilot: light skin tone"), QStringLiteral("pilot: light skin tone")})},
-{QStringLiteral("pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002708\U0000FE0F"), QStringLiteral("pilot: medium-light skin tone"), QStringLiteral("pilot: medium-light skin tone")})},
-{QStringLiteral("pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002708\U0000FE0F"), QStringLiteral("pilot: medium skin tone"), QStringLiteral("pilot: medium skin tone")})},
-{QStringLiteral("pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002708\U0000FE0F"), QStringLiteral("pilot: medium-dark skin tone"), QStringLiteral("pilot: medium-dark skin tone")})},
-{QStringLiteral("pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002708\U0000FE0F"), QStringLiteral("pilot: dark skin tone"), QStringLiteral("pilot: dark skin tone")})},
-{QStringLiteral("man pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002708\U0000FE0F"), QStringLiteral("man pilot: light skin tone"), QStringLiteral("man pilot: light skin tone")})},
-{QStringLiteral("man pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002708\U0000FE0F"), QStringLiteral("man pilot: medium-light skin tone"), QStringLiteral("man pilot: medium-light skin tone")})},
-{QStringLiteral("man pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002708\U0000FE0F"), QStringLiteral("man pilot: medium skin tone"), QStringLiteral("man pilot: medium skin tone")})},
-{QStringLiteral("man pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002708\U0000FE0F"), QStringLiteral("man pilot: medium-dark skin tone"), QStringLiteral("man pilot: medium-dark skin tone")})},
-{QStringLiteral("man pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002708\U0000FE0F"), QStringLiteral("man pilot: dark skin tone"), QStringLiteral("man pilot: dark skin tone")})},
-{QStringLiteral("woman pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002708\U0000FE0F"), QStringLiteral("woman pilot: light skin tone"), QStringLiteral("woman pilot: light skin tone")})},
-{QStringLiteral("woman pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002708\U0000FE0F"), QStringLiteral("woman pilot: medium-light skin tone"), QStringLiteral("woman pilot: medium-light skin tone")})},
-{QStringLiteral("woman pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002708\U0000FE0F"), QStringLiteral("woman pilot: medium skin tone"), QStringLiteral("woman pilot: medium skin tone")})},
-{QStringLiteral("woman pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002708\U0000FE0F"), QStringLiteral("woman pilot: medium-dark skin tone"), QStringLiteral("woman pilot: medium-dark skin tone")})},
-{QStringLiteral("woman pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002708\U0000FE0F"), QStringLiteral("woman pilot: dark skin tone"), QStringLiteral("woman pilot: dark skin tone")})},
-{QStringLiteral("astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F680"), QStringLiteral("astronaut: light skin tone"), QStringLiteral("astronaut: light skin tone")})},
-{QStringLiteral("astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F680"), QStringLiteral("astronaut: medium-light skin tone"), QStringLiteral("astronaut: medium-light skin tone")})},
-{QStringLiteral("astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F680"), QStringLiteral("astronaut: medium skin tone"), QStringLiteral("astronaut: medium skin tone")})},
-{QStringLiteral("astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F680"), QStringLiteral("astronaut: medium-dark skin tone"), QStringLiteral("astronaut: medium-dark skin tone")})},
-{QStringLiteral("astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F680"), QStringLiteral("astronaut: dark skin tone"), QStringLiteral("astronaut: dark skin tone")})},
-{QStringLiteral("man astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F680"), QStringLiteral("man astronaut: light skin tone"), QStringLiteral("man astronaut: light skin tone")})},
-{QStringLiteral("man astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F680"), QStringLiteral("man astronaut: medium-light skin tone"), QStringLiteral("man astronaut: medium-light skin tone")})},
-{QStringLiteral("man astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F680"), QStringLiteral("man astronaut: medium skin tone"), QStringLiteral("man astronaut: medium skin tone")})},
-{QStringLiteral("man astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F680"), QStringLiteral("man astronaut: medium-dark skin tone"), QStringLiteral("man astronaut: medium-dark skin tone")})},
-{QStringLiteral("man astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F680"), QStringLiteral("man astronaut: dark skin tone"), QStringLiteral("man astronaut: dark skin tone")})},
-{QStringLiteral("woman astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F680"), QStringLiteral("woman astronaut: light skin tone"), QStringLiteral("woman astronaut: light skin tone")})},
-{QStringLiteral("woman astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F680"), QStringLiteral("woman astronaut: medium-light skin tone"), QStringLiteral("woman astronaut: medium-light skin tone")})},
-{QStringLiteral("woman astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F680"), QStringLiteral("woman astronaut: medium skin tone"), QStringLiteral("woman astronaut: medium skin tone")})},
-{QStringLiteral("woman astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F680"), QStringLiteral("woman astronaut: medium-dark skin tone"), QStringLiteral("woman astronaut: medium-dark skin tone")})},
-{QStringLiteral("woman astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F680"), QStringLiteral("woman astronaut: dark skin tone"), QStringLiteral("woman astronaut: dark skin tone")})},
-{QStringLiteral("firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F692"), QStringLiteral("firefighter: light skin tone"), QStringLiteral("firefighter: light skin tone")})},
-{QStringLiteral("firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F692"), QStringLiteral("firefighter: medium-light skin tone"), QStringLiteral("firefighter: medium-light skin tone")})},
-{QStringLiteral("firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F692"), QStringLiteral("firefighter: medium skin tone"), QStringLiteral("firefighter: medium skin tone")})},
-{QStringLiteral("firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F692"), QStringLiteral("firefighter: medium-dark skin tone"), QStringLiteral("firefighter: medium-dark skin tone")})},
-{QStringLiteral("firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F692"), QStringLiteral("firefighter: dark skin tone"), QStringLiteral("firefighter: dark skin tone")})},
-{QStringLiteral("man firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F692"), QStringLiteral("man firefighter: light skin tone"), QStringLiteral("man firefighter: light skin tone")})},
-{QStringLiteral("man firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F692"), QStringLiteral("man firefighter: medium-light skin tone"), QStringLiteral("man firefighter: medium-light skin tone")})},
-{QStringLiteral("man firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F692"), QStringLiteral("man firefighter: medium skin tone"), QStringLiteral("man firefighter: medium skin tone")})},
-{QStringLiteral("man firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F692"), QStringLiteral("man firefighter: medium-dark skin tone"), QStringLiteral("man firefighter: medium-dark skin tone")})},
-{QStringLiteral("man firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F692"), QStringLiteral("man firefighter: dark skin tone"), QStringLiteral("man firefighter: dark skin tone")})},
-{QStringLiteral("woman firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F692"), QStringLiteral("woman firefighter: light skin tone"), QStringLiteral("woman firefighter: light skin tone")})},
-{QStringLiteral("woman firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F692"), QStringLiteral("woman firefighter: medium-light skin tone"), QStringLiteral("woman firefighter: medium-light skin tone")})},
-{QStringLiteral("woman firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F692"), QStringLiteral("woman firefighter: medium skin tone"), QStringLiteral("woman firefighter: medium skin tone")})},
-{QStringLiteral("woman firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F692"), QStringLiteral("woman firefighter: medium-dark skin tone"), QStringLiteral("woman firefighter: medium-dark skin tone")})},
-{QStringLiteral("woman firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F692"), QStringLiteral("woman firefighter: dark skin tone"), QStringLiteral("woman firefighter: dark skin tone")})},
-{QStringLiteral("police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FB"), QStringLiteral("cop_tone1"), QStringLiteral("police officer: light skin tone")})},
-{QStringLiteral("police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FC"), QStringLiteral("cop_tone2"), QStringLiteral("police officer: medium-light skin tone")})},
-{QStringLiteral("police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FD"), QStringLiteral("cop_tone3"), QStringLiteral("police officer: medium skin tone")})},
-{QStringLiteral("police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FE"), QStringLiteral("cop_tone4"), QStringLiteral("police officer: medium-dark skin tone")})},
-{QStringLiteral("police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FF"), QStringLiteral("cop_tone5"), QStringLiteral("police officer: dark skin tone")})},
-{QStringLiteral("man police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man police officer: light skin tone"), QStringLiteral("man police officer: light skin tone")})},
-{QStringLiteral("man police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man police officer: medium-light skin tone"), QStringLiteral("man police officer: medium-light skin tone")})},
-{QStringLiteral("man police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man police officer: medium skin tone"), QStringLiteral("man police officer: medium skin tone")})},
-{QStringLiteral("man police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man police officer: medium-dark skin tone"), QStringLiteral("man police officer: medium-dark skin tone")})},
-{QStringLiteral("man police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man police officer: dark skin tone"), QStringLiteral("man police officer: dark skin tone")})},
-{QStringLiteral("woman police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman police officer: light skin tone"), QStringLiteral("woman police officer: light skin tone")})},
-{QStringLiteral("woman police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman police officer: medium-light skin tone"), QStringLiteral("woman police officer: medium-light skin tone")})},
-{QStringLiteral("woman police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman police officer: medium skin tone"), QStringLiteral("woman police officer: medium skin tone")})},
-{QStringLiteral("woman police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman police officer: medium-dark skin tone"), QStringLiteral("woman police officer: medium-dark skin tone")})},
-{QStringLiteral("woman police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman police officer: dark skin tone"), QStringLiteral("woman police officer: dark skin tone")})},
-{QStringLiteral("detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FB"), QStringLiteral("spy_tone1"), QStringLiteral("detective: light skin tone")})},
-{QStringLiteral("detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FC"), QStringLiteral("spy_tone2"), QStringLiteral("detective: medium-light skin tone")})},
-{QStringLiteral("detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FD"), QStringLiteral("spy_tone3"), QStringLiteral("detective: medium skin tone")})},
-{QStringLiteral("detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FE"), QStringLiteral("spy_tone4"), QStringLiteral("detective: medium-dark skin tone")})},
-{QStringLiteral("detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FF"), QStringLiteral("spy_tone5"), QStringLiteral("detective: dark skin tone")})},
-{QStringLiteral("man detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man detective: light skin tone"), QStringLiteral("man detective: light skin tone")})},
-{QStringLiteral("man detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man detective: medium-light skin tone"), QStringLiteral("man detective: medium-light skin tone")})},
-{QStringLiteral("man detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man detective: medium skin tone"), QStringLiteral("man detective: medium skin tone")})},
-{QStringLiteral("man detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man detective: medium-dark skin tone"), QStringLiteral("man detective: medium-dark skin tone")})},
-{QStringLiteral("man detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man detective: dark skin tone"), QStringLiteral("man detective: dark skin tone")})},
-{QStringLiteral("woman detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman detective: light skin tone"), QStringLiteral("woman detective: light skin tone")})},
-{QStringLiteral("woman detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman detective: medium-light skin tone"), QStringLiteral("woman detective: medium-light skin tone")})},
-{QStringLiteral("woman detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman detective: medium skin tone"), QStringLiteral("woman detective: medium skin tone")})},
-{QStringLiteral("woman detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman detective: medium-dark skin tone"), QStringLiteral("woman detective: medium-dark skin tone")})},
-{QStringLiteral("woman detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman detective: dark skin tone"), QStringLiteral("woman detective: dark skin tone")})},
-{QStringLiteral("guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FB"), QStringLiteral("guardsman_tone1"), QStringLiteral("guard: light skin tone")})},
-{QStringLiteral("guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FC"), QStringLiteral("guardsman_tone2"), QStringLiteral("guard: medium-light skin tone")})},
-{QStringLiteral("guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FD"), QStringLiteral("guardsman_tone3"), QStringLiteral("guard: medium skin tone")})},
-{QStringLiteral("guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FE"), QStringLiteral("guardsman_tone4"), QStringLiteral("guard: medium-dark skin tone")})},
-{QStringLiteral("guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FF"), QStringLiteral("guardsman_tone5"), QStringLiteral("guard: dark skin tone")})},
-{QStringLiteral("man guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man guard: light skin tone"), QStringLiteral("man guard: light skin tone")})},
-{QStringLiteral("man guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man guard: medium-light skin tone"), QStringLiteral("man guard: medium-light skin tone")})},
-{QStringLiteral("man guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man guard: medium skin tone"), QStringLiteral("man guard: medium skin tone")})},
-{QStringLiteral("man guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man guard: medium-dark skin tone"), QStringLiteral("man guard: medium-dark skin tone")})},
-{QStringLiteral("man guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man guard: dark skin tone"), QStringLiteral("man guard: dark skin tone")})},
-{QStringLiteral("woman guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman guard: light skin tone"), QStringLiteral("woman guard: light skin tone")})},
-{QStringLiteral("woman guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman guard: medium-light skin tone"), QStringLiteral("woman guard: medium-light skin tone")})},
-{QStringLiteral("woman guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman guard: medium skin tone"), QStringLiteral("woman guard: medium skin tone")})},
-{QStringLiteral("woman guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman guard: medium-dark skin tone"), QStringLiteral("woman guard: medium-dark skin tone")})},
-{QStringLiteral("woman guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman guard: dark skin tone"), QStringLiteral("woman guard: dark skin tone")})},
-{QStringLiteral("ninja"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F977\U0001F3FB"), QStringLiteral("ninja: light skin tone"), QStringLiteral("ninja: light skin tone")})},
-{QStringLiteral("ninja"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F977\U0001F3FC"), QStringLiteral("ninja: medium-light skin tone"), QStringLiteral("ninja: medium-light skin tone")})},
-{QStringLiteral("ninja"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F977\U0001F3FD"), QStringLiteral("ninja: medium skin tone"), QStringLiteral("ninja: medium skin tone")})},
-{QStringLiteral("ninja"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F977\U0001F3FE"), QStringLiteral("ninja: medium-dark skin tone"), QStringLiteral("ninja: medium-dark skin tone")})},
-{QStringLiteral("ninja"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F977\U0001F3FF"), QStringLiteral("ninja: dark skin tone"), QStringLiteral("ninja: dark skin tone")})},
-{QStringLiteral("construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FB"), QStringLiteral("construction_worker_tone1"), QStringLiteral("construction worker: light skin tone")})},
-{QStringLiteral("construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FC"), QStringLiteral("construction_worker_tone2"), QStringLiteral("construction worker: medium-light skin tone")})},
-{QStringLiteral("construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FD"), QStringLiteral("construction_worker_tone3"), QStringLiteral("construction worker: medium skin tone")})},
-{QStringLiteral("construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FE"), QStringLiteral("construction_worker_tone4"), QStringLiteral("construction worker: medium-dark skin tone")})},
-{QStringLiteral("construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FF"), QStringLiteral("construction_worker_tone5"), QStringLiteral("construction worker: dark skin tone")})},
-{QStringLiteral("man construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man construction worker: light skin tone"), QStringLiteral("man construction worker: light skin tone")})},
-{QStringLiteral("man construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man construction worker: medium-light skin tone"), QStringLiteral("man construction worker: medium-light skin tone")})},
-{QStringLiteral("man construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man construction worker: medium skin tone"), QStringLiteral("man construction worker: medium skin tone")})},
-{QStringLiteral("man construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man construction worker: medium-dark skin tone"), QStringLiteral("man construction worker: medium-dark skin tone")})},
-{QStringLiteral("man construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man construction worker: dark skin tone"), QStringLiteral("man construction worker: dark skin tone")})},
-{QStringLiteral("woman construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman construction worker: light skin tone"), QStringLiteral("woman construction worker: light skin tone")})},
-{QStringLiteral("woman construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman construction worker: medium-light skin tone"), QStringLiteral("woman construction worker: medium-light skin tone")})},
-{QStringLiteral("woman construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman construction worker: medium skin tone"), QStringLiteral("woman construction worker: medium skin tone")})},
-{QStringLiteral("woman construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman construction worker: medium-dark skin tone"), QStringLiteral("woman construction worker: medium-dark skin tone")})},
-{QStringLiteral("woman construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman construction worker: dark skin tone"), QStringLiteral("woman construction worker: dark skin tone")})},
-{QStringLiteral("person with crown"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC5\U0001F3FB"), QStringLiteral("person with crown: light skin tone"), QStringLiteral("person with crown: light skin tone")})},
-{QStringLiteral("person with crown"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC5\U0001F3FC"), QStringLiteral("person with crown: medium-light skin tone"), QStringLiteral("person with crown: medium-light skin tone")})},
-{QStringLiteral("person with crown"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC5\U0001F3FD"), QStringLiteral("person with crown: medium skin tone"), QStringLiteral("person with crown: medium skin tone")})},
-{QStringLiteral("person with crown"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC5\U0001F3FE"), QStringLiteral("person with crown: medium-dark skin tone"), QStringLiteral("person with crown: medium-dark skin tone")})},
-{QStringLiteral("person with crown"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC5\U0001F3FF"), QStringLiteral("person with crown: dark skin tone"), QStringLiteral("person with crown: dark skin tone")})},
-{QStringLiteral("prince"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F934\U0001F3FB"), QStringLiteral("prince_tone1"), QStringLiteral("prince: light skin tone")})},
-{QStringLiteral("prince"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F934\U0001F3FC"), QStringLiteral("prince_tone2"), QStringLiteral("prince: medium-light skin tone")})},
-{QStringLiteral("prince"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F934\U0001F3FD"), QStringLiteral("prince_tone3"), QStringLiteral("prince: medium skin tone")})},
-{QStringLiteral("prince"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F934\U0001F3FE"), QStringLiteral("prince_tone4"), QStringLiteral("prince: medium-dark skin tone")})},
-{QStringLiteral("prince"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F934\U0001F3FF"), QStringLiteral("prince_tone5"), QStringLiteral("prince: dark skin tone")})},
-{QStringLiteral("princess"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F478\U0001F3FB"), QStringLiteral("princess_tone1"), QStringLiteral("princess: light skin tone")})},
-{QStringLiteral("princess"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F478\U0001F3FC"), QStringLiteral("princess_tone2"), QStringLiteral("princess: medium-light skin tone")})},
-{QStringLiteral("princess"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F478\U0001F3FD"), QStringLiteral("princess_tone3"), QStringLiteral("princess: medium skin tone")})},
-{QStringLiteral("princess"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F478\U0001F3FE"), QStringLiteral("princess_tone4"), QStringLiteral("princess: medium-dark skin tone")})},
-{QStringLiteral("princess"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F478\U0001F3FF"), QStringLiteral("princess_tone5"), QStringLiteral("princess: dark skin tone")})},
-{QStringLiteral("person wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FB"), QStringLiteral("man_with_turban_tone1"), QStringLiteral("person wearing turban: light skin tone")})},
-{QStringLiteral("person wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FC"), QStringLiteral("man_with_turban_tone2"), QStringLiteral("person wearing turban: medium-light skin tone")})},
-{QStringLiteral("person wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FD"), QStringLiteral("man_with_turban_tone3"), QStringLiteral("person wearing turban: medium skin tone")})},
-{QStringLiteral("person wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FE"), QStringLiteral("man_with_turban_tone4"), QStringLiteral("person wearing turban: medium-dark skin tone")})},
-{QStringLiteral("person wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FF"), QStringLiteral("man_with_turban_tone5"), QStringLiteral("person wearing turban: dark skin tone")})},
-{QStringLiteral("man wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man wearing turban: light skin tone"), QStringLiteral("man wearing turban: light skin tone")})},
-{QStringLiteral("man wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man wearing turban: medium-light skin tone"), QStringLiteral("man wearing turban: medium-light skin tone")})},
-{QStringLiteral("man wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man wearing turban: medium skin tone"), QStringLiteral("man wearing turban: medium skin tone")})},
-{QStringLiteral("man wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man wearing turban: medium-dark skin tone"), QStringLiteral("man wearing turban: medium-dark skin tone")})},
-{QStringLiteral("man wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man wearing turban: dark skin tone"), QStringLiteral("man wearing turban: dark skin tone")})},
-{QStringLiteral("woman wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman wearing turban: light skin tone"), QStringLiteral("woman wearing turban: light skin tone")})},
-{QStringLiteral("woman wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman wearing turban: medium-light skin tone"), QStringLiteral("woman wearing turban: medium-light skin tone")})},
-{QStringLiteral("woman wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman wearing turban: medium skin tone"), QStringLiteral("woman wearing turban: medium skin tone")})},
-{QStringLiteral("woman wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman wearing turban: medium-dark skin tone"), QStringLiteral("woman wearing turban: medium-dark skin tone")})},
-{QStringLiteral("woman wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman wearing turban: dark skin tone"), QStringLiteral("woman wearing turban: dark skin tone")})},
-{QStringLiteral("person with skullcap"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F472\U0001F3FB"), QStringLiteral("man_with_gua_pi_mao_tone1"), QStringLiteral("person with skullcap: light skin tone")})},
-{QStringLiteral("person with skullcap"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F472\U0001F3FC"), QStringLiteral("man_with_gua_pi_mao_tone2"), QStringLiteral("person with skullcap: medium-light skin tone")})},
-{QStringLiteral("person with skullcap"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F472\U0001F3FD"), QStringLiteral("man_with_gua_pi_mao_tone3"), QStringLiteral("person with skullcap: medium skin tone")})},
-{QStringLiteral("person with skullcap"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F472\U0001F3FE"), QStringLiteral("man_with_gua_pi_mao_tone4"), QStringLiteral("person with skullcap: medium-dark skin tone")})},
-{QStringLiteral("person with skullcap"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F472\U0001F3FF"), QStringLiteral("man_with_gua_pi_mao_tone5"), QStringLiteral("person with skullcap: dark skin tone")})},
-{QStringLiteral("woman with headscarf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D5\U0001F3FB"), QStringLiteral("woman_with_headscarf_tone1"), QStringLiteral("woman with headscarf: light skin tone")})},
-{QStringLiteral("woman with headscarf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D5\U0001F3FC"), QStringLiteral("woman_with_headscarf_tone2"), QStringLiteral("woman with headscarf: medium-light skin tone")})},
-{QStringLiteral("woman with headscarf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D5\U0001F3FD"), QStringLiteral("woman_with_headscarf_tone3"), QStringLiteral("woman with headscarf: medium skin tone")})},
-{QStringLiteral("woman with headscarf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D5\U0001F3FE"), QStringLiteral("woman_with_headscarf_tone4"), QStringLiteral("woman with headscarf: medium-dark skin tone")})},
-{QStringLiteral("woman with headscarf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D5\U0001F3FF"), QStringLiteral("woman_with_headscarf_tone5"), QStringLiteral("woman with headscarf: dark skin tone")})},
-{QStringLiteral("person in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FB"), QStringLiteral("man_in_tuxedo_tone1"), QStringLiteral("person in tuxedo: light skin tone")})},
-{QStringLiteral("person in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FC"), QStringLiteral("man_in_tuxedo_tone2"), QStringLiteral("person in tuxedo: medium-light skin tone")})},
-{QStringLiteral("person in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FD"), QStringLiteral("man_in_tuxedo_tone3"), QStringLiteral("person in tuxedo: medium skin tone")})},
-{QStringLiteral("person in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FE"), QStringLiteral("man_in_tuxedo_tone4"), QStringLiteral("person in tuxedo: medium-dark skin tone")})},
-{QStringLiteral("person in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FF"), QStringLiteral("man_in_tuxedo_tone5"), QStringLiteral("person in tuxedo: dark skin tone")})},
-{QStringLiteral("man in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in tuxedo: light skin tone"), QStringLiteral("man in tuxedo: light skin tone")})},
-{QStringLiteral("man in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in tuxedo: medium-light skin tone"), QStringLiteral("man in tuxedo: medium-light skin tone")})},
-{QStringLiteral("man in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in tuxedo: medium skin tone"), QStringLiteral("man in tuxedo: medium skin tone")})},
-{QStringLiteral("man in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in tuxedo: medium-dark skin tone"), QStringLiteral("man in tuxedo: medium-dark skin tone")})},
-{QStringLiteral("man in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in tuxedo: dark skin tone"), QStringLiteral("man in tuxedo: dark skin tone")})},
-{QStringLiteral("woman in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in tuxedo: light skin tone"), QStringLiteral("woman in tuxedo: light skin tone")})},
-{QStringLiteral("woman in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in tuxedo: medium-light skin tone"), QStringLiteral("woman in tuxedo: medium-light skin tone")})},
-{QStringLiteral("woman in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in tuxedo: medium skin tone"), QStringLiteral("woman in tuxedo: medium skin tone")})},
-{QStringLiteral("woman in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in tuxedo: medium-dark skin tone"), QStringLiteral("woman in tuxedo: medium-dark skin tone")})},
-{QStringLiteral("woman in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in tuxedo: dark skin tone"), QStringLiteral("woman in tuxedo: dark skin tone")})},
-{QStringLiteral("person with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FB"), QStringLiteral("bride_with_veil_tone1"), QStringLiteral("person with veil: light skin tone")})},
-{QStringLiteral("person with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FC"), QStringLiteral("bride_with_veil_tone2"), QStringLiteral("person with veil: medium-light skin tone")})},
-{QStringLiteral("person with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FD"), QStringLiteral("bride_with_veil_tone3"), QStringLiteral("person with veil: medium skin tone")})},
-{QStringLiteral("person with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FE"), QStringLiteral("bride_with_veil_tone4"), QStringLiteral("person with veil: medium-dark skin tone")})},
-{QStringLiteral("person with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FF"), QStringLiteral("bride_with_veil_tone5"), QStringLiteral("person with veil: dark skin tone")})},
-{QStringLiteral("man with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man with veil: light skin tone"), QStringLiteral("man with veil: light skin tone")})},
-{QStringLiteral("man with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man with veil: medium-light skin tone"), QStringLiteral("man with veil: medium-light skin tone")})},
-{QStringLiteral("man with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man with veil: medium skin tone"), QStringLiteral("man with veil: medium skin tone")})},
-{QStringLiteral("man with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man with veil: medium-dark skin tone"), QStringLiteral("man with veil: medium-dark skin tone")})},
-{QStringLiteral("man with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man with veil: dark skin tone"), QStringLiteral("man with veil: dark skin tone")})},
-{QStringLiteral("woman with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman with veil: light skin tone"), QStringLiteral("woman with veil: light skin tone")})},
-{QStringLiteral("woman with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman with veil: medium-light skin tone"), QStringLiteral("woman with veil: medium-light skin tone")})},
-{QStringLiteral("woman with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman with veil: medium skin tone"), QStringLiteral("woman with veil: medium skin tone")})},
-{QStringLiteral("woman with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman with veil: medium-dark skin tone"), QStringLiteral("woman with veil: medium-dark skin tone")})},
-{QStringLiteral("woman with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman with veil: dark skin tone"), QStringLiteral("woman with veil: dark skin tone")})},
-{QStringLiteral("pregnant woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F930\U0001F3FB"), QStringLiteral("pregnant_woman_tone1"), QStringLiteral("pregnant woman: light skin tone")})},
-{QStringLiteral("pregnant woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F930\U0001F3FC"), QStringLiteral("pregnant_woman_tone2"), QStringLiteral("pregnant woman: medium-light skin tone")})},
-{QStringLiteral("pregnant woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F930\U0001F3FD"), QStringLiteral("pregnant_woman_tone3"), QStringLiteral("pregnant woman: medium skin tone")})},
-{QStringLiteral("pregnant woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F930\U0001F3FE"), QStringLiteral("pregnant_woman_tone4"), QStringLiteral("pregnant woman: medium-dark skin tone")})},
-{QStringLiteral("pregnant woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F930\U0001F3FF"), QStringLiteral("pregnant_woman_tone5"), QStringLiteral("pregnant woman: dark skin tone")})},
-{QStringLiteral("pregnant man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC3\U0001F3FB"), QStringLiteral("pregnant man: light skin tone"), QStringLiteral("pregnant man: light skin tone")})},
-{QStringLiteral("pregnant man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC3\U0001F3FC"), QStringLiteral("pregnant man: medium-light skin tone"), QStringLiteral("pregnant man: medium-light skin tone")})},
-{QStringLiteral("pregnant man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC3\U0001F3FD"), QStringLiteral("pregnant man: medium skin tone"), QStringLiteral("pregnant man: medium skin tone")})},
-{QStringLiteral("pregnant man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC3\U0001F3FE"), QStringLiteral("pregnant man: medium-dark skin tone"), QStringLiteral("pregnant man: medium-dark skin tone")})},
-{QStringLiteral("pregnant man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC3\U0001F3FF"), QStringLiteral("pregnant man: dark skin tone"), QStringLiteral("pregnant man: dark skin tone")})},
-{QStringLiteral("pregnant person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC4\U0001F3FB"), QStringLiteral("pregnant person: light skin tone"), QStringLiteral("pregnant person: light skin tone")})},
-{QStringLiteral("pregnant person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC4\U0001F3FC"), QStringLiteral("pregnant person: medium-light skin tone"), QStringLiteral("pregnant person: medium-light skin tone")})},
-{QStringLiteral("pregnant person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC4\U0001F3FD"), QStringLiteral("pregnant person: medium skin tone"), QStringLiteral("pregnant person: medium skin tone")})},
-{QStringLiteral("pregnant person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC4\U0001F3FE"), QStringLiteral("pregnant person: medium-dark skin tone"), QStringLiteral("pregnant person: medium-dark skin tone")})},
-{QStringLiteral("pregnant person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC4\U0001F3FF"), QStringLiteral("pregnant person: dark skin tone"), QStringLiteral("pregnant person: dark skin tone")})},
-{QStringLiteral("breast-feeding"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F931\U0001F3FB"), QStringLiteral("breast_feeding_tone1"), QStringLiteral("breast-feeding: light skin tone")})},
-{QStringLiteral("breast-feeding"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F931\U0001F3FC"), QStringLiteral("breast_feeding_tone2"), QStringLiteral("breast-feeding: medium-light skin tone")})},
-{QStringLiteral("breast-feeding"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F931\U0001F3FD"), QStringLiteral("breast_feeding_tone3"), QStringLiteral("breast-feeding: medium skin tone")})},
-{QStringLiteral("breast-feeding"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F931\U0001F3FE"), QStringLiteral("breast_feeding_tone4"), QStringLiteral("breast-feeding: medium-dark skin tone")})},
-{QStringLiteral("breast-feeding"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F931\U0001F3FF"), QStringLiteral("breast_feeding_tone5"), QStringLiteral("breast-feeding: dark skin tone")})},
-{QStringLiteral("woman feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F37C"), QStringLiteral("woman feeding baby: light skin tone"), QStringLiteral("woman feeding baby: light skin tone")})},
-{QStringLiteral("woman feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F37C"), QStringLiteral("woman feeding baby: medium-light skin tone"), QStringLiteral("woman feeding baby: medium-light skin tone")})},
-{QStringLiteral("woman feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F37C"), QStringLiteral("woman feeding baby: medium skin tone"), QStringLiteral("woman feeding baby: medium skin tone")})},
-{QStringLiteral("woman feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F37C"), QStringLiteral("woman feeding baby: medium-dark skin tone"), QStringLiteral("woman feeding baby: medium-dark skin tone")})},
-{QStringLiteral("woman feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F37C"), QStringLiteral("woman feeding baby: dark skin tone"), QStringLiteral("woman feeding baby: dark skin tone")})},
-{QStringLiteral("man feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F37C"), QStringLiteral("man feeding baby: light skin tone"), QStringLiteral("man feeding baby: light skin tone")})},
-{QStringLiteral("man feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F37C"), QStringLiteral("man feeding baby: medium-light skin tone"), QStringLiteral("man feeding baby: medium-light skin tone")})},
-{QStringLiteral("man feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F37C"), QStringLiteral("man feeding baby: medium skin tone"), QStringLiteral("man feeding baby: medium skin tone")})},
-{QStringLiteral("man feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F37C"), QStringLiteral("man feeding baby: medium-dark skin tone"), QStringLiteral("man feeding baby: medium-dark skin tone")})},
-{QStringLiteral("man feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F37C"), QStringLiteral("man feeding baby: dark skin tone"), QStringLiteral("man feeding baby: dark skin tone")})},
-{QStringLiteral("person feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F37C"), QStringLiteral("person feeding baby: light skin tone"), QStringLiteral("person feeding baby: light skin tone")})},
-{QStringLiteral("person feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F37C"), QStringLiteral("person feeding baby: medium-light skin tone"), QStringLiteral("person feeding baby: medium-light skin tone")})},
-{QStringLiteral("person feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F37C"), QStringLiteral("person feeding baby: medium skin tone"), QStringLiteral("person feeding baby: medium skin tone")})},
-{QStringLiteral("person feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F37C"), QStringLiteral("person feeding baby: medium-dark skin tone"), QStringLiteral("person feeding baby: medium-dark skin tone")})},
-{QStringLiteral("person feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F37C"), QStringLiteral("person feeding baby: dark skin tone"), QStringLiteral("person feeding baby: dark skin tone")})},
-{QStringLiteral("baby angel"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47C\U0001F3FB"), QStringLiteral("angel_tone1"), QStringLiteral("baby angel: light skin tone")})},
-{QStringLiteral("baby angel"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47C\U0001F3FC"), QStringLiteral("angel_tone2"), QStringLiteral("baby angel: medium-light skin tone")})},
-{QStringLiteral("baby angel"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47C\U0001F3FD"), QStringLiteral("angel_tone3"), QStringLiteral("baby angel: medium skin tone")})},
-{QStringLiteral("baby angel"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47C\U0001F3FE"), QStringLiteral("angel_tone4"), QStringLiteral("baby angel: medium-dark skin tone")})},
-{QStringLiteral("baby angel"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47C\U0001F3FF"), QStringLiteral("angel_tone5"), QStringLiteral("baby angel: dark skin tone")})},
-{QStringLiteral("Santa Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F385\U0001F3FB"), QStringLiteral("santa_tone1"), QStringLiteral("Santa Claus: light skin tone")})},
-{QStringLiteral("Santa Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F385\U0001F3FC"), QStringLiteral("santa_tone2"), QStringLiteral("Santa Claus: medium-light skin tone")})},
-{QStringLiteral("Santa Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F385\U0001F3FD"), QStringLiteral("santa_tone3"), QStringLiteral("Santa Claus: medium skin tone")})},
-{QStringLiteral("Santa Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F385\U0001F3FE"), QStringLiteral("santa_tone4"), QStringLiteral("Santa Claus: medium-dark skin tone")})},
-{QStringLiteral("Santa Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F385\U0001F3FF"), QStringLiteral("santa_tone5"), QStringLiteral("Santa Claus: dark skin tone")})},
-{QStringLiteral("Mrs. Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F936\U0001F3FB"), QStringLiteral("mrs_claus_tone1"), QStringLiteral("Mrs. Claus: light skin tone")})},
-{QStringLiteral("Mrs. Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F936\U0001F3FC"), QStringLiteral("mrs_claus_tone2"), QStringLiteral("Mrs. Claus: medium-light skin tone")})},
-{QStringLiteral("Mrs. Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F936\U0001F3FD"), QStringLiteral("mrs_claus_tone3"), QStringLiteral("Mrs. Claus: medium skin tone")})},
-{QStringLiteral("Mrs. Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F936\U0001F3FE"), QStringLiteral("mrs_claus_tone4"), QStringLiteral("Mrs. Claus: medium-dark skin tone")})},
-{QStringLiteral("Mrs. Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F936\U0001F3FF"), QStringLiteral("mrs_claus_tone5"), QStringLiteral("Mrs. Claus: dark skin tone")})},
-{QStringLiteral("mx claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F384"), QStringLiteral("mx claus: light skin tone"), QStringLiteral("mx claus: light skin tone")})},
-{QStringLiteral("mx claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F384"), QStringLiteral("mx claus: medium-light skin tone"), QStringLiteral("mx claus: medium-light skin tone")})},
-{QStringLiteral("mx claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F384"), QStringLiteral("mx claus: medium skin tone"), QStringLiteral("mx claus: medium skin tone")})},
-{QStringLiteral("mx claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F384"), QStringLiteral("mx claus: medium-dark skin tone"), QStringLiteral("mx claus: medium-dark skin tone")})},
-{QStringLiteral("mx claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F384"), QStringLiteral("mx claus: dark skin tone"), QStringLiteral("mx claus: dark skin tone")})},
-{QStringLiteral("superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FB"), QStringLiteral("superhero_tone1"), QStringLiteral("superhero: light skin tone")})},
-{QStringLiteral("superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FC"), QStringLiteral("superhero_tone2"), QStringLiteral("superhero: medium-light skin tone")})},
-{QStringLiteral("superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FD"), QStringLiteral("superhero_tone3"), QStringLiteral("superhero: medium skin tone")})},
-{QStringLiteral("superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FE"), QStringLiteral("superhero_tone4"), QStringLiteral("superhero: medium-dark skin tone")})},
-{QStringLiteral("superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FF"), QStringLiteral("superhero_tone5"), QStringLiteral("superhero: dark skin tone")})},
-{QStringLiteral("man superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man superhero: light skin tone"), QStringLiteral("man superhero: light skin tone")})},
-{QStringLiteral("man superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man superhero: medium-light skin tone"), QStringLiteral("man superhero: medium-light skin tone")})},
-{QStringLiteral("man superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man superhero: medium skin tone"), QStringLiteral("man superhero: medium skin tone")})},
-{QStringLiteral("man superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man superhero: medium-dark skin tone"), QStringLiteral("man superhero: medium-dark skin tone")})},
-{QStringLiteral("man superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man superhero: dark skin tone"), QStringLiteral("man superhero: dark skin tone")})},
-{QStringLiteral("woman superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman superhero: light skin tone"), QStringLiteral("woman superhero: light skin tone")})},
-{QStringLiteral("woman superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman superhero: medium-light skin tone"), QStringLiteral("woman superhero: medium-light skin tone")})},
-{QStringLiteral("woman superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman superhero: medium skin tone"), QStringLiteral("woman superhero: medium skin tone")})},
-{QStringLiteral("woman superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman superhero: medium-dark skin tone"), QStringLiteral("woman superhero: medium-dark skin tone")})},
-{QStringLiteral("woman superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman superhero: dark skin tone"), QStringLiteral("woman superhero: dark skin tone")})},
-{QStringLiteral("supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FB"), QStringLiteral("supervillain_tone1"), QStringLiteral("supervillain: light skin tone")})},
-{QStringLiteral("supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FC"), QStringLiteral("supervillain_tone2"), QStringLiteral("supervillain: medium-light skin tone")})},
-{QStringLiteral("supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FD"), QStringLiteral("supervillain_tone3"), QStringLiteral("supervillain: medium skin tone")})},
-{QStringLiteral("supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FE"), QStringLiteral("supervillain_tone4"), QStringLiteral("supervillain: medium-dark skin tone")})},
-{QStringLiteral("supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FF"), QStringLiteral("supervillain_tone5"), QStringLiteral("supervillain: dark skin tone")})},
-{QStringLiteral("man supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man supervillain: light skin tone"), QStringLiteral("man supervillain: light skin tone")})},
-{QStringLiteral("man supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man supervillain: medium-light skin tone"), QStringLiteral("man supervillain: medium-light skin tone")})},
-{QStringLiteral("man supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man supervillain: medium skin tone"), QStringLiteral("man supervillain: medium skin tone")})},
-{QStringLiteral("man supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man supervillain: medium-dark skin tone"), QStringLiteral("man supervillain: medium-dark skin tone")})},
-{QStringLiteral("man supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man supervillain: dark skin tone"), QStringLiteral("man supervillain: dark skin tone")})},
-{QStringLiteral("woman supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman supervillain: light skin tone"), QStringLiteral("woman supervillain: light skin tone")})},
-{QStringLiteral("woman supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman supervillain: medium-light skin tone"), QStringLiteral("woman supervillain: medium-light skin tone")})},
-{QStringLiteral("woman supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman supervillain: medium skin tone"), QStringLiteral("woman supervillain: medium skin tone")})},
-{QStringLiteral("woman supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman supervillain: medium-dark skin tone"), QStringLiteral("woman supervillain: medium-dark skin tone")})},
-{QStringLiteral("woman supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman supervillain: dark skin tone"), QStringLiteral("woman supervillain: dark skin tone")})},
-{QStringLiteral("mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FB"), QStringLiteral("mage_tone1"), QStringLiteral("mage: light skin tone")})},
-{QStringLiteral("mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FC"), QStringLiteral("mage_tone2"), QStringLiteral("mage: medium-light skin tone")})},
-{QStringLiteral("mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FD"), QStringLiteral("mage_tone3"), QStringLiteral("mage: medium skin tone")})},
-{QStringLiteral("mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FE"), QStringLiteral("mage_tone4"), QStringLiteral("mage: medium-dark skin tone")})},
-{QStringLiteral("mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FF"), QStringLiteral("mage_tone5"), QStringLiteral("mage: dark skin tone")})},
-{QStringLiteral("man mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mage: light skin tone"), QStringLiteral("man mage: light skin tone")})},
-{QStringLiteral("man mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mage: medium-light skin tone"), QStringLiteral("man mage: medium-light skin tone")})},
-{QStringLiteral("man mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mage: medium skin tone"), QStringLiteral("man mage: medium skin tone")})},
-{QStringLiteral("man mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mage: medium-dark skin tone"), QStringLiteral("man mage: medium-dark skin tone")})},
-{QStringLiteral("man mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mage: dark skin tone"), QStringLiteral("man mage: dark skin tone")})},
-{QStringLiteral("woman mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mage: light skin tone"), QStringLiteral("woman mage: light skin tone")})},
-{QStringLiteral("woman mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mage: medium-light skin tone"), QStringLiteral("woman mage: medium-light skin tone")})},
-{QStringLiteral("woman mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mage: medium skin tone"), QStringLiteral("woman mage: medium skin tone")})},
-{QStringLiteral("woman mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mage: medium-dark skin tone"), QStringLiteral("woman mage: medium-dark skin tone")})},
-{QStringLiteral("woman mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mage: dark skin tone"), QStringLiteral("woman mage: dark skin tone")})},
-{QStringLiteral("fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FB"), QStringLiteral("fairy_tone1"), QStringLiteral("fairy: light skin tone")})},
-{QStringLiteral("fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FC"), QStringLiteral("fairy_tone2"), QStringLiteral("fairy: medium-light skin tone")})},
-{QStringLiteral("fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FD"), QStringLiteral("fairy_tone3"), QStringLiteral("fairy: medium skin tone")})},
-{QStringLiteral("fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FE"), QStringLiteral("fairy_tone4"), QStringLiteral("fairy: medium-dark skin tone")})},
-{QStringLiteral("fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FF"), QStringLiteral("fairy_tone5"), QStringLiteral("fairy: dark skin tone")})},
-{QStringLiteral("man fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man fairy: light skin tone"), QStringLiteral("man fairy: light skin tone")})},
-{QStringLiteral("man fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man fairy: medium-light skin tone"), QStringLiteral("man fairy: medium-light skin tone")})},
-{QStringLiteral("man fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man fairy: medium skin tone"), QStringLiteral("man fairy: medium skin tone")})},
-{QStringLiteral("man fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man fairy: medium-dark skin tone"), QStringLiteral("man fairy: medium-dark skin tone")})},
-{QStringLiteral("man fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man fairy: dark skin tone"), QStringLiteral("man fairy: dark skin tone")})},
-{QStringLiteral("woman fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman fairy: light skin tone"), QStringLiteral("woman fairy: light skin tone")})},
-{QStringLiteral("woman fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman fairy: medium-light skin tone"), QStringLiteral("woman fairy: medium-light skin tone")})},
-{QStringLiteral("woman fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman fairy: medium skin tone"), QStringLiteral("woman fairy: medium skin tone")})},
-{QStringLiteral("woman fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman fairy: medium-dark skin tone"), QStringLiteral("woman fairy: medium-dark skin tone")})},
-{QStringLiteral("woman fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman fairy: dark skin tone"), QStringLiteral("woman fairy: dark skin tone")})},
-{QStringLiteral("vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FB"), QStringLiteral("vampire_tone1"), QStringLiteral("vampire: light skin tone")})},
-{QStringLiteral("vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FC"), QStringLiteral("vampire_tone2"), QStringLiteral("vampire: medium-light skin tone")})},
-{QStringLiteral("vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FD"), QStringLiteral("vampire_tone3"), QStringLiteral("vampire: medium skin tone")})},
-{QStringLiteral("vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FE"), QStringLiteral("vampire_tone4"), QStringLiteral("vampire: medium-dark skin tone")})},
-{QStringLiteral("vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FF"), QStringLiteral("vampire_tone5"), QStringLiteral("vampire: dark skin tone")})},
-{QStringLiteral("man vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man vampire: light skin tone"), QStringLiteral("man vampire: light skin tone")})},
-{QStringLiteral("man vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man vampire: medium-light skin tone"), QStringLiteral("man vampire: medium-light skin tone")})},
-{QStringLiteral("man vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man vampire: medium skin tone"), QStringLiteral("man vampire: medium skin tone")})},
-{QStringLiteral("man vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man vampire: medium-dark skin tone"), QStringLiteral("man vampire: medium-dark skin tone")})},
-{QStringLiteral("man vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man vampire: dark skin tone"), QStringLiteral("man vampire: dark skin tone")})},
-{QStringLiteral("woman vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman vampire: light skin tone"), QStringLiteral("woman vampire: light skin tone")})},
-{QStringLiteral("woman vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman vampire: medium-light skin tone"), QStringLiteral("woman vampire: medium-light skin tone")})},
-{QStringLiteral("woman vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman vampire: medium skin tone"), QStringLiteral("woman vampire: medium skin tone")})},
-{QStringLiteral("woman vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman vampire: medium-dark skin tone"), QStringLiteral("woman vampire: medium-dark skin tone")})},
-{QStringLiteral("woman vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman vampire: dark skin tone"), QStringLiteral("woman vampire: dark skin tone")})},
-{QStringLiteral("merperson"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FB"), QStringLiteral("merperson_tone1"), QStringLiteral("merperson: light skin tone")})},
-{QStringLiteral("merperson"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FC"), QStringLiteral("merperson_tone2"), QStringLiteral("merperson: medium-light skin tone")})},
-{QStringLiteral("merperson"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FD"), QStringLiteral("merperson_tone3"), QStringLiteral("merperson: medium skin tone")})},
-{QStringLiteral("merperson"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FE"), QStringLiteral("merperson_tone4"), QStringLiteral("merperson: medium-dark skin tone")})},
-{QStringLiteral("merperson"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FF"), QStringLiteral("merperson_tone5"), QStringLiteral("merperson: dark skin tone")})},
-{QStringLiteral("merman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("merman: light skin tone"), QStringLiteral("merman: light skin tone")})},
-{QStringLiteral("merman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("merman: medium-light skin tone"), QStringLiteral("merman: medium-light skin tone")})},
-{QStringLiteral("merman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("merman: medium skin tone"), QStringLiteral("merman: medium skin tone")})},
-{QStringLiteral("merman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("merman: medium-dark skin tone"), QStringLiteral("merman: medium-dark skin tone")})},
-{QStringLiteral("merman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("merman: dark skin tone"), QStringLiteral("merman: dark skin tone")})},
-{QStringLiteral("mermaid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("mermaid: light skin tone"), QStringLiteral("mermaid: light skin tone")})},
-{QStringLiteral("mermaid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("mermaid: medium-light skin tone"), QStringLiteral("mermaid: medium-light skin tone")})},
-{QStringLiteral("mermaid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("mermaid: medium skin tone"), QStringLiteral("mermaid: medium skin tone")})},
-{QStringLiteral("mermaid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("mermaid: medium-dark skin tone"), QStringLiteral("mermaid: medium-dark skin tone")})},
-{QStringLiteral("mermaid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("mermaid: dark skin tone"), QStringLiteral("mermaid: dark skin tone")})},
-{QStringLiteral("elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FB"), QStringLiteral("elf_tone1"), QStringLiteral("elf: light skin tone")})},
-{QStringLiteral("elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FC"), QStringLiteral("elf_tone2"), QStringLiteral("elf: medium-light skin tone")})},
-{QStringLiteral("elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FD"), QStringLiteral("elf_tone3"), QStringLiteral("elf: medium skin tone")})},
-{QStringLiteral("elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FE"), QStringLiteral("elf_tone4"), QStringLiteral("elf: medium-dark skin tone")})},
-{QStringLiteral("elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FF"), QStringLiteral("elf_tone5"), QStringLiteral("elf: dark skin tone")})},
-{QStringLiteral("man elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man elf: light skin tone"), QStringLiteral("man elf: light skin tone")})},
-{QStringLiteral("man elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man elf: medium-light skin tone"), QStringLiteral("man elf: medium-light skin tone")})},
-{QStringLiteral("man elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man elf: medium skin tone"), QStringLiteral("man elf: medium skin tone")})},
-{QStringLiteral("man elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man elf: medium-dark skin tone"), QStringLiteral("man elf: medium-dark skin tone")})},
-{QStringLiteral("man elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man elf: dark skin tone"), QStringLiteral("man elf: dark skin tone")})},
-{QStringLiteral("woman elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman elf: light skin tone"), QStringLiteral("woman elf: light skin tone")})},
-{QStringLiteral("woman elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman elf: medium-light skin tone"), QStringLiteral("woman elf: medium-light skin tone")})},
-{QStringLiteral("woman elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman elf: medium skin tone"), QStringLiteral("woman elf: medium skin tone")})},
-{QStringLiteral("woman elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman elf: medium-dark skin tone"), QStringLiteral("woman elf: medium-dark skin tone")})},
-{QStringLiteral("woman elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman elf: dark skin tone"), QStringLiteral("woman elf: dark skin tone")})},
-{QStringLiteral("person getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FB"), QStringLiteral("massage_tone1"), QStringLiteral("person getting massage: light skin tone")})},
-{QStringLiteral("person getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FC"), QStringLiteral("massage_tone2"), QStringLiteral("person getting massage: medium-light skin tone")})},
-{QStringLiteral("person getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FD"), QStringLiteral("massage_tone3"), QStringLiteral("person getting massage: medium skin tone")})},
-{QStringLiteral("person getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FE"), QStringLiteral("massage_tone4"), QStringLiteral("person getting massage: medium-dark skin tone")})},
-{QStringLiteral("person getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FF"), QStringLiteral("massage_tone5"), QStringLiteral("person getting massage: dark skin tone")})},
-{QStringLiteral("man getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting massage: light skin tone"), QStringLiteral("man getting massage: light skin tone")})},
-{QStringLiteral("man getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting massage: medium-light skin tone"), QStringLiteral("man getting massage: medium-light skin tone")})},
-{QStringLiteral("man getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting massage: medium skin tone"), QStringLiteral("man getting massage: medium skin tone")})},
-{QStringLiteral("man getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting massage: medium-dark skin tone"), QStringLiteral("man getting massage: medium-dark skin tone")})},
-{QStringLiteral("man getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting massage: dark skin tone"), QStringLiteral("man getting massage: dark skin tone")})},
-{QStringLiteral("woman getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting massage: light skin tone"), QStringLiteral("woman getting massage: light skin tone")})},
-{QStringLiteral("woman getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting massage: medium-light skin tone"), QStringLiteral("woman getting massage: medium-light skin tone")})},
-{QStringLiteral("woman getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting massage: medium skin tone"), QStringLiteral("woman getting massage: medium skin tone")})},
-{QStringLiteral("woman getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting massage: medium-dark skin tone"), QStringLiteral("woman getting massage: medium-dark skin tone")})},
-{QStringLiteral("woman getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting massage: dark skin tone"), QStringLiteral("woman getting massage: dark skin tone")})},
-{QStringLiteral("person getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FB"), QStringLiteral("haircut_tone1"), QStringLiteral("person getting haircut: light skin tone")})},
-{QStringLiteral("person getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FC"), QStringLiteral("haircut_tone2"), QStringLiteral("person getting haircut: medium-light skin tone")})},
-{QStringLiteral("person getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FD"), QStringLiteral("haircut_tone3"), QStringLiteral("person getting haircut: medium skin tone")})},
-{QStringLiteral("person getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FE"), QStringLiteral("haircut_tone4"), QStringLiteral("person getting haircut: medium-dark skin tone")})},
-{QStringLiteral("person getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FF"), QStringLiteral("haircut_tone5"), QStringLiteral("person getting haircut: dark skin tone")})},
-{QStringLiteral("man getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting haircut: light skin tone"), QStringLiteral("man getting haircut: light skin tone")})},
-{QStringLiteral("man getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting haircut: medium-light skin tone"), QStringLiteral("man getting haircut: medium-light skin tone")})},
-{QStringLiteral("man getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting haircut: medium skin tone"), QStringLiteral("man getting haircut: medium skin tone")})},
-{QStringLiteral("man getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting haircut: medium-dark skin tone"), QStringLiteral("man getting haircut: medium-dark skin tone")})},
-{QStringLiteral("man getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting haircut: dark skin tone"), QStringLiteral("man getting haircut: dark skin tone")})},
-{QStringLiteral("woman getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting haircut: light skin tone"), QStringLiteral("woman getting haircut: light skin tone")})},
-{QStringLiteral("woman getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting haircut: medium-light skin tone"), QStringLiteral("woman getting haircut: medium-light skin tone")})},
-{QStringLiteral("woman getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting haircut: medium skin tone"), QStringLiteral("woman getting haircut: medium skin tone")})},
-{QStringLiteral("woman getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting haircut: medium-dark skin tone"), QStringLiteral("woman getting haircut: medium-dark skin tone")})},
-{QStringLiteral("woman getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting haircut: dark skin tone"), QStringLiteral("woman getting haircut: dark skin tone")})},
-{QStringLiteral("person walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FB"), QStringLiteral("walking_tone1"), QStringLiteral("person walking: light skin tone")})},
-{QStringLiteral("person walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FC"), QStringLiteral("walking_tone2"), QStringLiteral("person walking: medium-light skin tone")})},
-{QStringLiteral("person walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FD"), QStringLiteral("walking_tone3"), QStringLiteral("person walking: medium skin tone")})},
-{QStringLiteral("person walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FE"), QStringLiteral("walking_tone4"), QStringLiteral("person walking: medium-dark skin tone")})},
-{QStringLiteral("person walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FF"), QStringLiteral("walking_tone5"), QStringLiteral("person walking: dark skin tone")})},
-{QStringLiteral("man walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man walking: light skin tone"), QStringLiteral("man walking: light skin tone")})},
-{QStringLiteral("man walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man walking: medium-light skin tone"), QStringLiteral("man walking: medium-light skin tone")})},
-{QStringLiteral("man walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man walking: medium skin tone"), QStringLiteral("man walking: medium skin tone")})},
-{QStringLiteral("man walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man walking: medium-dark skin tone"), QStringLiteral("man walking: medium-dark skin tone")})},
-{QStringLiteral("man walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man walking: dark skin tone"), QStringLiteral("man walking: dark skin tone")})},
-{QStringLiteral("woman walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman walking: light skin tone"), QStringLiteral("woman walking: light skin tone")})},
-{QStringLiteral("woman walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman walking: medium-light skin tone"), QStringLiteral("woman walking: medium-light skin tone")})},
-{QStringLiteral("woman walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman walking: medium skin tone"), QStringLiteral("woman walking: medium skin tone")})},
-{QStringLiteral("woman walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman walking: medium-dark skin tone"), QStringLiteral("woman walking: medium-dark skin tone")})},
-{QStringLiteral("woman walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman walking: dark skin tone"), QStringLiteral("woman walking: dark skin tone")})},
-{QStringLiteral("person standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FB"), QStringLiteral("person standing: light skin tone"), QStringLiteral("person standing: light skin tone")})},
-{QStringLiteral("person standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FC"), QStringLiteral("person standing: medium-light skin tone"), QStringLiteral("person standing: medium-light skin tone")})},
-{QStringLiteral("person standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FD"), QStringLiteral("person standing: medium skin tone"), QStringLiteral("person standing: medium skin tone")})},
-{QStringLiteral("person standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FE"), QStringLiteral("person standing: medium-dark skin tone"), QStringLiteral("person standing: medium-dark skin tone")})},
-{QStringLiteral("person standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FF"), QStringLiteral("person standing: dark skin tone"), QStringLiteral("person standing: dark skin tone")})},
-{QStringLiteral("man standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man standing: light skin tone"), QStringLiteral("man standing: light skin tone")})},
-{QStringLiteral("man standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man standing: medium-light skin tone"), QStringLiteral("man standing: medium-light skin tone")})},
-{QStringLiteral("man standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man standing: medium skin tone"), QStringLiteral("man standing: medium skin tone")})},
-{QStringLiteral("man standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man standing: medium-dark skin tone"), QStringLiteral("man standing: medium-dark skin tone")})},
-{QStringLiteral("man standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man standing: dark skin tone"), QStringLiteral("man standing: dark skin tone")})},
-{QStringLiteral("woman standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman standing: light skin tone"), QStringLiteral("woman standing: light skin tone")})},
-{QStringLiteral("woman standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman standing: medium-light skin tone"), QStringLiteral("woman standing: medium-light skin tone")})},
-{QStringLiteral("woman standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman standing: medium skin tone"), QStringLiteral("woman standing: medium skin tone")})},
-{QStringLiteral("woman standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman standing: medium-dark skin tone"), QStringLiteral("woman standing: medium-dark skin tone")})},
-{QStringLiteral("woman standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman standing: dark skin tone"), QStringLiteral("woman standing: dark skin tone")})},
-{QStringLiteral("person kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FB"), QStringLiteral("person kneeling: light skin tone"), QStringLiteral("person kneeling: light skin tone")})},
-{QStringLiteral("person kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FC"), QStringLiteral("person kneeling: medium-light skin tone"), QStringLiteral("person kneeling: medium-light skin tone")})},
-{QStringLiteral("person kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FD"), QStringLiteral("person kneeling: medium skin tone"), QStringLiteral("person kneeling: medium skin tone")})},
-{QStringLiteral("person kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FE"), QStringLiteral("person kneeling: medium-dark skin tone"), QStringLiteral("person kneeling: medium-dark skin tone")})},
-{QStringLiteral("person kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FF"), QStringLiteral("person kneeling: dark skin tone"), QStringLiteral("person kneeling: dark skin tone")})},
-{QStringLiteral("man kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man kneeling: light skin tone"), QStringLiteral("man kneeling: light skin tone")})},
-{QStringLiteral("man kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man kneeling: medium-light skin tone"), QStringLiteral("man kneeling: medium-light skin tone")})},
-{QStringLiteral("man kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man kneeling: medium skin tone"), QStringLiteral("man kneeling: medium skin tone")})},
-{QStringLiteral("man kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man kneeling: medium-dark skin tone"), QStringLiteral("man kneeling: medium-dark skin tone")})},
-{QStringLiteral("man kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man kneeling: dark skin tone"), QStringLiteral("man kneeling: dark skin tone")})},
-{QStringLiteral("woman kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman kneeling: light skin tone"), QStringLiteral("woman kneeling: light skin tone")})},
-{QStringLiteral("woman kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman kneeling: medium-light skin tone"), QStringLiteral("woman kneeling: medium-light skin tone")})},
-{QStringLiteral("woman kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman kneeling: medium skin tone"), QStringLiteral("woman kneeling: medium skin tone")})},
-{QStringLiteral("woman kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman kneeling: medium-dark skin tone"), QStringLiteral("woman kneeling: medium-dark skin tone")})},
-{QStringLiteral("woman kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman kneeling: dark skin tone"), QStringLiteral("woman kneeling: dark skin tone")})},
-{QStringLiteral("person with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9AF"), QStringLiteral("person with white cane: light skin tone"), QStringLiteral("person with white cane: light skin tone")})},
-{QStringLiteral("person with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9AF"), QStringLiteral("person with white cane: medium-light skin tone"), QStringLiteral("person with white cane: medium-light skin tone")})},
-{QStringLiteral("person with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9AF"), QStringLiteral("person with white cane: medium skin tone"), QStringLiteral("person with white cane: medium skin tone")})},
-{QStringLiteral("person with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9AF"), QStringLiteral("person with white cane: medium-dark skin tone"), QStringLiteral("person with white cane: medium-dark skin tone")})},
-{QStringLiteral("person with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9AF"), QStringLiteral("person with white cane: dark skin tone"), QStringLiteral("person with white cane: dark skin tone")})},
-{QStringLiteral("man with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9AF"), QStringLiteral("man with white cane: light skin tone"), QStringLiteral("man with white cane: light skin tone")})},
-{QStringLiteral("man with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9AF"), QStringLiteral("man with white cane: medium-light skin tone"), QStringLiteral("man with white cane: medium-light skin tone")})},
-{QStringLiteral("man with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9AF"), QStringLiteral("man with white cane: medium skin tone"), QStringLiteral("man with white cane: medium skin tone")})},
-{QStringLiteral("man with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9AF"), QStringLiteral("man with white cane: medium-dark skin tone"), QStringLiteral("man with white cane: medium-dark skin tone")})},
-{QStringLiteral("man with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9AF"), QStringLiteral("man with white cane: dark skin tone"), QStringLiteral("man with white cane: dark skin tone")})},
-{QStringLiteral("woman with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9AF"), QStringLiteral("woman with white cane: light skin tone"), QStringLiteral("woman with white cane: light skin tone")})},
-{QStringLiteral("woman with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9AF"), QStringLiteral("woman with white cane: medium-light skin tone"), QStringLiteral("woman with white cane: medium-light skin tone")})},
-{QStringLiteral("woman with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9AF"), QStringLiteral("woman with white cane: medium skin tone"), QStringLiteral("woman with white cane: medium skin tone")})},
-{QStringLiteral("woman with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9AF"), QStringLiteral("woman with white cane: medium-dark skin tone"), QStringLiteral("woman with white cane: medium-dark skin tone")})},
-{QStringLiteral("woman with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9AF"), QStringLiteral("woman with white cane: dark skin tone"), QStringLiteral("woman with white cane: dark skin tone")})},
-{QStringLiteral("person in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9BC"), QStringLiteral("person in motorized wheelchair: light skin tone"), QStringLiteral("person in motorized wheelchair: light skin tone")})},
-{QStringLiteral("person in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9BC"), QStringLiteral("person in motorized wheelchair: medium-light skin tone"), QStringLiteral("person in motorized wheelchair: medium-light skin tone")})},
-{QStringLiteral("person in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9BC"), QStringLiteral("person in motorized wheelchair: medium skin tone"), QStringLiteral("person in motorized wheelchair: medium skin tone")})},
-{QStringLiteral("person in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9BC"), QStringLiteral("person in motorized wheelchair: medium-dark skin tone"), QStringLiteral("person in motorized wheelchair: medium-dark skin tone")})},
-{QStringLiteral("person in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9BC"), QStringLiteral("person in motorized wheelchair: dark skin tone"), QStringLiteral("person in motorized wheelchair: dark skin tone")})},
-{QStringLiteral("man in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9BC"), QStringLiteral("man in motorized wheelchair: light skin tone"), QStringLiteral("man in motorized wheelchair: light skin tone")})},
-{QStringLiteral("man in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9BC"), QStringLiteral("man in motorized wheelchair: medium-light skin tone"), QStringLiteral("man in motorized wheelchair: medium-light skin tone")})},
-{QStringLiteral("man in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9BC"), QStringLiteral("man in motorized wheelchair: medium skin tone"), QStringLiteral("man in motorized wheelchair: medium skin tone")})},
-{QStringLiteral("man in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9BC"), QStringLiteral("man in motorized wheelchair: medium-dark skin tone"), QStringLiteral("man in motorized wheelchair: medium-dark skin tone")})},
-{QStringLiteral("man in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9BC"), QStringLiteral("man in motorized wheelchair: dark skin tone"), QStringLiteral("man in motorized wheelchair: dark skin tone")})},
-{QStringLiteral("woman in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9BC"), QStringLiteral("woman in motorized wheelchair: light skin tone"), QStringLiteral("woman in motorized wheelchair: light skin tone")})},
-{QStringLiteral("woman in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9BC"), QStringLiteral("woman in motorized wheelchair: medium-light skin tone"), QStringLiteral("woman in motorized wheelchair: medium-light skin tone")})},
-{QStringLiteral("woman in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9BC"), QStringLiteral("woman in motorized wheelchair: medium skin tone"), QStringLiteral("woman in motorized wheelchair: medium skin tone")})},
-{QStringLiteral("woman in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9BC"), QStringLiteral("woman in motorized wheelchair: medium-dark skin tone"), QStringLiteral("woman in motorized wheelchair: medium-dark skin tone")})},
-{QStringLiteral("woman in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9BC"), QStringLiteral("woman in motorized wheelchair: dark skin tone"), QStringLiteral("woman in motorized wheelchair: dark skin tone")})},
-{QStringLiteral("person in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9BD"), QStringLiteral("person in manual wheelchair: light skin tone"), QStringLiteral("person in manual wheelchair: light skin tone")})},
-{QStringLiteral("person in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9BD"), QStringLiteral("person in manual wheelchair: medium-light skin tone"), QStringLiteral("person in manual wheelchair: medium-light skin tone")})},
-{QStringLiteral("person in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9BD"), QStringLiteral("person in manual wheelchair: medium skin tone"), QStringLiteral("person in manual wheelchair: medium skin tone")})},
-{QStringLiteral("person in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9BD"), QStringLiteral("person in manual wheelchair: medium-dark skin tone"), QStringLiteral("person in manual wheelchair: medium-dark skin tone")})},
-{QStringLiteral("person in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9BD"), QStringLiteral("person in manual wheelchair: dark skin tone"), QStringLiteral("person in manual wheelchair: dark skin tone")})},
-{QStringLiteral("man in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9BD"), QStringLiteral("man in manual wheelchair: light skin tone"), QStringLiteral("man in manual wheelchair: light skin tone")})},
-{QStringLiteral("man in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9BD"), QStringLiteral("man in manual wheelchair: medium-light skin tone"), QStringLiteral("man in manual wheelchair: medium-light skin tone")})},
-{QStringLiteral("man in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9BD"), QStringLiteral("man in manual wheelchair: medium skin tone"), QStringLiteral("man in manual wheelchair: medium skin tone")})},
-{QStringLiteral("man in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9BD"), QStringLiteral("man in manual wheelchair: medium-dark skin tone"), QStringLiteral("man in manual wheelchair: medium-dark skin tone")})},
-{QStringLiteral("man in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9BD"), QStringLiteral("man in manual wheelchair: dark skin tone"), QStringLiteral("man in manual wheelchair: dark skin tone")})},
-{QStringLiteral("woman in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9BD"), QStringLiteral("woman in manual wheelchair: light skin tone"), QStringLiteral("woman in manual wheelchair: light skin tone")})},
-{QStringLiteral("woman in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9BD"), QStringLiteral("woman in manual wheelchair: medium-light skin tone"), QStringLiteral("woman in manual wheelchair: medium-light skin tone")})},
-{QStringLiteral("woman in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9BD"), QStringLiteral("woman in manual wheelchair: medium skin tone"), QStringLiteral("woman in manual wheelchair: medium skin tone")})},
-{QStringLiteral("woman in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9BD"), QStringLiteral("woman in manual wheelchair: medium-dark skin tone"), QStringLiteral("woman in manual wheelchair: medium-dark skin tone")})},
-{QStringLiteral("woman in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9BD"), QStringLiteral("woman in manual wheelchair: dark skin tone"), QStringLiteral("woman in manual wheelchair: dark skin tone")})},
-{QStringLiteral("person running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FB"), QStringLiteral("runner_tone1"), QStringLiteral("person running: light skin tone")})},
-{QStringLiteral("person running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FC"), QStringLiteral("runner_tone2"), QStringLiteral("person running: medium-light skin tone")})},
-{QStringLiteral("person running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FD"), QStringLiteral("runner_tone3"), QStringLiteral("person running: medium skin tone")})},
-{QStringLiteral("person running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FE"), QStringLiteral("runner_tone4"), QStringLiteral("person running: medium-dark skin tone")})},
-{QStringLiteral("person running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FF"), QStringLiteral("runner_tone5"), QStringLiteral("person running: dark skin tone")})},
-{QStringLiteral("man running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man running: light skin tone"), QStringLiteral("man running: light skin tone")})},
-{QStringLiteral("man running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man running: medium-light skin tone"), QStringLiteral("man running: medium-light skin tone")})},
-{QStringLiteral("man running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man running: medium skin tone"), QStringLiteral("man running: medium skin tone")})},
-{QStringLiteral("man running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man running: medium-dark skin tone"), QStringLiteral("man running: medium-dark skin tone")})},
-{QStringLiteral("man running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man running: dark skin tone"), QStringLiteral("man running: dark skin tone")})},
-{QStringLiteral("woman running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman running: light skin tone"), QStringLiteral("woman running: light skin tone")})},
-{QStringLiteral("woman running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman running: medium-light skin tone"), QStringLiteral("woman running: medium-light skin tone")})},
-{QStringLiteral("woman running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman running: medium skin tone"), QStringLiteral("woman running: medium skin tone")})},
-{QStringLiteral("woman running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman running: medium-dark skin tone"), QStringLiteral("woman running: medium-dark skin tone")})},
-{QStringLiteral("woman running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman running: dark skin tone"), QStringLiteral("woman running: dark skin tone")})},
-{QStringLiteral("woman dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F483\U0001F3FB"), QStringLiteral("dancer_tone1"), QStringLiteral("woman dancing: light skin tone")})},
-{QStringLiteral("woman dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F483\U0001F3FC"), QStringLiteral("dancer_tone2"), QStringLiteral("woman dancing: medium-light skin tone")})},
-{QStringLiteral("woman dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F483\U0001F3FD"), QStringLiteral("dancer_tone3"), QStringLiteral("woman dancing: medium skin tone")})},
-{QStringLiteral("woman dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F483\U0001F3FE"), QStringLiteral("dancer_tone4"), QStringLiteral("woman dancing: medium-dark skin tone")})},
-{QStringLiteral("woman dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F483\U0001F3FF"), QStringLiteral("dancer_tone5"), QStringLiteral("woman dancing: dark skin tone")})},
-{QStringLiteral("man dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F57A\U0001F3FB"), QStringLiteral("man_dancing_tone1"), QStringLiteral("man dancing: light skin tone")})},
-{QStringLiteral("man dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F57A\U0001F3FC"), QStringLiteral("man_dancing_tone2"), QStringLiteral("man dancing: medium-light skin tone")})},
-{QStringLiteral("man dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F57A\U0001F3FD"), QStringLiteral("man_dancing_tone3"), QStringLiteral("man dancing: medium skin tone")})},
-{QStringLiteral("man dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F57A\U0001F3FE"), QStringLiteral("man_dancing_tone4"), QStringLiteral("man dancing: medium-dark skin tone")})},
-{QStringLiteral("man dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F57A\U0001F3FF"), QStringLiteral("man_dancing_tone5"), QStringLiteral("man dancing: dark skin tone")})},
-{QStringLiteral("person in suit levitating"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F574\U0001F3FB"), QStringLiteral("levitate_tone1"), QStringLiteral("person in suit levitating: light skin tone")})},
-{QStringLiteral("person in suit levitating"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F574\U0001F3FC"), QStringLiteral("levitate_tone2"), QStringLiteral("person in suit levitating: medium-light skin tone")})},
-{QStringLiteral("person in suit levitating"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F574\U0001F3FD"), QStringLiteral("levitate_tone3"), QStringLiteral("person in suit levitating: medium skin tone")})},
-{QStringLiteral("person in suit levitating"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F574\U0001F3FE"), QStringLiteral("levitate_tone4"), QStringLiteral("person in suit levitating: medium-dark skin tone")})},
-{QStringLiteral("person in suit levitating"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F574\U0001F3FF"), QStringLiteral("levitate_tone5"), QStringLiteral("person in suit levitating: dark skin tone")})},
-{QStringLiteral("person in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FB"), QStringLiteral("person_in_steamy_room_tone1"), QStringLiteral("person in steamy room: light skin tone")})},
-{QStringLiteral("person in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FC"), QStringLiteral("person_in_steamy_room_tone2"), QStringLiteral("person in steamy room: medium-light skin tone")})},
-{QStringLiteral("person in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FD"), QStringLiteral("person_in_steamy_room_tone3"), QStringLiteral("person in steamy room: medium skin tone")})},
-{QStringLiteral("person in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FE"), QStringLiteral("person_in_steamy_room_tone4"), QStringLiteral("person in steamy room: medium-dark skin tone")})},
-{QStringLiteral("person in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FF"), QStringLiteral("person_in_steamy_room_tone5"), QStringLiteral("person in steamy room: dark skin tone")})},
-{QStringLiteral("man in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in steamy room: light skin tone"), QStringLiteral("man in steamy room: light skin tone")})},
-{QStringLiteral("man in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in steamy room: medium-light skin tone"), QStringLiteral("man in steamy room: medium-light skin tone")})},
-{QStringLiteral("man in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in steamy room: medium skin tone"), QStringLiteral("man in steamy room: medium skin tone")})},
-{QStringLiteral("man in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in steamy room: medium-dark skin tone"), QStringLiteral("man in steamy room: medium-dark skin tone")})},
-{QStringLiteral("man in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in steamy room: dark skin tone"), QStringLiteral("man in steamy room: dark skin tone")})},
-{QStringLiteral("woman in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in steamy room: light skin tone"), QStringLiteral("woman in steamy room: light skin tone")})},
-{QStringLiteral("woman in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in steamy room: medium-light skin tone"), QStringLiteral("woman in steamy room: medium-light skin tone")})},
-{QStringLiteral("woman in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in steamy room: medium skin tone"), QStringLiteral("woman in steamy room: medium skin tone")})},
-{QStringLiteral("woman in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in steamy room: medium-dark skin tone"), QStringLiteral("woman in steamy room: medium-dark skin tone")})},
-{QStringLiteral("woman in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in steamy room: dark skin tone"), QStringLiteral("woman in steamy room: dark skin tone")})},
-{QStringLiteral("person climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FB"), QStringLiteral("person_climbing_tone1"), QStringLiteral("person climbing: light skin tone")})},
-{QStringLiteral("person climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FC"), QStringLiteral("person_climbing_tone2"), QStringLiteral("person climbing: medium-light skin tone")})},
-{QStringLiteral("person climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FD"), QStringLiteral("person_climbing_tone3"), QStringLiteral("person climbing: medium skin tone")})},
-{QStringLiteral("person climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FE"), QStringLiteral("person_climbing_tone4"), QStringLiteral("person climbing: medium-dark skin tone")})},
-{QStringLiteral("person climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FF"), QStringLiteral("person_climbing_tone5"), QStringLiteral("person climbing: dark skin tone")})},
-{QStringLiteral("man climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man climbing: light skin tone"), QStringLiteral("man climbing: light skin tone")})},
-{QStringLiteral("man climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man climbing: medium-light skin tone"), QStringLiteral("man climbing: medium-light skin tone")})},
-{QStringLiteral("man climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man climbing: medium skin tone"), QStringLiteral("man climbing: medium skin tone")})},
-{QStringLiteral("man climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man climbing: medium-dark skin tone"), QStringLiteral("man climbing: medium-dark skin tone")})},
-{QStringLiteral("man climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man climbing: dark skin tone"), QStringLiteral("man climbing: dark skin tone")})},
-{QStringLiteral("woman climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman climbing: light skin tone"), QStringLiteral("woman climbing: light skin tone")})},
-{QStringLiteral("woman climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman climbing: medium-light skin tone"), QStringLiteral("woman climbing: medium-light skin tone")})},
-{QStringLiteral("woman climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman climbing: medium skin tone"), QStringLiteral("woman climbing: medium skin tone")})},
-{QStringLiteral("woman climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman climbing: medium-dark skin tone"), QStringLiteral("woman climbing: medium-dark skin tone")})},
-{QStringLiteral("woman climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman climbing: dark skin tone"), QStringLiteral("woman climbing: dark skin tone")})},
-{QStringLiteral("horse racing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C7\U0001F3FB"), QStringLiteral("horse_racing_tone1"), QStringLiteral("horse racing: light skin tone")})},
-{QStringLiteral("horse racing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C7\U0001F3FC"), QStringLiteral("horse_racing_tone2"), QStringLiteral("horse racing: medium-light skin tone")})},
-{QStringLiteral("horse racing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C7\U0001F3FD"), QStringLiteral("horse_racing_tone3"), QStringLiteral("horse racing: medium skin tone")})},
-{QStringLiteral("horse racing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C7\U0001F3FE"), QStringLiteral("horse_racing_tone4"), QStringLiteral("horse racing: medium-dark skin tone")})},
-{QStringLiteral("horse racing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C7\U0001F3FF"), QStringLiteral("horse_racing_tone5"), QStringLiteral("horse racing: dark skin tone")})},
-{QStringLiteral("snowboarder"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C2\U0001F3FB"), QStringLiteral("snowboarder_tone1"), QStringLiteral("snowboarder: light skin tone")})},
-{QStringLiteral("snowboarder"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C2\U0001F3FC"), QStringLiteral("snowboarder_tone2"), QStringLiteral("snowboarder: medium-light skin tone")})},
-{QStringLiteral("snowboarder"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C2\U0001F3FD"), QStringLiteral("snowboarder_tone3"), QStringLiteral("snowboarder: medium skin tone")})},
-{QStringLiteral("snowboarder"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C2\U0001F3FE"), QStringLiteral("snowboarder_tone4"), QStringLiteral("snowboarder: medium-dark skin tone")})},
-{QStringLiteral("snowboarder"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C2\U0001F3FF"), QStringLiteral("snowboarder_tone5"), QStringLiteral("snowboarder: dark skin tone")})},
-{QStringLiteral("person golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FB"), QStringLiteral("person_golfing_tone1"), QStringLiteral("person golfing: light skin tone")})},
-{QStringLiteral("person golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FC"), QStringLiteral("person_golfing_tone2"), QStringLiteral("person golfing: medium-light skin tone")})},
-{QStringLiteral("person golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FD"), QStringLiteral("person_golfing_tone3"), QStringLiteral("person golfing: medium skin tone")})},
-{QStringLiteral("person golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FE"), QStringLiteral("person_golfing_tone4"), QStringLiteral("person golfing: medium-dark skin tone")})},
-{QStringLiteral("person golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FF"), QStringLiteral("person_golfing_tone5"), QStringLiteral("person golfing: dark skin tone")})},
-{QStringLiteral("man golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man golfing: light skin tone"), QStringLiteral("man golfing: light skin tone")})},
-{QStringLiteral("man golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man golfing: medium-light skin tone"), QStringLiteral("man golfing: medium-light skin tone")})},
-{QStringLiteral("man golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man golfing: medium skin tone"), QStringLiteral("man golfing: medium skin tone")})},
-{QStringLiteral("man golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man golfing: medium-dark skin tone"), QStringLiteral("man golfing: medium-dark skin tone")})},
-{QStringLiteral("man golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man golfing: dark skin tone"), QStringLiteral("man golfing: dark skin tone")})},
-{QStringLiteral("woman golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman golfing: light skin tone"), QStringLiteral("woman golfing: light skin tone")})},
-{QStringLiteral("woman golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman golfing: medium-light skin tone"), QStringLiteral("woman golfing: medium-light skin tone")})},
-{QStringLiteral("woman golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman golfing: medium skin tone"), QStringLiteral("woman golfing: medium skin tone")})},
-{QStringLiteral("woman golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman golfing: medium-dark skin tone"), QStringLiteral("woman golfing: medium-dark skin tone")})},
-{QStringLiteral("woman golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman golfing: dark skin tone"), QStringLiteral("woman golfing: dark skin tone")})},
-{QStringLiteral("person surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FB"), QStringLiteral("surfer_tone1"), QStringLiteral("person surfing: light skin tone")})},
-{QStringLiteral("person surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FC"), QStringLiteral("surfer_tone2"), QStringLiteral("person surfing: medium-light skin tone")})},
-{QStringLiteral("person surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FD"), QStringLiteral("surfer_tone3"), QStringLiteral("person surfing: medium skin tone")})},
-{QStringLiteral("person surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FE"), QStringLiteral("surfer_tone4"), QStringLiteral("person surfing: medium-dark skin tone")})},
-{QStringLiteral("person surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FF"), QStringLiteral("surfer_tone5"), QStringLiteral("person surfing: dark skin tone")})},
-{QStringLiteral("man surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man surfing: light skin tone"), QStringLiteral("man surfing: light skin tone")})},
-{QStringLiteral("man surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man surfing: medium-light skin tone"), QStringLiteral("man surfing: medium-light skin tone")})},
-{QStringLiteral("man surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man surfing: medium skin tone"), QStringLiteral("man surfing: medium skin tone")})},
-{QStringLiteral("man surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man surfing: medium-dark skin tone"), QStringLiteral("man surfing: medium-dark skin tone")})},
-{QStringLiteral("man surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man surfing: dark skin tone"), QStringLiteral("man surfing: dark skin tone")})},
-{QStringLiteral("woman surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman surfing: light skin tone"), QStringLiteral("woman surfing: light skin tone")})},
-{QStringLiteral("woman surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman surfing: medium-light skin tone"), QStringLiteral("woman surfing: medium-light skin tone")})},
-{QStringLiteral("woman surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman surfing: medium skin tone"), QStringLiteral("woman surfing: medium skin tone")})},
-{QStringLiteral("woman surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman surfing: medium-dark skin tone"), QStringLiteral("woman surfing: medium-dark skin tone")})},
-{QStringLiteral("woman surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman surfing: dark skin tone"), QStringLiteral("woman surfing: dark skin tone")})},
-{QStringLiteral("person rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FB"), QStringLiteral("rowboat_tone1"), QStringLiteral("person rowing boat: light skin tone")})},
-{QStringLiteral("person rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FC"), QStringLiteral("rowboat_tone2"), QStringLiteral("person rowing boat: medium-light skin tone")})},
-{QStringLiteral("person rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FD"), QStringLiteral("rowboat_tone3"), QStringLiteral("person rowing boat: medium skin tone")})},
-{QStringLiteral("person rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FE"), QStringLiteral("rowboat_tone4"), QStringLiteral("person rowing boat: medium-dark skin tone")})},
-{QStringLiteral("person rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FF"), QStringLiteral("rowboat_tone5"), QStringLiteral("person rowing boat: dark skin tone")})},
-{QStringLiteral("man rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man rowing boat: light skin tone"), QStringLiteral("man rowing boat: light skin tone")})},
-{QStringLiteral("man rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man rowing boat: medium-light skin tone"), QStringLiteral("man rowing boat: medium-light skin tone")})},
-{QStringLiteral("man rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man rowing boat: medium skin tone"), QStringLiteral("man rowing boat: medium skin tone")})},
-{QStringLiteral("man rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man rowing boat: medium-dark skin tone"), QStringLiteral("man rowing boat: medium-dark skin tone")})},
-{QStringLiteral("man rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man rowing boat: dark skin tone"), QStringLiteral("man rowing boat: dark skin tone")})},
-{QStringLiteral("woman rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman rowing boat: light skin tone"), QStringLiteral("woman rowing boat: light skin tone")})},
-{QStringLiteral("woman rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman rowing boat: medium-light skin tone"), QStringLiteral("woman rowing boat: medium-light skin tone")})},
-{QStringLiteral("woman rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman rowing boat: medium skin tone"), QStringLiteral("woman rowing boat: medium skin tone")})},
-{QStringLiteral("woman rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman rowing boat: medium-dark skin tone"), QStringLiteral("woman rowing boat: medium-dark skin tone")})},
-{QStringLiteral("woman rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman rowing boat: dark skin tone"), QStringLiteral("woman rowing boat: dark skin tone")})},
-{QStringLiteral("person swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FB"), QStringLiteral("swimmer_tone1"), QStringLiteral("person swimming: light skin tone")})},
-{QStringLiteral("person swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FC"), QStringLiteral("swimmer_tone2"), QStringLiteral("person swimming: medium-light skin tone")})},
-{QStringLiteral("person swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FD"), QStringLiteral("swimmer_tone3"), QStringLiteral("person swimming: medium skin tone")})},
-{QStringLiteral("person swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FE"), QStringLiteral("swimmer_tone4"), QStringLiteral("person swimming: medium-dark skin tone")})},
-{QStringLiteral("person swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FF"), QStringLiteral("swimmer_tone5"), QStringLiteral("person swimming: dark skin tone")})},
-{QStringLiteral("man swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man swimming: light skin tone"), QStringLiteral("man swimming: light skin tone")})},
-{QStringLiteral("man swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man swimming: medium-light skin tone"), QStringLiteral("man swimming: medium-light skin tone")})},
-{QStringLiteral("man swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man swimming: medium skin tone"), QStringLiteral("man swimming: medium skin tone")})},
-{QStringLiteral("man swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man swimming: medium-dark skin tone"), QStringLiteral("man swimming: medium-dark skin tone")})},
-{QStringLiteral("man swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man swimming: dark skin tone"), QStringLiteral("man swimming: dark skin tone")})},
-{QStringLiteral("woman swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman swimming: light skin tone"), QStringLiteral("woman swimming: light skin tone")})},
-{QStringLiteral("woman swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman swimming: medium-light skin tone"), QStringLiteral("woman swimming: medium-light skin tone")})},
-{QStringLiteral("woman swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman swimming: medium skin tone"), QStringLiteral("woman swimming: medium skin tone")})},
-{QStringLiteral("woman swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman swimming: medium-dark skin tone"), QStringLiteral("woman swimming: medium-dark skin tone")})},
-{QStringLiteral("woman swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman swimming: dark skin tone"), QStringLiteral("woman swimming: dark skin tone")})},
-{QStringLiteral("person bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FB"), QStringLiteral("basketball_player_tone1"), QStringLiteral("person bouncing ball: light skin tone")})},
-{QStringLiteral("person bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FC"), QStringLiteral("basketball_player_tone2"), QStringLiteral("person bouncing ball: medium-light skin tone")})},
-{QStringLiteral("person bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FD"), QStringLiteral("basketball_player_tone3"), QStringLiteral("person bouncing ball: medium skin tone")})},
-{QStringLiteral("person bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FE"), QStringLiteral("basketball_player_tone4"), QStringLiteral("person bouncing ball: medium-dark skin tone")})},
-{QStringLiteral("person bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FF"), QStringLiteral("basketball_player_tone5"), QStringLiteral("person bouncing ball: dark skin tone")})},
-{QStringLiteral("man bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bouncing ball: light skin tone"), QStringLiteral("man bouncing ball: light skin tone")})},
-{QStringLiteral("man bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bouncing ball: medium-light skin tone"), QStringLiteral("man bouncing ball: medium-light skin tone")})},
-{QStringLiteral("man bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bouncing ball: medium skin tone"), QStringLiteral("man bouncing ball: medium skin tone")})},
-{QStringLiteral("man bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bouncing ball: medium-dark skin tone"), QStringLiteral("man bouncing ball: medium-dark skin tone")})},
-{QStringLiteral("man bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bouncing ball: dark skin tone"), QStringLiteral("man bouncing ball: dark skin tone")})},
-{QStringLiteral("woman bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bouncing ball: light skin tone"), QStringLiteral("woman bouncing ball: light skin tone")})},
-{QStringLiteral("woman bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bouncing ball: medium-light skin tone"), QStringLiteral("woman bouncing ball: medium-light skin tone")})},
-{QStringLiteral("woman bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bouncing ball: medium skin tone"), QStringLiteral("woman bouncing ball: medium skin tone")})},
-{QStringLiteral("woman bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bouncing ball: medium-dark skin tone"), QStringLiteral("woman bouncing ball: medium-dark skin tone")})},
-{QStringLiteral("woman bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bouncing ball: dark skin tone"), QStringLiteral("woman bouncing ball: dark skin tone")})},
-{QStringLiteral("person lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FB"), QStringLiteral("lifter_tone1"), QStringLiteral("person lifting weights: light skin tone")})},
-{QStringLiteral("person lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FC"), QStringLiteral("lifter_tone2"), QStringLiteral("person lifting weights: medium-light skin tone")})},
-{QStringLiteral("person lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FD"), QStringLiteral("lifter_tone3"), QStringLiteral("person lifting weights: medium skin tone")})},
-{QStringLiteral("person lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FE"), QStringLiteral("lifter_tone4"), QStringLiteral("person lifting weights: medium-dark skin tone")})},
-{QStringLiteral("person lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FF"), QStringLiteral("lifter_tone5"), QStringLiteral("person lifting weights: dark skin tone")})},
-{QStringLiteral("man lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man lifting weights: light skin tone"), QStringLiteral("man lifting weights: light skin tone")})},
-{QStringLiteral("man lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man lifting weights: medium-light skin tone"), QStringLiteral("man lifting weights: medium-light skin tone")})},
-{QStringLiteral("man lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man lifting weights: medium skin tone"), QStringLiteral("man lifting weights: medium skin tone")})},
-{QStringLiteral("man lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man lifting weights: medium-dark skin tone"), QStringLiteral("man lifting weights: medium-dark skin tone")})},
-{QStringLiteral("man lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man lifting weights: dark skin tone"), QStringLiteral("man lifting weights: dark skin tone")})},
-{QStringLiteral("woman lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman lifting weights: light skin tone"), QStringLiteral("woman lifting weights: light skin tone")})},
-{QStringLiteral("woman lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman lifting weights: medium-light skin tone"), QStringLiteral("woman lifting weights: medium-light skin tone")})},
-{QStringLiteral("woman lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman lifting weights: medium skin tone"), QStringLiteral("woman lifting weights: medium skin tone")})},
-{QStringLiteral("woman lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman lifting weights: medium-dark skin tone"), QStringLiteral("woman lifting weights: medium-dark skin tone")})},
-{QStringLiteral("woman lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman lifting weights: dark skin tone"), QStringLiteral("woman lifting weights: dark skin tone")})},
-{QStringLiteral("person biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FB"), QStringLiteral("bicyclist_tone1"), QStringLiteral("person biking: light skin tone")})},
-{QStringLiteral("person biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FC"), QStringLiteral("bicyclist_tone2"), QStringLiteral("person biking: medium-light skin tone")})},
-{QStringLiteral("person biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FD"), QStringLiteral("bicyclist_tone3"), QStringLiteral("person biking: medium skin tone")})},
-{QStringLiteral("person biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FE"), QStringLiteral("bicyclist_tone4"), QStringLiteral("person biking: medium-dark skin tone")})},
-{QStringLiteral("person biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FF"), QStringLiteral("bicyclist_tone5"), QStringLiteral("person biking: dark skin tone")})},
-{QStringLiteral("man biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man biking: light skin tone"), QStringLiteral("man biking: light skin tone")})},
-{QStringLiteral("man biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man biking: medium-light skin tone"), QStringLiteral("man biking: medium-light skin tone")})},
-{QStringLiteral("man biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man biking: medium skin tone"), QStringLiteral("man biking: medium skin tone")})},
-{QStringLiteral("man biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man biking: medium-dark skin tone"), QStringLiteral("man biking: medium-dark skin tone")})},
-{QStringLiteral("man biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man biking: dark skin tone"), QStringLiteral("man biking: dark skin tone")})},
-{QStringLiteral("woman biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman biking: light skin tone"), QStringLiteral("woman biking: light skin tone")})},
-{QStringLiteral("woman biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman biking: medium-light skin tone"), QStringLiteral("woman biking: medium-light skin tone")})},
-{QStringLiteral("woman biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman biking: medium skin tone"), QStringLiteral("woman biking: medium skin tone")})},
-{QStringLiteral("woman biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman biking: medium-dark skin tone"), QStringLiteral("woman biking: medium-dark skin tone")})},
-{QStringLiteral("woman biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman biking: dark skin tone"), QStringLiteral("woman biking: dark skin tone")})},
-{QStringLiteral("person mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FB"), QStringLiteral("mountain_bicyclist_tone1"), QStringLiteral("person mountain biking: light skin tone")})},
-{QStringLiteral("person mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FC"), QStringLiteral("mountain_bicyclist_tone2"), QStringLiteral("person mountain biking: medium-light skin tone")})},
-{QStringLiteral("person mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FD"), QStringLiteral("mountain_bicyclist_tone3"), QStringLiteral("person mountain biking: medium skin tone")})},
-{QStringLiteral("person mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FE"), QStringLiteral("mountain_bicyclist_tone4"), QStringLiteral("person mountain biking: medium-dark skin tone")})},
-{QStringLiteral("person mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FF"), QStringLiteral("mountain_bicyclist_tone5"), QStringLiteral("person mountain biking: dark skin tone")})},
-{QStringLiteral("man mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mountain biking: light skin tone"), QStringLiteral("man mountain biking: light skin tone")})},
-{QStringLiteral("man mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mountain biking: medium-light skin tone"), QStringLiteral("man mountain biking: medium-light skin tone")})},
-{QStringLiteral("man mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mountain biking: medium skin tone"), QStringLiteral("man mountain biking: medium skin tone")})},
-{QStringLiteral("man mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mountain biking: medium-dark skin tone"), QStringLiteral("man mountain biking: medium-dark skin tone")})},
-{QStringLiteral("man mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mountain biking: dark skin tone"), QStringLiteral("man mountain biking: dark skin tone")})},
-{QStringLiteral("woman mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mountain biking: light skin tone"), QStringLiteral("woman mountain biking: light skin tone")})},
-{QStringLiteral("woman mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mountain biking: medium-light skin tone"), QStringLiteral("woman mountain biking: medium-light skin tone")})},
-{QStringLiteral("woman mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mountain biking: medium skin tone"), QStringLiteral("woman mountain biking: medium skin tone")})},
-{QStringLiteral("woman mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mountain biking: medium-dark skin tone"), QStringLiteral("woman mountain biking: medium-dark skin tone")})},
-{QStringLiteral("woman mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mountain biking: dark skin tone"), QStringLiteral("woman mountain biking: dark skin tone")})},
-{QStringLiteral("person cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FB"), QStringLiteral("cartwheel_tone1"), QStringLiteral("person cartwheeling: light skin tone")})},
-{QStringLiteral("person cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FC"), QStringLiteral("cartwheel_tone2"), QStringLiteral("person cartwheeling: medium-light skin tone")})},
-{QStringLiteral("person cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FD"), QStringLiteral("cartwheel_tone3"), QStringLiteral("person cartwheeling: medium skin tone")})},
-{QStringLiteral("person cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FE"), QStringLiteral("cartwheel_tone4"), QStringLiteral("person cartwheeling: medium-dark skin tone")})},
-{QStringLiteral("person cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FF"), QStringLiteral("cartwheel_tone5"), QStringLiteral("person cartwheeling: dark skin tone")})},
-{QStringLiteral("man cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man cartwheeling: light skin tone"), QStringLiteral("man cartwheeling: light skin tone")})},
-{QStringLiteral("man cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man cartwheeling: medium-light skin tone"), QStringLiteral("man cartwheeling: medium-light skin tone")})},
-{QStringLiteral("man cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man cartwheeling: medium skin tone"), QStringLiteral("man cartwheeling: medium skin tone")})},
-{QStringLiteral("man cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man cartwheeling: medium-dark skin tone"), QStringLiteral("man cartwheeling: medium-dark skin tone")})},
-{QStringLiteral("man cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man cartwheeling: dark skin tone"), QStringLiteral("man cartwheeling: dark skin tone")})},
-{QStringLiteral("woman cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman cartwheeling: light skin tone"), QStringLiteral("woman cartwheeling: light skin tone")})},
-{QStringLiteral("woman cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman cartwheeling: medium-light skin tone"), QStringLiteral("woman cartwheeling: medium-light skin tone")})},
-{QStringLiteral("woman cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman cartwheeling: medium skin tone"), QStringLiteral("woman cartwheeling: medium skin tone")})},
-{QStringLiteral("woman cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman cartwheeling: medium-dark skin tone"), QStringLiteral("woman cartwheeling: medium-dark skin tone")})},
-{QStringLiteral("woman cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman cartwheeling: dark skin tone"), QStringLiteral("woman cartwheeling: dark skin tone")})},
-{QStringLiteral("person playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FB"), QStringLiteral("water_polo_tone1"), QStringLiteral("person playing water polo: light skin tone")})},
-{QStringLiteral("person playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FC"), QStringLiteral("water_polo_tone2"), QStringLiteral("person playing water polo: medium-light skin tone")})},
-{QStringLiteral("person playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FD"), QStringLiteral("water_polo_tone3"), QStringLiteral("person playing water polo: medium skin tone")})},
-{QStringLiteral("person playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FE"), QStringLiteral("water_polo_tone4"), QStringLiteral("person playing water polo: medium-dark skin tone")})},
-{QStringLiteral("person playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FF"), QStringLiteral("water_polo_tone5"), QStringLiteral("person playing water polo: dark skin tone")})},
-{QStringLiteral("man playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing water polo: light skin tone"), QStringLiteral("man playing water polo: light skin tone")})},
-{QStringLiteral("man playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing water polo: medium-light skin tone"), QStringLiteral("man playing water polo: medium-light skin tone")})},
-{QStringLiteral("man playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing water polo: medium skin tone"), QStringLiteral("man playing water polo: medium skin tone")})},
-{QStringLiteral("man playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing water polo: medium-dark skin tone"), QStringLiteral("man playing water polo: medium-dark skin tone")})},
-{QStringLiteral("man playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing water polo: dark skin tone"), QStringLiteral("man playing water polo: dark skin tone")})},
-{QStringLiteral("woman playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing water polo: light skin tone"), QStringLiteral("woman playing water polo: light skin tone")})},
-{QStringLiteral("woman playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing water polo: medium-light skin tone"), QStringLiteral("woman playing water polo: medium-light skin tone")})},
-{QStringLiteral("woman playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing water polo: medium skin tone"), QStringLiteral("woman playing water polo: medium skin tone")})},
-{QStringLiteral("woman playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing water polo: medium-dark skin tone"), QStringLiteral("woman playing water polo: medium-dark skin tone")})},
-{QStringLiteral("woman playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing water polo: dark skin tone"), QStringLiteral("woman playing water polo: dark skin tone")})},
-{QStringLiteral("person playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FB"), QStringLiteral("handball_tone1"), QStringLiteral("person playing handball: light skin tone")})},
-{QStringLiteral("person playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FC"), QStringLiteral("handball_tone2"), QStringLiteral("person playing handball: medium-light skin tone")})},
-{QStringLiteral("person playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FD"), QStringLiteral("handball_tone3"), QStringLiteral("person playing handball: medium skin tone")})},
-{QStringLiteral("person playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FE"), QStringLiteral("handball_tone4"), QStringLiteral("person playing handball: medium-dark skin tone")})},
-{QStringLiteral("person playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FF"), QStringLiteral("handball_tone5"), QStringLiteral("person playing handball: dark skin tone")})},
-{QStringLiteral("man playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing handball: light skin tone"), QStringLiteral("man playing handball: light skin tone")})},
-{QStringLiteral("man playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing handball: medium-light skin tone"), QStringLiteral("man playing handball: medium-light skin tone")})},
-{QStringLiteral("man playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing handball: medium skin tone"), QStringLiteral("man playing handball: medium skin tone")})},
-{QStringLiteral("man playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing handball: medium-dark skin tone"), QStringLiteral("man playing handball: medium-dark skin tone")})},
-{QStringLiteral("man playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing handball: dark skin tone"), QStringLiteral("man playing handball: dark skin tone")})},
-{QStringLiteral("woman playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing handball: light skin tone"), QStringLiteral("woman playing handball: light skin tone")})},
-{QStringLiteral("woman playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing handball: medium-light skin tone"), QStringLiteral("woman playing handball: medium-light skin tone")})},
-{QStringLiteral("woman playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing handball: medium skin tone"), QStringLiteral("woman playing handball: medium skin tone")})},
-{QStringLiteral("woman playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing handball: medium-dark skin tone"), QStringLiteral("woman playing handball: medium-dark skin tone")})},
-{QStringLiteral("woman playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing handball: dark skin tone"), QStringLiteral("woman playing handball: dark skin tone")})},
-{QStringLiteral("person juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FB"), QStringLiteral("juggling_tone1"), QStringLiteral("person juggling: light skin tone")})},
-{QStringLiteral("person juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FC"), QStringLiteral("juggling_tone2"), QStringLiteral("person juggling: medium-light skin tone")})},
-{QStringLiteral("person juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FD"), QStringLiteral("juggling_tone3"), QStringLiteral("person juggling: medium skin tone")})},
-{QStringLiteral("person juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FE"), QStringLiteral("juggling_tone4"), QStringLiteral("person juggling: medium-dark skin tone")})},
-{QStringLiteral("person juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FF"), QStringLiteral("juggling_tone5"), QStringLiteral("person juggling: dark skin tone")})},
-{QStringLiteral("man juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man juggling: light skin tone"), QStringLiteral("man juggling: light skin tone")})},
-{QStringLiteral("man juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man juggling: medium-light skin tone"), QStringLiteral("man juggling: medium-light skin tone")})},
-{QStringLiteral("man juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man juggling: medium skin tone"), QStringLiteral("man juggling: medium skin tone")})},
-{QStringLiteral("man juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man juggling: medium-dark skin tone"), QStringLiteral("man juggling: medium-dark skin tone")})},
-{QStringLiteral("man juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man juggling: dark skin tone"), QStringLiteral("man juggling: dark skin tone")})},
-{QStringLiteral("woman juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman juggling: light skin tone"), QStringLiteral("woman juggling: light skin tone")})},
-{QStringLiteral("woman juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman juggling: medium-light skin tone"), QStringLiteral("woman juggling: medium-light skin tone")})},
-{QStringLiteral("woman juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman juggling: medium skin tone"), QStringLiteral("woman juggling: medium skin tone")})},
-{QStringLiteral("woman juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman juggling: medium-dark skin tone"), QStringLiteral("woman juggling: medium-dark skin tone")})},
-{QStringLiteral("woman juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman juggling: dark skin tone"), QStringLiteral("woman juggling: dark skin tone")})},
-{QStringLiteral("person in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FB"), QStringLiteral("person_in_lotus_position_tone1"), QStringLiteral("person in lotus position: light skin tone")})},
-{QStringLiteral("person in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FC"), QStringLiteral("person_in_lotus_position_tone2"), QStringLiteral("person in lotus position: medium-light skin tone")})},
-{QStringLiteral("person in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FD"), QStringLiteral("person_in_lotus_position_tone3"), QStringLiteral("person in lotus position: medium skin tone")})},
-{QStringLiteral("person in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FE"), QStringLiteral("person_in_lotus_position_tone4"), QStringLiteral("person in lotus position: medium-dark skin tone")})},
-{QStringLiteral("person in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FF"), QStringLiteral("person_in_lotus_position_tone5"), QStringLiteral("person in lotus position: dark skin tone")})},
-{QStringLiteral("man in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in lotus position: light skin tone"), QStringLiteral("man in lotus position: light skin tone")})},
-{QStringLiteral("man in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in lotus position: medium-light skin tone"), QStringLiteral("man in lotus position: medium-light skin tone")})},
-{QStringLiteral("man in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in lotus position: medium skin tone"), QStringLiteral("man in lotus position: medium skin tone")})},
-{QStringLiteral("man in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in lotus position: medium-dark skin tone"), QStringLiteral("man in lotus position: medium-dark skin tone")})},
-{QStringLiteral("man in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in lotus position: dark skin tone"), QStringLiteral("man in lotus position: dark skin tone")})},
-{QStringLiteral("woman in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in lotus position: light skin tone"), QStringLiteral("woman in lotus position: light skin tone")})},
-{QStringLiteral("woman in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in lotus position: medium-light skin tone"), QStringLiteral("woman in lotus position: medium-light skin tone")})},
-{QStringLiteral("woman in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in lotus position: medium skin tone"), QStringLiteral("woman in lotus position: medium skin tone")})},
-{QStringLiteral("woman in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in lotus position: medium-dark skin tone"), QStringLiteral("woman in lotus position: medium-dark skin tone")})},
-{QStringLiteral("woman in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in lotus position: dark skin tone"), QStringLiteral("woman in lotus position: dark skin tone")})},
-{QStringLiteral("person taking bath"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C0\U0001F3FB"), QStringLiteral("bath_tone1"), QStringLiteral("person taking bath: light skin tone")})},
-{QStringLiteral("person taking bath"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C0\U0001F3FC"), QStringLiteral("bath_tone2"), QStringLiteral("person taking bath: medium-light skin tone")})},
-{QStringLiteral("person taking bath"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C0\U0001F3FD"), QStringLiteral("bath_tone3"), QStringLiteral("person taking bath: medium skin tone")})},
-{QStringLiteral("person taking bath"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C0\U0001F3FE"), QStringLiteral("bath_tone4"), QStringLiteral("person taking bath: medium-dark skin tone")})},
-{QStringLiteral("person taking bath"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C0\U0001F3FF"), QStringLiteral("bath_tone5"), QStringLiteral("person taking bath: dark skin tone")})},
-{QStringLiteral("person in bed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CC\U0001F3FB"), QStringLiteral("person_in_bed_tone1"), QStringLiteral("person in bed: light skin tone")})},
-{QStringLiteral("person in bed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CC\U0001F3FC"), QStringLiteral("person_in_bed_tone2"), QStringLiteral("person in bed: medium-light skin tone")})},
-{QStringLiteral("person in bed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CC\U0001F3FD"), QStringLiteral("person_in_bed_tone3"), QStringLiteral("person in bed: medium skin tone")})},
-{QStringLiteral("person in bed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CC\U0001F3FE"), QStringLiteral("person_in_bed_tone4"), QStringLiteral("person in bed: medium-dark skin tone")})},
-{QStringLiteral("person in bed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CC\U0001F3FF"), QStringLiteral("person_in_bed_tone5"), QStringLiteral("person in bed: dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("people holding hands: light skin tone"), QStringLiteral("people holding hands: light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("people holding hands: light skin tone, medium-light skin tone"), QStringLiteral("people holding hands: light skin tone, medium-light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("people holding hands: light skin tone, medium skin tone"), QStringLiteral("people holding hands: light skin tone, medium skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("people holding hands: light skin tone, medium-dark skin tone"), QStringLiteral("people holding hands: light skin tone, medium-dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("people holding hands: light skin tone, dark skin tone"), QStringLiteral("people holding hands: light skin tone, dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("people holding hands: medium-light skin tone, light skin tone"), QStringLiteral("people holding hands: medium-light skin tone, light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("people holding hands: medium-light skin tone"), QStringLiteral("people holding hands: medium-light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("people holding hands: medium-light skin tone, medium skin tone"), QStringLiteral("people holding hands: medium-light skin tone, medium skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("people holding hands: medium-light skin tone, medium-dark skin tone"), QStringLiteral("people holding hands: medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("people holding hands: medium-light skin tone, dark skin tone"), QStringLiteral("people holding hands: medium-light skin tone, dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("people holding hands: medium skin tone, light skin tone"), QStringLiteral("people holding hands: medium skin tone, light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("people holding hands: medium skin tone, medium-light skin tone"), QStringLiteral("people holding hands: medium skin tone, medium-light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("people holding hands: medium skin tone"), QStringLiteral("people holding hands: medium skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("people holding hands: medium skin tone, medium-dark skin tone"), QStringLiteral("people holding hands: medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("people holding hands: medium skin tone, dark skin tone"), QStringLiteral("people holding hands: medium skin tone, dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("people holding hands: medium-dark skin tone, light skin tone"), QStringLiteral("people holding hands: medium-dark skin tone, light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("people holding hands: medium-dark skin tone, medium-light skin tone"), QStringLiteral("people holding hands: medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("people holding hands: medium-dark skin tone, medium skin tone"), QStringLiteral("people holding hands: medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("people holding hands: medium-dark skin tone"), QStringLiteral("people holding hands: medium-dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("people holding hands: medium-dark skin tone, dark skin tone"), QStringLiteral("people holding hands: medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("people holding hands: dark skin tone, light skin tone"), QStringLiteral("people holding hands: dark skin tone, light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("people holding hands: dark skin tone, medium-light skin tone"), QStringLiteral("people holding hands: dark skin tone, medium-light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("people holding hands: dark skin tone, medium skin tone"), QStringLiteral("people holding hands: dark skin tone, medium skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("people holding hands: dark skin tone, medium-dark skin tone"), QStringLiteral("people holding hands: dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("people holding hands: dark skin tone"), QStringLiteral("people holding hands: dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46D\U0001F3FB"), QStringLiteral("women holding hands: light skin tone"), QStringLiteral("women holding hands: light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("women holding hands: light skin tone, medium-light skin tone"), QStringLiteral("women holding hands: light skin tone, medium-light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("women holding hands: light skin tone, medium skin tone"), QStringLiteral("women holding hands: light skin tone, medium skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("women holding hands: light skin tone, medium-dark skin tone"), QStringLiteral("women holding hands: light skin tone, medium-dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("women holding hands: light skin tone, dark skin tone"), QStringLiteral("women holding hands: light skin tone, dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("women holding hands: medium-light skin tone, light skin tone"), QStringLiteral("women holding hands: medium-light skin tone, light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46D\U0001F3FC"), QStringLiteral("women holding hands: medium-light skin tone"), QStringLiteral("women holding hands: medium-light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("women holding hands: medium-light skin tone, medium skin tone"), QStringLiteral("women holding hands: medium-light skin tone, medium skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("women holding hands: medium-light skin tone, medium-dark skin tone"), QStringLiteral("women holding hands: medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("women holding hands: medium-light skin tone, dark skin tone"), QStringLiteral("women holding hands: medium-light skin tone, dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("women holding hands: medium skin tone, light skin tone"), QStringLiteral("women holding hands: medium skin tone, light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("women holding hands: medium skin tone, medium-light skin tone"), QStringLiteral("women holding hands: medium skin tone, medium-light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46D\U0001F3FD"), QStringLiteral("women holding hands: medium skin tone"), QStringLiteral("women holding hands: medium skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("women holding hands: medium skin tone, medium-dark skin tone"), QStringLiteral("women holding hands: medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("women holding hands: medium skin tone, dark skin tone"), QStringLiteral("women holding hands: medium skin tone, dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("women holding hands: medium-dark skin tone, light skin tone"), QStringLiteral("women holding hands: medium-dark skin tone, light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("women holding hands: medium-dark skin tone, medium-light skin tone"), QStringLiteral("women holding hands: medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("women holding hands: medium-dark skin tone, medium skin tone"), QStringLiteral("women holding hands: medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46D\U0001F3FE"), QStringLiteral("women holding hands: medium-dark skin tone"), QStringLiteral("women holding hands: medium-dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("women holding hands: medium-dark skin tone, dark skin tone"), QStringLiteral("women holding hands: medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("women holding hands: dark skin tone, light skin tone"), QStringLiteral("women holding hands: dark skin tone, light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("women holding hands: dark skin tone, medium-light skin tone"), QStringLiteral("women holding hands: dark skin tone, medium-light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("women holding hands: dark skin tone, medium skin tone"), QStringLiteral("women holding hands: dark skin tone, medium skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("women holding hands: dark skin tone, medium-dark skin tone"), QStringLiteral("women holding hands: dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46D\U0001F3FF"), QStringLiteral("women holding hands: dark skin tone"), QStringLiteral("women holding hands: dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46B\U0001F3FB"), QStringLiteral("woman and man holding hands: light skin tone"), QStringLiteral("woman and man holding hands: light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("woman and man holding hands: light skin tone, medium-light skin tone"), QStringLiteral("woman and man holding hands: light skin tone, medium-light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("woman and man holding hands: light skin tone, medium skin tone"), QStringLiteral("woman and man holding hands: light skin tone, medium skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("woman and man holding hands: light skin tone, medium-dark skin tone"), QStringLiteral("woman and man holding hands: light skin tone, medium-dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("woman and man holding hands: light skin tone, dark skin tone"), QStringLiteral("woman and man holding hands: light skin tone, dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("woman and man holding hands: medium-light skin tone, light skin tone"), QStringLiteral("woman and man holding hands: medium-light skin tone, light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46B\U0001F3FC"), QStringLiteral("woman and man holding hands: medium-light skin tone"), QStringLiteral("woman and man holding hands: medium-light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("woman and man holding hands: medium-light skin tone, medium skin tone"), QStringLiteral("woman and man holding hands: medium-light skin tone, medium skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("woman and man holding hands: medium-light skin tone, medium-dark skin tone"), QStringLiteral("woman and man holding hands: medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("woman and man holding hands: medium-light skin tone, dark skin tone"), QStringLiteral("woman and man holding hands: medium-light skin tone, dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("woman and man holding hands: medium skin tone, light skin tone"), QStringLiteral("woman and man holding hands: medium skin tone, light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("woman and man holding hands: medium skin tone, medium-light skin tone"), QStringLiteral("woman and man holding hands: medium skin tone, medium-light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46B\U0001F3FD"), QStringLiteral("woman and man holding hands: medium skin tone"), QStringLiteral("woman and man holding hands: medium skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("woman and man holding hands: medium skin tone, medium-dark skin tone"), QStringLiteral("woman and man holding hands: medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("woman and man holding hands: medium skin tone, dark skin tone"), QStringLiteral("woman and man holding hands: medium skin tone, dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("woman and man holding hands: medium-dark skin tone, light skin tone"), QStringLiteral("woman and man holding hands: medium-dark skin tone, light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("woman and man holding hands: medium-dark skin tone, medium-light skin tone"), QStringLiteral("woman and man holding hands: medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("woman and man holding hands: medium-dark skin tone, medium skin tone"), QStringLiteral("woman and man holding hands: medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46B\U0001F3FE"), QStringLiteral("woman and man holding hands: medium-dark skin tone"), QStringLiteral("woman and man holding hands: medium-dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("woman and man holding hands: medium-dark skin tone, dark skin tone"), QStringLiteral("woman and man holding hands: medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("woman and man holding hands: dark skin tone, light skin tone"), QStringLiteral("woman and man holding hands: dark skin tone, light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("woman and man holding hands: dark skin tone, medium-light skin tone"), QStringLiteral("woman and man holding hands: dark skin tone, medium-light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("woman and man holding hands: dark skin tone, medium skin tone"), QStringLiteral("woman and man holding hands: dark skin tone, medium skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("woman and man holding hands: dark skin tone, medium-dark skin tone"), QStringLiteral("woman and man holding hands: dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46B\U0001F3FF"), QStringLiteral("woman and man holding hands: dark skin tone"), QStringLiteral("woman and man holding hands: dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46C\U0001F3FB"), QStringLiteral("men holding hands: light skin tone"), QStringLiteral("men holding hands: light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("men holding hands: light skin tone, medium-light skin tone"), QStringLiteral("men holding hands: light skin tone, medium-light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("men holding hands: light skin tone, medium skin tone"), QStringLiteral("men holding hands: light skin tone, medium skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("men holding hands: light skin tone, medium-dark skin tone"), QStringLiteral("men holding hands: light skin tone, medium-dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("men holding hands: light skin tone, dark skin tone"), QStringLiteral("men holding hands: light skin tone, dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("men holding hands: medium-light skin tone, light skin tone"), QStringLiteral("men holding hands: medium-light skin tone, light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46C\U0001F3FC"), QStringLiteral("men holding hands: medium-light skin tone"), QStringLiteral("men holding hands: medium-light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("men holding hands: medium-light skin tone, medium skin tone"), QStringLiteral("men holding hands: medium-light skin tone, medium skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("men holding hands: medium-light skin tone, medium-dark skin tone"), QStringLiteral("men holding hands: medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("men holding hands: medium-light skin tone, dark skin tone"), QStringLiteral("men holding hands: medium-light skin tone, dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("men holding hands: medium skin tone, light skin tone"), QStringLiteral("men holding hands: medium skin tone, light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("men holding hands: medium skin tone, medium-light skin tone"), QStringLiteral("men holding hands: medium skin tone, medium-light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46C\U0001F3FD"), QStringLiteral("men holding hands: medium skin tone"), QStringLiteral("men holding hands: medium skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("men holding hands: medium skin tone, medium-dark skin tone"), QStringLiteral("men holding hands: medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("men holding hands: medium skin tone, dark skin tone"), QStringLiteral("men holding hands: medium skin tone, dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("men holding hands: medium-dark skin tone, light skin tone"), QStringLiteral("men holding hands: medium-dark skin tone, light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("men holding hands: medium-dark skin tone, medium-light skin tone"), QStringLiteral("men holding hands: medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("men holding hands: medium-dark skin tone, medium skin tone"), QStringLiteral("men holding hands: medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46C\U0001F3FE"), QStringLiteral("men holding hands: medium-dark skin tone"), QStringLiteral("men holding hands: medium-dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("men holding hands: medium-dark skin tone, dark skin tone"), QStringLiteral("men holding hands: medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("men holding hands: dark skin tone, light skin tone"), QStringLiteral("men holding hands: dark skin tone, light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("men holding hands: dark skin tone, medium-light skin tone"), QStringLiteral("men holding hands: dark skin tone, medium-light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("men holding hands: dark skin tone, medium skin tone"), QStringLiteral("men holding hands: dark skin tone, medium skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("men holding hands: dark skin tone, medium-dark skin tone"), QStringLiteral("men holding hands: dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46C\U0001F3FF"), QStringLiteral("men holding hands: dark skin tone"), QStringLiteral("men holding hands: dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48F\U0001F3FB"), QStringLiteral("kiss: light skin tone"), QStringLiteral("kiss: light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48F\U0001F3FC"), QStringLiteral("kiss: medium-light skin tone"), QStringLiteral("kiss: medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48F\U0001F3FD"), QStringLiteral("kiss: medium skin tone"), QStringLiteral("kiss: medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48F\U0001F3FE"), QStringLiteral("kiss: medium-dark skin tone"), QStringLiteral("kiss: medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48F\U0001F3FF"), QStringLiteral("kiss: dark skin tone"), QStringLiteral("kiss: dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("kiss: person, person, light skin tone, medium-light skin tone"), QStringLiteral("kiss: person, person, light skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("kiss: person, person, light skin tone, medium skin tone"), QStringLiteral("kiss: person, person, light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("kiss: person, person, light skin tone, medium-dark skin tone"), QStringLiteral("kiss: person, person, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("kiss: person, person, light skin tone, dark skin tone"), QStringLiteral("kiss: person, person, light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("kiss: person, person, medium-light skin tone, light skin tone"), QStringLiteral("kiss: person, person, medium-light skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("kiss: person, person, medium-light skin tone, medium skin tone"), QStringLiteral("kiss: person, person, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("kiss: person, person, medium-light skin tone, medium-dark skin tone"), QStringLiteral("kiss: person, person, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("kiss: person, person, medium-light skin tone, dark skin tone"), QStringLiteral("kiss: person, person, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("kiss: person, person, medium skin tone, light skin tone"), QStringLiteral("kiss: person, person, medium skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("kiss: person, person, medium skin tone, medium-light skin tone"), QStringLiteral("kiss: person, person, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("kiss: person, person, medium skin tone, medium-dark skin tone"), QStringLiteral("kiss: person, person, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("kiss: person, person, medium skin tone, dark skin tone"), QStringLiteral("kiss: person, person, medium skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("kiss: person, person, medium-dark skin tone, light skin tone"), QStringLiteral("kiss: person, person, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("kiss: person, person, medium-dark skin tone, medium-light skin tone"), QStringLiteral("kiss: person, person, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("kiss: person, person, medium-dark skin tone, medium skin tone"), QStringLiteral("kiss: person, person, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("kiss: person, person, medium-dark skin tone, dark skin tone"), QStringLiteral("kiss: person, person, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("kiss: person, person, dark skin tone, light skin tone"), QStringLiteral("kiss: person, person, dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("kiss: person, person, dark skin tone, medium-light skin tone"), QStringLiteral("kiss: person, person, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("kiss: person, person, dark skin tone, medium skin tone"), QStringLiteral("kiss: person, person, dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("kiss: person, person, dark skin tone, medium-dark skin tone"), QStringLiteral("kiss: person, person, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: woman, man, light skin tone"), QStringLiteral("kiss: woman, man, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: woman, man, light skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, man, light skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: woman, man, light skin tone, medium skin tone"), QStringLiteral("kiss: woman, man, light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: woman, man, light skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, man, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: woman, man, light skin tone, dark skin tone"), QStringLiteral("kiss: woman, man, light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: woman, man, medium-light skin tone, light skin tone"), QStringLiteral("kiss: woman, man, medium-light skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: woman, man, medium-light skin tone"), QStringLiteral("kiss: woman, man, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: woman, man, medium-light skin tone, medium skin tone"), QStringLiteral("kiss: woman, man, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: woman, man, medium-light skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, man, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: woman, man, medium-light skin tone, dark skin tone"), QStringLiteral("kiss: woman, man, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: woman, man, medium skin tone, light skin tone"), QStringLiteral("kiss: woman, man, medium skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: woman, man, medium skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, man, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: woman, man, medium skin tone"), QStringLiteral("kiss: woman, man, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: woman, man, medium skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, man, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: woman, man, medium skin tone, dark skin tone"), QStringLiteral("kiss: woman, man, medium skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: woman, man, medium-dark skin tone, light skin tone"), QStringLiteral("kiss: woman, man, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: woman, man, medium-dark skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, man, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: woman, man, medium-dark skin tone, medium skin tone"), QStringLiteral("kiss: woman, man, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: woman, man, medium-dark skin tone"), QStringLiteral("kiss: woman, man, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: woman, man, medium-dark skin tone, dark skin tone"), QStringLiteral("kiss: woman, man, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: woman, man, dark skin tone, light skin tone"), QStringLiteral("kiss: woman, man, dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: woman, man, dark skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, man, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: woman, man, dark skin tone, medium skin tone"), QStringLiteral("kiss: woman, man, dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: woman, man, dark skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, man, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: woman, man, dark skin tone"), QStringLiteral("kiss: woman, man, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: man, man, light skin tone"), QStringLiteral("kiss: man, man, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: man, man, light skin tone, medium-light skin tone"), QStringLiteral("kiss: man, man, light skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: man, man, light skin tone, medium skin tone"), QStringLiteral("kiss: man, man, light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: man, man, light skin tone, medium-dark skin tone"), QStringLiteral("kiss: man, man, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: man, man, light skin tone, dark skin tone"), QStringLiteral("kiss: man, man, light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: man, man, medium-light skin tone, light skin tone"), QStringLiteral("kiss: man, man, medium-light skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: man, man, medium-light skin tone"), QStringLiteral("kiss: man, man, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: man, man, medium-light skin tone, medium skin tone"), QStringLiteral("kiss: man, man, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: man, man, medium-light skin tone, medium-dark skin tone"), QStringLiteral("kiss: man, man, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: man, man, medium-light skin tone, dark skin tone"), QStringLiteral("kiss: man, man, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: man, man, medium skin tone, light skin tone"), QStringLiteral("kiss: man, man, medium skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: man, man, medium skin tone, medium-light skin tone"), QStringLiteral("kiss: man, man, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: man, man, medium skin tone"), QStringLiteral("kiss: man, man, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: man, man, medium skin tone, medium-dark skin tone"), QStringLiteral("kiss: man, man, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: man, man, medium skin tone, dark skin tone"), QStringLiteral("kiss: man, man, medium skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: man, man, medium-dark skin tone, light skin tone"), QStringLiteral("kiss: man, man, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: man, man, medium-dark skin tone, medium-light skin tone"), QStringLiteral("kiss: man, man, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: man, man, medium-dark skin tone, medium skin tone"), QStringLiteral("kiss: man, man, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: man, man, medium-dark skin tone"), QStringLiteral("kiss: man, man, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: man, man, medium-dark skin tone, dark skin tone"), QStringLiteral("kiss: man, man, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: man, man, dark skin tone, light skin tone"), QStringLiteral("kiss: man, man, dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: man, man, dark skin tone, medium-light skin tone"), QStringLiteral("kiss: man, man, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: man, man, dark skin tone, medium skin tone"), QStringLiteral("kiss: man, man, dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: man, man, dark skin tone, medium-dark skin tone"), QStringLiteral("kiss: man, man, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: man, man, dark skin tone"), QStringLiteral("kiss: man, man, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("kiss: woman, woman, light skin tone"), QStringLiteral("kiss: woman, woman, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("kiss: woman, woman, light skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, woman, light skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("kiss: woman, woman, light skin tone, medium skin tone"), QStringLiteral("kiss: woman, woman, light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("kiss: woman, woman, light skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, woman, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("kiss: woman, woman, light skin tone, dark skin tone"), QStringLiteral("kiss: woman, woman, light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("kiss: woman, woman, medium-light skin tone, light skin tone"), QStringLiteral("kiss: woman, woman, medium-light skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("kiss: woman, woman, medium-light skin tone"), QStringLiteral("kiss: woman, woman, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("kiss: woman, woman, medium-light skin tone, medium skin tone"), QStringLiteral("kiss: woman, woman, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("kiss: woman, woman, medium-light skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, woman, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("kiss: woman, woman, medium-light skin tone, dark skin tone"), QStringLiteral("kiss: woman, woman, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("kiss: woman, woman, medium skin tone, light skin tone"), QStringLiteral("kiss: woman, woman, medium skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("kiss: woman, woman, medium skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, woman, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("kiss: woman, woman, medium skin tone"), QStringLiteral("kiss: woman, woman, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("kiss: woman, woman, medium skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, woman, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("kiss: woman, woman, medium skin tone, dark skin tone"), QStringLiteral("kiss: woman, woman, medium skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, light skin tone"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, medium skin tone"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("kiss: woman, woman, medium-dark skin tone"), QStringLiteral("kiss: woman, woman, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, dark skin tone"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("kiss: woman, woman, dark skin tone, light skin tone"), QStringLiteral("kiss: woman, woman, dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("kiss: woman, woman, dark skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, woman, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("kiss: woman, woman, dark skin tone, medium skin tone"), QStringLiteral("kiss: woman, woman, dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("kiss: woman, woman, dark skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, woman, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("kiss: woman, woman, dark skin tone"), QStringLiteral("kiss: woman, woman, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F491\U0001F3FB"), QStringLiteral("couple with heart: light skin tone"), QStringLiteral("couple with heart: light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F491\U0001F3FC"), QStringLiteral("couple with heart: medium-light skin tone"), QStringLiteral("couple with heart: medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F491\U0001F3FD"), QStringLiteral("couple with heart: medium skin tone"), QStringLiteral("couple with heart: medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F491\U0001F3FE"), QStringLiteral("couple with heart: medium-dark skin tone"), QStringLiteral("couple with heart: medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F491\U0001F3FF"), QStringLiteral("couple with heart: dark skin tone"), QStringLiteral("couple with heart: dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("couple with heart: person, person, light skin tone, medium-light skin tone"), QStringLiteral("couple with heart: person, person, light skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("couple with heart: person, person, light skin tone, medium skin tone"), QStringLiteral("couple with heart: person, person, light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("couple with heart: person, person, light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: person, person, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("couple with heart: person, person, light skin tone, dark skin tone"), QStringLiteral("couple with heart: person, person, light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("couple with heart: person, person, medium-light skin tone, light skin tone"), QStringLiteral("couple with heart: person, person, medium-light skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("couple with heart: person, person, medium-light skin tone, medium skin tone"), QStringLiteral("couple with heart: person, person, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("couple with heart: person, person, medium-light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: person, person, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("couple with heart: person, person, medium-light skin tone, dark skin tone"), QStringLiteral("couple with heart: person, person, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("couple with heart: person, person, medium skin tone, light skin tone"), QStringLiteral("couple with heart: person, person, medium skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("couple with heart: person, person, medium skin tone, medium-light skin tone"), QStringLiteral("couple with heart: person, person, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("couple with heart: person, person, medium skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: person, person, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("couple with heart: person, person, medium skin tone, dark skin tone"), QStringLiteral("couple with heart: person, person, medium skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, light skin tone"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, medium skin tone"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, dark skin tone"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("couple with heart: person, person, dark skin tone, light skin tone"), QStringLiteral("couple with heart: person, person, dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("couple with heart: person, person, dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: person, person, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("couple with heart: person, person, dark skin tone, medium skin tone"), QStringLiteral("couple with heart: person, person, dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("couple with heart: person, person, dark skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: person, person, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: woman, man, light skin tone"), QStringLiteral("couple with heart: woman, man, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: woman, man, light skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, man, light skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: woman, man, light skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, man, light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: woman, man, light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, man, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: woman, man, light skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, man, light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, light skin tone"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: woman, man, medium-light skin tone"), QStringLiteral("couple with heart: woman, man, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: woman, man, medium skin tone, light skin tone"), QStringLiteral("couple with heart: woman, man, medium skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: woman, man, medium skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, man, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: woman, man, medium skin tone"), QStringLiteral("couple with heart: woman, man, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: woman, man, medium skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, man, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: woman, man, medium skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, man, medium skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, light skin tone"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: woman, man, dark skin tone, light skin tone"), QStringLiteral("couple with heart: woman, man, dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: woman, man, dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, man, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: woman, man, dark skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, man, dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: woman, man, dark skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, man, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: woman, man, dark skin tone"), QStringLiteral("couple with heart: woman, man, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: man, man, light skin tone"), QStringLiteral("couple with heart: man, man, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: man, man, light skin tone, medium-light skin tone"), QStringLiteral("couple with heart: man, man, light skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: man, man, light skin tone, medium skin tone"), QStringLiteral("couple with heart: man, man, light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: man, man, light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: man, man, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: man, man, light skin tone, dark skin tone"), QStringLiteral("couple with heart: man, man, light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: man, man, medium-light skin tone, light skin tone"), QStringLiteral("couple with heart: man, man, medium-light skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: man, man, medium-light skin tone"), QStringLiteral("couple with heart: man, man, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: man, man, medium-light skin tone, medium skin tone"), QStringLiteral("couple with heart: man, man, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: man, man, medium-light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: man, man, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: man, man, medium-light skin tone, dark skin tone"), QStringLiteral("couple with heart: man, man, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: man, man, medium skin tone, light skin tone"), QStringLiteral("couple with heart: man, man, medium skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: man, man, medium skin tone, medium-light skin tone"), QStringLiteral("couple with heart: man, man, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: man, man, medium skin tone"), QStringLiteral("couple with heart: man, man, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: man, man, medium skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: man, man, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: man, man, medium skin tone, dark skin tone"), QStringLiteral("couple with heart: man, man, medium skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, light skin tone"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, medium skin tone"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: man, man, medium-dark skin tone"), QStringLiteral("couple with heart: man, man, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, dark skin tone"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: man, man, dark skin tone, light skin tone"), QStringLiteral("couple with heart: man, man, dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: man, man, dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: man, man, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: man, man, dark skin tone, medium skin tone"), QStringLiteral("couple with heart: man, man, dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: man, man, dark skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: man, man, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: man, man, dark skin tone"), QStringLiteral("couple with heart: man, man, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("couple with heart: woman, woman, light skin tone"), QStringLiteral("couple with heart: woman, woman, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("couple with heart: woman, woman, light skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, woman, light skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("couple with heart: woman, woman, light skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, woman, light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("couple with heart: woman, woman, light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, woman, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("couple with heart: woman, woman, light skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, woman, light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, light skin tone"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("couple with heart: woman, woman, medium skin tone, light skin tone"), QStringLiteral("couple with heart: woman, woman, medium skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("couple with heart: woman, woman, medium skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, woman, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("couple with heart: woman, woman, medium skin tone"), QStringLiteral("couple with heart: woman, woman, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("couple with heart: woman, woman, medium skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, woman, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("couple with heart: woman, woman, medium skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, woman, medium skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, light skin tone"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("couple with heart: woman, woman, dark skin tone, light skin tone"), QStringLiteral("couple with heart: woman, woman, dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("couple with heart: woman, woman, dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, woman, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("couple with heart: woman, woman, dark skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, woman, dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("couple with heart: woman, woman, dark skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, woman, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("couple with heart: woman, woman, dark skin tone"), QStringLiteral("couple with heart: woman, woman, dark skin tone")})},
-{QStringLiteral("light skin tone"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3FB"), QStringLiteral("tone1"), QStringLiteral("light skin tone")})},
-{QStringLiteral("medium-light skin tone"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3FC"), QStringLiteral("tone2"), QStringLiteral("medium-light skin tone")})},
-{QStringLiteral("medium skin tone"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3FD"), QStringLiteral("tone3"), QStringLiteral("medium skin tone")})},
-{QStringLiteral("medium-dark skin tone"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3FE"), QStringLiteral("tone4"), QStringLiteral("medium-dark skin tone")})},
-{QStringLiteral("dark skin tone"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3FF"), QStringLiteral("tone5"), QStringLiteral("dark skin tone")})},
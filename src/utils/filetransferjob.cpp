@@ -8,83 +8,510 @@
 
 #include <KLocalizedString>
 #include <QNetworkReply>
+#include <QTimer>
+
+#include <algorithm>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+// Android gives us content:// URIs, where there's no place to keep a partial file next to the destination
+#ifdef Q_OS_ANDROID
+constexpr bool directWrite = true;
+#else
+constexpr bool directWrite = false;
+#endif
+
+// Chunks are read from the reply into this much memory, and written to the file from there
+constexpr qsizetype bufferSize = 64 * 1024;
+
+// How often a segment is resumed without making any progress, before giving up
+constexpr int maxAttempts = 5;
+
+struct ContentRange {
+    qint64 first = -1;
+    qint64 total = -1;
+};
+
+// Like "bytes 100-199/1000", where the total may be "*" if it's not known
+ContentRange parseContentRange(const QByteArray &header)
+{
+    if (!header.startsWith("bytes ")) {
+        return {};
+    }
+
+    const qsizetype dash = header.indexOf('-');
+    const qsizetype slash = header.indexOf('/');
+    if (dash < 0 || slash < dash) {
+        return {};
+    }
+
+    bool ok = false;
+    const qint64 first = header.sliced(6, dash - 6).trimmed().toLongLong(&ok);
+    if (!ok) {
+        return {};
+    }
+    const qint64 total = header.sliced(slash + 1).trimmed().toLongLong(&ok);
+    return {.first = first, .total = ok ? total : -1};
+}
+
+// Failures of the connection or the server, where it's worth trying again
+bool isTransientFailure(const QNetworkReply *reply)
+{
+    const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (statusCode == 408 || statusCode == 429 || statusCode >= 500) {
+        return true;
+    }
+    return reply->error() != QNetworkReply::NoError && reply->error() != QNetworkReply::OperationCanceledError
+        && reply->error() < QNetworkReply::ProxyConnectionRefusedError;
+}
+
+// What to send as If-Range, so the server only sends the rest if it's still the same file. Weak ETags can't be used for that.
+QByteArray validatorOf(const QNetworkReply *reply)
+{
+    const QByteArray etag = reply->rawHeader("ETag");
+    if (!etag.isEmpty() && !etag.startsWith("W/")) {
+        return etag;
+    }
+    return reply->rawHeader("Last-Modified");
+}
+}
 
 FileTransferJob::FileTransferJob(AbstractAccount *account, const QString &source, const QString &destination)
     : KJob()
     , m_account(account)
     , m_source(source)
     , m_destination(destination)
-    , m_temporaryFile(new QSaveFile(destination))
+    , m_file(partialFileName(destination))
 {
-    // Enable direct write on Android, because we don't have the permissions to write anywhere where we save
-#ifdef Q_OS_ANDROID
-    m_temporaryFile->setDirectWriteFallback(true);
-#endif
+    setCapabilities(KJob::Killable);
+
+    // Without a partial file, segments would leave gaps in the destination when it fails
+    if (directWrite) {
+        m_maxSegments = 1;
+    }
+}
+
+void FileTransferJob::setMaxSegments(const int count)
+{
+    m_maxSegments = directWrite ? 1 : std::max(count, 1);
+}
+
+void FileTransferJob::setMinimumSegmentSize(const qint64 bytes)
+{
+    m_minimumSegmentSize = std::max<qint64>(bytes, 1);
+}
+
+void FileTransferJob::setRetryDelay(const std::chrono::milliseconds delay)
+{
+    m_retryDelay = delay;
+}
+
+QString FileTransferJob::partialFileName(const QString &destination)
+{
+    return directWrite ? destination : destination + u".part"_s;
 }
 
 void FileTransferJob::start()
 {
-    if (auto account = qobject_cast<Account *>(m_account); account) {
-        auto qnam = account->qnam();
+    Q_EMIT description(this,
+                       i18nc("Job heading, like 'Copying'", "Downloading"),
+                       {i18nc("The URL being downloaded/uploaded", "Source"), m_source},
+                       {i18nc("The location being downloaded to", "Destination"), m_destination});
 
-        auto reply = qnam->get(QNetworkRequest(QUrl(m_source)));
+    const auto account = qobject_cast<Account *>(m_account);
+    if (!account) {
+        fail(NetworkError, i18n("This account can't download files"));
+        return;
+    }
+    m_qnam = account->qnam();
 
-        setTotalAmount(Unit::Files, 1);
-        if (!m_temporaryFile->open(QIODevice::WriteOnly)) {
-            qCWarning(TOKODON_HTTP) << "Couldn't open the temporary file" << m_temporaryFile->fileName() << "for writing" << m_temporaryFile->errorString();
-            setError(FileError);
-            setErrorText(i18n("Could not open the temporary download file"));
-            emitResult();
+    // A leftover marker means the previous download was never stopped properly, so the partial file may have gaps
+    const bool crashed = !directWrite && QFile::exists(m_file.fileName() + u".sparse"_s);
+    const bool sameSource = !directWrite && readSource();
+
+    // Chunks go straight to disk, without another copy in the file's own buffer
+    QIODevice::OpenMode mode = QIODevice::ReadWrite | QIODevice::Unbuffered;
+    if (directWrite || crashed || !sameSource) {
+        mode |= QIODevice::Truncate;
+        m_validator.clear();
+    }
+    if (!m_file.open(mode)) {
+        qCWarning(TOKODON_HTTP) << "Couldn't open the temporary file" << m_file.fileName() << "for writing" << m_file.errorString();
+        fail(FileError, i18n("Could not open the temporary download file"));
+        return;
+    }
+    setSparse(false);
+
+    if (m_file.size() > 0) {
+        qCDebug(TOKODON_HTTP) << "Resuming the download of" << m_source << "from" << m_file.size() << "bytes";
+    }
+
+    m_buffer.resize(bufferSize);
+    m_processed = m_file.size();
+    m_segments = {Segment{.position = m_file.size()}};
+    setTotalAmount(Unit::Files, 1);
+    setProcessedAmount(Unit::Bytes, m_processed);
+
+    request(0);
+}
+
+bool FileTransferJob::doKill()
+{
+    stop();
+    return true;
+}
+
+void FileTransferJob::request(const qsizetype index)
+{
+    Segment &segment = m_segments[index];
+    segment.accepted = false;
+
+    QNetworkRequest networkRequest((QUrl(m_source)));
+    // Large files would only push everything else out of the cache, and ranges of compressed bodies aren't what's on disk
+    networkRequest.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::AlwaysNetwork);
+    networkRequest.setAttribute(QNetworkRequest::CacheSaveControlAttribute, false);
+    networkRequest.setRawHeader("Accept-Encoding", "identity");
+    if (segment.position > 0 || segment.end != -1) {
+        const QByteArray last = segment.end != -1 ? QByteArray::number(segment.end - 1) : QByteArray();
+        networkRequest.setRawHeader("Range", "bytes=" + QByteArray::number(segment.position) + '-' + last);
+        if (!m_validator.isEmpty()) {
+            networkRequest.setRawHeader("If-Range", m_validator);
+        }
+    }
+
+    const auto reply = m_qnam->get(networkRequest);
+    segment.reply = reply;
+
+    connect(reply, &QNetworkReply::metaDataChanged, this, [this, index, reply] {
+        readMetaData(index, reply);
+    });
+    connect(reply, &QIODevice::readyRead, this, [this, index, reply] {
+        write(index, reply);
+    });
+    connect(reply, &QNetworkReply::finished, this, [this, index, reply] {
+        segmentFinished(index, reply);
+    });
+}
+
+void FileTransferJob::readMetaData(const qsizetype index, QNetworkReply *reply)
+{
+    const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (m_segments[index].accepted || (statusCode != 200 && statusCode != 206)) {
+        return;
+    }
+
+    qint64 total = -1;
+    bool acceptsRanges = false;
+    if (statusCode == 206) {
+        const ContentRange range = parseContentRange(reply->rawHeader("Content-Range"));
+        if (range.first != m_segments[index].position) {
+            fail(NetworkError, i18n("The server sent the wrong part of the file"));
             return;
         }
-        connect(reply, &QNetworkReply::downloadProgress, this, [this](qint64 bytesReceived, qint64 bytesTotal) {
-            if (bytesTotal != -1) {
-                setTotalAmount(Unit::Bytes, bytesTotal);
+        // Servers which don't understand If-Range would send the rest of another file
+        const QByteArray validator = validatorOf(reply);
+        if (!m_validator.isEmpty() && !validator.isEmpty() && validator != m_validator) {
+            if (m_segments.size() > 1 || !m_file.resize(0)) {
+                fail(NetworkError, i18n("The file changed on the server while downloading it"));
+                return;
             }
-            setProcessedAmount(Unit::Bytes, bytesReceived);
-        });
-
-        connect(reply, &QNetworkReply::finished, this, [this, reply]() {
-            if (reply->error() != QNetworkReply::NoError) {
-                setError(FileError);
-                setErrorText(reply->errorString());
-                emitResult();
+            qCDebug(TOKODON_HTTP) << "Starting the download of" << m_source << "over, since it changed on the server";
+            reply->disconnect(this);
+            reply->abort();
+            reply->deleteLater();
+            restart(index);
+            return;
+        }
+        total = range.total;
+        acceptsRanges = true;
+    } else {
+        // The server ignored the range, so all of it is coming again
+        if (m_segments[index].position > 0) {
+            if (m_segments.size() > 1) {
+                fail(NetworkError, i18n("The server stopped sending parts of the file"));
                 return;
             }
-            if (!m_temporaryFile->commit()) {
-                qCWarning(TOKODON_HTTP) << "errror when saving";
+            if (!m_file.resize(0)) {
+                fail(FileError, i18n("Could not write to the temporary download file"));
+                return;
             }
-            reply->deleteLater();
-            emitResult();
-        });
+            m_segments[index].position = 0;
+            m_processed = 0;
+            setProcessedAmount(Unit::Bytes, 0);
+        }
 
-        connect(reply, &QIODevice::readyRead, this, [this, reply] {
-            auto bytes = reply->read(reply->bytesAvailable());
-            if (!bytes.isEmpty()) {
-                m_temporaryFile->write(bytes);
-            } else {
-                qCWarning(TOKODON_HTTP) << "Unexpected empty chunk when downloading from" << reply->url() << "to" << m_temporaryFile->fileName();
-            }
-        });
+        // Whatever comes next is resumed from this version of the file only
+        m_validator = validatorOf(reply);
+        writeSource();
+
+        const auto sizeHeader = reply->header(QNetworkRequest::ContentLengthHeader);
+        if (sizeHeader.isValid()) {
+            total = sizeHeader.toLongLong();
+        }
+        acceptsRanges = reply->rawHeader("Accept-Ranges").trimmed() == "bytes";
+    }
+
+    if (m_total != -1 && total != -1 && total != m_total) {
+        fail(NetworkError, i18n("The file changed on the server while downloading it"));
+        return;
+    }
+    m_segments[index].accepted = true;
+
+    // Only the first answer decides on how the file is downloaded
+    if (total == -1 || m_total != -1 || m_segments.size() > 1) {
+        return;
+    }
+
+    m_total = total;
+    setTotalAmount(Unit::Bytes, total);
+    m_segments[index].end = total;
+
+    const qint64 start = m_segments[index].position;
+    const qint64 remaining = total - start;
+    const int count = acceptsRanges ? static_cast<int>(std::clamp<qint64>(remaining / m_minimumSegmentSize, 1, m_maxSegments)) : 1;
 
-        connect(reply, &QNetworkReply::metaDataChanged, this, [this, reply] {
-            auto sizeHeader = reply->header(QNetworkRequest::ContentLengthHeader);
-            if (sizeHeader.isValid()) {
-                auto targetSize = sizeHeader.toLongLong();
-                if (targetSize != -1) {
-                    if (!m_temporaryFile->resize(targetSize)) {
-                        qCWarning(TOKODON_HTTP) << "Failed to allocate" << targetSize << "bytes for" << m_temporaryFile->fileName();
-                        setError(FileError);
-                        setErrorText(i18n("Could not reserve disk space for download"));
-                        emitResult();
-                    }
-                }
+    if (m_file.size() < total || count > 1) {
+        setSparse(true);
+    }
+    if (m_file.size() < total && !m_file.resize(total)) {
+        qCWarning(TOKODON_HTTP) << "Failed to allocate" << total << "bytes for" << m_file.fileName();
+        fail(FileError, i18n("Could not reserve disk space for download"));
+        return;
+    }
+
+    if (count == 1) {
+        return;
+    }
+
+    // This reply carries on with the first segment, and is stopped once it's there
+    const qint64 segmentSize = remaining / count;
+    m_segments[index].end = start + segmentSize;
+    for (int i = 1; i < count; i++) {
+        const qint64 position = start + i * segmentSize;
+        m_segments.push_back(Segment{.position = position, .end = i == count - 1 ? total : position + segmentSize});
+    }
+    for (qsizetype i = 1; i < m_segments.size(); i++) {
+        request(i);
+    }
+}
+
+void FileTransferJob::write(const qsizetype index, QNetworkReply *reply)
+{
+    Segment &segment = m_segments[index];
+    if (!segment.accepted) {
+        return;
+    }
+
+    qint64 written = 0;
+    while (reply->bytesAvailable() > 0) {
+        qint64 wanted = std::min<qint64>(reply->bytesAvailable(), m_buffer.size());
+        if (segment.end != -1) {
+            wanted = std::min(wanted, segment.end - segment.position);
+        }
+        if (wanted <= 0) {
+            break;
+        }
+
+        const qint64 read = reply->read(m_buffer.data(), wanted);
+        if (read <= 0) {
+            break;
+        }
+        if (!m_file.seek(segment.position) || m_file.write(m_buffer.constData(), read) != read) {
+            qCWarning(TOKODON_HTTP) << "Couldn't write to" << m_file.fileName() << m_file.errorString();
+            fail(FileError, i18n("Could not write to the temporary download file"));
+            return;
+        }
+        segment.position += read;
+        written += read;
+    }
+
+    if (written > 0) {
+        segment.attempts = 0;
+        m_processed += written;
+        setProcessedAmount(Unit::Bytes, m_processed);
+    }
+
+    // A reply which started at the beginning keeps going past the first segment
+    if (segment.end != -1 && segment.position >= segment.end && reply->isRunning()) {
+        reply->abort();
+    }
+}
+
+void FileTransferJob::segmentFinished(const qsizetype index, QNetworkReply *reply)
+{
+    reply->deleteLater();
+    m_segments[index].reply = nullptr;
+    if (m_stopped) {
+        return;
+    }
+
+    if (!m_segments[index].accepted) {
+        readMetaData(index, reply);
+        // Either it failed, or the segment was asked for again
+        if (m_stopped || m_segments[index].reply) {
+            return;
+        }
+    }
+    write(index, reply);
+    if (m_stopped) {
+        return;
+    }
+
+    Segment &segment = m_segments[index];
+    const bool complete = segment.end != -1 ? segment.position >= segment.end : segment.accepted && reply->error() == QNetworkReply::NoError;
+    if (complete) {
+        segment.done = true;
+        if (std::ranges::all_of(m_segments, &Segment::done)) {
+            finishDownload();
+        }
+        return;
+    }
+
+    // The partial file is complete already, or of another file, so start over
+    const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (statusCode == 416 && m_segments.size() == 1 && segment.position > 0 && m_file.resize(0)) {
+        restart(index);
+        return;
+    }
+
+    // Either the connection dropped halfway, or it's worth asking again
+    if ((segment.accepted || isTransientFailure(reply)) && segment.attempts < maxAttempts) {
+        qCDebug(TOKODON_HTTP) << "Resuming" << m_source << "from" << segment.position << "after" << reply->error();
+        QTimer::singleShot(m_retryDelay * (1 << segment.attempts), this, [this, index] {
+            if (!m_stopped) {
+                request(index);
             }
         });
+        segment.attempts++;
+        return;
+    }
+
+    fail(NetworkError, reply->error() != QNetworkReply::NoError ? reply->errorString() : i18n("The download was interrupted"));
+}
+
+void FileTransferJob::finishDownload()
+{
+    m_stopped = true;
+    m_file.close();
+    setProcessedAmount(Unit::Files, 1);
+
+    if (!directWrite) {
+        QFile::remove(m_destination);
+        if (!QFile::rename(m_file.fileName(), m_destination)) {
+            qCWarning(TOKODON_HTTP) << "Couldn't move" << m_file.fileName() << "to" << m_destination;
+            setError(FileError);
+            setErrorText(i18n("Could not save the downloaded file"));
+        }
+        setSparse(false);
+        QFile::remove(sourceFileName());
+    }
+
+    emitResult();
+}
+
+void FileTransferJob::fail(const int error, const QString &errorText)
+{
+    stop();
+    setError(error);
+    setErrorText(errorText);
+    emitResult();
+}
+
+void FileTransferJob::stop()
+{
+    m_stopped = true;
+
+    for (auto &segment : m_segments) {
+        if (const auto reply = std::exchange(segment.reply, nullptr)) {
+            reply->disconnect(this);
+            reply->abort();
+            reply->deleteLater();
+        }
+    }
+
+    // Keep what's there for next time, but only up to the first gap
+    if (m_file.isOpen()) {
+        if (!directWrite && !m_file.resize(contiguousSize())) {
+            qCWarning(TOKODON_HTTP) << "Couldn't truncate" << m_file.fileName() << m_file.errorString();
+        } else {
+            setSparse(false);
+        }
+        m_file.close();
+    }
+}
+
+void FileTransferJob::setSparse(const bool sparse)
+{
+    if (directWrite) {
+        return;
+    }
+
+    QFile marker(m_file.fileName() + u".sparse"_s);
+    if (sparse) {
+        if (!marker.open(QIODevice::WriteOnly)) {
+            qCWarning(TOKODON_HTTP) << "Couldn't create" << marker.fileName() << marker.errorString();
+        }
+    } else if (marker.exists()) {
+        marker.remove();
+    }
+}
+
+void FileTransferJob::restart(const qsizetype index)
+{
+    Segment &segment = m_segments[index];
+    segment.position = 0;
+    segment.end = -1;
+    m_total = -1;
+    m_processed = 0;
+    m_validator.clear();
+    setProcessedAmount(Unit::Bytes, 0);
+    request(index);
+}
+
+QString FileTransferJob::sourceFileName() const
+{
+    return m_file.fileName() + u".source"_s;
+}
+
+bool FileTransferJob::readSource()
+{
+    // The URL on the first line, and the validator of the partial file on the second
+    QFile file(sourceFileName());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    const QList<QByteArray> lines = file.readAll().split('\n');
+    if (lines.size() < 2 || QString::fromUtf8(lines[0]) != m_source || lines[1].isEmpty()) {
+        return false;
+    }
+    m_validator = lines[1];
+    return true;
+}
+
+void FileTransferJob::writeSource()
+{
+    if (directWrite) {
+        return;
+    }
 
-        Q_EMIT description(this,
-                           i18nc("Job heading, like 'Copying'", "Downloading"),
-                           {i18nc("The URL being downloaded/uploaded", "Source"), m_source},
-                           {i18nc("The location being downloaded to", "Destination"), m_destination});
+    QFile file(sourceFileName());
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(TOKODON_HTTP) << "Couldn't create" << file.fileName() << file.errorString();
+        return;
+    }
+    file.write(m_source.toUtf8() + '\n' + m_validator + '\n');
+}
+
+qint64 FileTransferJob::contiguousSize() const
+{
+    qint64 size = 0;
+    for (const auto &segment : m_segments) {
+        size = segment.position;
+        if (!segment.done) {
+            break;
+        }
     }
+    return size;
 }
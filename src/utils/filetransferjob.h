@@ -4,10 +4,23 @@
 #pragma once
 
 #include <KJob>
-#include <QSaveFile>
+#include <QFile>
+#include <QList>
+
+#include <chrono>
 
 class AbstractAccount;
+class QNetworkAccessManager;
+class QNetworkReply;
 
+/**
+ * @brief Downloads a file to disk.
+ *
+ * The file is downloaded next to the destination first, and that partial file is kept if the download fails or is killed. Downloading the
+ * same URL to the same destination again continues where it left off, with a Range request. The ETag or Last-Modified date is kept next to
+ * the partial file and sent as If-Range, so a file which changed on the server in the meantime starts over instead. Connections which drop
+ * halfway are resumed a few times before giving up, and large files are downloaded in a few parallel segments if the server accepts ranges.
+ */
 class FileTransferJob final : public KJob
 {
 public:
@@ -16,11 +29,70 @@ public:
 
     enum ExtraError {
         FileError = UserDefinedError,
+        NetworkError,
     };
 
+    /**
+     * @brief Download at most @p count segments of the file at once.
+     */
+    void setMaxSegments(int count);
+
+    /**
+     * @brief Don't split the file into segments smaller than @p bytes.
+     */
+    void setMinimumSegmentSize(qint64 bytes);
+
+    /**
+     * @brief Wait @p delay before resuming a dropped connection, and twice as long each time after that.
+     */
+    void setRetryDelay(std::chrono::milliseconds delay);
+
+    /**
+     * @return Where the file for @p destination is downloaded to until it's complete.
+     */
+    [[nodiscard]] static QString partialFileName(const QString &destination);
+
+protected:
+    bool doKill() override;
+
 private:
+    struct Segment {
+        qint64 position = 0; ///< Of the next byte to write.
+        qint64 end = -1; ///< Exclusive, or -1 while the size of the file isn't known.
+        QNetworkReply *reply = nullptr;
+        bool accepted = false; ///< Whether the server answered with the right part of the file.
+        bool done = false;
+        int attempts = 0; ///< Since the last time it made progress.
+    };
+
+    void request(qsizetype index);
+    void readMetaData(qsizetype index, QNetworkReply *reply);
+    void write(qsizetype index, QNetworkReply *reply);
+    void segmentFinished(qsizetype index, QNetworkReply *reply);
+    void finishDownload();
+    void fail(int error, const QString &errorText);
+    void stop();
+    void restart(qsizetype index);
+    void setSparse(bool sparse);
+    [[nodiscard]] QString sourceFileName() const;
+    [[nodiscard]] bool readSource();
+    void writeSource();
+    [[nodiscard]] qint64 contiguousSize() const;
+
     AbstractAccount *const m_account;
+    QNetworkAccessManager *m_qnam = nullptr;
     QString m_source;
     QString m_destination;
-    QScopedPointer<QSaveFile> m_temporaryFile;
+    QFile m_file;
+    QByteArray m_validator; ///< The ETag or Last-Modified date of the file being downloaded.
+
+    QList<Segment> m_segments;
+    QByteArray m_buffer;
+    qint64 m_total = -1;
+    qint64 m_processed = 0;
+    bool m_stopped = false;
+
+    int m_maxSegments = 4;
+    qint64 m_minimumSegmentSize = 4 * 1024 * 1024;
+    std::chrono::milliseconds m_retryDelay = std::chrono::seconds(1);
 };
@@ -0,0 +1,291 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/imagecache.h"
+
+#include "network/networkaccessmanagerfactory.h"
+#include "utils/asyncimageresponse.h"
+
+#include <QBuffer>
+#include <QElapsedTimer>
+#include <QImageReader>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+
+#include <cmath>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+// Device pixels attachment sizes are rounded up to
+constexpr int attachmentSizeStep = 128;
+
+int roundUpToStep(const qreal value)
+{
+    return static_cast<int>(std::ceil(value / attachmentSizeStep)) * attachmentSizeStep;
+}
+}
+
+ImageCache &ImageCache::instance()
+{
+    static ImageCache _instance;
+    return _instance;
+}
+
+ImageCache::ImageCache(QObject *parent)
+    : QObject(parent)
+    , m_cache(64 * 1024 * 1024)
+    , m_nam(NetworkAccessManagerFactory().create(this))
+{
+}
+
+ImageCache::~ImageCache()
+{
+    m_pool.waitForDone();
+}
+
+QUrl ImageCache::source(const QUrl &url)
+{
+    if (url.isEmpty()) {
+        return {};
+    }
+    return QUrl(u"image://remote/"_s + QString::fromLatin1(QUrl::toPercentEncoding(url.toString())));
+}
+
+void ImageCache::request(const QUrl &url, const QSize &size, QObject *context, Callback callback)
+{
+    if (url.isEmpty()) {
+        QMetaObject::invokeMethod(
+            context,
+            [callback] {
+                callback({});
+            },
+            Qt::QueuedConnection);
+        return;
+    }
+
+    const QString key = ImageCache::key(url, size);
+
+    QMutexLocker locker(&m_mutex);
+
+    if (const auto image = m_cache.object(key)) {
+        m_statistics.hits++;
+        QMetaObject::invokeMethod(
+            context,
+            [callback, image = *image] {
+                callback(image);
+            },
+            Qt::QueuedConnection);
+        return;
+    }
+
+    auto pending = m_pending.value(key);
+    if (pending) {
+        m_statistics.joined++;
+    } else {
+        m_statistics.misses++;
+
+        // It may outlive the thread which asked first
+        pending = new PendingImage;
+        pending->moveToThread(thread());
+        m_pending.insert(key, pending);
+
+        // Other sizes of the same image share the download
+        auto &sizes = m_downloads[url];
+        sizes.push_back(size);
+        if (sizes.size() == 1) {
+            QMetaObject::invokeMethod(
+                this,
+                [this, url] {
+                    download(url);
+                },
+                Qt::QueuedConnection);
+        }
+    }
+
+    connect(pending, &PendingImage::done, context, std::move(callback));
+}
+
+QImage ImageCache::cached(const QUrl &url, const QSize &size) const
+{
+    QMutexLocker locker(&m_mutex);
+
+    const auto image = m_cache.object(key(url, size));
+    return image ? *image : QImage{};
+}
+
+void ImageCache::setByteBudget(const qsizetype bytes)
+{
+    QMutexLocker locker(&m_mutex);
+    m_cache.setMaxCost(bytes);
+}
+
+QVariantMap ImageCache::statistics() const
+{
+    QMutexLocker locker(&m_mutex);
+
+    return {
+        {u"hits"_s, m_statistics.hits},
+        {u"misses"_s, m_statistics.misses},
+        {u"joined"_s, m_statistics.joined},
+        {u"count"_s, m_cache.count()},
+        {u"bytes"_s, m_cache.totalCost()},
+        {u"byteBudget"_s, m_cache.maxCost()},
+        {u"downloads"_s, m_statistics.downloads},
+        {u"downloadedBytes"_s, m_statistics.downloadedBytes},
+        {u"failures"_s, m_statistics.failures},
+        {u"decodes"_s, m_statistics.decodes},
+        {u"averageDecodeTime"_s, m_statistics.decodes > 0 ? m_statistics.decodeTime / m_statistics.decodes : 0},
+        {u"maxDecodeTime"_s, m_statistics.maxDecodeTime},
+    };
+}
+
+void ImageCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+
+    m_cache.clear();
+    m_statistics = {};
+}
+
+QSize ImageCache::targetSize(const QSize &original, const QSize &requested)
+{
+    if (!original.isValid() || original.isEmpty()) {
+        return original;
+    }
+
+    const bool hasWidth = requested.width() > 0;
+    const bool hasHeight = requested.height() > 0;
+
+    QSize target;
+    if (hasWidth && hasHeight) {
+        target = original.scaled(requested, Qt::KeepAspectRatioByExpanding);
+    } else if (hasWidth) {
+        target = QSize(requested.width(), std::max(1, qRound(original.height() * requested.width() / static_cast<double>(original.width()))));
+    } else if (hasHeight) {
+        target = QSize(std::max(1, qRound(original.width() * requested.height() / static_cast<double>(original.height()))), requested.height());
+    } else {
+        return original;
+    }
+
+    // Upscaling is left to the scene graph
+    if (target.width() >= original.width() || target.height() >= original.height()) {
+        return original;
+    }
+    return target;
+}
+
+QSize ImageCache::attachmentSize(const QSizeF &gridSize, const int count, const int index, const qreal devicePixelRatio)
+{
+    if (gridSize.isEmpty() || count < 1) {
+        return {};
+    }
+
+    // The same layout as AttachmentGrid: two columns at most, and the first of three spans both rows
+    const int columns = std::min(count, 2);
+    const int rows = (count + 1) / 2;
+    const int rowSpan = index == 0 && count == 3 ? 2 : 1;
+
+    return {roundUpToStep(gridSize.width() / columns * devicePixelRatio), roundUpToStep(gridSize.height() / rows * rowSpan * devicePixelRatio)};
+}
+
+QImage ImageCache::decode(const QByteArray &data, const QSize &size)
+{
+    QBuffer buffer;
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+
+    QImageReader reader(&buffer);
+    reader.setAutoTransform(true);
+
+    // Most formats can decode straight to a smaller size, which is much cheaper than decoding everything and scaling afterwards
+    const QSize original = reader.size();
+    const QSize target = targetSize(original, size);
+    if (target != original) {
+        reader.setScaledSize(target);
+    }
+
+    const QImage image = reader.read();
+    if (image.isNull()) {
+        return {};
+    }
+    return image.convertToFormat(image.hasAlphaChannel() ? QImage::Format_ARGB32_Premultiplied : QImage::Format_RGB32);
+}
+
+QString ImageCache::key(const QUrl &url, const QSize &size)
+{
+    return u"%1@%2x%3"_s.arg(url.toString()).arg(size.width()).arg(size.height());
+}
+
+void ImageCache::download(const QUrl &url)
+{
+    QNetworkRequest request(url);
+    // Images don't change once uploaded, so anything on disk is good enough
+    request.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::PreferCache);
+
+    const auto reply = m_nam->get(request);
+    connect(reply, &QNetworkReply::finished, this, [this, reply, url] {
+        reply->deleteLater();
+
+        const QByteArray data = reply->error() == QNetworkReply::NoError ? reply->readAll() : QByteArray{};
+
+        QList<QSize> sizes;
+        {
+            QMutexLocker locker(&m_mutex);
+
+            sizes = m_downloads.take(url);
+            if (!reply->attribute(QNetworkRequest::SourceIsFromCacheAttribute).toBool()) {
+                m_statistics.downloads++;
+                m_statistics.downloadedBytes += data.size();
+            }
+            if (data.isEmpty()) {
+                m_statistics.failures++;
+            }
+        }
+
+        for (const auto &size : std::as_const(sizes)) {
+            const QString key = ImageCache::key(url, size);
+            if (data.isEmpty()) {
+                decoded(key, {}, 0);
+                continue;
+            }
+
+            m_pool.start([this, key, data, size] {
+                QElapsedTimer timer;
+                timer.start();
+
+                const QImage image = decode(data, size);
+                decoded(key, image, timer.nsecsElapsed());
+            });
+        }
+    });
+}
+
+void ImageCache::decoded(const QString &key, const QImage &image, const qint64 nsecs)
+{
+    PendingImage *pending = nullptr;
+    {
+        QMutexLocker locker(&m_mutex);
+
+        if (nsecs > 0) {
+            const qint64 usecs = nsecs / 1000;
+            m_statistics.decodes++;
+            m_statistics.decodeTime += usecs;
+            m_statistics.maxDecodeTime = std::max(m_statistics.maxDecodeTime, usecs);
+        }
+
+        // Failures aren't kept, they might work out the next time
+        if (!image.isNull()) {
+            m_cache.insert(key, new QImage(image), image.sizeInBytes());
+        }
+        pending = m_pending.take(key);
+    }
+
+    if (pending) {
+        Q_EMIT pending->done(image);
+        pending->deleteLater();
+    }
+}
+
+#include "moc_imagecache.cpp"
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QCache>
+#include <QHash>
+#include <QImage>
+#include <QMutex>
+#include <QObject>
+#include <QQmlEngine>
+#include <QThreadPool>
+#include <QUrl>
+
+#include <functional>
+
+class QNetworkAccessManager;
+class PendingImage;
+
+/**
+ * @brief Downloads and decodes remote images like avatars and attachment previews, and keeps them around.
+ *
+ * Images are decoded on a thread pool at the size they are shown at, instead of their full resolution. Decoded images are kept in memory up to a
+ * byte budget, dropping the least recently used ones first. Below that, the downloads go through the same HTTP disk cache as the rest of the
+ * application, so an image dropped from memory is decoded again without hitting the network.
+ *
+ * An image which is being downloaded or decoded is only downloaded and decoded once, however many times it's asked for in the meantime.
+ *
+ * QML uses it through RemoteImageProvider, see source().
+ */
+class ImageCache : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+
+public:
+    using Callback = std::function<void(const QImage &)>;
+
+    static ImageCache *create(QQmlEngine *, QJSEngine *)
+    {
+        auto inst = &instance();
+        QJSEngine::setObjectOwnership(inst, QJSEngine::ObjectOwnership::CppOwnership);
+        return inst;
+    }
+
+    static ImageCache &instance();
+
+    explicit ImageCache(QObject *parent = nullptr);
+    ~ImageCache() override;
+
+    /**
+     * @return The image:// url to show @p url through the cache in QML.
+     */
+    Q_INVOKABLE static QUrl source(const QUrl &url);
+
+    /**
+     * @brief Loads @p url, scaled down to cover @p size, and calls @p callback with it in the thread of @p context.
+     *
+     * The callback gets a null image if loading failed. It's never called right away, even if the image is in memory already. Can be called
+     * from any thread.
+     *
+     * @p size may be invalid, or only have a width or a height, to not scale in that direction.
+     */
+    void request(const QUrl &url, const QSize &size, QObject *context, Callback callback);
+
+    /**
+     * @return The image for @p url at @p size if it's in memory, or a null image.
+     */
+    [[nodiscard]] QImage cached(const QUrl &url, const QSize &size) const;
+
+    /**
+     * @brief Keep no more than @p bytes of decoded images in memory.
+     */
+    void setByteBudget(qsizetype bytes);
+
+    /**
+     * @return Hit and miss counts, memory use, and download and decode times in microseconds.
+     */
+    Q_INVOKABLE QVariantMap statistics() const;
+
+    /**
+     * @brief Drops every decoded image from memory, and resets the statistics.
+     */
+    Q_INVOKABLE void clear();
+
+    /**
+     * @return The size to decode an image of @p original size at to cover @p requested, never larger than the original.
+     */
+    [[nodiscard]] static QSize targetSize(const QSize &original, const QSize &requested);
+
+    /**
+     * @return The size in device pixels to decode attachment @p index out of @p count at, in an AttachmentGrid of @p gridSize.
+     *
+     * It's rounded up, so resizing the window doesn't decode every attachment again at each step. Invalid while the grid has no size.
+     */
+    Q_INVOKABLE static QSize attachmentSize(const QSizeF &gridSize, int count, int index, qreal devicePixelRatio);
+
+    /**
+     * @brief Decodes @p data to cover @p size, in a format Qt Quick uploads as is.
+     */
+    [[nodiscard]] static QImage decode(const QByteArray &data, const QSize &size);
+
+private:
+    struct Statistics {
+        qint64 hits = 0;
+        qint64 misses = 0;
+        qint64 joined = 0;
+        qint64 downloads = 0;
+        qint64 downloadedBytes = 0;
+        qint64 failures = 0;
+        qint64 decodes = 0;
+        qint64 decodeTime = 0;
+        qint64 maxDecodeTime = 0;
+    };
+
+    [[nodiscard]] static QString key(const QUrl &url, const QSize &size);
+    void download(const QUrl &url);
+    void decoded(const QString &key, const QImage &image, qint64 nsecs);
+
+    mutable QMutex m_mutex;
+    QCache<QString, QImage> m_cache;
+    QHash<QString, PendingImage *> m_pending;
+    QHash<QUrl, QList<QSize>> m_downloads; ///< The sizes each download is decoded at once done.
+    Statistics m_statistics;
+
+    QNetworkAccessManager *const m_nam;
+
+    QThreadPool m_pool;
+};
@@ -0,0 +1,18 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/remoteimageprovider.h"
+
+#include "utils/asyncimageresponse.h"
+#include "utils/imagecache.h"
+
+#include <KLocalizedString>
+
+QQuickImageResponse *RemoteImageProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
+{
+    const auto response = new AsyncImageResponse;
+    ImageCache::instance().request(QUrl(QUrl::fromPercentEncoding(id.toUtf8())), requestedSize, response, [response](const QImage &image) {
+        response->handleDone(image, image.isNull() ? i18n("Failed to load the image.") : QString());
+    });
+    return response;
+}
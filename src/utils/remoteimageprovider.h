@@ -0,0 +1,17 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QQuickAsyncImageProvider>
+
+/**
+ * @brief Serves remote images through ImageCache, with the "image://remote/" scheme.
+ *
+ * The id is the percent-encoded url of the image, see ImageCache::source().
+ */
+class RemoteImageProvider : public QQuickAsyncImageProvider
+{
+public:
+    QQuickImageResponse *requestImageResponse(const QString &id, const QSize &requestedSize) override;
+};
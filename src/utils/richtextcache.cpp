@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/richtextcache.h"
+
+#include "utils/texthandler.h"
+
+#include <algorithm>
+
+namespace
+{
+// About 8 MiB, or a few thousand posts
+constexpr qsizetype defaultMaxCost = 4 * 1024 * 1024;
+}
+
+RichTextCache &RichTextCache::instance()
+{
+    static RichTextCache _instance;
+    return _instance;
+}
+
+RichTextCache::RichTextCache(QObject *parent)
+    : QObject(parent)
+    , m_texts(defaultMaxCost)
+{
+    // Scrolling quickly through a timeline shouldn't take up every core
+    m_pool.setMaxThreadCount(2);
+}
+
+RichTextCache::~RichTextCache()
+{
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+std::optional<QString> RichTextCache::text(const QString &html, const QFont &font)
+{
+    if (font != m_font) {
+        reset(font);
+        // This is usually called from a model's data(), which can't have its rows change underneath it
+        QMetaObject::invokeMethod(this, &RichTextCache::fontChanged, Qt::QueuedConnection);
+    }
+
+    if (const auto text = m_texts.object(html)) {
+        return *text;
+    }
+
+    if (!m_pending.contains(html)) {
+        m_pending.insert(html);
+        m_pool.start([this, generation = m_generation, html, font] {
+            const QString text = TextHandler::fixBidirectionality(html, font);
+            QMetaObject::invokeMethod(
+                this,
+                [this, generation, html, text] {
+                    finished(generation, html, text);
+                },
+                Qt::QueuedConnection);
+        });
+    }
+
+    return std::nullopt;
+}
+
+void RichTextCache::setFont(const QFont &font)
+{
+    if (font == m_font) {
+        return;
+    }
+    reset(font);
+    Q_EMIT fontChanged();
+}
+
+void RichTextCache::setMaxCost(const qsizetype characters)
+{
+    m_texts.setMaxCost(characters);
+}
+
+void RichTextCache::finished(const int generation, const QString &html, const QString &text)
+{
+    if (generation != m_generation) {
+        return;
+    }
+
+    m_pending.remove(html);
+    // Anything costing more than the maximum wouldn't be kept at all, and asked for again right away
+    m_texts.insert(html, new QString(text), std::clamp<qsizetype>(text.size(), 1, m_texts.maxCost()));
+    Q_EMIT textReady(html);
+}
+
+void RichTextCache::reset(const QFont &font)
+{
+    m_font = font;
+    m_generation++;
+    m_texts.clear();
+    m_pending.clear();
+}
+
+#include "moc_richtextcache.cpp"
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QCache>
+#include <QFont>
+#include <QObject>
+#include <QSet>
+#include <QThreadPool>
+
+#include <optional>
+
+/**
+ * @brief Post content which went through TextHandler::fixBidirectionality(), so it's only done once per post.
+ *
+ * That builds a whole QTextDocument, which is too slow to do on the GUI thread whenever a post is shown. Instead it's done in the background,
+ * and the results for the most recently shown posts are kept around.
+ */
+class RichTextCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    static RichTextCache &instance();
+
+    explicit RichTextCache(QObject *parent = nullptr);
+    ~RichTextCache() override;
+
+    /**
+     * @return The processed @p html for @p font, or nothing if it isn't ready yet. It will be prepared in the background then, and textReady()
+     * is emitted once it's done.
+     */
+    std::optional<QString> text(const QString &html, const QFont &font);
+
+    /**
+     * @brief Throws away everything prepared for another font than @p font.
+     *
+     * text() does this as well when it's given another font, but then fontChanged() is only emitted later.
+     */
+    void setFont(const QFont &font);
+
+    /**
+     * @brief Sets how many characters of processed text are kept at most.
+     */
+    void setMaxCost(qsizetype characters);
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when the processed @p html is ready.
+     */
+    void textReady(const QString &html);
+
+    /**
+     * @brief Emitted when everything prepared so far was thrown away, since the font changed. Anything shown has to be asked for again.
+     */
+    void fontChanged();
+
+private:
+    void finished(int generation, const QString &html, const QString &text);
+    void reset(const QFont &font);
+
+    QCache<QString, QString> m_texts; ///< By the HTML they came from.
+    QSet<QString> m_pending;
+    QFont m_font;
+    int m_generation = 0; ///< Increased whenever the font changes, so the texts prepared for the last one are thrown away.
+    QThreadPool m_pool;
+};
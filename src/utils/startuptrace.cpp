@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/startuptrace.h"
+
+#include "account/abstractaccount.h"
+#include "tokodon_startup_debug.h"
+
+#include <QUrl>
+
+using namespace Qt::Literals::StringLiterals;
+
+static QString spanKey(const QString &scope, const QString &phase)
+{
+    return scope + '/'_L1 + phase;
+}
+
+StartupTrace::StartupTrace()
+{
+    m_timer.start();
+}
+
+StartupTrace &StartupTrace::instance()
+{
+    static StartupTrace _instance;
+    return _instance;
+}
+
+QString StartupTrace::scope(const AbstractAccount *account)
+{
+    // Not settingsGroupName(), the username may not be known yet
+    return QStringLiteral("%1@%2").arg(account->username(), QUrl::fromUserInput(account->instanceUri()).host());
+}
+
+void StartupTrace::begin(const QString &scope, const QString &phase)
+{
+    const QString key = spanKey(scope, phase);
+    if (m_finished || m_spanIndices.contains(key)) {
+        return;
+    }
+
+    m_spanIndices.insert(key, m_spans.size());
+    m_spans.push_back({scope, phase, m_timer.elapsed()});
+}
+
+void StartupTrace::end(const QString &scope, const QString &phase)
+{
+    const auto it = m_spanIndices.constFind(spanKey(scope, phase));
+    if (it == m_spanIndices.cend()) {
+        return;
+    }
+
+    auto &span = m_spans[*it];
+    if (span.end != -1) {
+        return;
+    }
+
+    span.end = m_timer.elapsed();
+    qCDebug(TOKODON_STARTUP) << scope << phase << "took" << span.end - span.start << "ms, finished at" << span.end << "ms";
+}
+
+void StartupTrace::mark(const QString &scope, const QString &phase)
+{
+    begin(scope, phase);
+    end(scope, phase);
+}
+
+void StartupTrace::finish()
+{
+    if (m_finished) {
+        return;
+    }
+
+    m_finished = true;
+    qCDebug(TOKODON_STARTUP).noquote() << "Startup finished after" << m_timer.elapsed() << "ms\n" << report();
+}
+
+QString StartupTrace::report() const
+{
+    QString report;
+    for (const auto &span : m_spans) {
+        const QString duration = span.end == -1 ? QStringLiteral("running") : QStringLiteral("%1 ms").arg(span.end - span.start);
+        report += QStringLiteral("%1 ms\t%2\t%3\t%4\n").arg(QString::number(span.start), span.scope, span.phase, duration);
+    }
+    return report;
+}
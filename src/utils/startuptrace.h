@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2026 Tokodon Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QString>
+
+class AbstractAccount;
+
+/**
+ * @brief Records how long each phase of startup takes, per account.
+ *
+ * Every phase is only recorded the first time it runs, so later reloads don't skew the numbers. Once all accounts are loaded, a summary is written
+ * to the org.kde.tokodon.startup logging category.
+ */
+class StartupTrace
+{
+public:
+    static StartupTrace &instance();
+
+    /**
+     * @return The scope to record phases of @p account under.
+     */
+    [[nodiscard]] static QString scope(const AbstractAccount *account);
+
+    /**
+     * @brief Marks the start of @p phase in @p scope.
+     */
+    void begin(const QString &scope, const QString &phase);
+
+    /**
+     * @brief Marks the end of @p phase in @p scope, which must have been started with begin().
+     */
+    void end(const QString &scope, const QString &phase);
+
+    /**
+     * @brief Records that @p phase in @p scope was reached, without a duration.
+     */
+    void mark(const QString &scope, const QString &phase);
+
+    /**
+     * @brief Stops recording new phases and logs the summary. Phases which are still running will still be recorded once they end.
+     */
+    void finish();
+
+    /**
+     * @return A human-readable table of every recorded phase, ordered by when it started.
+     */
+    [[nodiscard]] QString report() const;
+
+private:
+    StartupTrace();
+
+    struct Span {
+        QString scope;
+        QString phase;
+        qint64 start = 0;
+        qint64 end = -1;
+    };
+
+    QElapsedTimer m_timer;
+    QList<Span> m_spans;
+    QHash<QString, qsizetype> m_spanIndices;
+    bool m_finished = false;
+};
@@ -10,6 +10,8 @@
 #include <QTextCursor>
 #include <QTextDocument>
 
+#include <optional>
+
 using namespace Qt::StringLiterals;
 
 static const auto fsi = QStringLiteral("\u2068");
@@ -119,12 +121,54 @@ QPair<QString, QList<QString>> TextHandler::removeStandaloneTags(QString content
 
 QString TextHandler::replaceCustomEmojis(const QList<CustomEmoji> &emojis, const QString &source)
 {
-    QString processed = source;
+    CustomEmojiUrls urls;
+    urls.reserve(emojis.size());
     for (const auto &emoji : emojis) {
-        processed.replace(QStringLiteral(":%1:").arg(emoji.shortcode),
-                          QStringLiteral("<img height=\"16\" align=\"middle\" width=\"16\" src=\"%1\">").arg(emoji.url));
+        urls.insert(emoji.shortcode, emoji.url);
+    }
+
+    return replaceCustomEmojis(urls, source);
+}
+
+QString TextHandler::replaceCustomEmojis(const CustomEmojiUrls &emojis, const QString &source)
+{
+    if (emojis.isEmpty()) {
+        return source;
+    }
+
+    QString processed;
+    qsizetype copied = 0;
+    qsizetype start = source.indexOf(u':');
+    while (start != -1) {
+        const qsizetype end = source.indexOf(u':', start + 1);
+        if (end == -1) {
+            break;
+        }
+
+        // Only looking it up, so there's no need to copy it
+        const auto it = emojis.constFind(QString::fromRawData(source.constData() + start + 1, end - start - 1));
+        if (it == emojis.constEnd()) {
+            // The closing colon may be the opening one of an emoji instead
+            start = end;
+            continue;
+        }
+
+        if (processed.isEmpty()) {
+            processed.reserve(source.size() + 64);
+        }
+        processed.append(QStringView(source).sliced(copied, start - copied));
+        processed.append("<img height=\"16\" align=\"middle\" width=\"16\" src=\""_L1);
+        processed.append(*it);
+        processed.append("\">"_L1);
+
+        copied = end + 1;
+        start = source.indexOf(u':', copied);
     }
 
+    if (copied == 0) {
+        return source;
+    }
+    processed.append(QStringView(source).sliced(copied));
     return processed;
 }
 
@@ -215,11 +259,124 @@ std::optional<QUrl> TextHandler::getPrevLink(const QString &linkText)
     return std::nullopt;
 }
 
+namespace
+{
+// Tags which start a new line, everything else is only markup around text
+bool isBlockTag(const QStringView name)
+{
+    for (const auto tag : {"p"_L1, "div"_L1, "li"_L1, "blockquote"_L1}) {
+        if (name.compare(tag, Qt::CaseInsensitive) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Decodes the entity at the start of text, which is as long as length then
+std::optional<char32_t> decodeEntity(const QStringView text, qsizetype &length)
+{
+    // The longest which is understood is &#x10FFFF;
+    const qsizetype end = text.left(10).indexOf(u';');
+    if (end < 2) {
+        return std::nullopt;
+    }
+    length = end + 1;
+
+    const QStringView name = text.sliced(1, end - 1);
+    if (name.startsWith(u'#')) {
+        bool ok = false;
+        const uint codepoint = name.startsWith("#x"_L1, Qt::CaseInsensitive) ? name.sliced(2).toUInt(&ok, 16) : name.sliced(1).toUInt(&ok);
+        if (!ok || codepoint == 0 || codepoint > QChar::LastValidCodePoint) {
+            return std::nullopt;
+        }
+        return codepoint;
+    }
+
+    // Servers only escape what they have to, everything else is sent as it is
+    static constexpr std::pair<QLatin1StringView, char32_t> named[] = {
+        {"amp"_L1, U'&'},
+        {"lt"_L1, U'<'},
+        {"gt"_L1, U'>'},
+        {"quot"_L1, U'"'},
+        {"apos"_L1, U'\''},
+        {"nbsp"_L1, U' '},
+    };
+    for (const auto &[entity, character] : named) {
+        if (name == entity) {
+            return character;
+        }
+    }
+    return std::nullopt;
+}
+}
+
 QString TextHandler::stripHtml(const QString &html)
 {
-    QTextDocument doc;
-    doc.setHtml(html);
-    return doc.toPlainText();
+    QString text;
+    text.reserve(html.size());
+
+    // Runs of whitespace are shown as a single space, and not at all at the start or end of a line
+    bool pendingSpace = false;
+    const auto append = [&text, &pendingSpace](const auto &part) {
+        if (pendingSpace) {
+            text.append(u' ');
+            pendingSpace = false;
+        }
+        text.append(part);
+    };
+    const auto newLine = [&text, &pendingSpace](const bool always) {
+        pendingSpace = false;
+        if (always || (!text.isEmpty() && !text.endsWith(u'\n'))) {
+            text.append(u'\n');
+        }
+    };
+
+    const QStringView source = html;
+    qsizetype i = 0;
+    while (i < source.size()) {
+        const QChar c = source[i];
+
+        if (c == u'<') {
+            const qsizetype end = source.indexOf(u'>', i);
+            if (end != -1) {
+                const QStringView tag = source.sliced(i + 1, end - i - 1);
+                qsizetype nameStart = tag.startsWith(u'/') ? 1 : 0;
+                qsizetype nameEnd = nameStart;
+                while (nameEnd < tag.size() && tag[nameEnd].isLetterOrNumber()) {
+                    nameEnd++;
+                }
+                const QStringView name = tag.sliced(nameStart, nameEnd - nameStart);
+
+                if (name.compare("br"_L1, Qt::CaseInsensitive) == 0) {
+                    newLine(true);
+                } else if (isBlockTag(name)) {
+                    newLine(false);
+                }
+
+                i = end + 1;
+                continue;
+            }
+        } else if (c == u'&') {
+            qsizetype length = 0;
+            if (const auto decoded = decodeEntity(source.sliced(i), length)) {
+                append(QStringView(QChar::fromUcs4(*decoded)));
+                i += length;
+                continue;
+            }
+        } else if (c.isSpace()) {
+            pendingSpace = !text.isEmpty() && !text.endsWith(u'\n');
+            i++;
+            continue;
+        }
+
+        append(c);
+        i++;
+    }
+
+    while (text.endsWith(u'\n')) {
+        text.chop(1);
+    }
+    return text;
 }
 
 #include "moc_texthandler.cpp"
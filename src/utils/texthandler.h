@@ -48,6 +48,17 @@ public:
      */
     static QString replaceCustomEmojis(const QList<CustomEmoji> &emojis, const QString &source);
 
+    /**
+     * @brief Replaces parts of a plaintext string that contain an existing custom emoji.
+     *
+     * This goes over the text once, no matter how many emojis there are.
+     *
+     * @param emojis The URLs of the custom emojis by shortcode, given from CustomEmoji::parseCustomEmojiUrls()
+     * @param source The plaintext source to use.
+     * @return HTML to be used as rich text.
+     */
+    static QString replaceCustomEmojis(const CustomEmojiUrls &emojis, const QString &source);
+
     /**
      * @brief Determines whether or not a URL could possibly be a post.
      * @note This isn't supposed to be perfect, but catch the 99% case.
@@ -79,6 +90,9 @@ public:
     /**
      * @brief Removes non-human readable HTML, suitable for screen readers.
      *
+     * This only understands the HTML servers send for posts and profiles: paragraphs and line breaks become new lines, other tags are
+     * dropped and entities are decoded. It goes over the text once, without building a document.
+     *
      * @param html The HTML text to process.
      * @return The processed HTML.
      */
@@ -28,21 +28,14 @@ for (shortcode, props) in gemojione_json.items():
 
 response = requests.get('https://unicode.org/Public/emoji/14.0/emoji-test.txt')
 group = ""
-file = open("../src/utils/emojis.h", "w")
+# Turned into constant tables by cmake/GenerateEmojiTables.cmake when building
+file = open("../src/utils/emojis.txt", "w")
 # REUSE-IgnoreStart
-file.write("// SPDX-FileCopyrightText: None\n")
-file.write("// SPDX-License-Identifier: LGPL-2.0-or-later\n")
+file.write("# SPDX-FileCopyrightText: None\n")
+file.write("# SPDX-License-Identifier: LGPL-2.0-or-later\n")
 # REUSE-IgnoreEnd
-file.write("// This file is auto-generated. All changes will be lost. See tools/update-emojis.py\n")
-file.write("// clang-format off\n")
-
-tones_file = open("../src/utils/emojitones_data.h", "w")
-# REUSE-IgnoreStart
-tones_file.write("// SPDX-FileCopyrightText: None\n")
-tones_file.write("// SPDX-License-Identifier: LGPL-2.0-or-later\n")
-# REUSE-IgnoreEnd
-tones_file.write("// This file is auto-generated. All changes will be lost. See tools/update-emojis.py\n")
-tones_file.write("// clang-format off\n")
+file.write("# This file is auto-generated. All changes will be lost. See tools/update-emojis.py\n")
+file.write("# Category, code points, short name and description, separated by tabs. Skin tone variants are in the Tone category.\n")
 
 for line in response.text.split("\n"):
     if line.startswith("# group"):
@@ -91,12 +84,6 @@ for line in response.text.split("\n"):
         if escaped_sequence in emoji_unicode_shortname_map:
             shortcode = emoji_unicode_shortname_map[escaped_sequence]
 
-        emoji_args = 'QString::fromUtf8("{0}"), QStringLiteral("{1}"), QStringLiteral("{2}")'.format(escaped_sequence, shortcode, description)
-        emoji_qvariant = 'QVariant::fromValue(Emoji{' + emoji_args + '})'
-
-        if is_skin_tone:
-            tones_file.write("{\"" + description.split(":")[0] + "\", " + emoji_qvariant + "},\n")
-            continue
-        file.write("_emojis[" + group + "].append(" + emoji_qvariant + ");\n")
+        category = "Tone" if is_skin_tone else group
+        file.write("\t".join([category, first, shortcode, description]) + "\n")
 file.close()
-tones_file.close()